@@ -10,8 +10,10 @@ out vec2 texuv;
 out float screenspace;
 flat out int paletteid;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 void main() {
     gl_Position = projection * view * vec4(vaPos, 1.0);
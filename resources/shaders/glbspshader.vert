@@ -13,8 +13,10 @@ out vec3 vsNorm;
 flat out int vsAttrib;
 flat out int vsSector;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 
 void main() {
@@ -12,8 +12,10 @@ out vec2 texuv;
 //flat out int vsAttrib;
 out vec4 viewspace;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 uniform float decalbias;
 
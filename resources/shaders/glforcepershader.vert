@@ -7,8 +7,10 @@ out vec4 colour;
 out vec4 texuv;
 out float screenspace;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 void main() {
     // vaPos.w - 0.000001 is needed for 6700XT under linux or sky will flicker
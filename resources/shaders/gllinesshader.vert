@@ -3,8 +3,10 @@ layout (location = 1) in vec4 vaCol;
 
 out vec4 colour;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 void main() {
     vec4 adjpos = view * vec4(vaPos, 1.0);
@@ -11,8 +11,10 @@ out vec3 vsPos;
 out vec3 vsNorm;
 out vec4 viewspace;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 void main() {
     viewspace = view * vec4(vaPos, 1.0);
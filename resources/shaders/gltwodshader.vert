@@ -9,8 +9,10 @@ out vec4 colour;
 out vec2 texuv;
 flat out int paletteid;
 
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform CameraUniforms {
+    mat4 projection;
+    mat4 view;
+};
 
 void main() {
     gl_Position = projection * view * vec4(vaPos, 1.0);
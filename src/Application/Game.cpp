@@ -77,6 +77,7 @@
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Logger/Logger.h"
 #include "Library/Fsm/Fsm.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/String/Format.h"
 #include "Utility/ScopeGuard.h"
@@ -275,6 +276,7 @@ bool IsWindowSwitchable() {
 }
 
 void Game::processQueuedMessages() {
+    MM_PROFILE_ZONE("Game::processQueuedMessages");
     GUIWindow *pWindow2;        // ecx@248
     int v37;                    // eax@341
     ODMFace *pODMFace;          // ecx@412
@@ -1632,6 +1634,8 @@ void Game::gameLoop() {
 
         bool game_finished = false;
         do {
+            Profiler::markFrame();
+
             MessageLoopWithWait();
 
             engine->particle_engine->UpdateParticles();
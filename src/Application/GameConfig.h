@@ -83,6 +83,26 @@ class GameConfig : public Config {
 
         Bool NoMargaret = {this, "no_margareth", false, "Disable Margaret's tour messages on Emerald Island."};
 
+        Bool TableCache = {this, "table_cache", false,
+                           "Cache compiled text tables from events.lod in the 'cache' folder, so that later startups "
+                           "don't have to parse them."};
+
+        Bool LevelMeshCache = {this, "level_mesh_cache", false,
+                               "Cache decoded level textures in the 'cache' folder, so that later loads of the same map "
+                               "don't have to decode them."};
+
+        Bool Profiler = {this, "profiler", false,
+                         "Record profiler zones, show them in the profiler overlay, and write them out to "
+                         "'profiler_trace.json' on exit in Chrome trace format."};
+
+        Bool AllocationTracker = {this, "allocation_tracker", false,
+                                  "Count allocations per frame and per profiler zone, and show them in the profiler "
+                                  "overlay."};
+
+        Int AllocationBudget = {this, "allocation_budget", 0,
+                                "Per-frame allocation budget, frames that go over it are highlighted in the profiler "
+                                "overlay. 0 means no budget."};
+
         ConfigEntry<::LogLevel> LogLevel = {this, "log_level", LOG_ERROR,
                                             "Default log level. One of 'trace', 'debug', 'info', 'warning', 'error' and 'critical'."};
 
@@ -92,13 +112,18 @@ class GameConfig : public Config {
                                 "Number of milliseconds per frame when recording game traces."};
 
         ConfigEntry<RandomEngineType> TraceRandomEngine = {this, "trace_random_engine", RANDOM_ENGINE_MERSENNE_TWISTER,
-                                                           "Random engine to use for trace recording, 'sequential' or 'mersenne_twister'."};
+                                                           "Random engine to use for trace recording, 'sequential', 'mersenne_twister' or 'philox'."};
 
         Bool TraceNoVideo = {this, "trace_no_video", true, "Don't play movies when recording traces."};
 
         Bool TraceNoPartyActorCollisions = {this, "trace_no_party_actor_collisions", false,
                                             "Disable collisions between the party and monsters on the map when recording traces."};
 
+        Bool TraceStateHashes = {this, "trace_state_hashes", false,
+                                 "Record per-frame hashes of the game state when recording traces, so that a desync can be "
+                                 "pinpointed to a frame on playback. This snapshots the whole world every frame, so it's "
+                                 "off by default."};
+
         Bool FullMonsterID = { this, "full_monster_id", false, "Full monster info on popup." };
 
      private:
@@ -382,6 +407,10 @@ class GameConfig : public Config {
 
         Int MaxVisibleSectors = {this, "maxvisiblesectors", 10, &ValidateMaxSectors, "Max number of BSP sectors to display."};
 
+        Int RenderListThreads = {this, "render_list_threads", 0, &ValidateRenderListThreads,
+                                 "Number of threads used to build the sprite & decoration render lists, including the "
+                                 "main thread. Use 0 to pick automatically, 1 to build them on the main thread only."};
+
         Bool SeasonsChange = {this, "seasons_change", true,
                               "Allow changing trees/ground depending on current season (originally was only used in MM6)."};
 
@@ -424,6 +453,9 @@ class GameConfig : public Config {
         static int ValidateMaxSectors(int sectors) {
             return std::clamp(sectors, 1, 150);
         }
+        static int ValidateRenderListThreads(int threads) {
+            return std::clamp(threads, 0, 32);
+        }
         static int ValidateTorchlight(int distance) {
             if (distance < 0)
                 return 0;
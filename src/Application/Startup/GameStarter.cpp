@@ -16,6 +16,7 @@
 #include "Engine/EngineGlobals.h"
 #include "Engine/EngineIocContainer.h"
 #include "Engine/EngineFileSystem.h"
+#include "Engine/Graphics/LevelMeshBuilder.h"
 #include "Engine/Graphics/Renderer/RendererFactory.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Components/Trace/EngineTracePlayer.h"
@@ -28,7 +29,10 @@
 #include "Engine/Components/Deterministic/EngineDeterministicComponent.h"
 #include "Engine/Components/Random/EngineRandomComponent.h"
 
+#include "Media/Audio/AudioPlayer.h"
+
 #include "GUI/Overlay/OverlaySystem.h"
+#include "GUI/Overlay/ProfilerOverlay.h"
 
 #include "Library/Environment/Interface/Environment.h"
 #include "Library/Platform/Application/PlatformApplication.h"
@@ -39,6 +43,8 @@
 #include "Library/Platform/Interface/Platform.h"
 #include "Library/Platform/Null/NullPlatform.h"
 #include "Library/FileSystem/Memory/MemoryFileSystem.h"
+#include "Library/Profiler/Profiler.h"
+#include "Library/Serialization/Serialization.h"
 
 #include "Scripting/AudioBindings.h"
 #include "Scripting/ConfigBindings.h"
@@ -51,7 +57,9 @@
 #include "Scripting/RendererBindings.h"
 #include "Scripting/ScriptingSystem.h"
 
+#include "Utility/Memory/AllocationTracker.h"
 #include "Utility/Exception.h"
+#include "Utility/Streams/StringOutputStream.h"
 
 #include "PathResolver.h"
 
@@ -159,7 +167,8 @@ void GameStarter::initializeWithLogger() {
     // and then trace component stores the updated value in a recorded `PaintEvent`.
     _application->installComponent(std::make_unique<GameKeyboardController>()); // This one should go before the window handler.
     _application->installComponent(std::make_unique<GameWindowHandler>());
-    _application->installComponent(std::make_unique<EngineControlComponent>());
+    _application->installComponent(std::make_unique<EngineControlComponent>(
+        _options.controlBackend.value_or(EngineControlComponent::defaultBackend())));
     _application->installComponent(std::make_unique<EngineTraceSimpleRecorder>());
     _application->installComponent(std::make_unique<EngineTraceSimplePlayer>());
     _application->installComponent(std::make_unique<EngineDeterministicComponent>());
@@ -181,6 +190,11 @@ void GameStarter::initializeWithLogger() {
 
     // Init overlays.
     _overlaySystem = std::make_unique<OverlaySystem>(*_renderer, *_application);
+    _overlaySystem->addOverlay("profiler", std::make_unique<ProfilerOverlay>());
+
+    // Init profiler.
+    Profiler::setEnabled(_config->debug.Profiler.value());
+    AllocationTracker::setEnabled(_config->debug.AllocationTracker.value());
 
     // Init io.
     ::keyboardActionMapping = std::make_shared<Io::KeyboardActionMapping>(_config);;
@@ -211,7 +225,15 @@ void GameStarter::initializeWithLogger() {
 }
 
 GameStarter::~GameStarter() {
-    _application->removeComponent<EngineControlComponent>(); // Join the control thread first.
+    _application->removeComponent<EngineControlComponent>(); // Terminate the control routine first.
+
+    if (_config->debug.Profiler.value()) {
+        std::string trace;
+        StringOutputStream stream(&trace);
+        Profiler::writeChromeTrace(&stream);
+        stream.close();
+        ufs->write("profiler_trace.json", Blob::fromString(std::move(trace)));
+    }
 
     ::engine = nullptr;
     ::render = nullptr;
@@ -330,3 +352,23 @@ void GameStarter::runInstrumented(std::function<void(EngineController *)> contro
 
     run();
 }
+
+void GameStarter::prepareForFork() {
+    if (!_options.headless)
+        throw Exception("Forking is only supported in headless mode");
+
+    EngineControlBackend backend = _application->component<EngineControlComponent>()->backend();
+    if (backend != CONTROL_BACKEND_COROUTINE)
+        throw Exception("Forking is not supported with the '{}' control backend", toString(backend));
+
+    // Both are restarted on demand, so there is nothing to do for them in resumeAfterFork.
+    if (LevelMeshBuilder *builder = _renderer->levelMeshBuilder())
+        builder->finish();
+    _renderer->releaseRenderListPool();
+
+    pAudioPlayer->suspendDevice();
+}
+
+void GameStarter::resumeAfterFork() {
+    pAudioPlayer->resumeDevice();
+}
@@ -40,6 +40,17 @@ class GameStarter {
 
     void runInstrumented(std::function<void(EngineController *)> controlRoutine);
 
+    /**
+     * Stops all helper threads so that the process can be `fork`-ed from inside a control routine, see `ForkServer`:
+     * waits for the level mesh builder, joins the render list worker pool, and pauses audio. Call `resumeAfterFork`
+     * afterwards, both in the forked processes and in the parent.
+     *
+     * @throws Exception                If not running headless, or if the control routine has its own thread, as then
+     *                                  the game thread won't survive the `fork`.
+     */
+    void prepareForFork();
+    void resumeAfterFork();
+
  private:
     void initializeWithLogger();
 
@@ -3,6 +3,8 @@
 #include <string>
 #include <optional>
 
+#include "Engine/Components/Control/EngineControlEnums.h"
+
 #include "Library/Logger/LogEnums.h"
 
 struct GameStarterOptions {
@@ -13,4 +15,5 @@ struct GameStarterOptions {
                                 // from/to disk. This also means that default config will be used.
     bool headless = false; // Run in headless mode.
     bool tracingRng = false; // Use tracing random engine?
+    std::optional<EngineControlBackend> controlBackend; // Override control backend, default is the thread one.
 };
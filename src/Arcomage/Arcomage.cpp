@@ -1,6 +1,8 @@
 #include "Arcomage.h"
 
+#include <cassert>
 #include <string>
+#include <utility>
 
 #include "Engine/EngineGlobals.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
@@ -19,19 +21,15 @@
 #include "Media/MediaPlayer.h"
 
 
-#include "Utility/IndexedArray.h"
+#include "Arcomage/Core/ArcomageAi.h"
 
-void SetStartConditions();
 void SetStartGameData();
 void FillPlayerDeck();
 void InitalHandsFill();
 void GetNextCardFromDeck(int player_num);
-int GetEmptyCardSlotIndex(int player_num);
 void IncreaseResourcesInTurn(int player_num);
 void TurnChange();
 bool IsGameOver();
-int CalculateCardPower(ArcomagePlayer *player, ArcomagePlayer *enemy,
-                       ArcomageCard *pCard, int mastery);
 char PlayerTurn(int player_num);
 void DrawGameUI(int animation_stage);
 void DrawSparks();
@@ -52,102 +50,36 @@ bool PlayCard(int player_num, int card_slot_num);
 bool CanCardBePlayed(int player_num, int hand_card_indx);
 void ApplyCardToPlayer(int player_num, int uCardID);
 int new_explosion_effect(Pointi *startXY, int effect_value);
-int ApplyDamageToBuildings(int player_num, int damage);
 void GameResultsApply();
 
 void am_DrawText(std::string_view str, Pointi *pXY);
 void DrawRect(Recti *pRect, Color uColor, char bSolidFill);
 
-struct ArcomageStartConditions {
-    int16_t max_tower;
-    int16_t max_resources;
-    int16_t tower_height;
-    int16_t wall_height;
-    int16_t quarry_level;
-    int16_t magic_level;
-    int16_t zoo_level;
-    int16_t bricks_amount;
-    int16_t gems_amount;
-    int16_t beasts_amount;
-    int mastery_lvl;
-};
-
-IndexedArray<ArcomageStartConditions, HOUSE_FIRST_ARCOMAGE_TAVERN, HOUSE_LAST_ARCOMAGE_TAVERN> start_conditions = {
-    {HOUSE_TAVERN_HARMONDALE,       {30, 100, 15, 5, 2, 2, 2, 10, 10, 10, 0}},
-    {HOUSE_TAVERN_ERATHIA,          {50, 150, 20, 5, 2, 2, 2, 5, 5, 5, 1}},
-    {HOUSE_TAVERN_TULAREAN_FOREST,  {50, 150, 20, 5, 2, 2, 2, 5, 5, 5, 2}},
-    {HOUSE_TAVERN_DEYJA,            {75, 200, 25, 10, 3, 3, 3, 5, 5, 5, 2}},
-    {HOUSE_TAVERN_BRACADA_DESERT,   {75, 200, 20, 10, 3, 3, 3, 5, 5, 5, 1}},
-    {HOUSE_TAVERN_CELESTE,          {100, 300, 30, 15, 4, 4, 4, 10, 10, 10, 1}},
-    {HOUSE_TAVERN_PIT,              {100, 300, 30, 15, 4, 4, 4, 10, 10, 10, 2}},
-    {HOUSE_TAVERN_EVENMORN_ISLAND,  {150, 400, 20, 10, 5, 5, 5, 25, 25, 25, 0}},
-    {HOUSE_TAVERN_MOUNT_NIGHON,     {200, 500, 20, 10, 1, 1, 1, 15, 15, 15, 2}},
-    {HOUSE_TAVERN_BARROW_DOWNS,     {100, 300, 20, 50, 1, 1, 5, 5, 5, 25, 0}},
-    {HOUSE_TAVERN_TATALIA,          {125, 350, 10, 20, 3, 1, 2, 15, 5, 10, 2}},
-    {HOUSE_TAVERN_AVLEE,            {125, 350, 10, 20, 3, 1, 2, 15, 5, 10, 1}},
-    {HOUSE_TAVERN_STONE_CITY,       {100, 300, 50, 50, 5, 3, 5, 20, 10, 20, 0}}
-};
-
 constexpr auto SIG_MEMALOC = 0x67707274;  // memory allocated;
 constexpr auto SIG_MEMFREE = 0x78787878;  // memory free;
 
 ArcomageGame *pArcomageGame = new ArcomageGame;
 
-ArcomagePlayer am_Players[2];
+ArcomageState am_State;
+ArcomagePlayerUi am_PlayersUi[2];
 AcromageCardOnTable shown_cards[10];
 am_effects_struct am_effects_array[10];
 
-ArcomageDeck playDeck;
-ArcomageDeck deckMaster;
-
 char Player2Name[] = "Enemy";
 char Player1Name[] = "Player";
 
-struct am_ai_cardpowerstruct {
-    int slot_index;
-    int card_power;
-};
-
-am_ai_cardpowerstruct cards_power[10];
-
 bool Player_Gets_First_Turn = true;  // who starts the game
 bool Player_Cards_Shift = true;  // shifts the cards round at the bottom of the screen so they arent all level
 char use_start_bonus = 1;
 
-int start_tower_height;
-int start_wall_height;
-int start_quarry_level;
-int start_magic_level;
-int start_zoo_level;
-
-int start_bricks_amount;
-int start_gems_amount;
-int start_beasts_amount;
-
-int minimum_cards_at_hand = 5;
-int quarry_bonus = 1;  // acts as effective min level
-int magic_bonus = 1;
-int zoo_bonus = 1;
-
-int max_tower_height = 50;
-int max_resources_amount = 100;
-
-int opponent_mastery = 1;
+ArcomageStrategy opponent_strategy = ARCOMAGE_STRATEGY_BUILDER;
 char opponents_turn;
 char See_Opponents_Cards = 0;
-int current_player_num;
-
-char need_to_discard_card;
-
 int current_card_slot_index;
 int played_card_id;
 int discarded_card_id;
 
-int deck_walk_index;
-
 int Card_Hover_Index;
-int num_cards_to_discard;
-int num_actions_left;
 
 Pointi anim_card_spd_drawncard;  // anim card speed draw from deck
 Pointi anim_card_pos_drawncard;  // anim card pos draw from deck
@@ -567,312 +499,16 @@ bool ArcomageGame::LoadSprites() {
     return true;
 }
 
-int CalculateCardPower(ArcomagePlayer *player, ArcomagePlayer *enemy,
-                       ArcomageCard *pCard, int mastery) {
-    enum class V_IND {
-        P_TOWER_M10,
-        P_WALL_M10,
-        E_TOWER,
-        E_WALL,
-        E_BUILDINGS,
-        E_QUARRY,
-        E_MAGIC,
-        E_ZOO,
-        E_RES
-    };
-    using enum V_IND;
-
-    // mastery coeffs
-    // base mastery focus on growing walls + tower
-    // second level high priority on resource gen
-    static constexpr IndexedArray<std::array<int, 2>, P_TOWER_M10, E_RES> mastery_coeff = {
-        {P_TOWER_M10,   {{10, 5}}},
-        {P_WALL_M10,    {{2, 1}}},
-        {E_TOWER,       {{1, 10}}},
-        {E_WALL,        {{1, 3}}},
-        {E_BUILDINGS,   {{1, 7}}},
-        {E_QUARRY,      {{1, 5}}},
-        {E_MAGIC,       {{1, 40}}},
-        {E_ZOO,         {{1, 40}}},
-        {E_RES,         {{1, 2}}}
-    };
-
-    int card_power = 0;
-    int element_power = 0;
-
-    if (pCard->to_player_tower == 99 || pCard->to_pl_enm_tower == 99 ||
-        pCard->to_player_tower2 == 99 || pCard->to_pl_enm_tower2 == 99) {
-        element_power = enemy->tower_height - player->tower_height;
-    } else {
-        element_power = pCard->to_player_tower + pCard->to_pl_enm_tower +
-                        pCard->to_player_tower2 + pCard->to_pl_enm_tower2;
-    }
-
-    if (player->tower_height >= 10) {
-        card_power += mastery_coeff[P_TOWER_M10][mastery] * element_power;
-    } else {
-        card_power += 20 * element_power;
-    }
-
-    if (pCard->to_player_wall == 99 || pCard->to_pl_enm_wall == 99 ||
-        pCard->to_player_wall2 == 99 || pCard->to_pl_enm_wall2 == 99) {
-        element_power = enemy->wall_height - player->wall_height;
-    } else {
-        element_power = pCard->to_player_wall + pCard->to_pl_enm_wall +
-                        pCard->to_player_wall2 + pCard->to_pl_enm_wall2;
-    }
-
-    if (player->wall_height >= 10) {
-        card_power += mastery_coeff[P_WALL_M10][mastery] * element_power;  // 1
-    } else {
-        card_power += 5 * element_power;
-    }
-
-    card_power +=
-        7 * (pCard->to_player_buildings + pCard->to_pl_enm_buildings +
-             pCard->to_player_buildings2 + pCard->to_pl_enm_buildings2);
-
-    if (pCard->to_player_quarry_lvl == 99 ||
-        pCard->to_pl_enm_quarry_lvl == 99 ||
-        pCard->to_player_quarry_lvl2 == 99 ||
-        pCard->to_pl_enm_quarry_lvl2 == 99) {
-        element_power = enemy->quarry_level - player->quarry_level;
-    } else {
-        element_power =
-            pCard->to_player_quarry_lvl + pCard->to_pl_enm_quarry_lvl +
-            pCard->to_player_quarry_lvl2 + pCard->to_pl_enm_quarry_lvl;
-    }
-
-    card_power += 40 * element_power;
-
-    if (pCard->to_player_magic_lvl == 99 || pCard->to_pl_enm_magic_lvl == 99 ||
-        pCard->to_player_magic_lvl2 == 99 ||
-        pCard->to_pl_enm_magic_lvl2 == 99) {
-        element_power = enemy->magic_level - player->magic_level;
-    } else {
-        element_power =
-            pCard->to_player_magic_lvl + pCard->to_pl_enm_magic_lvl +
-            pCard->to_player_magic_lvl2 + pCard->to_pl_enm_magic_lvl2;
-    }
-    card_power += 40 * element_power;
-
-    if (pCard->to_player_zoo_lvl == 99 || pCard->to_pl_enm_zoo_lvl == 99 ||
-        pCard->to_player_zoo_lvl2 == 99 || pCard->to_pl_enm_zoo_lvl2 == 99) {
-        element_power = enemy->zoo_level - player->zoo_level;
-    } else {
-        element_power = pCard->to_player_zoo_lvl + pCard->to_pl_enm_zoo_lvl +
-                        pCard->to_player_zoo_lvl2 + pCard->to_pl_enm_zoo_lvl2;
-    }
-    card_power += 40 * element_power;
-
-    if (pCard->to_player_bricks == 99 || pCard->to_pl_enm_bricks == 99 ||
-        pCard->to_player_bricks2 == 99 || pCard->to_pl_enm_bricks2 == 99) {
-        element_power = enemy->resource_bricks - player->resource_bricks;
-    } else {
-        element_power = pCard->to_player_bricks + pCard->to_pl_enm_bricks +
-                        pCard->to_player_bricks2 + pCard->to_pl_enm_bricks2;
-    }
-    card_power += 2 * element_power;
-
-    if (pCard->to_player_gems == 99 || pCard->to_pl_enm_gems == 99 ||
-        pCard->to_player_gems2 == 99 || pCard->to_pl_enm_gems2 == 99) {
-        element_power = enemy->resource_gems - player->resource_gems;
-    } else {
-        element_power = pCard->to_player_gems + pCard->to_pl_enm_gems +
-                        pCard->to_player_gems2 + pCard->to_pl_enm_gems2;
-    }
-    card_power += 2 * element_power;
-
-    if (pCard->to_player_beasts == 99 || pCard->to_pl_enm_beasts == 99 ||
-        pCard->to_player_beasts2 == 99 || pCard->to_pl_enm_beasts2 == 99) {
-        element_power = enemy->resource_beasts - player->resource_beasts;
-    } else {
-        element_power = pCard->to_player_beasts + pCard->to_pl_enm_beasts +
-                        pCard->to_player_beasts2 + pCard->to_pl_enm_beasts2;
-    }
-    card_power += 2 * element_power;
-
-    if (pCard->to_enemy_tower == 99 || pCard->to_enemy_tower2 == 99) {
-        element_power = player->tower_height - enemy->tower_height;
-    } else {
-        element_power = -(pCard->to_enemy_tower + pCard->to_enemy_tower2);
-    }
-    card_power += mastery_coeff[E_TOWER][mastery] * element_power;
-
-    if (pCard->to_enemy_wall == 99 || pCard->to_enemy_wall2 == 99) {
-        element_power = player->wall_height - enemy->wall_height;
-    } else {
-        element_power = -(pCard->to_enemy_wall + pCard->to_enemy_wall2);
-    }
-    card_power += mastery_coeff[E_WALL][mastery] * element_power;
-
-    card_power -= mastery_coeff[E_BUILDINGS][mastery] *
-                  (pCard->to_enemy_buildings + pCard->to_enemy_buildings2);
-
-    if (pCard->to_enemy_quarry_lvl == 99 || pCard->to_enemy_quarry_lvl2 == 99) {
-        element_power = player->quarry_level - enemy->quarry_level;  // 5
-    } else {
-        element_power =
-            -(pCard->to_enemy_quarry_lvl + pCard->to_enemy_quarry_lvl2);  // 5
-    }
-    card_power += mastery_coeff[E_QUARRY][mastery] * element_power;
-
-    if (pCard->to_enemy_magic_lvl == 99 || pCard->to_enemy_magic_lvl2 == 99) {
-        element_power = player->magic_level - enemy->magic_level;  // 40
-    } else {
-        element_power =
-            -(pCard->to_enemy_magic_lvl + pCard->to_enemy_magic_lvl2);
-    }
-    card_power += mastery_coeff[E_MAGIC][mastery] * element_power;
-
-    if (pCard->to_enemy_zoo_lvl == 99 || pCard->to_enemy_zoo_lvl2 == 99) {
-        element_power = player->zoo_level - enemy->zoo_level;  // 40
-    } else {
-        element_power = -(pCard->to_enemy_zoo_lvl + pCard->to_enemy_zoo_lvl2);
-    }
-    card_power += mastery_coeff[E_ZOO][mastery] * element_power;
-
-    if (pCard->to_enemy_bricks == 99 || pCard->to_enemy_bricks2 == 99) {
-        element_power = player->resource_bricks - enemy->resource_bricks;  // 2
-    } else {
-        element_power = -(pCard->to_enemy_bricks + pCard->to_enemy_bricks2);
-    }
-    card_power += mastery_coeff[E_RES][mastery] * element_power;
-
-    if (pCard->to_enemy_gems == 99 || pCard->to_enemy_gems2 == 99) {
-        element_power = player->resource_gems - enemy->resource_gems;  // 2
-    } else {
-        element_power = -(pCard->to_enemy_gems + pCard->to_enemy_gems2);
-    }
-    card_power += mastery_coeff[E_RES][mastery] * element_power;
-
-    if (pCard->to_enemy_beasts == 99 || pCard->to_enemy_beasts2 == 99) {
-        element_power = player->resource_beasts - enemy->resource_beasts;  // 2
-    } else {
-        element_power = -(pCard->to_enemy_beasts + pCard->to_enemy_beasts2);
-    }
-    card_power += mastery_coeff[E_RES][mastery] * element_power;
-
-    if (pCard->field_30 || pCard->field_4D) {
-        card_power *= 10;
-    }
-
-    if (pCard->card_resource_type == 1) {
-        element_power = player->resource_bricks - pCard->needed_bricks;
-    } else if (pCard->card_resource_type == 2) {
-        element_power = player->resource_gems - pCard->needed_gems;
-    } else if (pCard->card_resource_type == 3) {
-        element_power = player->resource_beasts - pCard->needed_beasts;
-    }
-    if (element_power > 3) {
-        element_power = 3;
-    }
-    card_power += 5 * element_power;
-
-    if (enemy->tower_height <= pCard->to_enemy_tower2 + pCard->to_enemy_tower) {
-        card_power += 9999;
-    }
-
-    if (pCard->to_enemy_tower2 + pCard->to_enemy_tower + pCard->to_enemy_wall +
-            pCard->to_enemy_wall2 + pCard->to_enemy_buildings +
-            pCard->to_enemy_buildings2 >=
-        enemy->wall_height + enemy->tower_height) {
-        card_power += 9999;
-    }
-
-    if ((pCard->to_player_tower2 + pCard->to_pl_enm_tower2 +
-         pCard->to_player_tower + pCard->to_pl_enm_tower +
-         player->tower_height) >= max_tower_height) {
-        card_power += 9999;
-    }
-
-    return card_power;
-}
-
 bool OpponentsAITurn(int player_num) {
     assert(player_num != 0);
 
-    int ai_player_cards_count = GetPlayerHandCardCount(player_num);
-    if (ai_player_cards_count == 0) return true;
-
-    // opponent_mastery = 2; // testing
+    if (GetPlayerHandCardCount(player_num) == 0) return true;
 
     opponents_turn = 1;
-    if (opponent_mastery == 0) {
-        // select card at random to play
-        int random_card_slot;
-        if (need_to_discard_card == 0) {
-            for (int i = 0; i < 10; ++i) {
-                random_card_slot = grng->randomInSegment(0, ai_player_cards_count - 1);
-                if (CanCardBePlayed(player_num, random_card_slot))
-                    return PlayCard(player_num, random_card_slot);
-            }
-        }
-
-        // if that fails discard card at random
-        random_card_slot = grng->randomInSegment(0, ai_player_cards_count - 1);
-        return DiscardCard(player_num, random_card_slot);
-
-    } else if ((opponent_mastery == 1) || (opponent_mastery == 2)) {
-        // apply some cunning
-        ArcomagePlayer *player = &am_Players[player_num];
-        ArcomagePlayer *enemy = &am_Players[(player_num + 1) % 2];
-
-        // wipe cards power array - set negative for unfilled card slots
-        for (int i = 0; i < 10; ++i) {
-            if (i >= ai_player_cards_count) {
-                cards_power[i].slot_index = -1;
-                cards_power[i].card_power = -9999;
-            } else {
-                cards_power[i].slot_index = i;
-                cards_power[i].card_power = 0;
-            }
-        }
-
-        // calculate how effective each card would be
-        for (int i = 0; i < ai_player_cards_count; ++i) {
-            ArcomageCard *calc_card = &pCards[am_Players[player_num].cards_at_hand[cards_power[i].slot_index]];
-            cards_power[i].card_power =
-                CalculateCardPower(player, enemy, calc_card, opponent_mastery - 1);
-        }
-
-        // bubble sort the card powers in order
-        for (int j = ai_player_cards_count - 1; j >= 0; --j) {
-            for (int m = 0; m < j; ++m) {
-                if (cards_power[m].card_power < cards_power[m + 1].card_power) {
-                    int tempslot = cards_power[m].slot_index;
-                    int temppow = cards_power[m].card_power;
-                    cards_power[m].slot_index = cards_power[m + 1].slot_index;
-                    cards_power[m].card_power = cards_power[m + 1].card_power;
-                    cards_power[m + 1].slot_index = tempslot;
-                    cards_power[m + 1].card_power = temppow;
-                }
-            }
-        }
-
-        // if we have to discard pick the least powerful to chuck
-        int discard_slot = 0;
-        for (int i = ai_player_cards_count - 1; i; --i) {
-            if (i >= 0) {
-                if (pCards[am_Players[player_num].cards_at_hand[cards_power[i].slot_index]].can_be_discarded) {
-                    discard_slot = cards_power[i].slot_index;
-                }
-            }
-        }
-
-        if (!need_to_discard_card) {
-            // try and play most powerful card
-            for (int i = 0; i < ai_player_cards_count - 1; ++i) {
-                if (CanCardBePlayed(player_num, cards_power[i].slot_index) && cards_power[i].card_power) {
-                    return PlayCard(player_num, cards_power[i].slot_index);
-                }
-            }
-        }
-
-        // fall back - have to discard
-        return DiscardCard(player_num, discard_slot);
-    }
-    return true;  // result != 0;
+    ArcomageMove move = chooseArcomageMove(am_State, player_num, opponent_strategy, grng);
+    if (move.type == ARCOMAGE_MOVE_PLAY)
+        return PlayCard(player_num, move.slot);
+    return DiscardCard(player_num, move.slot);
 }
 
 void ArcomageGame::Loop() {
@@ -882,19 +518,19 @@ void ArcomageGame::Loop() {
     bool am_turn_not_finished = false;
     while (!pArcomageGame->GameOver) {
         am_turn_not_finished = true;
-        IncreaseResourcesInTurn(current_player_num);
+        IncreaseResourcesInTurn(am_State.currentPlayer);
         // LABEL_8:
         while (am_turn_not_finished) {
             played_card_id = -1;
-            GetNextCardFromDeck(current_player_num);
+            GetNextCardFromDeck(am_State.currentPlayer);
             while (true) {
-                am_turn_not_finished = PlayerTurn(current_player_num);
-                if (GetPlayerHandCardCount(current_player_num) <=
-                    minimum_cards_at_hand) {
-                    need_to_discard_card = 0;
+                am_turn_not_finished = PlayerTurn(am_State.currentPlayer);
+                if (GetPlayerHandCardCount(am_State.currentPlayer) <=
+                    am_State.rules.minimumCardsAtHand) {
+                    am_State.needToDiscardCard = false;
                     break;
                 }
-                need_to_discard_card = 1;
+                am_State.needToDiscardCard = true;
                 if (pArcomageGame->force_am_exit) break;
             }
         }
@@ -928,35 +564,35 @@ void ArcomageGame::Loop() {
             if (cnt >= 8) {
                 cnt = 0;
                 if (pArcomageGame->uGameWinner == 1) {
-                    if (am_Players[1].tower_height > 0) {
-                        int div = (am_Players[1].tower_height / 10);
+                    if (am_State.players[1].tower_height > 0) {
+                        int div = (am_State.players[1].tower_height / 10);
                         if (div == 0) div = 1;
-                        am_Players[1].tower_height -= div;
+                        am_State.players[1].tower_height -= div;
                         explos_coords.x = 514;
                         explos_coords.y = 296;
                         new_explosion_effect(&explos_coords, -div);
                     }
-                    if (am_Players[1].wall_height > 0) {
-                        int div = (am_Players[1].wall_height / 10);
+                    if (am_State.players[1].wall_height > 0) {
+                        int div = (am_State.players[1].wall_height / 10);
                         if (div == 0) div = 1;
-                        am_Players[1].wall_height -= div;
+                        am_State.players[1].wall_height -= div;
                         explos_coords.x = 442;
                         explos_coords.y = 296;
                         new_explosion_effect(&explos_coords, -div);
                     }
                 } else {
-                    if (am_Players[0].tower_height > 0) {
-                        int div = (am_Players[0].tower_height / 10);
+                    if (am_State.players[0].tower_height > 0) {
+                        int div = (am_State.players[0].tower_height / 10);
                         if (div == 0) div = 1;
-                        am_Players[0].tower_height -= div;
+                        am_State.players[0].tower_height -= div;
                         explos_coords.x = 122;
                         explos_coords.y = 296;
                         new_explosion_effect(&explos_coords, -div);
                     }
-                    if (am_Players[0].wall_height > 0) {
-                        int div = (am_Players[0].wall_height / 10);
+                    if (am_State.players[0].wall_height > 0) {
+                        int div = (am_State.players[0].wall_height / 10);
                         if (div == 0) div = 1;
-                        am_Players[0].wall_height -= div;
+                        am_State.players[0].wall_height -= div;
                         explos_coords.x = 180;
                         explos_coords.y = 296;
                         new_explosion_effect(&explos_coords, -div);
@@ -1000,117 +636,45 @@ void ArcomageGame::Loop() {
     if (pMovie_Track) BackToHouseMenu();
 }
 
+static ArcomageTavern arcomageTavernForHouse(HouseId houseId) {
+    assert(isArcomageTavern(houseId));
+    return static_cast<ArcomageTavern>(std::to_underlying(houseId) - std::to_underlying(HOUSE_FIRST_ARCOMAGE_TAVERN));
+}
+
 void SetStartGameData() {
-    signed int j;                       // edx@7
-    int card_id_counter;                // edx@13
-    signed int i;                       // ecx@13
-    signed int card_dispenser_counter;  // eax@13
-
-    SetStartConditions();
-
-    current_player_num = !Player_Gets_First_Turn;
-    am_Players[1].pPlayerName = pArcomageGame->pPlayer2Name;
-    am_Players[1].IsHisTurn = 0;  // !Player_Gets_First_Turn;
-    am_Players[0].pPlayerName = pArcomageGame->pPlayer1Name;
-    am_Players[0].IsHisTurn = 1;  // Player_Gets_First_Turn;
-
-    for (i = 0; i < 2; ++i) {
-        am_Players[i].tower_height = start_tower_height;
-        am_Players[i].wall_height = start_wall_height;
-        am_Players[i].quarry_level = start_quarry_level;
-        am_Players[i].magic_level = start_magic_level;
-        am_Players[i].zoo_level = start_zoo_level;
-        am_Players[i].resource_bricks = start_bricks_amount;
-        am_Players[i].resource_gems = start_gems_amount;
-        am_Players[i].resource_beasts = start_beasts_amount;
-
-        for (j = 0; j < 10; ++j) {
-            am_Players[i].cards_at_hand[j] = -1;
+    ArcomageTavern tavern = arcomageTavernForHouse(window_SpeakInHouse->houseId());
+    const ArcomageStartConditions &conditions = arcomageStartConditions[tavern];
+
+    am_State.reset(conditions, !Player_Gets_First_Turn);
+    opponent_strategy = static_cast<ArcomageStrategy>(conditions.mastery_lvl);
+
+    am_PlayersUi[1].pPlayerName = pArcomageGame->pPlayer2Name;
+    am_PlayersUi[1].IsHisTurn = 0;  // !Player_Gets_First_Turn;
+    am_PlayersUi[0].pPlayerName = pArcomageGame->pPlayer1Name;
+    am_PlayersUi[0].IsHisTurn = 1;  // Player_Gets_First_Turn;
+
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 10; ++j) {
             if (Player_Cards_Shift) {
-                am_Players[i].card_shift[j].x = -1;
-                am_Players[i].card_shift[j].y = -1;
+                am_PlayersUi[i].card_shift[j].x = -1;
+                am_PlayersUi[i].card_shift[j].y = -1;
             } else {
-                am_Players[i].card_shift[j].x = 0;
-                am_Players[i].card_shift[j].y = 0;
+                am_PlayersUi[i].card_shift[j].x = 0;
+                am_PlayersUi[i].card_shift[j].y = 0;
             }
         }
     }
-    deckMaster.name = "Master Deck";
-    for (i = 0, card_dispenser_counter = -2, card_id_counter = 0; i < DECK_SIZE;
-         ++i, ++card_dispenser_counter) {
-        deckMaster.cardsInUse[i] = 0;
-        deckMaster.cards_IDs[i] = card_id_counter;
-        switch (card_dispenser_counter) {
-            case 0:
-            case 2:
-            case 6:
-            case 9:
-            case 13:
-            case 18:
-            case 23:
-            case 33:
-            case 36:
-            case 38:
-            case 44:
-            case 46:
-            case 52:
-            case 57:
-            case 69:
-            case 71:
-            case 75:
-            case 79:
-            case 81:
-            case 84:
-            case 89:
-                break;
-            default:
-                ++card_id_counter;
-        }
-    }
+
     FillPlayerDeck();
 }
 
 void FillPlayerDeck() {
-    int m;
-    int rand_deck_pos = 0;
-    char card_taken_flags[DECK_SIZE];
-    int i, j;
-
     ArcomageGame::playSound(20);
-    memset(deckMaster.cardsInUse, 0, DECK_SIZE);
-    memset(card_taken_flags, 0, DECK_SIZE);
-
-    for (i = 0; i < 2; ++i) {
-        for (j = 0; j < 10; ++j) {
-            if (am_Players[i].cards_at_hand[j] > -1) {
-                for (m = 0; m < DECK_SIZE; ++m) {
-                    if (deckMaster.cards_IDs[m] ==
-                            am_Players[i].cards_at_hand[j] &&
-                        deckMaster.cardsInUse[m] == 0) {
-                        // mark which cards are already in players hands
-                        deckMaster.cardsInUse[m] = 1;
-                        break;
-                    }
-                }
-            }
-        }
-    }
-
-    for (i = 0; i < DECK_SIZE; ++i) {
-        do {
-            rand_deck_pos = grng->random(DECK_SIZE);
-        } while (card_taken_flags[rand_deck_pos] == 1);
-
-        card_taken_flags[rand_deck_pos] = 1;
-        playDeck.cards_IDs[i] = deckMaster.cards_IDs[rand_deck_pos];
-        playDeck.cardsInUse[i] = deckMaster.cardsInUse[rand_deck_pos];
-    }
-
-    deck_walk_index = 0;
+    am_State.shuffleDeck(grng);
 }
 
 void InitalHandsFill() {
-    for (int i = 0; i < minimum_cards_at_hand; ++i) {
+    for (int i = 0; i < am_State.rules.minimumCardsAtHand; ++i) {
         // GetNextCardFromDeck(0);
         // GetNextCardFromDeck(1);
         GetNextCardFromDeck(Player_Gets_First_Turn);
@@ -1118,62 +682,29 @@ void InitalHandsFill() {
 }
 
 void GetNextCardFromDeck(int player_num) {
-    signed int deck_index;      // eax@1
-    int new_card_id;            // edi@1
-    signed int card_slot_indx;  // eax@7
-
-    deck_index = deck_walk_index;
-    for (;;) {
-        if (deck_index >= DECK_SIZE) {
-            FillPlayerDeck();
-            deck_index = deck_walk_index = 0;
-        }
-        if (!playDeck.cardsInUse[deck_index]) {
-            new_card_id = playDeck.cards_IDs[deck_index];
-            ++deck_index;
-            deck_walk_index = deck_index;
-            break;
-        }
-        ++deck_index;
-        deck_walk_index = deck_index;
-    }
+    ArcomageDraw draw = am_State.drawCard(player_num, grng);
+    if (draw.reshuffled)
+        ArcomageGame::playSound(20);
 
     ArcomageGame::playSound(21);
-    card_slot_indx = GetEmptyCardSlotIndex(player_num);
-    if (card_slot_indx != -1) {
-        drawn_card_slot_index = card_slot_indx;
-        am_Players[player_num].cards_at_hand[card_slot_indx] = new_card_id;
+    if (draw.slot != -1) {
+        drawn_card_slot_index = draw.slot;
         // Note that we're using grng here for a reason - we want recorded mouse clicks to work.
-        am_Players[player_num].card_shift[card_slot_indx].x = grng->randomInSegment(-4, 4);
-        am_Players[player_num].card_shift[card_slot_indx].y = grng->randomInSegment(-4, 4);
+        am_PlayersUi[player_num].card_shift[draw.slot].x = grng->randomInSegment(-4, 4);
+        am_PlayersUi[player_num].card_shift[draw.slot].y = grng->randomInSegment(-4, 4);
         drawn_card_anim_start = 1;
     }
 }
 
-int GetEmptyCardSlotIndex(int player_num) {
-    // find first empty card slot
-    for (int i = 0; i < 10; ++i) {
-        if (am_Players[player_num].cards_at_hand[i] == -1) return i;
-    }
-    return -1;
-}
-
 void IncreaseResourcesInTurn(int player_num) {
-    // increase player resources
-    am_Players[player_num].resource_bricks +=
-        quarry_bonus + am_Players[player_num].quarry_level;
-    am_Players[player_num].resource_gems +=
-        magic_bonus + am_Players[player_num].magic_level;
-    am_Players[player_num].resource_beasts +=
-        zoo_bonus + am_Players[player_num].zoo_level;
+    am_State.increaseResources(player_num);
 }
 
 void TurnChange() {
     if (!pArcomageGame->force_am_exit) {
-        if (am_Players[0].IsHisTurn != 1 || am_Players[1].IsHisTurn != 1) {
-            ++current_player_num;
+        if (am_PlayersUi[0].IsHisTurn != 1 || am_PlayersUi[1].IsHisTurn != 1) {
+            am_State.changeTurn();
             hide_card_anim_start = 1;
-            if (current_player_num >= 2) current_player_num = 0;
         } else {
             // this is never called - pause when switching turns
             assert(false);
@@ -1182,18 +713,7 @@ void TurnChange() {
 }
 
 bool IsGameOver() {
-    // check if victory conditions have been met
-    bool result = false;
-    for (int i = 0; i < 2; ++i) {
-        if (am_Players[i].tower_height <= 0) result = true;
-        if (am_Players[i].tower_height >= max_tower_height) result = true;
-        if (am_Players[i].resource_bricks >= max_resources_amount ||
-            am_Players[i].resource_gems >= max_resources_amount ||
-            am_Players[i].resource_beasts >= max_resources_amount)
-            result = true;
-    }
-
-    return result;
+    return am_State.isGameOver();
 }
 
 char PlayerTurn(int player_num) {
@@ -1203,7 +723,7 @@ char PlayerTurn(int player_num) {
 
     // reset player turn
     opponents_turn = 0;
-    num_actions_left = 0;
+    am_State.numActionsLeft = 0;
 
     // reset animations
     int animation_stage = 20;
@@ -1224,7 +744,7 @@ char PlayerTurn(int player_num) {
         switch (get_message.am_input_type) {
             case ARCO_MSG_FORCEQUIT:
                 if (get_message.field_4 == 129 && get_message.am_input_key == 1) {
-                    num_actions_left = 0;
+                    am_State.numActionsLeft = 0;
                     break_loop = true;
                     pArcomageGame->force_am_exit = 1;
                 }
@@ -1247,16 +767,16 @@ char PlayerTurn(int player_num) {
         }
 
         // time to start the AIs turn
-        if (am_Players[current_player_num].IsHisTurn != 1 && !opponents_turn &&
+        if (am_PlayersUi[am_State.currentPlayer].IsHisTurn != 1 && !opponents_turn &&
             !playdiscard_anim_start && !drawn_card_anim_start) {
             if (hide_card_anim_start) hide_card_anim_runnning = 1;
-            OpponentsAITurn(current_player_num);
+            OpponentsAITurn(am_State.currentPlayer);
             playdiscard_anim_start = 1;
         }
 
         if (drawn_card_slot_index != -1 && drawn_card_anim_cnt > 10) drawn_card_anim_cnt = 10;
 
-        if (playdiscard_anim_start || drawn_card_anim_start || am_Players[current_player_num].IsHisTurn != 1) {
+        if (playdiscard_anim_start || drawn_card_anim_start || am_PlayersUi[am_State.currentPlayer].IsHisTurn != 1) {
             // player cant act
             // card drawing animation
             if (drawn_card_anim_start) {
@@ -1265,8 +785,8 @@ char PlayerTurn(int player_num) {
                     drawn_card_anim_start = 0;
                     drawn_card_anim_cnt = 10;
                     break_loop = false;
-                    if (GetPlayerHandCardCount(current_player_num) <= minimum_cards_at_hand) {
-                        GetNextCardFromDeck(current_player_num);
+                    if (GetPlayerHandCardCount(am_State.currentPlayer) <= am_State.rules.minimumCardsAtHand) {
+                        GetNextCardFromDeck(am_State.currentPlayer);
                     }
                 }
             }
@@ -1275,8 +795,8 @@ char PlayerTurn(int player_num) {
             if (playdiscard_anim_start) {
                 --animation_stage;
                 if (animation_stage < 0) {
-                    if (num_actions_left > 1) {
-                        --num_actions_left;
+                    if (am_State.numActionsLeft > 1) {
+                        --am_State.numActionsLeft;
                         opponents_turn = 0;
                     } else {
                         break_loop = true;
@@ -1287,13 +807,13 @@ char PlayerTurn(int player_num) {
             }
         } else {
             // can play cards
-            if (need_to_discard_card) {
+            if (am_State.needToDiscardCard) {
                 // any mouse - try and discard
                 if ((get_message.am_input_type == ARCO_MSG_LM_DOWN || get_message.am_input_type == ARCO_MSG_RM_DOWN) && DiscardCard(player_num, current_card_slot_index)) {
                     if (hide_card_anim_start) hide_card_anim_runnning = 1;
-                    if (num_cards_to_discard > 0) {
-                        --num_cards_to_discard;
-                        need_to_discard_card = (GetPlayerHandCardCount(player_num) > minimum_cards_at_hand);
+                    if (am_State.numCardsToDiscard > 0) {
+                        --am_State.numCardsToDiscard;
+                        am_State.needToDiscardCard = (GetPlayerHandCardCount(player_num) > am_State.rules.minimumCardsAtHand);
                     }
                     playdiscard_anim_start = 1;
                 }
@@ -1324,7 +844,7 @@ char PlayerTurn(int player_num) {
         DrawGameUI(animation_stage);
     } while (!break_loop);
 
-    return num_actions_left > 0;
+    return am_State.numActionsLeft > 0;
 }
 
 void DrawGameUI(int animation_stage) {
@@ -1340,7 +860,7 @@ void DrawGameUI(int animation_stage) {
     DrawPlayersText();    //рисуем текст
 
     DrawCardAnimation(animation_stage);
-    current_card_slot_index = DrawCardsRectangles(current_player_num);
+    current_card_slot_index = DrawCardsRectangles(am_State.currentPlayer);
 
     // update explosion effects
     for (int i = 0; i < 10; ++i) {
@@ -1426,7 +946,7 @@ void DrawPlayersText() {
     std::string text_buff;
     Pointi text_position;
 
-    if (need_to_discard_card) {
+    if (am_State.needToDiscardCard) {
         text_buff = localization->GetString(LSTR_ARCOMAGE_CARD_DISCARD);
         text_position.x = 320 - pArcomageGame->pfntArrus->GetLineWidth(text_buff) / 2;
         text_position.y = 306;
@@ -1434,75 +954,75 @@ void DrawPlayersText() {
     }
 
     // player names
-    text_buff = am_Players[0].pPlayerName;
-    if (current_player_num == 0) text_buff += "***";
+    text_buff = am_PlayersUi[0].pPlayerName;
+    if (am_State.currentPlayer == 0) text_buff += "***";
     text_position.x = 47 - pArcomageGame->pfntComic->GetLineWidth(text_buff) / 2;
     text_position.y = 21;
     am_DrawText(text_buff, &text_position);
 
-    text_buff = am_Players[1].pPlayerName;
-    if (current_player_num == 1) text_buff += "***";
+    text_buff = am_PlayersUi[1].pPlayerName;
+    if (am_State.currentPlayer == 1) text_buff += "***";
     text_position.x = 595 - pArcomageGame->pfntComic->GetLineWidth(text_buff) / 2;
     text_position.y = 21;
     am_DrawText(text_buff, &text_position);
 
     // tower heights
-    text_buff = toString(am_Players[0].tower_height);
+    text_buff = toString(am_State.players[0].tower_height);
     text_position.x = 123 - pArcomageGame->pfntComic->GetLineWidth(text_buff) / 2;
     text_position.y = 305;
     am_DrawText(text_buff, &text_position);
 
-    text_buff = toString(am_Players[1].tower_height);
+    text_buff = toString(am_State.players[1].tower_height);
     text_position.x = 515 - pArcomageGame->pfntComic->GetLineWidth(text_buff) / 2;
     text_position.y = 305;
     am_DrawText(text_buff, &text_position);
 
     // wall heights
-    text_buff = toString(am_Players[0].wall_height);
+    text_buff = toString(am_State.players[0].wall_height);
     text_position.x = 188 - pArcomageGame->pfntComic->GetLineWidth(text_buff) / 2;
     text_position.y = 305;
     am_DrawText(text_buff, &text_position);
 
-    text_buff = toString(am_Players[1].wall_height);
+    text_buff = toString(am_State.players[1].wall_height);
     text_position.x = 451 - pArcomageGame->pfntComic->GetLineWidth(text_buff) / 2;
     text_position.y = 305;
     am_DrawText(text_buff, &text_position);
 
     // quarry levels
-    res_value = am_Players[0].quarry_level;
-    if (use_start_bonus) res_value = am_Players[0].quarry_level + quarry_bonus;
+    res_value = am_State.players[0].quarry_level;
+    if (use_start_bonus) res_value = am_State.players[0].quarry_level + am_State.rules.quarryBonus;
     text_position.x = 14;
     text_position.y = 92;
     DrawPlayerLevels(toString(res_value), &text_position);
 
-    res_value = am_Players[1].quarry_level;
-    if (use_start_bonus) res_value = am_Players[1].quarry_level + quarry_bonus;
+    res_value = am_State.players[1].quarry_level;
+    if (use_start_bonus) res_value = am_State.players[1].quarry_level + am_State.rules.quarryBonus;
     text_position.y = 92;
     text_position.x = 561;
     DrawPlayerLevels(toString(res_value), &text_position);
 
     // magic levels
-    res_value = am_Players[0].magic_level;
-    if (use_start_bonus) res_value = am_Players[0].magic_level + magic_bonus;
+    res_value = am_State.players[0].magic_level;
+    if (use_start_bonus) res_value = am_State.players[0].magic_level + am_State.rules.magicBonus;
     text_position.y = 164;
     text_position.x = 14;
     DrawPlayerLevels(toString(res_value), &text_position);
 
-    res_value = am_Players[1].magic_level;
-    if (use_start_bonus) res_value = am_Players[1].magic_level + magic_bonus;
+    res_value = am_State.players[1].magic_level;
+    if (use_start_bonus) res_value = am_State.players[1].magic_level + am_State.rules.magicBonus;
     text_position.y = 164;
     text_position.x = 561;
     DrawPlayerLevels(toString(res_value), &text_position);
 
     // zoo levels
-    res_value = am_Players[0].zoo_level;
-    if (use_start_bonus) res_value = am_Players[0].zoo_level + zoo_bonus;
+    res_value = am_State.players[0].zoo_level;
+    if (use_start_bonus) res_value = am_State.players[0].zoo_level + am_State.rules.zooBonus;
     text_position.y = 236;
     text_position.x = 14;
     DrawPlayerLevels(toString(res_value), &text_position);
 
-    res_value = am_Players[1].zoo_level;
-    if (use_start_bonus) res_value = am_Players[1].zoo_level + zoo_bonus;
+    res_value = am_State.players[1].zoo_level;
+    if (use_start_bonus) res_value = am_State.players[1].zoo_level + am_State.rules.zooBonus;
     text_position.y = 236;
     text_position.x = 561;
     DrawPlayerLevels(toString(res_value), &text_position);
@@ -1510,29 +1030,29 @@ void DrawPlayersText() {
     // bricks
     text_position.y = 114;
     text_position.x = 10;
-    DrawBricksCount(toString(am_Players[0].resource_bricks), &text_position);
+    DrawBricksCount(toString(am_State.players[0].resource_bricks), &text_position);
 
     text_position.x = 557;
     text_position.y = 114;
-    DrawBricksCount(toString(am_Players[1].resource_bricks), &text_position);
+    DrawBricksCount(toString(am_State.players[1].resource_bricks), &text_position);
 
     // gems
     text_position.x = 10;
     text_position.y = 186;
-    DrawGemsCount(toString(am_Players[0].resource_gems), &text_position);
+    DrawGemsCount(toString(am_State.players[0].resource_gems), &text_position);
 
     text_position.x = 557;
     text_position.y = 186;
-    DrawGemsCount(toString(am_Players[1].resource_gems), &text_position);
+    DrawGemsCount(toString(am_State.players[1].resource_gems), &text_position);
 
     // beasts
     text_position.x = 10;
     text_position.y = 258;
-    DrawBeastsCount(toString(am_Players[0].resource_beasts), &text_position);
+    DrawBeastsCount(toString(am_State.players[0].resource_beasts), &text_position);
 
     text_position.x = 557;
     text_position.y = 258;
-    DrawBeastsCount(toString(am_Players[1].resource_beasts), &text_position);
+    DrawBeastsCount(toString(am_State.players[1].resource_beasts), &text_position);
 }
 
 void DrawPlayerLevels(std::string_view str, Pointi *pXY) {
@@ -1628,14 +1148,14 @@ void DrawPlayersTowers() {
     Pointi pTargetXY;
 
     // draw player 0 tower
-    int tower_height = am_Players[0].tower_height;
+    int tower_height = am_State.players[0].tower_height;
     // check limits
-    if (tower_height > max_tower_height) tower_height = max_tower_height;
+    if (tower_height > am_State.rules.maxTowerHeight) tower_height = am_State.rules.maxTowerHeight;
     pSrcXYZW.y = 0;
     pSrcXYZW.x = 892;
     pSrcXYZW.w = 937 - pSrcXYZW.x;
     // calc height ratio
-    int tower_top = 200 * tower_height / max_tower_height;
+    int tower_top = 200 * tower_height / am_State.rules.maxTowerHeight;
     pSrcXYZW.h = tower_top - pSrcXYZW.y;
     pTargetXY.x = 102;
     pTargetXY.y = 297 - tower_top;
@@ -1651,11 +1171,11 @@ void DrawPlayersTowers() {
     render->DrawFromSpriteSheet(&pSrcXYZW, &pTargetXY, pArcomageGame->field_54, 2);  //верхушка башни
 
     // draw player 1 tower
-    tower_height = am_Players[1].tower_height;
+    tower_height = am_State.players[1].tower_height;
     // set limits
-    if (tower_height > max_tower_height) tower_height = max_tower_height;
+    if (tower_height > am_State.rules.maxTowerHeight) tower_height = am_State.rules.maxTowerHeight;
     // calc tower height ratio
-    tower_top = 200 * tower_height / max_tower_height;
+    tower_top = 200 * tower_height / am_State.rules.maxTowerHeight;
     pSrcXYZW.y = 0;
     pSrcXYZW.x = 892;
     pSrcXYZW.w = 937 - pSrcXYZW.x;
@@ -1679,7 +1199,7 @@ void DrawPlayersWall() {
     Pointi pTargetXY;
 
     // draw player 0 wall
-    int player_0_h = am_Players[0].wall_height;
+    int player_0_h = am_State.players[0].wall_height;
     // fix limit
     if (player_0_h > 100) player_0_h = 100;
 
@@ -1697,7 +1217,7 @@ void DrawPlayersWall() {
     }
 
     // draw player 1 wall
-    int player_1_h = am_Players[1].wall_height;
+    int player_1_h = am_State.players[1].wall_height;
     if (player_1_h > 100) player_1_h = 100;
     if (player_1_h > 0) {
         pSrcXYZW.y = 0;
@@ -1717,7 +1237,7 @@ void DrawCards() {
     Pointi pTargetXY;
 
     // draw player hand
-    int card_count = GetPlayerHandCardCount(current_player_num);
+    int card_count = GetPlayerHandCardCount(am_State.currentPlayer);
     pTargetXY.y = 327;
     int card_spacing = (render->GetRenderDimensions().w - 96 * card_count) / (card_count + 1);
     pTargetXY.x = card_spacing;
@@ -1725,24 +1245,24 @@ void DrawCards() {
     for (int card_slot = 0; card_slot < card_count; ++card_slot) {
         // shift card pos
         if (Player_Cards_Shift) {
-            pTargetXY.x += am_Players[current_player_num].card_shift[card_slot].x;
-            pTargetXY.y += am_Players[current_player_num].card_shift[card_slot].y;
+            pTargetXY.x += am_PlayersUi[am_State.currentPlayer].card_shift[card_slot].x;
+            pTargetXY.y += am_PlayersUi[am_State.currentPlayer].card_shift[card_slot].y;
         }
 
-        if (am_Players[current_player_num].cards_at_hand[card_slot] == -1) {
+        if (am_State.players[am_State.currentPlayer].cards_at_hand[card_slot] == -1) {
             // need to acess another slot if card sent for animatoin
             ++card_count;
         } else if (card_slot != drawn_card_slot_index) {
             // draw back of card for opponents turn
-            if (am_Players[current_player_num].IsHisTurn == 0 && See_Opponents_Cards == 0) {
+            if (am_PlayersUi[am_State.currentPlayer].IsHisTurn == 0 && See_Opponents_Cards == 0) {
                 pSrcXYZW.x = 192;
                 pSrcXYZW.y = 0;
                 pSrcXYZW.w = 288 - pSrcXYZW.x;
                 pSrcXYZW.h = 128 - pSrcXYZW.y;
                 render->DrawFromSpriteSheet(&pSrcXYZW, &pTargetXY, 0, 2);  //рисуется оборотные стороны карт противника
             } else {
-                pArcomageGame->GetCardRect(am_Players[current_player_num].cards_at_hand[card_slot], &pSrcXYZW);
-                if (!CanCardBePlayed(current_player_num, card_slot)) {
+                pArcomageGame->GetCardRect(am_State.players[am_State.currentPlayer].cards_at_hand[card_slot], &pSrcXYZW);
+                if (!CanCardBePlayed(am_State.currentPlayer, card_slot)) {
                     // рисуются неактивные карты - greyed out
                     render->DrawFromSpriteSheet(&pSrcXYZW, &pTargetXY, 0, 0);
                 } else {
@@ -1753,8 +1273,8 @@ void DrawCards() {
 
         // unshift by card pos
         if (Player_Cards_Shift) {
-            pTargetXY.x -= am_Players[current_player_num].card_shift[card_slot].x;
-            pTargetXY.y -= am_Players[current_player_num].card_shift[card_slot].y;
+            pTargetXY.x -= am_PlayersUi[am_State.currentPlayer].card_shift[card_slot].x;
+            pTargetXY.y -= am_PlayersUi[am_State.currentPlayer].card_shift[card_slot].y;
         }
 
         // shift draw postion along
@@ -1832,15 +1352,15 @@ void DrawCardAnimation(int animation_stage) {
             // animation start so calcualte posiotn and speeds
             anim_card_pos_drawncard.y = 18;
             anim_card_pos_drawncard.x = 120;
-            int card_count = GetPlayerHandCardCount(current_player_num);
+            int card_count = GetPlayerHandCardCount(am_State.currentPlayer);
             int card_spacing = (render->GetRenderDimensions().w - (96 * card_count)) / (card_count + 1);
 
             int targetx = drawn_card_slot_index * (card_spacing + 96) + card_spacing;
             int targety = 327;
 
             if (Player_Cards_Shift) {
-                targetx += am_Players[current_player_num].card_shift[drawn_card_slot_index].x;
-                targety += am_Players[current_player_num].card_shift[drawn_card_slot_index].y;
+                targetx += am_PlayersUi[am_State.currentPlayer].card_shift[drawn_card_slot_index].x;
+                targety += am_PlayersUi[am_State.currentPlayer].card_shift[drawn_card_slot_index].y;
             }
 
             anim_card_spd_drawncard.x = (targetx - (signed)anim_card_pos_drawncard.x) / 10;
@@ -1923,7 +1443,7 @@ void DrawCardAnimation(int animation_stage) {
         if (animation_stage > 5) {
             if (animation_stage == 15) {
                 // card arrived at centre - execute effects
-                ApplyCardToPlayer(current_player_num, played_card_id);
+                ApplyCardToPlayer(am_State.currentPlayer, played_card_id);
             }
 
             // draw in centre
@@ -2000,12 +1520,7 @@ void ArcomageGame::GetCardRect(int uCardID, Recti *pCardRect) {
 }
 
 int GetPlayerHandCardCount(int player_num) {
-    int card_count = 0;
-    for (int i = 0; i < 10; ++i) {
-        if (am_Players[player_num].cards_at_hand[i] != -1) ++card_count;
-    }
-
-    return card_count;
+    return am_State.handCardCount(player_num);
 }
 
 signed int DrawCardsRectangles(int player_num) {
@@ -2015,7 +1530,7 @@ signed int DrawCardsRectangles(int player_num) {
     Color color;
 
     // only do for the human player
-    if (am_Players[player_num].IsHisTurn) {
+    if (am_PlayersUi[player_num].IsHisTurn) {
         // get the mouse position
         if (get_mouse.Update()) {
             // calc spacings and first card position
@@ -2030,11 +1545,11 @@ signed int DrawCardsRectangles(int player_num) {
             // loop through hand of cards
             for (int hand_index = 0; hand_index < card_count; hand_index++) {
                 // if there is a card
-                if (am_Players[player_num].cards_at_hand[hand_index] != -1) {
+                if (am_State.players[player_num].cards_at_hand[hand_index] != -1) {
                     // shift rectangle co ords
                     if (Player_Cards_Shift) {
-                        pRect.x += am_Players[player_num].card_shift[hand_index].x;
-                        pRect.y += am_Players[player_num].card_shift[hand_index].y;
+                        pRect.x += am_PlayersUi[player_num].card_shift[hand_index].x;
+                        pRect.y += am_PlayersUi[player_num].card_shift[hand_index].y;
                     }
 
                     // see if mouse is hovering
@@ -2054,8 +1569,8 @@ signed int DrawCardsRectangles(int player_num) {
 
                     // unshift rectangle co ords
                     if (Player_Cards_Shift) {
-                        pRect.x -= am_Players[player_num].card_shift[hand_index].x;
-                        pRect.y -= am_Players[player_num].card_shift[hand_index].y;
+                        pRect.x -= am_PlayersUi[player_num].card_shift[hand_index].x;
+                        pRect.y -= am_PlayersUi[player_num].card_shift[hand_index].y;
                     }
 
                     // shift offsets along a card width
@@ -2073,13 +1588,13 @@ bool DiscardCard(int player_num, int card_slot_index) {
     if (card_slot_index <= -1) return false;
 
     // can the card be discarded
-    if (pCards[am_Players[player_num].cards_at_hand[card_slot_index]].can_be_discarded) {
+    if (am_State.canDiscardCard(player_num, card_slot_index)) {
         // calc animation position and move speed
-        int card_count = GetPlayerHandCardCount(current_player_num);
+        int card_count = GetPlayerHandCardCount(am_State.currentPlayer);
         int card_spacing = (render->GetRenderDimensions().w - (96 * card_count)) / (card_count + 1);
 
-        anim_card_pos_playdiscard.x = am_Players[player_num].card_shift[card_slot_index].x + (card_slot_index * (card_spacing + 96) + card_spacing);
-        anim_card_pos_playdiscard.y = am_Players[player_num].card_shift[card_slot_index].y + 327;
+        anim_card_pos_playdiscard.x = am_PlayersUi[player_num].card_shift[card_slot_index].x + (card_slot_index * (card_spacing + 96) + card_spacing);
+        anim_card_pos_playdiscard.y = am_PlayersUi[player_num].card_shift[card_slot_index].y + 327;
 
         // find first free table slot
         int table_slot = 0;
@@ -2094,9 +1609,7 @@ bool DiscardCard(int player_num, int card_slot_index) {
 
         // play sound - set anim card and remove from player
         ArcomageGame::playSound(22);
-        discarded_card_id = am_Players[player_num].cards_at_hand[card_slot_index];
-        am_Players[player_num].cards_at_hand[card_slot_index] = -1;
-        need_to_discard_card = 0;
+        discarded_card_id = am_State.discardCard(player_num, card_slot_index);
 
         return true;
     } else {
@@ -2112,25 +1625,18 @@ bool PlayCard(int player_num, int card_slot_num) {
     // can the card be played
     if (CanCardBePlayed(player_num, card_slot_num)) {
         // calc animation position and move speed
-        int cards_at_hand = GetPlayerHandCardCount(current_player_num);
+        int cards_at_hand = GetPlayerHandCardCount(am_State.currentPlayer);
         int card_spacing = (render->GetRenderDimensions().w - (96 * cards_at_hand)) / (cards_at_hand + 1);
 
-        anim_card_pos_playdiscard.x = am_Players[player_num].card_shift[card_slot_num].x + (card_slot_num * (card_spacing + 96) + card_spacing);
-        anim_card_pos_playdiscard.y = am_Players[player_num].card_shift[card_slot_num].y + 327;
+        anim_card_pos_playdiscard.x = am_PlayersUi[player_num].card_shift[card_slot_num].x + (card_slot_num * (card_spacing + 96) + card_spacing);
+        anim_card_pos_playdiscard.y = am_PlayersUi[player_num].card_shift[card_slot_num].y + 327;
 
         anim_card_spd_playdiscard.x = (272 - (int)anim_card_pos_playdiscard.x) / 5;
         anim_card_spd_playdiscard.y = -30;  // (-150 / 5)
 
-        // play sound and take resource cost
-        ArcomageCard *pCard = &pCards[am_Players[player_num].cards_at_hand[card_slot_num]];
+        // play sound, take resource cost, set anim card and remove from player
         ArcomageGame::playSound(23);
-        am_Players[player_num].resource_bricks -= pCard->needed_bricks;
-        am_Players[player_num].resource_beasts -= pCard->needed_beasts;
-        am_Players[player_num].resource_gems -= pCard->needed_gems;
-
-        // set anim card and remove from player
-        played_card_id = am_Players[player_num].cards_at_hand[card_slot_num];
-        am_Players[player_num].cards_at_hand[card_slot_num] = -1;
+        played_card_id = am_State.playCard(player_num, card_slot_num);
 
         return true;
     } else {
@@ -2140,314 +1646,37 @@ bool PlayCard(int player_num, int card_slot_num) {
 }
 
 bool CanCardBePlayed(int player_num, int hand_card_indx) {
-    bool result = true;
-    ArcomagePlayer *pPlayer = &am_Players[player_num];
-    ArcomageCard *test_card = &pCards[pPlayer->cards_at_hand[hand_card_indx]];
-
-    // test card conditions
-    if (test_card->needed_quarry_level > pPlayer->quarry_level) result = false;
-    if (test_card->needed_magic_level > pPlayer->magic_level) result = false;
-    if (test_card->needed_zoo_level > pPlayer->zoo_level) result = false;
-    if (test_card->needed_bricks > pPlayer->resource_bricks) result = false;
-    if (test_card->needed_gems > pPlayer->resource_gems) result = false;
-    if (test_card->needed_beasts > pPlayer->resource_beasts) result = false;
-
-    return result;
+    return am_State.canPlayCard(player_num, hand_card_indx);
 }
 
 void ApplyCardToPlayer(int player_num, int uCardID) {
-#define APPLY_TO_PLAYER(PLAYER, ENEMY, FIELD, VAL, RES)   \
-    if (VAL != 0) {                                       \
-        if (VAL == 99) {                                  \
-            if (PLAYER->FIELD < ENEMY->FIELD) {           \
-                PLAYER->FIELD = ENEMY->FIELD;             \
-                RES = ENEMY->FIELD - PLAYER->FIELD;       \
-            }                                             \
-        } else {                                          \
-            PLAYER->FIELD += (signed int)(VAL);           \
-            if (PLAYER->FIELD < 0) PLAYER->FIELD = 0;     \
-            RES = (signed int)(VAL);                      \
-        }                                                 \
-    }
-
-#define APPLY_TO_ENEMY(PLAYER, ENEMY, FIELD, VAL, RES) \
-    APPLY_TO_PLAYER(ENEMY, PLAYER, FIELD, VAL, RES)
-
-#define APPLY_TO_BOTH(PLAYER, ENEMY, FIELD, VAL, RES_P, RES_E) \
-    if (VAL != 0) {                                            \
-        if (VAL == 99) {                                       \
-            if (PLAYER->FIELD != ENEMY->FIELD) {               \
-                if (PLAYER->FIELD <= ENEMY->FIELD) {           \
-                    PLAYER->FIELD = ENEMY->FIELD;              \
-                    RES_P = ENEMY->FIELD - PLAYER->FIELD;      \
-                } else {                                       \
-                    ENEMY->FIELD = PLAYER->FIELD;              \
-                    RES_E = PLAYER->FIELD - ENEMY->FIELD;      \
-                }                                              \
-            }                                                  \
-        } else {                                               \
-            PLAYER->FIELD += (signed int)(VAL);                \
-            ENEMY->FIELD += (signed int)(VAL);                 \
-            if (PLAYER->FIELD < 0) {                           \
-                PLAYER->FIELD = 0;                             \
-            }                                                  \
-            if (ENEMY->FIELD < 0) {                            \
-                ENEMY->FIELD = 0;                              \
-            }                                                  \
-            RES_P = (signed int)(VAL);                         \
-            RES_E = (signed int)(VAL);                         \
-        }                                                      \
-    }
-
-    ArcomagePlayer *player = &am_Players[player_num];
-    int enemy_num = ((player_num + 1) % 2);
-    ArcomagePlayer *enemy = &am_Players[enemy_num];
-    ArcomageCard *pCard = &pCards[uCardID];
-
-    int buildings_e = 0;
-    int buildings_p = 0;
-    int dmg_e = 0;
-    int dmg_p = 0;
-    int tower_e = 0;
-    int tower_p = 0;
-    int wall_e = 0;
-    int wall_p = 0;
-
-    int beasts_e = 0;
-    int beasts_p = 0;
-    int gems_e = 0;
-    int gems_p = 0;
-    int bricks_e = 0;
-    int bricks_p = 0;
-    int zoo_e = 0;
-    int zoo_p = 0;
-    int magic_e = 0;
-    int magic_p = 0;
-    int quarry_e = 0;
-    int quarry_p = 0;
-
-    switch (pCard->compare_param) {
-        case CHECK_LESSER_QUARRY : // Mother Lode & Copping the Tech
-            if (player->quarry_level < enemy->quarry_level)
-                goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_MAGIC: // Parity
-            if (player->magic_level < enemy->magic_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_ZOO:
-            if (player->zoo_level < enemy->zoo_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_QUARRY:
-            if (player->quarry_level == enemy->quarry_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_MAGIC:
-            if (player->magic_level == enemy->magic_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_ZOO:
-            if (player->zoo_level == enemy->zoo_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_QUARRY:
-            if (player->quarry_level > enemy->quarry_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_MAGIC: // Unicorn
-            if (player->magic_level > enemy->magic_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_ZOO:
-            if (player->zoo_level > enemy->zoo_level) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_NO_WALL: // Foundations
-            if (!player->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_HAVE_WALL:
-            if (player->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_ENEMY_HAS_NO_WALL: // Spizzer
-            if (!enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_ENEMY_HAS_WALL: // Corrosion Cloud
-            if (enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_WALL:
-            if (player->wall_height < enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_LESSER_TOWER:
-            if (player->tower_height < enemy->tower_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_WALL:
-            if (player->wall_height == enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_EQUAL_TOWER:
-            if (player->tower_height == enemy->tower_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_WALL: // Elven Archers
-            if (player->wall_height > enemy->wall_height) goto desired_effects;
-            goto secondary_effects;
-        case CHECK_GREATER_TOWER:
-            if (player->tower_height > enemy->tower_height) goto desired_effects;
-            goto secondary_effects;
-        default:
-        desired_effects:
-            num_actions_left =
-                pCard->draw_extra_card_count + (pCard->field_30 == 1);
-            num_cards_to_discard = pCard->draw_extra_card_count;
-            for (char i = 0; i < pCard->draw_extra_card_count; i++)
-                GetNextCardFromDeck(player_num);
-
-            need_to_discard_card =
-                GetPlayerHandCardCount(player_num) > minimum_cards_at_hand;
-
-            APPLY_TO_PLAYER(player, enemy, quarry_level,
-                            pCard->to_player_quarry_lvl, quarry_p);
-            APPLY_TO_PLAYER(player, enemy, magic_level,
-                            pCard->to_player_magic_lvl, magic_p);
-            APPLY_TO_PLAYER(player, enemy, zoo_level, pCard->to_player_zoo_lvl,
-                            zoo_p);
-            APPLY_TO_PLAYER(player, enemy, resource_bricks,
-                            pCard->to_player_bricks, bricks_p);
-            APPLY_TO_PLAYER(player, enemy, resource_gems, pCard->to_player_gems,
-                            gems_p);
-            APPLY_TO_PLAYER(player, enemy, resource_beasts,
-                            pCard->to_player_beasts, beasts_p);
-            if (pCard->to_player_buildings) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_player_buildings);
-                buildings_p = (signed int)pCard->to_player_buildings - dmg_p;
-            }
-            APPLY_TO_PLAYER(player, enemy, wall_height, pCard->to_player_wall,
-                            wall_p);
-            APPLY_TO_PLAYER(player, enemy, tower_height, pCard->to_player_tower,
-                            tower_p);
-
-            APPLY_TO_ENEMY(player, enemy, quarry_level,
-                           pCard->to_enemy_quarry_lvl, quarry_e);
-            APPLY_TO_ENEMY(player, enemy, magic_level,
-                           pCard->to_enemy_magic_lvl, magic_e);
-            APPLY_TO_ENEMY(player, enemy, zoo_level, pCard->to_enemy_zoo_lvl,
-                           zoo_e);
-            APPLY_TO_ENEMY(player, enemy, resource_bricks,
-                           pCard->to_enemy_bricks, bricks_e);
-            APPLY_TO_ENEMY(player, enemy, resource_gems, pCard->to_enemy_gems,
-                           gems_e);
-            APPLY_TO_ENEMY(player, enemy, resource_beasts,
-                           pCard->to_enemy_beasts, beasts_e);
-            if (pCard->to_enemy_buildings) {
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_enemy_buildings);
-                buildings_e = (signed int)pCard->to_enemy_buildings - dmg_e;
-            }
-            APPLY_TO_ENEMY(player, enemy, wall_height, pCard->to_enemy_wall,
-                           wall_e);
-            APPLY_TO_ENEMY(player, enemy, tower_height, pCard->to_enemy_tower,
-                           tower_e);
-
-            APPLY_TO_BOTH(player, enemy, quarry_level,
-                          pCard->to_pl_enm_quarry_lvl, quarry_p, quarry_e);
-            APPLY_TO_BOTH(player, enemy, magic_level,
-                          pCard->to_pl_enm_magic_lvl, magic_p, magic_e);
-            APPLY_TO_BOTH(player, enemy, zoo_level, pCard->to_pl_enm_zoo_lvl,
-                          zoo_p, zoo_e);
-            APPLY_TO_BOTH(player, enemy, resource_bricks,
-                          pCard->to_pl_enm_bricks, bricks_p, bricks_e);
-            APPLY_TO_BOTH(player, enemy, resource_gems, pCard->to_pl_enm_gems,
-                          gems_p, gems_e);
-            APPLY_TO_BOTH(player, enemy, resource_beasts,
-                          pCard->to_pl_enm_beasts, beasts_p, beasts_e);
-            if (pCard->to_pl_enm_buildings) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_pl_enm_buildings);
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_pl_enm_buildings);
-                buildings_p = (signed int)pCard->to_pl_enm_buildings - dmg_p;
-                buildings_e = (signed int)pCard->to_pl_enm_buildings - dmg_e;
-            }
-            APPLY_TO_BOTH(player, enemy, wall_height, pCard->to_pl_enm_wall,
-                          wall_p, wall_e);
-            APPLY_TO_BOTH(player, enemy, tower_height, pCard->to_pl_enm_tower,
-                          tower_p, tower_e);
-            break;
-        case CHECK_ALWAYS_SECONDARY:
-        secondary_effects:
-            num_actions_left = pCard->can_draw_extra_card2 + (pCard->field_4D == 1);
-            num_cards_to_discard = pCard->can_draw_extra_card2;
-            for (char i = 0; i < pCard->can_draw_extra_card2; i++)
-                GetNextCardFromDeck(player_num);
-
-            need_to_discard_card =
-                GetPlayerHandCardCount(player_num) > minimum_cards_at_hand;
-
-            APPLY_TO_PLAYER(player, enemy, quarry_level,
-                            pCard->to_player_quarry_lvl2, quarry_p);
-            APPLY_TO_PLAYER(player, enemy, magic_level,
-                            pCard->to_player_magic_lvl2, magic_p);
-            APPLY_TO_PLAYER(player, enemy, zoo_level, pCard->to_player_zoo_lvl2,
-                            zoo_p);
-            APPLY_TO_PLAYER(player, enemy, resource_bricks,
-                            pCard->to_player_bricks2, bricks_p);
-            APPLY_TO_PLAYER(player, enemy, resource_gems,
-                            pCard->to_player_gems2, gems_p);
-            APPLY_TO_PLAYER(player, enemy, resource_beasts,
-                            pCard->to_player_beasts2, beasts_p);
-            if (pCard->to_player_buildings2) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_player_buildings2);
-                buildings_p = (signed int)pCard->to_player_buildings2 - dmg_p;
-            }
-            APPLY_TO_PLAYER(player, enemy, wall_height, pCard->to_player_wall2,
-                            wall_p);
-            APPLY_TO_PLAYER(player, enemy, tower_height,
-                            pCard->to_player_tower2, tower_p);
-
-            APPLY_TO_ENEMY(player, enemy, quarry_level,
-                           pCard->to_enemy_quarry_lvl2, quarry_e);
-            APPLY_TO_ENEMY(player, enemy, magic_level,
-                           pCard->to_enemy_magic_lvl2, magic_e);
-            APPLY_TO_ENEMY(player, enemy, zoo_level, pCard->to_enemy_zoo_lvl2,
-                           zoo_e);
-            APPLY_TO_ENEMY(player, enemy, resource_bricks,
-                           pCard->to_enemy_bricks2, bricks_e);
-            APPLY_TO_ENEMY(player, enemy, resource_gems, pCard->to_enemy_gems2,
-                           gems_e);
-            APPLY_TO_ENEMY(player, enemy, resource_beasts,
-                           pCard->to_enemy_beasts2, beasts_e);
-            if (pCard->to_enemy_buildings2) {
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_enemy_buildings2);
-                buildings_e = (signed int)pCard->to_enemy_buildings2 - dmg_e;
-            }
-            APPLY_TO_ENEMY(player, enemy, wall_height, pCard->to_enemy_wall2,
-                           wall_e);
-            APPLY_TO_ENEMY(player, enemy, tower_height, pCard->to_enemy_tower2,
-                           tower_e);
-
-            APPLY_TO_BOTH(player, enemy, quarry_level,
-                          pCard->to_pl_enm_quarry_lvl2, quarry_p, quarry_e);
-            APPLY_TO_BOTH(player, enemy, magic_level,
-                          pCard->to_pl_enm_magic_lvl2, magic_p, magic_e);
-            APPLY_TO_BOTH(player, enemy, zoo_level, pCard->to_pl_enm_zoo_lvl2,
-                          zoo_p, zoo_e);
-            APPLY_TO_BOTH(player, enemy, resource_bricks,
-                          pCard->to_pl_enm_bricks2, bricks_p, bricks_e);
-            APPLY_TO_BOTH(player, enemy, resource_gems, pCard->to_pl_enm_gems2,
-                          gems_p, gems_e);
-            APPLY_TO_BOTH(player, enemy, resource_beasts,
-                          pCard->to_pl_enm_beasts2, beasts_p, beasts_e);
-
-            if (pCard->to_pl_enm_buildings2) {
-                dmg_p = ApplyDamageToBuildings(
-                    player_num, (signed int)pCard->to_pl_enm_buildings2);
-                dmg_e = ApplyDamageToBuildings(
-                    enemy_num, (signed int)pCard->to_pl_enm_buildings2);
-                buildings_p = (signed int)pCard->to_pl_enm_buildings2 - dmg_p;
-                buildings_e = (signed int)pCard->to_pl_enm_buildings2 - dmg_e;
-            }
-            APPLY_TO_BOTH(player, enemy, wall_height, pCard->to_pl_enm_wall2,
-                          wall_p, wall_e);
-            APPLY_TO_BOTH(player, enemy, tower_height, pCard->to_pl_enm_tower2,
-                          tower_p, tower_e);
-            break;
-    }
-    //  }
-
+    ArcomageCardEffects effects = am_State.applyCard(player_num, uCardID);
+
+    // Card effects don't depend on the cards in hand, so it's OK to draw after applying them.
+    for (int i = 0; i < effects.extraDraws; i++)
+        GetNextCardFromDeck(player_num);
+    am_State.needToDiscardCard = GetPlayerHandCardCount(player_num) > am_State.rules.minimumCardsAtHand;
+
+    int quarry_p = effects.player.quarry;
+    int quarry_e = effects.enemy.quarry;
+    int magic_p = effects.player.magic;
+    int magic_e = effects.enemy.magic;
+    int zoo_p = effects.player.zoo;
+    int zoo_e = effects.enemy.zoo;
+    int bricks_p = effects.player.bricks;
+    int bricks_e = effects.enemy.bricks;
+    int gems_p = effects.player.gems;
+    int gems_e = effects.enemy.gems;
+    int beasts_p = effects.player.beasts;
+    int beasts_e = effects.enemy.beasts;
+    int wall_p = effects.player.wall;
+    int wall_e = effects.enemy.wall;
+    int tower_p = effects.player.tower;
+    int tower_e = effects.enemy.tower;
+    int buildings_p = effects.player.buildings;
+    int buildings_e = effects.enemy.buildings;
+    int dmg_p = effects.player.damage;
+    int dmg_e = effects.enemy.damage;
 
     // call sound if required
     if (quarry_p > 0 || quarry_e > 0) pArcomageGame->playSound(30);
@@ -2674,169 +1903,16 @@ void ApplyCardToPlayer(int player_num, int uCardID) {
             new_explosion_effect(&explos_coords, buildings_e);
         }
     }
-
-#undef APPLY_TO_BOTH
-#undef APPLY_TO_ENEMY
-#undef APPLY_TO_PLAYER
 }
 
 
 
-int ApplyDamageToBuildings(int player_num, int damage) {
-    int wall = am_Players[player_num].wall_height;
-    int result = 0;
-
-    if (wall >= -damage) {  // wall absorbs all damage
-        result = damage;
-        am_Players[player_num].wall_height += damage;
-    } else {
-        damage += wall;  // reduce damage by size of wall
-        am_Players[player_num].wall_height = 0;
-        result = -wall;
-        am_Players[player_num].tower_height += damage;  // apply remaining to tower
-    }
-
-    if (am_Players[player_num].tower_height < 0)
-        am_Players[player_num].tower_height = 0;
-
-    return result;
-}
-
 void GameResultsApply() {
-    int winner;               // esi@1
-    int victory_type;         // edi@1
-    int pl_resource;          // edx@25
-    int en_resource;          // eax@28
     int tavern_num;  // eax@54
 
-    winner = -1;
-    victory_type = -1;
-    // nullsub_1();
-    /*strcpy(pText, "The Winner is: ");//"Победил: " Ritor1: архаизм
-    xy.y = 160;
-    xy.x = 320; //- 12 * v2 / 2;
-    am_DrawText(-1, pText, &xy);*/
-
-    //проверка построена ли башня
-    if (am_Players[0].tower_height < max_tower_height &&
-        am_Players[1].tower_height >=
-            max_tower_height) {  //наша башня не построена, а у врага построена
-        winner = 2;  //победил игрок 2(враг)
-        victory_type = 0;
-    } else if (am_Players[0].tower_height >= max_tower_height &&
-               am_Players[1].tower_height <
-                   max_tower_height) {  //наша башня построена, а у врага нет
-        winner = 1;  //победил игрок 1(мы)
-        victory_type = 0;
-    } else if (am_Players[0].tower_height >= max_tower_height &&
-               am_Players[1].tower_height >=
-                   max_tower_height) {  //и у нас, и у врага построена
-        if (am_Players[0].tower_height ==
-            am_Players[1].tower_height) {  //наши башни равны
-            winner = 0;        //никто не победил
-            victory_type = 4;  //ничья
-        } else {               //наши башни не равны
-            winner =
-                (am_Players[0].tower_height <= am_Players[1].tower_height) +
-                1;  //победил тот, у кого выше
-            victory_type = 0;
-        }
-    }
-
-    //проверка разрушена ли башня
-    if (am_Players[0].tower_height <= 0 &&
-        am_Players[1].tower_height > 0) {  //наша башня разрушена, а у врага нет
-        winner = 2;        // победил игрок 2(враг)
-        victory_type = 2;  //победил разрушив башню врага
-    } else if (am_Players[0].tower_height > 0 &&
-               am_Players[1].tower_height <=
-                   0) {  //у врага башня разрушена, а у нас нет
-        winner = 1;        //победил игрок 1(мы)
-        victory_type = 2;  //победил разрушив башню врага
-    } else if (am_Players[0].tower_height <= 0 &&
-               am_Players[1].tower_height <=
-                   0) {  //наша башня разрушена, и у врага разрушена
-        if (am_Players[0].tower_height ==
-            am_Players[1].tower_height) {  //если башни равны
-            if (am_Players[0].wall_height ==
-                am_Players[1].wall_height) {  //если стены равны
-                winner = 0;
-                victory_type = 4;
-            } else {  //если стены не равны
-                winner =
-                    (am_Players[0].wall_height <= am_Players[1].wall_height) +
-                    1;  //победил тот, у кого стена выше
-                victory_type = 1;  //победа когда больше стена при ничье
-            }
-        } else {  //башни не равны
-            winner =
-                (am_Players[0].tower_height <= am_Players[1].tower_height) +
-                1;  // побеждает тот у кого башня больше
-            victory_type = 2;  //победил разрушив башню врага
-        }
-    }
-
-    //проверка набраны ли ресурсы
-    //проверка какого ресурса больше всего у игрока 1(нас)
-    pl_resource =
-        am_Players[0].resource_bricks;  //кирпичей больше чем др. ресурсов
-    if (am_Players[0].resource_gems > am_Players[0].resource_bricks &&
-        am_Players[0].resource_gems >
-            am_Players[0].resource_beasts)  //драг.камней больше всего
-        pl_resource = am_Players[0].resource_gems;
-    else if (am_Players[0].resource_beasts > am_Players[0].resource_gems &&
-             am_Players[0].resource_beasts >
-                 am_Players[0].resource_bricks)  //зверей больше всего
-        pl_resource = am_Players[0].resource_beasts;
-
-    //проверка какого ресурса больше у игрока 2(врага)
-    en_resource =
-        am_Players[1].resource_bricks;  //кирпичей больше чем др. ресурсов
-    if (am_Players[1].resource_gems > am_Players[1].resource_bricks &&
-        am_Players[1].resource_gems >
-            am_Players[1].resource_beasts)  //драг.камней больше всего
-        en_resource = am_Players[1].resource_gems;
-    else if (am_Players[1].resource_beasts > am_Players[1].resource_gems &&
-             am_Players[1].resource_beasts >
-                 am_Players[1].resource_bricks)  //зверей больше всего
-        en_resource = am_Players[1].resource_beasts;
-
-    //сравнение ресурсов игроков
-    if (winner == -1 && victory_type == -1) {  //нет победителя по башням
-        if (pl_resource < max_resources_amount &&
-            en_resource >=
-                max_resources_amount) {  //враг набрал нужное количество
-            winner = 2;  // враг победил
-            victory_type = 3;  //победа собрав нужное количество ресурсов
-        } else if (pl_resource >= max_resources_amount &&
-                   en_resource <
-                       max_resources_amount) {  //мы набрали нужное количество
-            winner = 1;  // мы победили
-            victory_type = 3;  //победа собрав нужное количество ресурсов
-        } else if (pl_resource >= max_resources_amount &&
-                   en_resource >=
-                       max_resources_amount) {  //и у нас и у врага нужное
-                                                //количество ресурсов
-            if (pl_resource == en_resource) {  // ресурсы равны
-                winner = 0;        //ресурсы равны
-                victory_type = 4;  //ничья
-            } else {
-                winner = (pl_resource <= en_resource) +
-                         1;  //ресурсы не равны, побеждает тот у кого больше
-                victory_type = 3;  //победа собрав нужное количество ресурсов
-            }
-        }
-    } else if (winner == 0 && victory_type == 4) {  // при ничье по башням и стене
-        if (pl_resource != en_resource) {  //ресурсы не равны
-            winner =
-                (pl_resource <= en_resource) + 1;  //победил тот у кого больше
-            victory_type =
-                5;  //победа когда при ничье большее количество ресурсов
-        } else {    //ресурсы равны
-            winner = 0;        //нет победителя
-            victory_type = 4;  //ничья
-        }
-    }
+    ArcomageResult result = am_State.result();
+    int winner = result.winner;
+    int victory_type = result.victoryType;
 
     pArcomageGame->Victory_type = victory_type;
     pArcomageGame->uGameWinner = winner;
@@ -2922,7 +1998,7 @@ void ArcomageGame::PrepareArcomage() {
     // set card params
     current_card_slot_index = -1;
     drawn_card_slot_index = -1;
-    need_to_discard_card = 0;
+    am_State.needToDiscardCard = false;
 
     // set exiting params
     pArcomageGame->force_am_exit = 0;
@@ -2930,32 +2006,6 @@ void ArcomageGame::PrepareArcomage() {
     pArcomageGame->GameOver = 0;
 }
 
-void SetStartConditions() {
-    const ArcomageStartConditions *st_cond;
-    st_cond = &start_conditions[window_SpeakInHouse->houseId()];
-
-    // set start conditions
-    start_tower_height = st_cond->tower_height;
-    start_wall_height = st_cond->wall_height;
-    start_quarry_level = st_cond->quarry_level - 1;
-    start_magic_level = st_cond->magic_level - 1;
-    start_zoo_level = st_cond->zoo_level - 1;
-    start_bricks_amount = st_cond->bricks_amount;
-    start_gems_amount = st_cond->gems_amount;
-    start_beasts_amount = st_cond->beasts_amount;
-    // win conditions
-    max_tower_height = st_cond->max_tower;
-    max_resources_amount = st_cond->max_resources;
-    // opponent skill level
-    opponent_mastery = st_cond->mastery_lvl;
-
-    // bonus acts as min level
-    minimum_cards_at_hand = 5;
-    quarry_bonus = 1;
-    magic_bonus = 1;
-    zoo_bonus = 1;
-}
-
 void am_DrawText(std::string_view str, Pointi *pXY) {
     pPrimaryWindow->DrawText(assets->pFontComic.get(), {pXY->x, pXY->y - ((assets->pFontComic->GetHeight() - 3) / 2) + 3}, colorTable.White, str);
 }
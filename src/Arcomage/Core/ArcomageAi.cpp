@@ -0,0 +1,290 @@
+#include "ArcomageAi.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <utility>
+
+#include "Library/Random/RandomEngine.h"
+
+#include "Utility/IndexedArray.h"
+
+int calculateArcomageCardPower(const ArcomagePlayer &player, const ArcomagePlayer &enemy, const ArcomageCard &card,
+                               int mastery, int maxTowerHeight) {
+    enum class V_IND {
+        P_TOWER_M10,
+        P_WALL_M10,
+        E_TOWER,
+        E_WALL,
+        E_BUILDINGS,
+        E_QUARRY,
+        E_MAGIC,
+        E_ZOO,
+        E_RES
+    };
+    using enum V_IND;
+
+    // mastery coeffs
+    // base mastery focus on growing walls + tower
+    // second level high priority on resource gen
+    static constexpr IndexedArray<std::array<int, 2>, P_TOWER_M10, E_RES> mastery_coeff = {
+        {P_TOWER_M10,   {{10, 5}}},
+        {P_WALL_M10,    {{2, 1}}},
+        {E_TOWER,       {{1, 10}}},
+        {E_WALL,        {{1, 3}}},
+        {E_BUILDINGS,   {{1, 7}}},
+        {E_QUARRY,      {{1, 5}}},
+        {E_MAGIC,       {{1, 40}}},
+        {E_ZOO,         {{1, 40}}},
+        {E_RES,         {{1, 2}}}
+    };
+
+    int card_power = 0;
+    int element_power = 0;
+
+    if (card.to_player_tower == 99 || card.to_pl_enm_tower == 99 ||
+        card.to_player_tower2 == 99 || card.to_pl_enm_tower2 == 99) {
+        element_power = enemy.tower_height - player.tower_height;
+    } else {
+        element_power = card.to_player_tower + card.to_pl_enm_tower +
+                        card.to_player_tower2 + card.to_pl_enm_tower2;
+    }
+
+    if (player.tower_height >= 10) {
+        card_power += mastery_coeff[P_TOWER_M10][mastery] * element_power;
+    } else {
+        card_power += 20 * element_power;
+    }
+
+    if (card.to_player_wall == 99 || card.to_pl_enm_wall == 99 ||
+        card.to_player_wall2 == 99 || card.to_pl_enm_wall2 == 99) {
+        element_power = enemy.wall_height - player.wall_height;
+    } else {
+        element_power = card.to_player_wall + card.to_pl_enm_wall +
+                        card.to_player_wall2 + card.to_pl_enm_wall2;
+    }
+
+    if (player.wall_height >= 10) {
+        card_power += mastery_coeff[P_WALL_M10][mastery] * element_power;  // 1
+    } else {
+        card_power += 5 * element_power;
+    }
+
+    card_power +=
+        7 * (card.to_player_buildings + card.to_pl_enm_buildings +
+             card.to_player_buildings2 + card.to_pl_enm_buildings2);
+
+    if (card.to_player_quarry_lvl == 99 ||
+        card.to_pl_enm_quarry_lvl == 99 ||
+        card.to_player_quarry_lvl2 == 99 ||
+        card.to_pl_enm_quarry_lvl2 == 99) {
+        element_power = enemy.quarry_level - player.quarry_level;
+    } else {
+        element_power =
+            card.to_player_quarry_lvl + card.to_pl_enm_quarry_lvl +
+            card.to_player_quarry_lvl2 + card.to_pl_enm_quarry_lvl;
+    }
+
+    card_power += 40 * element_power;
+
+    if (card.to_player_magic_lvl == 99 || card.to_pl_enm_magic_lvl == 99 ||
+        card.to_player_magic_lvl2 == 99 ||
+        card.to_pl_enm_magic_lvl2 == 99) {
+        element_power = enemy.magic_level - player.magic_level;
+    } else {
+        element_power =
+            card.to_player_magic_lvl + card.to_pl_enm_magic_lvl +
+            card.to_player_magic_lvl2 + card.to_pl_enm_magic_lvl2;
+    }
+    card_power += 40 * element_power;
+
+    if (card.to_player_zoo_lvl == 99 || card.to_pl_enm_zoo_lvl == 99 ||
+        card.to_player_zoo_lvl2 == 99 || card.to_pl_enm_zoo_lvl2 == 99) {
+        element_power = enemy.zoo_level - player.zoo_level;
+    } else {
+        element_power = card.to_player_zoo_lvl + card.to_pl_enm_zoo_lvl +
+                        card.to_player_zoo_lvl2 + card.to_pl_enm_zoo_lvl2;
+    }
+    card_power += 40 * element_power;
+
+    if (card.to_player_bricks == 99 || card.to_pl_enm_bricks == 99 ||
+        card.to_player_bricks2 == 99 || card.to_pl_enm_bricks2 == 99) {
+        element_power = enemy.resource_bricks - player.resource_bricks;
+    } else {
+        element_power = card.to_player_bricks + card.to_pl_enm_bricks +
+                        card.to_player_bricks2 + card.to_pl_enm_bricks2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_player_gems == 99 || card.to_pl_enm_gems == 99 ||
+        card.to_player_gems2 == 99 || card.to_pl_enm_gems2 == 99) {
+        element_power = enemy.resource_gems - player.resource_gems;
+    } else {
+        element_power = card.to_player_gems + card.to_pl_enm_gems +
+                        card.to_player_gems2 + card.to_pl_enm_gems2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_player_beasts == 99 || card.to_pl_enm_beasts == 99 ||
+        card.to_player_beasts2 == 99 || card.to_pl_enm_beasts2 == 99) {
+        element_power = enemy.resource_beasts - player.resource_beasts;
+    } else {
+        element_power = card.to_player_beasts + card.to_pl_enm_beasts +
+                        card.to_player_beasts2 + card.to_pl_enm_beasts2;
+    }
+    card_power += 2 * element_power;
+
+    if (card.to_enemy_tower == 99 || card.to_enemy_tower2 == 99) {
+        element_power = player.tower_height - enemy.tower_height;
+    } else {
+        element_power = -(card.to_enemy_tower + card.to_enemy_tower2);
+    }
+    card_power += mastery_coeff[E_TOWER][mastery] * element_power;
+
+    if (card.to_enemy_wall == 99 || card.to_enemy_wall2 == 99) {
+        element_power = player.wall_height - enemy.wall_height;
+    } else {
+        element_power = -(card.to_enemy_wall + card.to_enemy_wall2);
+    }
+    card_power += mastery_coeff[E_WALL][mastery] * element_power;
+
+    card_power -= mastery_coeff[E_BUILDINGS][mastery] *
+                  (card.to_enemy_buildings + card.to_enemy_buildings2);
+
+    if (card.to_enemy_quarry_lvl == 99 || card.to_enemy_quarry_lvl2 == 99) {
+        element_power = player.quarry_level - enemy.quarry_level;  // 5
+    } else {
+        element_power =
+            -(card.to_enemy_quarry_lvl + card.to_enemy_quarry_lvl2);  // 5
+    }
+    card_power += mastery_coeff[E_QUARRY][mastery] * element_power;
+
+    if (card.to_enemy_magic_lvl == 99 || card.to_enemy_magic_lvl2 == 99) {
+        element_power = player.magic_level - enemy.magic_level;  // 40
+    } else {
+        element_power =
+            -(card.to_enemy_magic_lvl + card.to_enemy_magic_lvl2);
+    }
+    card_power += mastery_coeff[E_MAGIC][mastery] * element_power;
+
+    if (card.to_enemy_zoo_lvl == 99 || card.to_enemy_zoo_lvl2 == 99) {
+        element_power = player.zoo_level - enemy.zoo_level;  // 40
+    } else {
+        element_power = -(card.to_enemy_zoo_lvl + card.to_enemy_zoo_lvl2);
+    }
+    card_power += mastery_coeff[E_ZOO][mastery] * element_power;
+
+    if (card.to_enemy_bricks == 99 || card.to_enemy_bricks2 == 99) {
+        element_power = player.resource_bricks - enemy.resource_bricks;  // 2
+    } else {
+        element_power = -(card.to_enemy_bricks + card.to_enemy_bricks2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.to_enemy_gems == 99 || card.to_enemy_gems2 == 99) {
+        element_power = player.resource_gems - enemy.resource_gems;  // 2
+    } else {
+        element_power = -(card.to_enemy_gems + card.to_enemy_gems2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.to_enemy_beasts == 99 || card.to_enemy_beasts2 == 99) {
+        element_power = player.resource_beasts - enemy.resource_beasts;  // 2
+    } else {
+        element_power = -(card.to_enemy_beasts + card.to_enemy_beasts2);
+    }
+    card_power += mastery_coeff[E_RES][mastery] * element_power;
+
+    if (card.field_30 || card.field_4D) {
+        card_power *= 10;
+    }
+
+    if (card.card_resource_type == 1) {
+        element_power = player.resource_bricks - card.needed_bricks;
+    } else if (card.card_resource_type == 2) {
+        element_power = player.resource_gems - card.needed_gems;
+    } else if (card.card_resource_type == 3) {
+        element_power = player.resource_beasts - card.needed_beasts;
+    }
+    if (element_power > 3) {
+        element_power = 3;
+    }
+    card_power += 5 * element_power;
+
+    if (enemy.tower_height <= card.to_enemy_tower2 + card.to_enemy_tower) {
+        card_power += 9999;
+    }
+
+    if (card.to_enemy_tower2 + card.to_enemy_tower + card.to_enemy_wall +
+            card.to_enemy_wall2 + card.to_enemy_buildings +
+            card.to_enemy_buildings2 >=
+        enemy.wall_height + enemy.tower_height) {
+        card_power += 9999;
+    }
+
+    if ((card.to_player_tower2 + card.to_pl_enm_tower2 +
+         card.to_player_tower + card.to_pl_enm_tower +
+         player.tower_height) >= maxTowerHeight) {
+        card_power += 9999;
+    }
+
+    return card_power;
+}
+
+ArcomageMove chooseArcomageMove(const ArcomageState &state, int player, ArcomageStrategy strategy, RandomEngine *rng) {
+    struct CardPower {
+        int slot;
+        int power;
+    };
+
+    int cardCount = state.handCardCount(player);
+    assert(cardCount > 0);
+
+    if (strategy == ARCOMAGE_STRATEGY_RANDOM) {
+        // Select card at random to play.
+        if (!state.needToDiscardCard) {
+            for (int i = 0; i < 10; ++i) {
+                int randomSlot = rng->randomInSegment(0, cardCount - 1);
+                if (state.canPlayCard(player, randomSlot))
+                    return {ARCOMAGE_MOVE_PLAY, randomSlot};
+            }
+        }
+
+        // If that fails discard card at random.
+        return {ARCOMAGE_MOVE_DISCARD, rng->randomInSegment(0, cardCount - 1)};
+    }
+
+    // Apply some cunning.
+    const ArcomagePlayer &self = state.players[player];
+    const ArcomagePlayer &enemy = state.players[(player + 1) % 2];
+    int mastery = std::to_underlying(strategy) - 1;
+
+    // Calculate how effective each card would be.
+    std::array<CardPower, HAND_SIZE> powers;
+    for (int i = 0; i < cardCount; ++i) {
+        int card = self.cards_at_hand[i];
+        powers[i].slot = i;
+        powers[i].power = card == -1 ? -9999 : calculateArcomageCardPower(self, enemy, pCards[card], mastery, state.rules.maxTowerHeight);
+    }
+
+    // Sort by power. Original code used a bubble sort here, which is stable.
+    std::stable_sort(powers.begin(), powers.begin() + cardCount, [](const CardPower &l, const CardPower &r) {
+        return l.power > r.power;
+    });
+
+    // If we have to discard pick a weak card to chuck. Note that this never considers the weakest card, this is how
+    // it worked in the original game.
+    int discardSlot = 0;
+    for (int i = cardCount - 1; i > 0; --i)
+        if (state.canDiscardCard(player, powers[i].slot))
+            discardSlot = powers[i].slot;
+
+    // Try and play most powerful card.
+    if (!state.needToDiscardCard)
+        for (int i = 0; i < cardCount - 1; ++i)
+            if (state.canPlayCard(player, powers[i].slot) && powers[i].power)
+                return {ARCOMAGE_MOVE_PLAY, powers[i].slot};
+
+    // Fall back - have to discard.
+    return {ARCOMAGE_MOVE_DISCARD, discardSlot};
+}
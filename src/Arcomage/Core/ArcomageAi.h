@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Utility/Segment.h"
+
+#include "ArcomageState.h"
+
+class RandomEngine;
+
+/**
+ * Arcomage opponent strategies. Values match the `mastery_lvl` of the tavern start conditions.
+ */
+enum class ArcomageStrategy {
+    ARCOMAGE_STRATEGY_RANDOM = 0, // Plays a random playable card.
+    ARCOMAGE_STRATEGY_BUILDER = 1, // Card power heuristic focused on growing own wall & tower.
+    ARCOMAGE_STRATEGY_ATTACKER = 2, // Card power heuristic focused on damaging the enemy & resource generation.
+
+    ARCOMAGE_STRATEGY_FIRST = ARCOMAGE_STRATEGY_RANDOM,
+    ARCOMAGE_STRATEGY_LAST = ARCOMAGE_STRATEGY_ATTACKER
+};
+using enum ArcomageStrategy;
+
+constexpr Segment<ArcomageStrategy> allArcomageStrategies() {
+    return {ARCOMAGE_STRATEGY_FIRST, ARCOMAGE_STRATEGY_LAST};
+}
+
+enum class ArcomageMoveType {
+    ARCOMAGE_MOVE_PLAY,
+    ARCOMAGE_MOVE_DISCARD
+};
+using enum ArcomageMoveType;
+
+struct ArcomageMove {
+    ArcomageMoveType type = ARCOMAGE_MOVE_DISCARD;
+    int slot = -1;
+};
+
+/**
+ * @param player                        Player to evaluate the card for.
+ * @param enemy                         Player's opponent.
+ * @param card                          Card to evaluate.
+ * @param mastery                       `0` for `ARCOMAGE_STRATEGY_BUILDER`, `1` for `ARCOMAGE_STRATEGY_ATTACKER`.
+ * @param maxTowerHeight                Tower height needed to win.
+ * @return                              Heuristic power of the card, higher is better.
+ */
+int calculateArcomageCardPower(const ArcomagePlayer &player, const ArcomagePlayer &enemy, const ArcomageCard &card,
+                               int mastery, int maxTowerHeight);
+
+/**
+ * Picks the next move for an AI player. Doesn't modify the state, and consumes random numbers exactly like the
+ * original game's opponent did.
+ *
+ * @param state                         Current game state.
+ * @param player                        Player to pick a move for. Must have at least one card in hand.
+ * @param strategy                      Strategy to use.
+ * @param rng                           Random engine to use.
+ * @return                              Move to make. Note that the move is not guaranteed to be valid, e.g. the
+ *                                      random strategy might try discarding a card that cannot be discarded.
+ */
+ArcomageMove chooseArcomageMove(const ArcomageState &state, int player, ArcomageStrategy strategy, RandomEngine *rng);
@@ -1,4 +1,4 @@
-#include "Arcomage.h"
+#include "ArcomageCard.h"
 
 ArcomageCard pCards[87]  =  {
     { .pCardName = "Brick Shortage", .slot = 0, .card_resource_type = 1, .to_pl_enm_bricks = -8},
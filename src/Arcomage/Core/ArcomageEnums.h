@@ -0,0 +1,25 @@
+#pragma once
+
+/**
+ * Arcomage taverns, in the same order as the `HOUSE_TAVERN_*` values from `HOUSE_FIRST_ARCOMAGE_TAVERN` to
+ * `HOUSE_LAST_ARCOMAGE_TAVERN`. The rules core doesn't depend on the GUI, so it can't use `HouseId` directly.
+ */
+enum class ArcomageTavern {
+    ARCOMAGE_TAVERN_HARMONDALE = 0,
+    ARCOMAGE_TAVERN_ERATHIA,
+    ARCOMAGE_TAVERN_TULAREAN_FOREST,
+    ARCOMAGE_TAVERN_DEYJA,
+    ARCOMAGE_TAVERN_BRACADA_DESERT,
+    ARCOMAGE_TAVERN_CELESTE,
+    ARCOMAGE_TAVERN_PIT,
+    ARCOMAGE_TAVERN_EVENMORN_ISLAND,
+    ARCOMAGE_TAVERN_MOUNT_NIGHON,
+    ARCOMAGE_TAVERN_BARROW_DOWNS,
+    ARCOMAGE_TAVERN_TATALIA,
+    ARCOMAGE_TAVERN_AVLEE,
+    ARCOMAGE_TAVERN_STONE_CITY,
+
+    ARCOMAGE_TAVERN_FIRST = ARCOMAGE_TAVERN_HARMONDALE,
+    ARCOMAGE_TAVERN_LAST = ARCOMAGE_TAVERN_STONE_CITY
+};
+using enum ArcomageTavern;
@@ -0,0 +1,207 @@
+#include "ArcomageSelfPlay.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+namespace {
+
+/** Max number of actions in a single turn, a player that makes more than that is considered stuck. */
+constexpr int MAX_ACTIONS_PER_TURN = 100;
+
+/** Number of games that a worker thread grabs at once. */
+constexpr int GAMES_PER_BATCH = 256;
+
+void refillHand(ArcomageState *state, int player, RandomEngine *rng) {
+    // In-game code draws another card each time the card drawing animation ends and there are not enough cards in
+    // hand, so we end up with one card over the minimum.
+    while (state->handCardCount(player) <= state->rules.minimumCardsAtHand)
+        state->drawCard(player, rng);
+}
+
+/**
+ * Headless version of the in-game `PlayerTurn`.
+ *
+ * @return                              Whether the player has more actions left.
+ */
+bool playActions(ArcomageState *state, ArcomageStrategy strategy, RandomEngine *rng, int *actionBudget) {
+    int player = state->currentPlayer;
+    state->numActionsLeft = 0;
+
+    while (true) {
+        if (--*actionBudget < 0)
+            return false;
+
+        if (state->handCardCount(player) > 0) {
+            ArcomageMove move = chooseArcomageMove(*state, player, strategy, rng);
+            if (move.type == ARCOMAGE_MOVE_PLAY && state->canPlayCard(player, move.slot)) {
+                int cardId = state->playCard(player, move.slot);
+                ArcomageCardEffects effects = state->applyCard(player, cardId);
+
+                bool drawn = false;
+                for (int i = 0; i < effects.extraDraws; i++)
+                    drawn |= state->drawCard(player, rng).slot != -1;
+                state->needToDiscardCard = state->handCardCount(player) > state->rules.minimumCardsAtHand;
+                if (drawn)
+                    refillHand(state, player, rng);
+            } else if (move.type == ARCOMAGE_MOVE_DISCARD && state->canDiscardCard(player, move.slot)) {
+                state->discardCard(player, move.slot);
+            }
+        }
+
+        if (state->numActionsLeft <= 1)
+            return state->numActionsLeft > 0;
+        --state->numActionsLeft;
+    }
+}
+
+/**
+ * Headless version of a single turn of the in-game `ArcomageGame::Loop`.
+ */
+void playTurn(ArcomageState *state, ArcomageStrategy strategy, RandomEngine *rng, int *actionBudget) {
+    int player = state->currentPlayer;
+    state->increaseResources(player);
+
+    bool turnNotFinished = true;
+    while (turnNotFinished && *actionBudget >= 0) {
+        if (state->drawCard(player, rng).slot != -1)
+            refillHand(state, player, rng);
+
+        while (true) {
+            turnNotFinished = playActions(state, strategy, rng, actionBudget);
+            if (state->handCardCount(player) <= state->rules.minimumCardsAtHand) {
+                state->needToDiscardCard = false;
+                break;
+            }
+            state->needToDiscardCard = true;
+            if (*actionBudget < 0)
+                break;
+        }
+    }
+}
+
+void accumulate(ArcomageMatchupStats *target, const ArcomageMatchupStats &source) {
+    target->games += source.games;
+    target->wins += source.wins;
+    target->losses += source.losses;
+    target->draws += source.draws;
+    target->aborted += source.aborted;
+    target->turns += source.turns;
+}
+
+} // namespace
+
+ArcomageGameOutcome playArcomageGame(ArcomageState *state, const std::array<ArcomageStrategy, 2> &strategies,
+                                     RandomEngine *rng, int maxTurns) {
+    ArcomageGameOutcome outcome;
+
+    state->shuffleDeck(rng);
+    for (int i = 0; i < state->rules.minimumCardsAtHand; i++)
+        state->drawCard((state->currentPlayer + 1) % 2, rng);
+
+    while (true) {
+        if (outcome.turns >= maxTurns) {
+            outcome.aborted = true;
+            break;
+        }
+        outcome.turns++;
+
+        int actionBudget = MAX_ACTIONS_PER_TURN;
+        playTurn(state, strategies[state->currentPlayer], rng, &actionBudget);
+        if (actionBudget < 0) {
+            outcome.aborted = true;
+            break;
+        }
+
+        if (state->isGameOver())
+            break;
+        state->changeTurn();
+    }
+
+    outcome.result = state->result();
+    return outcome;
+}
+
+int64_t ArcomageSelfPlayStats::totalGames() const {
+    int64_t result = 0;
+    for (const auto &row : matchups)
+        for (const ArcomageMatchupStats &stats : row)
+            result += stats.games;
+    return result;
+}
+
+double ArcomageSelfPlayStats::winRate(ArcomageStrategy strategy) const {
+    double points = 0;
+    int64_t games = 0;
+    for (ArcomageStrategy other : allArcomageStrategies()) {
+        const ArcomageMatchupStats &first = matchups[strategy][other];
+        const ArcomageMatchupStats &second = matchups[other][strategy];
+        points += first.wins + 0.5 * (first.draws + first.aborted);
+        points += second.losses + 0.5 * (second.draws + second.aborted);
+        games += first.games + second.games;
+    }
+    return games == 0 ? 0.0 : points / games;
+}
+
+ArcomageSelfPlayStats runArcomageSelfPlay(const ArcomageSelfPlayOptions &options) {
+    constexpr int strategyCount = allArcomageStrategies().size();
+    const int64_t totalGames = static_cast<int64_t>(strategyCount) * strategyCount * options.gamesPerMatchup;
+
+    ArcomageSelfPlayStats result;
+    std::mutex resultMutex;
+    std::atomic<int64_t> nextGame = 0;
+
+    auto worker = [&] {
+        ArcomageSelfPlayStats local;
+        MersenneTwisterRandomEngine rng;
+
+        while (true) {
+            int64_t batchStart = nextGame.fetch_add(GAMES_PER_BATCH);
+            if (batchStart >= totalGames)
+                break;
+
+            int64_t batchEnd = std::min(batchStart + GAMES_PER_BATCH, totalGames);
+            for (int64_t game = batchStart; game < batchEnd; game++) {
+                int64_t matchup = game / options.gamesPerMatchup;
+                ArcomageStrategy first = static_cast<ArcomageStrategy>(matchup / strategyCount);
+                ArcomageStrategy second = static_cast<ArcomageStrategy>(matchup % strategyCount);
+
+                rng.seed(static_cast<int>(options.seed + game));
+                ArcomageState state;
+                state.reset(options.conditions, 0);
+                ArcomageGameOutcome outcome = playArcomageGame(&state, {first, second}, &rng);
+
+                ArcomageMatchupStats &stats = local.matchups[first][second];
+                stats.games++;
+                stats.turns += outcome.turns;
+                if (outcome.aborted) {
+                    stats.aborted++;
+                } else if (outcome.result.winner == 1) {
+                    stats.wins++;
+                } else if (outcome.result.winner == 2) {
+                    stats.losses++;
+                } else {
+                    stats.draws++;
+                }
+            }
+        }
+
+        std::lock_guard lock(resultMutex);
+        for (ArcomageStrategy i : allArcomageStrategies())
+            for (ArcomageStrategy j : allArcomageStrategies())
+                accumulate(&result.matchups[i][j], local.matchups[i][j]);
+    };
+
+    int threadCount = options.threads > 0 ? options.threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++)
+        threads.emplace_back(worker);
+    for (std::thread &thread : threads)
+        thread.join();
+
+    return result;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Utility/IndexedArray.h"
+
+#include "ArcomageAi.h"
+#include "ArcomageState.h"
+
+class RandomEngine;
+
+struct ArcomageGameOutcome {
+    ArcomageResult result;
+    int turns = 0;
+    bool aborted = false; // Game hit the turn limit, or one of the players got stuck.
+};
+
+/**
+ * Plays a single arcomage game between two AI players, headlessly. Turn structure follows the in-game
+ * `ArcomageGame::Loop`, minus the animations.
+ *
+ * @param state                         Game state, as returned by `ArcomageState::reset`. Deck doesn't need to be
+ *                                      shuffled, this function will do that.
+ * @param strategies                    Strategies for the two players.
+ * @param rng                           Random engine to use.
+ * @param maxTurns                      Turn limit, the game is aborted if it's reached.
+ * @return                              Game outcome. Final state is left in `state`.
+ */
+ArcomageGameOutcome playArcomageGame(ArcomageState *state, const std::array<ArcomageStrategy, 2> &strategies,
+                                     RandomEngine *rng, int maxTurns = 10000);
+
+struct ArcomageSelfPlayOptions {
+    ArcomageStartConditions conditions = arcomageStartConditions[ARCOMAGE_TAVERN_FIRST];
+    int gamesPerMatchup = 1000; // Number of games for each ordered pair of strategies.
+    int threads = 0; // Number of worker threads, `0` means use hardware concurrency.
+    uint32_t seed = 1; // Game `i` is seeded with `seed + i`, so results don't depend on the number of threads.
+};
+
+struct ArcomageMatchupStats {
+    int64_t games = 0;
+    int64_t wins = 0; // Wins of the first player.
+    int64_t losses = 0;
+    int64_t draws = 0;
+    int64_t aborted = 0;
+    int64_t turns = 0;
+};
+
+struct ArcomageSelfPlayStats {
+    /** Stats indexed by [first player strategy][second player strategy]. */
+    IndexedArray<IndexedArray<ArcomageMatchupStats, ARCOMAGE_STRATEGY_FIRST, ARCOMAGE_STRATEGY_LAST>, ARCOMAGE_STRATEGY_FIRST, ARCOMAGE_STRATEGY_LAST> matchups = {{}};
+
+    [[nodiscard]] int64_t totalGames() const;
+
+    /**
+     * @return                          Win rate of the provided strategy over all of its games, on both seats.
+     *                                  Draws and aborted games count as half a win.
+     */
+    [[nodiscard]] double winRate(ArcomageStrategy strategy) const;
+};
+
+/**
+ * Runs a batch of headless self-play games for every ordered pair of AI strategies on a pool of worker threads.
+ * Results are fully deterministic for the given options.
+ */
+ArcomageSelfPlayStats runArcomageSelfPlay(const ArcomageSelfPlayOptions &options);
@@ -0,0 +1,485 @@
+#include "ArcomageState.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "Library/Random/RandomEngine.h"
+
+const IndexedArray<ArcomageStartConditions, ARCOMAGE_TAVERN_FIRST, ARCOMAGE_TAVERN_LAST> arcomageStartConditions = {
+    {ARCOMAGE_TAVERN_HARMONDALE,       {30, 100, 15, 5, 2, 2, 2, 10, 10, 10, 0}},
+    {ARCOMAGE_TAVERN_ERATHIA,          {50, 150, 20, 5, 2, 2, 2, 5, 5, 5, 1}},
+    {ARCOMAGE_TAVERN_TULAREAN_FOREST,  {50, 150, 20, 5, 2, 2, 2, 5, 5, 5, 2}},
+    {ARCOMAGE_TAVERN_DEYJA,            {75, 200, 25, 10, 3, 3, 3, 5, 5, 5, 2}},
+    {ARCOMAGE_TAVERN_BRACADA_DESERT,   {75, 200, 20, 10, 3, 3, 3, 5, 5, 5, 1}},
+    {ARCOMAGE_TAVERN_CELESTE,          {100, 300, 30, 15, 4, 4, 4, 10, 10, 10, 1}},
+    {ARCOMAGE_TAVERN_PIT,              {100, 300, 30, 15, 4, 4, 4, 10, 10, 10, 2}},
+    {ARCOMAGE_TAVERN_EVENMORN_ISLAND,  {150, 400, 20, 10, 5, 5, 5, 25, 25, 25, 0}},
+    {ARCOMAGE_TAVERN_MOUNT_NIGHON,     {200, 500, 20, 10, 1, 1, 1, 15, 15, 15, 2}},
+    {ARCOMAGE_TAVERN_BARROW_DOWNS,     {100, 300, 20, 50, 1, 1, 5, 5, 5, 25, 0}},
+    {ARCOMAGE_TAVERN_TATALIA,          {125, 350, 10, 20, 3, 1, 2, 15, 5, 10, 2}},
+    {ARCOMAGE_TAVERN_AVLEE,            {125, 350, 10, 20, 3, 1, 2, 15, 5, 10, 1}},
+    {ARCOMAGE_TAVERN_STONE_CITY,       {100, 300, 50, 50, 5, 3, 5, 20, 10, 20, 0}}
+};
+
+namespace {
+
+/**
+ * One of the two effect blocks of an arcomage card, the one that's used is chosen based on `compare_param`.
+ */
+struct CardEffect {
+    struct Values {
+        int quarry;
+        int magic;
+        int zoo;
+        int bricks;
+        int gems;
+        int beasts;
+        int buildings;
+        int wall;
+        int tower;
+    };
+
+    int playAgain;
+    int drawCards;
+    Values toPlayer;
+    Values toEnemy;
+    Values toBoth;
+};
+
+CardEffect primaryEffect(const ArcomageCard &card) {
+    return {
+        .playAgain = card.field_30,
+        .drawCards = card.draw_extra_card_count,
+        .toPlayer = {card.to_player_quarry_lvl, card.to_player_magic_lvl, card.to_player_zoo_lvl, card.to_player_bricks,
+                     card.to_player_gems, card.to_player_beasts, card.to_player_buildings, card.to_player_wall,
+                     card.to_player_tower},
+        .toEnemy = {card.to_enemy_quarry_lvl, card.to_enemy_magic_lvl, card.to_enemy_zoo_lvl, card.to_enemy_bricks,
+                    card.to_enemy_gems, card.to_enemy_beasts, card.to_enemy_buildings, card.to_enemy_wall,
+                    card.to_enemy_tower},
+        .toBoth = {card.to_pl_enm_quarry_lvl, card.to_pl_enm_magic_lvl, card.to_pl_enm_zoo_lvl, card.to_pl_enm_bricks,
+                   card.to_pl_enm_gems, card.to_pl_enm_beasts, card.to_pl_enm_buildings, card.to_pl_enm_wall,
+                   card.to_pl_enm_tower}
+    };
+}
+
+CardEffect secondaryEffect(const ArcomageCard &card) {
+    return {
+        .playAgain = card.field_4D,
+        .drawCards = card.can_draw_extra_card2,
+        .toPlayer = {card.to_player_quarry_lvl2, card.to_player_magic_lvl2, card.to_player_zoo_lvl2, card.to_player_bricks2,
+                     card.to_player_gems2, card.to_player_beasts2, card.to_player_buildings2, card.to_player_wall2,
+                     card.to_player_tower2},
+        .toEnemy = {card.to_enemy_quarry_lvl2, card.to_enemy_magic_lvl2, card.to_enemy_zoo_lvl2, card.to_enemy_bricks2,
+                    card.to_enemy_gems2, card.to_enemy_beasts2, card.to_enemy_buildings2, card.to_enemy_wall2,
+                    card.to_enemy_tower2},
+        .toBoth = {card.to_pl_enm_quarry_lvl2, card.to_pl_enm_magic_lvl2, card.to_pl_enm_zoo_lvl2, card.to_pl_enm_bricks2,
+                   card.to_pl_enm_gems2, card.to_pl_enm_beasts2, card.to_pl_enm_buildings2, card.to_pl_enm_wall2,
+                   card.to_pl_enm_tower2}
+    };
+}
+
+bool checkCondition(ArcomageCheck check, const ArcomagePlayer &player, const ArcomagePlayer &enemy) {
+    switch (check) {
+    case CHECK_ALWAYS_SECONDARY: return false;
+    case CHECK_LESSER_QUARRY: return player.quarry_level < enemy.quarry_level; // Mother Lode & Copping the Tech.
+    case CHECK_LESSER_MAGIC: return player.magic_level < enemy.magic_level; // Parity.
+    case CHECK_LESSER_ZOO: return player.zoo_level < enemy.zoo_level;
+    case CHECK_EQUAL_QUARRY: return player.quarry_level == enemy.quarry_level;
+    case CHECK_EQUAL_MAGIC: return player.magic_level == enemy.magic_level;
+    case CHECK_EQUAL_ZOO: return player.zoo_level == enemy.zoo_level;
+    case CHECK_GREATER_QUARRY: return player.quarry_level > enemy.quarry_level;
+    case CHECK_GREATER_MAGIC: return player.magic_level > enemy.magic_level; // Unicorn.
+    case CHECK_GREATER_ZOO: return player.zoo_level > enemy.zoo_level;
+    case CHECK_NO_WALL: return !player.wall_height; // Foundations.
+    case CHECK_HAVE_WALL: return player.wall_height;
+    case CHECK_ENEMY_HAS_NO_WALL: return !enemy.wall_height; // Spizzer.
+    case CHECK_ENEMY_HAS_WALL: return enemy.wall_height; // Corrosion Cloud.
+    case CHECK_LESSER_WALL: return player.wall_height < enemy.wall_height;
+    case CHECK_LESSER_TOWER: return player.tower_height < enemy.tower_height;
+    case CHECK_EQUAL_WALL: return player.wall_height == enemy.wall_height;
+    case CHECK_EQUAL_TOWER: return player.tower_height == enemy.tower_height;
+    case CHECK_GREATER_WALL: return player.wall_height > enemy.wall_height; // Elven Archers.
+    case CHECK_GREATER_TOWER: return player.tower_height > enemy.tower_height;
+    default: return true;
+    }
+}
+
+// Note that the result is always zero when value is 99, this is how it worked in the original game.
+void applyToPlayer(ArcomagePlayer *player, ArcomagePlayer *enemy, int ArcomagePlayer::*field, int value, int *result) {
+    if (value == 0)
+        return;
+
+    if (value == 99) {
+        if (player->*field < enemy->*field) {
+            player->*field = enemy->*field;
+            *result = enemy->*field - player->*field;
+        }
+    } else {
+        player->*field += value;
+        if (player->*field < 0)
+            player->*field = 0;
+        *result = value;
+    }
+}
+
+void applyToBoth(ArcomagePlayer *player, ArcomagePlayer *enemy, int ArcomagePlayer::*field, int value, int *playerResult, int *enemyResult) {
+    if (value == 0)
+        return;
+
+    if (value == 99) {
+        if (player->*field != enemy->*field) {
+            if (player->*field <= enemy->*field) {
+                player->*field = enemy->*field;
+                *playerResult = enemy->*field - player->*field;
+            } else {
+                enemy->*field = player->*field;
+                *enemyResult = player->*field - enemy->*field;
+            }
+        }
+    } else {
+        player->*field += value;
+        enemy->*field += value;
+        if (player->*field < 0)
+            player->*field = 0;
+        if (enemy->*field < 0)
+            enemy->*field = 0;
+        *playerResult = value;
+        *enemyResult = value;
+    }
+}
+
+int maxResource(const ArcomagePlayer &player) {
+    if (player.resource_gems > player.resource_bricks && player.resource_gems > player.resource_beasts)
+        return player.resource_gems;
+    if (player.resource_beasts > player.resource_gems && player.resource_beasts > player.resource_bricks)
+        return player.resource_beasts;
+    return player.resource_bricks;
+}
+
+} // namespace
+
+void ArcomageState::reset(const ArcomageStartConditions &conditions, int firstPlayer) {
+    assert(firstPlayer == 0 || firstPlayer == 1);
+
+    rules = ArcomageRules();
+    rules.maxTowerHeight = conditions.max_tower;
+    rules.maxResourcesAmount = conditions.max_resources;
+
+    for (ArcomagePlayer &player : players) {
+        player.tower_height = conditions.tower_height;
+        player.wall_height = conditions.wall_height;
+        player.quarry_level = conditions.quarry_level - 1;
+        player.magic_level = conditions.magic_level - 1;
+        player.zoo_level = conditions.zoo_level - 1;
+        player.resource_bricks = conditions.bricks_amount;
+        player.resource_gems = conditions.gems_amount;
+        player.resource_beasts = conditions.beasts_amount;
+        for (int &card : player.cards_at_hand)
+            card = -1;
+    }
+
+    // Some of the cards are present in the deck twice.
+    for (int i = 0, cardDispenserCounter = -2, cardId = 0; i < DECK_SIZE; ++i, ++cardDispenserCounter) {
+        masterDeck.cardsInUse[i] = 0;
+        masterDeck.cards_IDs[i] = cardId;
+        switch (cardDispenserCounter) {
+        case 0: case 2: case 6: case 9: case 13: case 18: case 23: case 33: case 36: case 38: case 44:
+        case 46: case 52: case 57: case 69: case 71: case 75: case 79: case 81: case 84: case 89:
+            break;
+        default:
+            ++cardId;
+        }
+    }
+
+    playDeck = ArcomageDeck();
+    deckWalkIndex = 0;
+    currentPlayer = firstPlayer;
+    needToDiscardCard = false;
+    numActionsLeft = 0;
+    numCardsToDiscard = 0;
+}
+
+void ArcomageState::shuffleDeck(RandomEngine *rng) {
+    char cardTakenFlags[DECK_SIZE];
+
+    memset(masterDeck.cardsInUse, 0, DECK_SIZE);
+    memset(cardTakenFlags, 0, DECK_SIZE);
+
+    // Mark which cards are already in players hands.
+    for (const ArcomagePlayer &player : players) {
+        for (int card : player.cards_at_hand) {
+            if (card <= -1)
+                continue;
+
+            for (int m = 0; m < DECK_SIZE; ++m) {
+                if (masterDeck.cards_IDs[m] == card && masterDeck.cardsInUse[m] == 0) {
+                    masterDeck.cardsInUse[m] = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < DECK_SIZE; ++i) {
+        int randomDeckPos;
+        do {
+            randomDeckPos = rng->random(DECK_SIZE);
+        } while (cardTakenFlags[randomDeckPos] == 1);
+
+        cardTakenFlags[randomDeckPos] = 1;
+        playDeck.cards_IDs[i] = masterDeck.cards_IDs[randomDeckPos];
+        playDeck.cardsInUse[i] = masterDeck.cardsInUse[randomDeckPos];
+    }
+
+    deckWalkIndex = 0;
+}
+
+ArcomageDraw ArcomageState::drawCard(int player, RandomEngine *rng) {
+    ArcomageDraw result;
+
+    while (true) {
+        if (deckWalkIndex >= DECK_SIZE) {
+            shuffleDeck(rng);
+            result.reshuffled = true;
+        }
+
+        int deckIndex = deckWalkIndex++;
+        if (!playDeck.cardsInUse[deckIndex]) {
+            result.cardId = playDeck.cards_IDs[deckIndex];
+            break;
+        }
+    }
+
+    result.slot = emptyCardSlot(player);
+    if (result.slot != -1)
+        players[player].cards_at_hand[result.slot] = result.cardId;
+    return result;
+}
+
+int ArcomageState::handCardCount(int player) const {
+    int result = 0;
+    for (int card : players[player].cards_at_hand)
+        if (card != -1)
+            result++;
+    return result;
+}
+
+int ArcomageState::emptyCardSlot(int player) const {
+    for (int i = 0; i < HAND_SIZE; ++i)
+        if (players[player].cards_at_hand[i] == -1)
+            return i;
+    return -1;
+}
+
+void ArcomageState::increaseResources(int player) {
+    ArcomagePlayer &p = players[player];
+    p.resource_bricks += rules.quarryBonus + p.quarry_level;
+    p.resource_gems += rules.magicBonus + p.magic_level;
+    p.resource_beasts += rules.zooBonus + p.zoo_level;
+}
+
+bool ArcomageState::canPlayCard(int player, int slot) const {
+    const ArcomagePlayer &p = players[player];
+    if (slot < 0 || p.cards_at_hand[slot] == -1)
+        return false;
+
+    const ArcomageCard &card = pCards[p.cards_at_hand[slot]];
+    return card.needed_quarry_level <= p.quarry_level &&
+           card.needed_magic_level <= p.magic_level &&
+           card.needed_zoo_level <= p.zoo_level &&
+           card.needed_bricks <= p.resource_bricks &&
+           card.needed_gems <= p.resource_gems &&
+           card.needed_beasts <= p.resource_beasts;
+}
+
+bool ArcomageState::canDiscardCard(int player, int slot) const {
+    const ArcomagePlayer &p = players[player];
+    if (slot < 0 || p.cards_at_hand[slot] == -1)
+        return false;
+
+    return pCards[p.cards_at_hand[slot]].can_be_discarded;
+}
+
+int ArcomageState::playCard(int player, int slot) {
+    assert(canPlayCard(player, slot));
+
+    ArcomagePlayer &p = players[player];
+    int cardId = p.cards_at_hand[slot];
+    const ArcomageCard &card = pCards[cardId];
+    p.resource_bricks -= card.needed_bricks;
+    p.resource_beasts -= card.needed_beasts;
+    p.resource_gems -= card.needed_gems;
+    p.cards_at_hand[slot] = -1;
+    return cardId;
+}
+
+int ArcomageState::discardCard(int player, int slot) {
+    assert(canDiscardCard(player, slot));
+
+    int cardId = players[player].cards_at_hand[slot];
+    players[player].cards_at_hand[slot] = -1;
+    needToDiscardCard = false;
+    return cardId;
+}
+
+ArcomageCardEffects ArcomageState::applyCard(int player, int cardId) {
+    int enemyNum = (player + 1) % 2;
+    ArcomagePlayer *p = &players[player];
+    ArcomagePlayer *e = &players[enemyNum];
+    const ArcomageCard &card = pCards[cardId];
+
+    CardEffect effect = checkCondition(card.compare_param, *p, *e) ? primaryEffect(card) : secondaryEffect(card);
+
+    ArcomageCardEffects result;
+    ArcomagePlayerEffects &rp = result.player;
+    ArcomagePlayerEffects &re = result.enemy;
+
+    result.extraDraws = effect.drawCards;
+    numActionsLeft = effect.drawCards + (effect.playAgain == 1);
+    numCardsToDiscard = effect.drawCards;
+
+    applyToPlayer(p, e, &ArcomagePlayer::quarry_level, effect.toPlayer.quarry, &rp.quarry);
+    applyToPlayer(p, e, &ArcomagePlayer::magic_level, effect.toPlayer.magic, &rp.magic);
+    applyToPlayer(p, e, &ArcomagePlayer::zoo_level, effect.toPlayer.zoo, &rp.zoo);
+    applyToPlayer(p, e, &ArcomagePlayer::resource_bricks, effect.toPlayer.bricks, &rp.bricks);
+    applyToPlayer(p, e, &ArcomagePlayer::resource_gems, effect.toPlayer.gems, &rp.gems);
+    applyToPlayer(p, e, &ArcomagePlayer::resource_beasts, effect.toPlayer.beasts, &rp.beasts);
+    if (effect.toPlayer.buildings) {
+        rp.damage = applyDamageToBuildings(player, effect.toPlayer.buildings);
+        rp.buildings = effect.toPlayer.buildings - rp.damage;
+    }
+    applyToPlayer(p, e, &ArcomagePlayer::wall_height, effect.toPlayer.wall, &rp.wall);
+    applyToPlayer(p, e, &ArcomagePlayer::tower_height, effect.toPlayer.tower, &rp.tower);
+
+    applyToPlayer(e, p, &ArcomagePlayer::quarry_level, effect.toEnemy.quarry, &re.quarry);
+    applyToPlayer(e, p, &ArcomagePlayer::magic_level, effect.toEnemy.magic, &re.magic);
+    applyToPlayer(e, p, &ArcomagePlayer::zoo_level, effect.toEnemy.zoo, &re.zoo);
+    applyToPlayer(e, p, &ArcomagePlayer::resource_bricks, effect.toEnemy.bricks, &re.bricks);
+    applyToPlayer(e, p, &ArcomagePlayer::resource_gems, effect.toEnemy.gems, &re.gems);
+    applyToPlayer(e, p, &ArcomagePlayer::resource_beasts, effect.toEnemy.beasts, &re.beasts);
+    if (effect.toEnemy.buildings) {
+        re.damage = applyDamageToBuildings(enemyNum, effect.toEnemy.buildings);
+        re.buildings = effect.toEnemy.buildings - re.damage;
+    }
+    applyToPlayer(e, p, &ArcomagePlayer::wall_height, effect.toEnemy.wall, &re.wall);
+    applyToPlayer(e, p, &ArcomagePlayer::tower_height, effect.toEnemy.tower, &re.tower);
+
+    applyToBoth(p, e, &ArcomagePlayer::quarry_level, effect.toBoth.quarry, &rp.quarry, &re.quarry);
+    applyToBoth(p, e, &ArcomagePlayer::magic_level, effect.toBoth.magic, &rp.magic, &re.magic);
+    applyToBoth(p, e, &ArcomagePlayer::zoo_level, effect.toBoth.zoo, &rp.zoo, &re.zoo);
+    applyToBoth(p, e, &ArcomagePlayer::resource_bricks, effect.toBoth.bricks, &rp.bricks, &re.bricks);
+    applyToBoth(p, e, &ArcomagePlayer::resource_gems, effect.toBoth.gems, &rp.gems, &re.gems);
+    applyToBoth(p, e, &ArcomagePlayer::resource_beasts, effect.toBoth.beasts, &rp.beasts, &re.beasts);
+    if (effect.toBoth.buildings) {
+        rp.damage = applyDamageToBuildings(player, effect.toBoth.buildings);
+        re.damage = applyDamageToBuildings(enemyNum, effect.toBoth.buildings);
+        rp.buildings = effect.toBoth.buildings - rp.damage;
+        re.buildings = effect.toBoth.buildings - re.damage;
+    }
+    applyToBoth(p, e, &ArcomagePlayer::wall_height, effect.toBoth.wall, &rp.wall, &re.wall);
+    applyToBoth(p, e, &ArcomagePlayer::tower_height, effect.toBoth.tower, &rp.tower, &re.tower);
+
+    return result;
+}
+
+int ArcomageState::applyDamageToBuildings(int player, int damage) {
+    ArcomagePlayer &p = players[player];
+    int wall = p.wall_height;
+    int result = 0;
+
+    if (wall >= -damage) { // Wall absorbs all damage.
+        result = damage;
+        p.wall_height += damage;
+    } else {
+        damage += wall; // Reduce damage by size of wall.
+        p.wall_height = 0;
+        result = -wall;
+        p.tower_height += damage; // Apply remaining to tower.
+    }
+
+    if (p.tower_height < 0)
+        p.tower_height = 0;
+
+    return result;
+}
+
+void ArcomageState::changeTurn() {
+    currentPlayer = (currentPlayer + 1) % 2;
+}
+
+bool ArcomageState::isGameOver() const {
+    for (const ArcomagePlayer &player : players) {
+        if (player.tower_height <= 0)
+            return true;
+        if (player.tower_height >= rules.maxTowerHeight)
+            return true;
+        if (player.resource_bricks >= rules.maxResourcesAmount ||
+            player.resource_gems >= rules.maxResourcesAmount ||
+            player.resource_beasts >= rules.maxResourcesAmount)
+            return true;
+    }
+    return false;
+}
+
+ArcomageResult ArcomageState::result() const {
+    const ArcomagePlayer &p0 = players[0];
+    const ArcomagePlayer &p1 = players[1];
+    int maxTower = rules.maxTowerHeight;
+    int maxResources = rules.maxResourcesAmount;
+    ArcomageResult result;
+
+    // Check whether a tower was built.
+    if (p0.tower_height < maxTower && p1.tower_height >= maxTower) {
+        result = {2, 0};
+    } else if (p0.tower_height >= maxTower && p1.tower_height < maxTower) {
+        result = {1, 0};
+    } else if (p0.tower_height >= maxTower && p1.tower_height >= maxTower) {
+        if (p0.tower_height == p1.tower_height) {
+            result = {0, 4}; // Draw.
+        } else {
+            result = {(p0.tower_height <= p1.tower_height) + 1, 0}; // Higher tower wins.
+        }
+    }
+
+    // Check whether a tower was destroyed.
+    if (p0.tower_height <= 0 && p1.tower_height > 0) {
+        result = {2, 2};
+    } else if (p0.tower_height > 0 && p1.tower_height <= 0) {
+        result = {1, 2};
+    } else if (p0.tower_height <= 0 && p1.tower_height <= 0) {
+        if (p0.tower_height == p1.tower_height) {
+            if (p0.wall_height == p1.wall_height) {
+                result = {0, 4};
+            } else {
+                result = {(p0.wall_height <= p1.wall_height) + 1, 1}; // Higher wall wins.
+            }
+        } else {
+            result = {(p0.tower_height <= p1.tower_height) + 1, 2};
+        }
+    }
+
+    // Check whether resources were accumulated.
+    int p0Resource = maxResource(p0);
+    int p1Resource = maxResource(p1);
+    if (result.winner == -1 && result.victoryType == -1) {
+        if (p0Resource < maxResources && p1Resource >= maxResources) {
+            result = {2, 3};
+        } else if (p0Resource >= maxResources && p1Resource < maxResources) {
+            result = {1, 3};
+        } else if (p0Resource >= maxResources && p1Resource >= maxResources) {
+            if (p0Resource == p1Resource) {
+                result = {0, 4};
+            } else {
+                result = {(p0Resource <= p1Resource) + 1, 3};
+            }
+        }
+    } else if (result.winner == 0 && result.victoryType == 4) {
+        if (p0Resource != p1Resource) {
+            result = {(p0Resource <= p1Resource) + 1, 5}; // Draw on towers & walls, more resources wins.
+        } else {
+            result = {0, 4};
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Utility/IndexedArray.h"
+
+#include "ArcomageCard.h"
+#include "ArcomageEnums.h"
+
+class RandomEngine;
+
+constexpr int DECK_SIZE = 108;
+constexpr int HAND_SIZE = 10;
+
+/**
+ * Start & win conditions for a single arcomage tavern.
+ */
+struct ArcomageStartConditions {
+    int16_t max_tower;
+    int16_t max_resources;
+    int16_t tower_height;
+    int16_t wall_height;
+    int16_t quarry_level;
+    int16_t magic_level;
+    int16_t zoo_level;
+    int16_t bricks_amount;
+    int16_t gems_amount;
+    int16_t beasts_amount;
+    int mastery_lvl;
+};
+
+extern const IndexedArray<ArcomageStartConditions, ARCOMAGE_TAVERN_FIRST, ARCOMAGE_TAVERN_LAST> arcomageStartConditions;
+
+struct ArcomagePlayer {
+    int tower_height = 0;
+    int wall_height = 0;
+    int quarry_level = 0;
+    int magic_level = 0;
+    int zoo_level = 0;
+    int resource_bricks = 0;
+    int resource_gems = 0;
+    int resource_beasts = 0;
+    int cards_at_hand[HAND_SIZE] {};
+};
+
+struct ArcomageDeck {
+    char cardsInUse[DECK_SIZE] {};
+    int cards_IDs[DECK_SIZE] {};
+};
+
+/**
+ * Game rules that stay constant for the duration of a single game.
+ */
+struct ArcomageRules {
+    int maxTowerHeight = 50;
+    int maxResourcesAmount = 100;
+    int minimumCardsAtHand = 5;
+    int quarryBonus = 1; // Acts as effective min level.
+    int magicBonus = 1;
+    int zooBonus = 1;
+};
+
+/**
+ * Result of drawing a card from the deck.
+ */
+struct ArcomageDraw {
+    int cardId = -1;
+    int slot = -1; // Hand slot the card went into, `-1` if the hand was full and the card was lost.
+    bool reshuffled = false; // Whether the deck had to be reshuffled before drawing.
+};
+
+/**
+ * Changes that a played card has made to a single player. Zero means the corresponding value wasn't changed.
+ * These are only used by the UI to play sounds and draw sparks.
+ */
+struct ArcomagePlayerEffects {
+    int quarry = 0;
+    int magic = 0;
+    int zoo = 0;
+    int bricks = 0;
+    int gems = 0;
+    int beasts = 0;
+    int wall = 0;
+    int tower = 0;
+    int buildings = 0; // Building damage that went into the tower.
+    int damage = 0; // Building damage that went into the wall.
+};
+
+struct ArcomageCardEffects {
+    int extraDraws = 0; // Number of cards that the player should draw after the card is applied.
+    ArcomagePlayerEffects player;
+    ArcomagePlayerEffects enemy;
+};
+
+struct ArcomageResult {
+    int winner = -1; // `1` or `2` for the winning player, `0` for a draw, `-1` if there is no winner yet.
+    int victoryType = -1;
+};
+
+/**
+ * Full state of an arcomage game, with no rendering, sound or global state attached. This struct is trivially
+ * copyable, so it can be cloned for search or simulated on any thread.
+ *
+ * Methods that need randomness take a `RandomEngine` explicitly and consume random numbers in exactly the same
+ * order as the original in-game code, so that the same core can drive both the in-game mode and the headless
+ * simulation without breaking recorded traces.
+ */
+struct ArcomageState {
+    ArcomageRules rules;
+    ArcomagePlayer players[2];
+    ArcomageDeck masterDeck;
+    ArcomageDeck playDeck;
+    int deckWalkIndex = 0;
+    int currentPlayer = 0;
+    bool needToDiscardCard = false;
+    int numActionsLeft = 0;
+    int numCardsToDiscard = 0;
+
+    /**
+     * Sets up the players and the master deck for a new game. Doesn't shuffle the deck, call `shuffleDeck` for that.
+     *
+     * @param conditions                Start conditions for the tavern.
+     * @param firstPlayer               Index of the player that makes the first turn.
+     */
+    void reset(const ArcomageStartConditions &conditions, int firstPlayer);
+
+    /**
+     * Reshuffles the play deck, marking the cards that are currently in the players' hands as used.
+     */
+    void shuffleDeck(RandomEngine *rng);
+
+    /**
+     * Draws the next card from the play deck into the player's hand, reshuffling the deck if it's exhausted.
+     */
+    ArcomageDraw drawCard(int player, RandomEngine *rng);
+
+    [[nodiscard]] int handCardCount(int player) const;
+    [[nodiscard]] int emptyCardSlot(int player) const;
+
+    void increaseResources(int player);
+
+    [[nodiscard]] bool canPlayCard(int player, int slot) const;
+    [[nodiscard]] bool canDiscardCard(int player, int slot) const;
+
+    /**
+     * Pays the card's cost and removes it from the player's hand. Card effects are applied separately through
+     * `applyCard`.
+     *
+     * @return                          Id of the played card.
+     */
+    int playCard(int player, int slot);
+
+    /**
+     * @return                          Id of the discarded card.
+     */
+    int discardCard(int player, int slot);
+
+    /**
+     * Applies the effects of a played card and updates `numActionsLeft` & `numCardsToDiscard`. Doesn't draw the
+     * extra cards, the caller is expected to draw `extraDraws` cards and then update `needToDiscardCard`.
+     *
+     * @param player                    Player who has played the card.
+     * @param cardId                    Id of the card.
+     */
+    ArcomageCardEffects applyCard(int player, int cardId);
+
+    /**
+     * @return                          Part of the damage that was absorbed by the wall.
+     */
+    int applyDamageToBuildings(int player, int damage);
+
+    void changeTurn();
+
+    [[nodiscard]] bool isGameOver() const;
+    [[nodiscard]] ArcomageResult result() const;
+};
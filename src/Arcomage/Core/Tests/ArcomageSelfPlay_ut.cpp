@@ -0,0 +1,48 @@
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+#include "Arcomage/Core/ArcomageSelfPlay.h"
+
+UNIT_TEST(ArcomageSelfPlay, SingleGame) {
+    for (ArcomageStrategy strategy : allArcomageStrategies()) {
+        MersenneTwisterRandomEngine rng;
+        rng.seed(123);
+
+        ArcomageState state;
+        state.reset(arcomageStartConditions[ARCOMAGE_TAVERN_HARMONDALE], 0);
+        ArcomageGameOutcome outcome = playArcomageGame(&state, {strategy, strategy}, &rng);
+
+        EXPECT_FALSE(outcome.aborted);
+        EXPECT_GT(outcome.turns, 0);
+        EXPECT_TRUE(state.isGameOver());
+        EXPECT_NE(outcome.result.winner, -1);
+    }
+}
+
+UNIT_TEST(ArcomageSelfPlay, Deterministic) {
+    ArcomageSelfPlayOptions options;
+    options.gamesPerMatchup = 100;
+    options.seed = 42;
+
+    options.threads = 1;
+    ArcomageSelfPlayStats stats1 = runArcomageSelfPlay(options);
+    options.threads = 4;
+    ArcomageSelfPlayStats stats4 = runArcomageSelfPlay(options);
+
+    EXPECT_EQ(stats1.totalGames(), 900);
+    EXPECT_EQ(stats4.totalGames(), 900);
+    for (ArcomageStrategy i : allArcomageStrategies()) {
+        for (ArcomageStrategy j : allArcomageStrategies()) {
+            const ArcomageMatchupStats &a = stats1.matchups[i][j];
+            const ArcomageMatchupStats &b = stats4.matchups[i][j];
+            EXPECT_EQ(a.games, 100);
+            EXPECT_EQ(a.wins + a.losses + a.draws + a.aborted, a.games);
+            EXPECT_EQ(a.wins, b.wins);
+            EXPECT_EQ(a.losses, b.losses);
+            EXPECT_EQ(a.draws, b.draws);
+            EXPECT_EQ(a.aborted, b.aborted);
+            EXPECT_EQ(a.turns, b.turns);
+        }
+    }
+}
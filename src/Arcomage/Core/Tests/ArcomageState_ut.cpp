@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <map>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+
+#include "Arcomage/Core/ArcomageState.h"
+
+UNIT_TEST(ArcomageState, Reset) {
+    const ArcomageStartConditions &conditions = arcomageStartConditions[ARCOMAGE_TAVERN_HARMONDALE];
+
+    ArcomageState state;
+    state.reset(conditions, 1);
+
+    EXPECT_EQ(state.currentPlayer, 1);
+    EXPECT_EQ(state.rules.maxTowerHeight, conditions.max_tower);
+    EXPECT_EQ(state.rules.maxResourcesAmount, conditions.max_resources);
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(state.players[i].tower_height, conditions.tower_height);
+        EXPECT_EQ(state.players[i].quarry_level, conditions.quarry_level - 1);
+        EXPECT_EQ(state.handCardCount(i), 0);
+        EXPECT_EQ(state.emptyCardSlot(i), 0);
+    }
+
+    // 87 cards, 21 of them are in the deck twice.
+    std::map<int, int> counts;
+    for (int cardId : state.masterDeck.cards_IDs)
+        counts[cardId]++;
+    EXPECT_EQ(counts.size(), 87);
+    EXPECT_EQ(std::count_if(counts.begin(), counts.end(), [](const auto &pair) { return pair.second == 2; }), 21);
+}
+
+UNIT_TEST(ArcomageState, DrawAndReshuffle) {
+    MersenneTwisterRandomEngine rng;
+    ArcomageState state;
+    state.reset(arcomageStartConditions[ARCOMAGE_TAVERN_HARMONDALE], 0);
+    state.shuffleDeck(&rng);
+
+    for (int i = 0; i < HAND_SIZE; i++) {
+        ArcomageDraw draw = state.drawCard(0, &rng);
+        EXPECT_EQ(draw.slot, i);
+        EXPECT_FALSE(draw.reshuffled);
+    }
+    EXPECT_EQ(state.handCardCount(0), HAND_SIZE);
+    EXPECT_EQ(state.drawCard(0, &rng).slot, -1); // Hand is full, card is lost.
+
+    // Walk through the rest of the deck, next draw should reshuffle it, marking the cards in hands as used.
+    while (state.deckWalkIndex < DECK_SIZE)
+        state.drawCard(1, &rng);
+    EXPECT_EQ(state.handCardCount(1), HAND_SIZE);
+    ArcomageDraw draw = state.drawCard(1, &rng);
+    EXPECT_TRUE(draw.reshuffled);
+    EXPECT_EQ(draw.slot, -1);
+
+    int inUse = 0;
+    for (char used : state.playDeck.cardsInUse)
+        inUse += used;
+    EXPECT_EQ(inUse, 2 * HAND_SIZE);
+}
+
+UNIT_TEST(ArcomageState, DamageToBuildings) {
+    ArcomageState state;
+    state.reset(arcomageStartConditions[ARCOMAGE_TAVERN_HARMONDALE], 0);
+    state.players[0].wall_height = 5;
+    state.players[0].tower_height = 15;
+
+    EXPECT_EQ(state.applyDamageToBuildings(0, -3), -3);
+    EXPECT_EQ(state.players[0].wall_height, 2);
+    EXPECT_EQ(state.players[0].tower_height, 15);
+
+    EXPECT_EQ(state.applyDamageToBuildings(0, -10), -2);
+    EXPECT_EQ(state.players[0].wall_height, 0);
+    EXPECT_EQ(state.players[0].tower_height, 7);
+
+    EXPECT_EQ(state.applyDamageToBuildings(0, -100), 0);
+    EXPECT_EQ(state.players[0].tower_height, 0);
+    EXPECT_TRUE(state.isGameOver());
+    EXPECT_EQ(state.result().winner, 2);
+}
+
+UNIT_TEST(ArcomageState, EmptySlots) {
+    ArcomageState state;
+    state.reset(arcomageStartConditions[ARCOMAGE_TAVERN_HARMONDALE], 0);
+
+    EXPECT_FALSE(state.canPlayCard(0, -1));
+    EXPECT_FALSE(state.canPlayCard(0, 0));
+    EXPECT_FALSE(state.canDiscardCard(0, -1));
+    EXPECT_FALSE(state.canDiscardCard(0, 0));
+}
@@ -0,0 +1,69 @@
+#include "ArcomageSimOptions.h"
+
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+#include <string_view>
+
+#include "Arcomage/Core/ArcomageSelfPlay.h"
+
+#include "Utility/String/Format.h"
+#include "Utility/UnicodeCrt.h"
+
+static std::string_view strategyName(ArcomageStrategy strategy) {
+    switch (strategy) {
+    default: assert(false); [[fallthrough]];
+    case ARCOMAGE_STRATEGY_RANDOM: return "random";
+    case ARCOMAGE_STRATEGY_BUILDER: return "builder";
+    case ARCOMAGE_STRATEGY_ATTACKER: return "attacker";
+    }
+}
+
+int runSim(const ArcomageSimOptions &options) {
+    ArcomageTavern tavern = static_cast<ArcomageTavern>(options.tavern);
+    if (tavern < ARCOMAGE_TAVERN_FIRST || tavern > ARCOMAGE_TAVERN_LAST)
+        throw std::runtime_error(fmt::format("Invalid arcomage tavern index {}", options.tavern));
+
+    ArcomageSelfPlayOptions simOptions;
+    simOptions.conditions = arcomageStartConditions[tavern];
+    simOptions.gamesPerMatchup = options.games;
+    simOptions.threads = options.threads;
+    simOptions.seed = options.seed;
+
+    auto start = std::chrono::steady_clock::now();
+    ArcomageSelfPlayStats stats = runArcomageSelfPlay(simOptions);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    fmt::println("{:<10} {:<10} {:>8} {:>8} {:>8} {:>8} {:>8} {:>10}", "first", "second", "games", "wins", "losses", "draws", "aborted", "avg turns");
+    for (ArcomageStrategy first : allArcomageStrategies()) {
+        for (ArcomageStrategy second : allArcomageStrategies()) {
+            const ArcomageMatchupStats &s = stats.matchups[first][second];
+            double avgTurns = s.games == 0 ? 0.0 : static_cast<double>(s.turns) / s.games;
+            fmt::println("{:<10} {:<10} {:>8} {:>8} {:>8} {:>8} {:>8} {:>10.1f}",
+                         strategyName(first), strategyName(second), s.games, s.wins, s.losses, s.draws, s.aborted, avgTurns);
+        }
+    }
+
+    fmt::println("");
+    for (ArcomageStrategy strategy : allArcomageStrategies())
+        fmt::println("Win rate, {}: {:.1f}%", strategyName(strategy), 100.0 * stats.winRate(strategy));
+
+    fmt::println("");
+    fmt::println("Played {} games in {:.2f}s, {:.0f} games/hour.", stats.totalGames(), seconds,
+                 seconds > 0 ? stats.totalGames() * 3600.0 / seconds : 0.0);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    try {
+        UnicodeCrt _(argc, argv);
+        ArcomageSimOptions options = ArcomageSimOptions::parse(argc, argv);
+        if (options.helpPrinted)
+            return 1;
+
+        return runSim(options);
+    } catch (const std::exception &e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+}
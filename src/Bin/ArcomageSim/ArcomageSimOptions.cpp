@@ -0,0 +1,19 @@
+#include "ArcomageSimOptions.h"
+
+#include <memory>
+
+#include "Library/Cli/CliApp.h"
+
+ArcomageSimOptions ArcomageSimOptions::parse(int argc, char **argv) {
+    ArcomageSimOptions result;
+    std::unique_ptr<CliApp> app = std::make_unique<CliApp>("Headless arcomage self-play simulator.\n");
+
+    app->set_help_flag("-h,--help", "Print help and exit.");
+    app->add_option("--games", result.games, "Number of games to play for each pair of AI strategies.")->check(CLI::PositiveNumber)->option_text("COUNT");
+    app->add_option("--threads", result.threads, "Number of worker threads, 0 means use all hardware threads.")->check(CLI::NonNegativeNumber)->option_text("COUNT");
+    app->add_option("--seed", result.seed, "Random seed, game i is played with seed + i.")->option_text("SEED");
+    app->add_option("--tavern", result.tavern, "Index of the arcomage tavern to take the start conditions from, 0 is Harmondale.")->option_text("INDEX");
+
+    app->parse(argc, argv, result.helpPrinted);
+    return result;
+}
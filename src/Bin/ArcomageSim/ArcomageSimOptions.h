@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+struct ArcomageSimOptions {
+    int games = 1000; // Games per ordered pair of strategies.
+    int threads = 0;
+    uint32_t seed = 1;
+    int tavern = 0; // Arcomage tavern index, see `ArcomageTavern`.
+    bool helpPrinted = false; // True means that help message was already printed.
+
+    static ArcomageSimOptions parse(int argc, char **argv);
+};
@@ -153,7 +153,7 @@ std::string mapIdEnumName(const MapInfo &mapInfo) {
 
 int runMapIdCodeGen(const CodeGenOptions &options, GameResourceManager *resourceManager) {
     MapStats mapStats;
-    mapStats.Initialize(resourceManager->getEventsFile("MapStats.txt"));
+    mapStats.Initialize(resourceManager->getEventsTable("MapStats.txt"));
 
     CodeGenMap map;
     map.insert(MAP_INVALID, "INVALID", "");
@@ -176,7 +176,7 @@ const MapInfo &mapInfoByFileName(const MapStats &mapStats, std::string_view file
 
 int runBeaconsCodeGen(const CodeGenOptions &options, GameResourceManager *resourceManager) {
     MapStats mapStats;
-    mapStats.Initialize(resourceManager->getEventsFile("MapStats.txt"));
+    mapStats.Initialize(resourceManager->getEventsTable("MapStats.txt"));
 
     LodReader gamesLod(dfs->read("data/games.lod"));
     std::vector<std::string> fileNames = gamesLod.ls();
@@ -194,9 +194,9 @@ int runBeaconsCodeGen(const CodeGenOptions &options, GameResourceManager *resour
 
 int runHouseIdCodeGen(const CodeGenOptions &options, GameResourceManager *resourceManager) {
     MapStats mapStats;
-    mapStats.Initialize(resourceManager->getEventsFile("MapStats.txt"));
+    mapStats.Initialize(resourceManager->getEventsTable("MapStats.txt"));
 
-    initializeBuildings(resourceManager->getEventsFile("2dEvents.txt"));
+    initializeBuildings(resourceManager->getEventsTable("2dEvents.txt"));
     // ^ Initializes buildingTable.
 
     std::unordered_map<HouseId, std::set<std::string>> mapNamesByHouseId; // Only arbiter exists on two maps.
@@ -264,7 +264,7 @@ MonsterStats loadMonsterStats(GameResourceManager *resourceManager) {
     deserialize(dmonBlobs, pMonsterList);
 
     MonsterStats result;
-    result.Initialize(resourceManager->getEventsFile("monsters.txt"));
+    result.Initialize(resourceManager->getEventsTable("monsters.txt"));
     return result;
 }
 
@@ -396,7 +396,7 @@ int runBountyHuntCodeGen(const CodeGenOptions &options, GameResourceManager *res
 
 int runMusicCodeGen(const CodeGenOptions &options, GameResourceManager *resourceManager) {
     MapStats mapStats;
-    mapStats.Initialize(resourceManager->getEventsFile("MapStats.txt"));
+    mapStats.Initialize(resourceManager->getEventsTable("MapStats.txt"));
 
     std::map<MusicId, std::vector<std::string>> mapNamesByMusicId, mapEnumNamesByMusicId;
     for (const MapInfo &info : mapStats.pInfos) {
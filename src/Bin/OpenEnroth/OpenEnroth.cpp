@@ -2,10 +2,12 @@
 #include <cassert>
 #include <utility>
 #include <ranges>
+#include <span>
 #include <vector>
 #include <string>
 #include <algorithm>
 #include <chrono>
+#include <filesystem>
 
 #include "Application/Startup/GameStarter.h"
 
@@ -16,6 +18,7 @@
 #include "Engine/Components/Trace/EngineTracePlayer.h"
 #include "Engine/Engine.h"
 
+#include "Library/ForkServer/ForkServer.h"
 #include "Library/StackTrace/StackTraceOnCrash.h"
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Trace/EventTrace.h"
@@ -40,6 +43,10 @@ static std::string normalizeText(std::string_view text) {
     return result;
 }
 
+static std::string traceSavePath(const std::string &tracePath) {
+    return std::filesystem::path(tracePath).replace_extension(".mm7").generic_string();
+}
+
 static void printLines(const std::vector<std::string_view> &lines, ssize_t line, ssize_t delta) {
     for (size_t i = std::max(static_cast<ssize_t>(0), line - delta); i < std::min(std::ssize(lines), line + delta + 1); i++)
         fmt::println(stderr, "{:>5}: {}", i + 1, lines[i]);
@@ -60,45 +67,94 @@ static void printTraceDiff(std::string_view current, std::string_view canonical)
     printLines(currentLines, line, 2);
 }
 
+static int retraceTrace(EngineController *game, PlatformApplication *application, const OpenEnrothOptions &options,
+                        const std::string &tracePath) {
+    EngineTraceSimplePlayer *player = application->component<EngineTraceSimplePlayer>();
+    EngineTraceRecorder *recorder = application->component<EngineTraceRecorder>();
+
+    fmt::println(stderr, "Retracing '{}'...", tracePath);
+    auto startTime = std::chrono::steady_clock::now();
+
+    std::string savePath = traceSavePath(tracePath);
+    Blob oldTraceBlob = Blob::fromFile(tracePath);
+    Blob oldSaveBlob = Blob::fromFile(savePath);
+
+    bool isBinary = EventTrace::isBinaryBlob(oldTraceBlob);
+    EventTrace oldTrace = EventTrace::fromBlob(oldTraceBlob, application->window());
+
+    EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), oldTrace.header.config);
+    recorder->startRecording(game, oldSaveBlob);
+    engine->config->graphics.FPSLimit.setValue(0);
+    player->playTrace(game, std::move(oldTrace.events), tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
+    EngineTraceRecording recording = recorder->finishRecording(game);
+
+    auto endTime = std::chrono::steady_clock::now();
+    fmt::println(stderr, "Retraced in {}ms.", std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count());
+
+    // Recorder always produces json, binary traces are written back as binary.
+    if (!options.retrace.checkCanonical) {
+        oldTraceBlob = Blob(); // Close old trace file
+        if (isBinary) {
+            FileOutputStream(tracePath).write(EventTrace::toBinaryBlob(EventTrace::fromJsonBlob(recording.trace, application->window())));
+        } else {
+            FileOutputStream(tracePath).write(recording.trace);
+        }
+    } else {
+        if (isBinary)
+            oldTraceBlob = EventTrace::toJsonBlob(EventTrace::fromBinaryBlob(oldTraceBlob, application->window()));
+        std::string oldTraceJson = normalizeText(oldTraceBlob.string_view());
+        std::string newTraceJson = normalizeText(recording.trace.string_view());
+        if (oldTraceJson != newTraceJson) {
+            fmt::println(stderr, "Trace '{}' is not in canonical representation.", tracePath);
+            printTraceDiff(oldTraceJson, newTraceJson);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 int runRetrace(const OpenEnrothOptions &options) {
     GameStarter starter(options);
 
     int status = 0;
 
-    starter.runInstrumented([&status, options, application = starter.application()] (EngineController *game) {
-        EngineTraceSimplePlayer *player = application->component<EngineTraceSimplePlayer>();
-        EngineTraceRecorder *recorder = application->component<EngineTraceRecorder>();
-
-        for (const std::string &tracePath : options.retrace.traces) {
-            fmt::println(stderr, "Retracing '{}'...", tracePath);
-            auto startTime = std::chrono::steady_clock::now();
-
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
-            Blob oldTraceBlob = Blob::fromFile(tracePath);
-            Blob oldSaveBlob = Blob::fromFile(savePath);
-
-            EventTrace oldTrace = EventTrace::fromJsonBlob(oldTraceBlob, application->window());
-
-            EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), oldTrace.header.config);
-            recorder->startRecording(game, oldSaveBlob);
-            engine->config->graphics.FPSLimit.setValue(0);
-            player->playTrace(game, std::move(oldTrace.events), tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
-            EngineTraceRecording recording = recorder->finishRecording(game);
-
-            auto endTime = std::chrono::steady_clock::now();
-            fmt::println(stderr, "Retraced in {}ms.", std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count());
-
-            if (!options.retrace.checkCanonical) {
-                oldTraceBlob = Blob(); // Close old trace file
-                FileOutputStream(tracePath).write(recording.trace);
-            } else {
-                std::string oldTraceJson = normalizeText(oldTraceBlob.string_view());
-                std::string newTraceJson = normalizeText(recording.trace.string_view());
-                if (oldTraceJson != newTraceJson) {
-                    fmt::println(stderr, "Trace '{}' is not in canonical representation.", tracePath);
-                    printTraceDiff(oldTraceJson, newTraceJson);
+    starter.runInstrumented([&status, &starter, options, application = starter.application()] (EngineController *game) {
+        const std::vector<std::string> &traces = options.retrace.traces;
+
+        if (options.retrace.jobs == 0) {
+            for (const std::string &tracePath : traces)
+                if (retraceTrace(game, application, options, tracePath) != 0)
                     status = 1;
-                }
+            return;
+        }
+
+        // Fork-server mode, engine startup is paid only once, and each batch of traces is retraced in a copy of this
+        // process.
+        int jobSize = options.retrace.jobSize;
+        int jobCount = (traces.size() + jobSize - 1) / jobSize;
+        auto jobTraces = [&] (int index) {
+            return std::span(traces).subspan(index * jobSize, std::min<size_t>(jobSize, traces.size() - index * jobSize));
+        };
+
+        starter.prepareForFork();
+        std::vector<ForkServerJobResult> results = ForkServer(options.retrace.jobs).run(jobCount, [&] (int index) {
+            starter.resumeAfterFork();
+            int result = 0;
+            for (const std::string &tracePath : jobTraces(index))
+                if (retraceTrace(game, application, options, tracePath) != 0)
+                    result = 1;
+            return result;
+        }, [] (int, const ForkServerJobResult &result) {
+            fmt::print(stderr, "{}", result.output);
+        });
+        starter.resumeAfterFork();
+
+        for (size_t i = 0; i < results.size(); i++) {
+            if (results[i].exitCode != 0) {
+                fmt::println(stderr, "Retracing '{}' failed with exit code {}.", fmt::join(jobTraces(i), "', '"),
+                             results[i].exitCode);
+                status = 1;
             }
         }
     });
@@ -118,7 +174,7 @@ int runPlay(const OpenEnrothOptions &options) {
         for (const std::string &tracePath : options.play.traces) {
             fmt::println(stderr, "Playing back '{}'...", tracePath);
 
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+            std::string savePath = traceSavePath(tracePath);
 
             EngineTraceRecording recording;
             recording.save = Blob::fromFile(savePath);
@@ -134,6 +190,18 @@ int runPlay(const OpenEnrothOptions &options) {
     return 0;
 }
 
+int runConvertTrace(const OpenEnrothOptions &options) {
+    EventTrace trace = EventTrace::fromBlob(Blob::fromFile(options.convertTrace.input), nullptr);
+
+    bool toJson = std::filesystem::path(options.convertTrace.output).extension() == ".json";
+    Blob result = toJson ? EventTrace::toJsonBlob(trace) : EventTrace::toBinaryBlob(trace);
+    FileOutputStream(options.convertTrace.output).write(result);
+
+    fmt::println(stderr, "Converted '{}' -> '{}', {} -> {} bytes.", options.convertTrace.input, options.convertTrace.output,
+                 std::filesystem::file_size(options.convertTrace.input), result.size());
+    return 0;
+}
+
 int runOpenEnroth(const OpenEnrothOptions &options) {
     GameStarter(options).run();
     return 0;
@@ -152,6 +220,7 @@ int openEnrothMain(int argc, char **argv) {
         case OpenEnrothOptions::SUBCOMMAND_GAME: return runOpenEnroth(options);
         case OpenEnrothOptions::SUBCOMMAND_PLAY: return runPlay(options);
         case OpenEnrothOptions::SUBCOMMAND_RETRACE: return runRetrace(options);
+        case OpenEnrothOptions::SUBCOMMAND_CONVERT_TRACE: return runConvertTrace(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
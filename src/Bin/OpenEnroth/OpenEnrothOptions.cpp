@@ -61,6 +61,14 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     retrace->add_flag(
         "--check-canonical", result.retrace.checkCanonical,
         "Check whether all passed traces are stored in canonical representation and return an error if not. Don't overwrite the actual trace files.");
+    retrace->add_option(
+        "-j,--jobs", result.retrace.jobs,
+        "Initialize once, then retrace each trace in a forked copy of the process, running at most JOBS of them in "
+        "parallel. Implies --headless, Linux only.")->option_text("JOBS");
+    retrace->add_option(
+        "--job-size", result.retrace.jobSize,
+        "Number of traces to retrace in each forked process, used with --jobs.")
+        ->check(CLI::PositiveNumber)->option_text("SIZE");
     retrace->add_option(
         "--ls", traceDir,
         "Directory to look for traces to retrace."); // This is here so that we don't have to jump through hoops in cmake.
@@ -69,6 +77,15 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
         "Path to trace file(s) to retrace.")->option_text("...");
     retrace->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
 
+    CLI::App *convertTrace = app->add_subcommand("convert-trace", "Convert a trace between json & binary formats and exit.", result.subcommand, SUBCOMMAND_CONVERT_TRACE)->fallthrough();
+    convertTrace->add_option(
+        "INPUT", result.convertTrace.input,
+        "Path to input trace file, either json or binary.")->required()->check(CLI::ExistingFile)->option_text(" ");
+    convertTrace->add_option(
+        "OUTPUT", result.convertTrace.output,
+        "Path to output trace file. Output is written as json if the file has '.json' extension, and in binary format otherwise.")->required()->option_text(" ");
+    convertTrace->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
+
     app->parse(argc, argv, result.helpPrinted);
 
     if (!portable && std::filesystem::exists(".portable"))
@@ -85,13 +102,19 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
 
         if (!traceDir.empty()) {
             for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(traceDir))
-                if (entry.path().extension() == ".json")
+                if (entry.path().extension() == ".json" || entry.path().extension() == ".oetr")
                     result.retrace.traces.push_back(entry.path().generic_string());
             std::ranges::sort(result.retrace.traces); // NOLINT: This is ranges::sort. We want a fixed order.
         }
 
         if (result.retrace.traces.empty())
             throw Exception("No trace files to retrace.");
+
+        if (result.retrace.jobs > 0) {
+            // Only the game thread survives a fork, so the control routine should run on it.
+            result.headless = true;
+            result.controlBackend = CONTROL_BACKEND_COROUTINE;
+        }
     }
 
     if (result.subcommand == SUBCOMMAND_PLAY)
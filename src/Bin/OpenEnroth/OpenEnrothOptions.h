@@ -12,13 +12,16 @@ struct OpenEnrothOptions : public GameStarterOptions {
     enum class Subcommand {
         SUBCOMMAND_GAME,
         SUBCOMMAND_PLAY,
-        SUBCOMMAND_RETRACE
+        SUBCOMMAND_RETRACE,
+        SUBCOMMAND_CONVERT_TRACE
     };
     using enum Subcommand;
 
     struct RetraceOptions {
         std::vector<std::string> traces;
         bool checkCanonical = false;
+        int jobs = 0; // Number of forked worker processes to retrace in, zero means retrace in this process.
+        int jobSize = 1; // Number of traces to retrace in each forked worker process.
     };
 
     struct PlayOptions {
@@ -26,10 +29,16 @@ struct OpenEnrothOptions : public GameStarterOptions {
         float speed = 1.0f;
     };
 
+    struct ConvertTraceOptions {
+        std::string input;
+        std::string output;
+    };
+
     Subcommand subcommand = SUBCOMMAND_GAME;
     bool helpPrinted = false; // True means that help message was already printed.
     RetraceOptions retrace;
     PlayOptions play;
+    ConvertTraceOptions convertTrace;
 
     /**
      * Parses OpenEnroth command line options.
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "Engine/Graphics/LineOfSight.h"
 #include "Engine/Objects/ActorEnums.h"
 #include "Engine/Pid.h"
 
@@ -18,6 +19,16 @@ struct AttackDescription {
 
 extern std::vector<AttackDescription> attackList;  // for area of effect damage
 
+/**
+ * Scratch buffers for `evaluateAoeDamage`, owned by the engine and reused between frames.
+ */
+struct AoeDamageBuffers {
+    std::vector<LineOfSightQuery> losQueries;
+    std::vector<int> losActorIds; // Actor ids for the queries in `losQueries`.
+    LineOfSightResults losResults;
+    LineOfSightBuffers losBuffers;
+};
+
 /**
  * Register damaging AOE spell impact.
  *
@@ -1,5 +1,6 @@
 #include "EngineControlComponent.h"
 
+#include <exception>
 #include <utility>
 #include <memory>
 
@@ -7,7 +8,7 @@
 
 #include "EngineController.h"
 
-static void controlThread(EngineControlState *unsafeState) {
+static void controlRoutine(EngineControlState *unsafeState) {
     EngineControlStateHandle state(SIDE_CONTROL, unsafeState);
     EngineController controller(state);
 
@@ -18,6 +19,7 @@ static void controlThread(EngineControlState *unsafeState) {
         if (state->terminating)
             return;
 
+        std::exception_ptr exception;
         try {
             // std::queue uses std::deque which doesn't move elements around on reallocation, so we're safe even if
             // another control routine is queued from inside this call.
@@ -31,7 +33,12 @@ static void controlThread(EngineControlState *unsafeState) {
         } catch (EngineControlState::TerminationException) {
             return;
         } catch (...) {
-            state->gameRoutine = [exception = std::current_exception()] {
+            exception = std::current_exception();
+        }
+
+        // Yielding outside of the catch block, the coroutine backend shares exception handling state with the game.
+        if (exception) {
+            state->gameRoutine = [exception] {
                 std::rethrow_exception(exception);
             };
             state.yieldExecution();
@@ -41,9 +48,21 @@ static void controlThread(EngineControlState *unsafeState) {
     }
 }
 
-EngineControlComponent::EngineControlComponent(): _unsafeState(std::make_unique<EngineControlState>()), _state(SIDE_GAME, _unsafeState.get()) {
+static std::unique_ptr<EngineControlState> createState(EngineControlBackend backend) {
+    auto result = std::make_unique<EngineControlState>();
+    result->backend = backend;
+    if (backend == CONTROL_BACKEND_COROUTINE)
+        result->coroutine = std::make_unique<Coroutine>([state = result.get()] { controlRoutine(state); });
+    return result;
+}
+
+EngineControlComponent::EngineControlComponent(EngineControlBackend backend) :
+    _backend(backend),
+    _unsafeState(createState(backend)),
+    _state(SIDE_GAME, _unsafeState.get()) {
     _emptyHandler = std::make_unique<PlatformEventHandler>();
-    _controlThread = std::thread(&controlThread, _unsafeState.get());
+    if (backend == CONTROL_BACKEND_THREAD)
+        _controlThread = std::thread(&controlRoutine, _unsafeState.get());
 }
 
 EngineControlComponent::~EngineControlComponent() {
@@ -51,8 +70,13 @@ EngineControlComponent::~EngineControlComponent() {
     assert(!_controlThread.joinable()); // Thread should be joined at this point.
 }
 
+EngineControlBackend EngineControlComponent::defaultBackend() {
+    return CONTROL_BACKEND_THREAD;
+}
+
 void EngineControlComponent::runControlRoutine(ControlRoutine routine) {
     assert(std::this_thread::get_id() != _controlThread.get_id());
+    assert(!_unsafeState->coroutine || !_unsafeState->coroutine->isRunning());
 
     _state->controlRoutineQueue.push(std::move(routine));
 }
@@ -121,5 +145,6 @@ void EngineControlComponent::swapBuffers() {
 void EngineControlComponent::removeNotify() {
     _state->terminating = true;
     _state.yieldExecution();
-    _controlThread.join();
+    if (_controlThread.joinable())
+        _controlThread.join();
 }
@@ -8,6 +8,7 @@
 #include "Library/Platform/Proxy/ProxyEventLoop.h"
 #include "Library/Platform/Application/PlatformApplicationAware.h"
 
+#include "EngineControlEnums.h"
 #include "EngineControlStateHandle.h"
 
 class EngineController;
@@ -20,9 +21,12 @@ class PlatformEvent;
  * This component exposes a coroutine-like API that makes it possible to control the game by passing in synthetic
  * platform events.
  *
- * The implementation just uses a separate thread that runs a control routine, and the execution can switch between
- * threads from inside the `swapBuffers` call. This effectively means that the control routine runs in between game
- * frames.
+ * The control routine runs either in a separate thread, or in a stackful coroutine on the game thread, see
+ * `EngineControlBackend`. Either way, the execution can switch between the game and the control routine only from
+ * inside the `swapBuffers` call. This effectively means that the control routine runs in between game frames.
+ * Thread backend is the default. Coroutine backend is opt-in: it doesn't go through the OS scheduler on every frame,
+ * but the control routine then shares thread-locals with the game thread, e.g. profiler zone depth & per-thread
+ * allocation stats.
  *
  * If the control component is destroyed while the control routine is still running, the control routine will be
  * terminated by throwing an exception from inside `EngineController`. If you use `catch(...)` inside the control
@@ -34,9 +38,18 @@ class EngineControlComponent : private ProxyOpenGLContext, private ProxyEventLoo
  public:
     using ControlRoutine = std::function<void(EngineController *)>;
 
-    EngineControlComponent();
+    explicit EngineControlComponent(EngineControlBackend backend = defaultBackend());
     virtual ~EngineControlComponent();
 
+    /**
+     * @return                          Backend to use when none was requested explicitly, `CONTROL_BACKEND_THREAD`.
+     */
+    [[nodiscard]] static EngineControlBackend defaultBackend();
+
+    [[nodiscard]] EngineControlBackend backend() const {
+        return _backend;
+    }
+
     /**
      * Schedules a control routine for execution. It will be started in a control thread from inside the next
      * `swapBuffers` call. All spontaneous (OS-generated) events will be blocked while the control routine is running.
@@ -68,7 +81,8 @@ class EngineControlComponent : private ProxyOpenGLContext, private ProxyEventLoo
     virtual void removeNotify() override;
 
  private:
-    std::thread _controlThread;
+    EngineControlBackend _backend = CONTROL_BACKEND_THREAD;
+    std::thread _controlThread; // Thread backend only.
     std::unique_ptr<EngineControlState> _unsafeState;
     EngineControlStateHandle _state;
     std::unique_ptr<PlatformEventHandler> _emptyHandler;
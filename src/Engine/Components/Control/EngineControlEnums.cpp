@@ -0,0 +1,8 @@
+#include "EngineControlEnums.h"
+
+#include "Library/Serialization/EnumSerialization.h"
+
+MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(EngineControlBackend, CASE_INSENSITIVE, {
+    {CONTROL_BACKEND_THREAD, "thread"},
+    {CONTROL_BACKEND_COROUTINE, "coroutine"},
+})
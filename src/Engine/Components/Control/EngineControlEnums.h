@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Library/Serialization/SerializationFwd.h"
+
+/**
+ * How `EngineControlComponent` runs control routines.
+ */
+enum class EngineControlBackend {
+    /** Control routine runs in a separate thread, and the execution is handed back & forth with a condvar. */
+    CONTROL_BACKEND_THREAD,
+
+    /** Control routine runs in a stackful coroutine on the game thread. Only available where `Coroutine` is
+     * supported, but is a lot cheaper as switching doesn't involve the OS scheduler. */
+    CONTROL_BACKEND_COROUTINE
+};
+using enum EngineControlBackend;
+MM_DECLARE_SERIALIZATION_FUNCTIONS(EngineControlBackend)
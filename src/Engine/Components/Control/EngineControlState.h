@@ -7,8 +7,12 @@
 #include <memory>
 #include <exception>
 
+#include "Library/Coroutine/Coroutine.h"
+
 #include "Utility/IndexedArray.h"
 
+#include "EngineControlEnums.h"
+
 class PlatformEvent;
 class EngineController;
 
@@ -52,14 +56,21 @@ class EngineControlState {
 
     // Synchronization primitives.
 
-    /** Which thread is currently active. */
+    /** How the control routine is run, this defines which of the members below are used. */
+    EngineControlBackend backend = CONTROL_BACKEND_THREAD;
+
+    /** Which side is currently active. */
     EngineControlSide currentSide = SIDE_GAME;
 
-    /** This mutex protects everything. Game thread & control thread can run ONLY after locking it, and thus cannot
-     * run in parallel. */
+    /** Thread backend only. This mutex protects everything. Game thread & control thread can run ONLY after locking
+     * it, and thus cannot run in parallel. */
     std::mutex mutex;
 
-    /** Condvars to wake up control/game threads. */
+    /** Thread backend only. Condvars to wake up control/game threads. */
     IndexedArray<std::condition_variable, SIDE_GAME, SIDE_CONTROL> wakeEvents;
+
+    /** Coroutine backend only. Coroutine that runs the control routines, resumed from the game side and yielding
+     * from the control side. */
+    std::unique_ptr<Coroutine> coroutine;
 };
 
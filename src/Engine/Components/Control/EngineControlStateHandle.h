@@ -18,7 +18,7 @@ class EngineControlStateHandle {
     EngineControlStateHandle(EngineControlStateHandle &&) = default;
 
     EngineControlState *operator->() const {
-        assert(_data->lock.owns_lock());
+        assert(_data->isActive());
 
         return _data->state;
     }
@@ -29,15 +29,32 @@ class EngineControlStateHandle {
 
  private:
     struct SharedData {
-        SharedData(EngineControlSide side, EngineControlState *state): side(side), state(state), lock(state->mutex) {
+        SharedData(EngineControlSide side, EngineControlState *state) :
+            side(side),
+            state(state),
+            lock(state->mutex, std::defer_lock) {
             assert(state);
+
+            if (state->backend == CONTROL_BACKEND_THREAD)
+                lock.lock();
         }
 
         ~SharedData() {
             yieldExecutionInternal(false);
         }
 
+        bool isActive() const {
+            if (state->backend == CONTROL_BACKEND_THREAD)
+                return lock.owns_lock();
+            return state->currentSide == mySide();
+        }
+
         void yieldExecutionInternal(bool wait) {
+            if (state->backend == CONTROL_BACKEND_COROUTINE) {
+                yieldCoroutineInternal(wait);
+                return;
+            }
+
             assert(lock.owns_lock());
 
             state->currentSide = otherSide();
@@ -47,6 +64,24 @@ class EngineControlStateHandle {
                 state->wakeEvents[mySide()].wait(lock, [&] { return state->currentSide == mySide(); });
         }
 
+        void yieldCoroutineInternal(bool wait) {
+            assert(state->currentSide == mySide());
+
+            state->currentSide = otherSide();
+
+            // Not waiting on the control side means that the control routine is about to return, and the coroutine
+            // will switch back to the game side on its own.
+            if (!wait)
+                return;
+
+            if (mySide() == SIDE_GAME) {
+                state->coroutine->resume();
+            } else {
+                state->coroutine->yield();
+            }
+            assert(state->currentSide == mySide());
+        }
+
         EngineControlSide mySide() const {
             return side;
         }
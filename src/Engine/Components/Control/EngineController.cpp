@@ -12,9 +12,14 @@
 #include "GUI/GUIWindow.h"
 #include "GUI/GUIButton.h"
 
+#include "Engine/Components/Random/EngineRandomComponent.h"
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/Outdoor.h"
 #include "Engine/SaveLoad.h"
+#include "Engine/Engine.h"
 #include "Engine/EngineFileSystem.h"
 #include "Engine/EngineGlobals.h"
+#include "Engine/MapInfo.h"
 #include "Engine/mm7_data.h"
 
 #include "Library/FileSystem/Memory/MemoryFileSystem.h"
@@ -24,6 +29,8 @@
 #include "Utility/Exception.h"
 #include "Utility/ScopedRollback.h"
 
+#include "WorldSnapshot.h"
+
 EngineController::EngineController(EngineControlStateHandle state): _state(std::move(state)) {}
 
 EngineController::~EngineController() = default;
@@ -227,6 +234,59 @@ void EngineController::loadGame(const Blob &savedGame) {
     skipLoadingScreen();
 }
 
+// Fills in the current map & its base level data. Must be called from the game thread.
+static void snapshotLevel(WorldSnapshot *snapshot) {
+    snapshot->map = engine->_currentLoadedMapId;
+
+    const std::string &fileName = pMapStats->pInfos[snapshot->map].fileName;
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        snapshot->indoorData = IndoorLocation::loadBaseData(fileName);
+    } else {
+        snapshot->outdoorData = OutdoorLocation::loadBaseData(fileName);
+    }
+}
+
+WorldSnapshot EngineController::saveWorld() {
+    if (current_screen_type != SCREEN_GAME)
+        throw Exception("World snapshots can only be made on the game screen");
+
+    WorldSnapshot result;
+    runGameRoutine([&] {
+        // See the comment in saveGame on why this needs to run in game thread.
+        result.save = CreateSaveData(false, "").second;
+        snapshotLevel(&result);
+    });
+    result.random = ::application->component<EngineRandomComponent>()->state();
+    return result;
+}
+
+WorldSnapshot EngineController::loadWorld(Blob savedGame) {
+    loadGame(savedGame);
+
+    WorldSnapshot result;
+    runGameRoutine([&] { snapshotLevel(&result); });
+    result.save = std::move(savedGame);
+    result.random = ::application->component<EngineRandomComponent>()->state();
+    return result;
+}
+
+void EngineController::restoreWorld(const WorldSnapshot &snapshot) {
+    assert(snapshot.map != MAP_INVALID);
+
+    // Loading code takes the preloaded data & resets it, rollbacks are there in case loading fails half-way.
+    std::string fileName = pMapStats->pInfos[snapshot.map].fileName;
+    ScopedRollback<std::string> indoorName(&pIndoor->preloadedFilename, snapshot.indoorData ? fileName : "");
+    ScopedRollback<std::shared_ptr<const IndoorLocation_MM7>> indoorData(&pIndoor->preloadedData, snapshot.indoorData);
+    ScopedRollback<std::string> outdoorName(&pOutdoor->preloadedFilename, snapshot.outdoorData ? fileName : "");
+    ScopedRollback<std::shared_ptr<const OutdoorLocation_MM7>> outdoorData(&pOutdoor->preloadedData,
+                                                                          snapshot.outdoorData);
+
+    loadGame(snapshot.save);
+
+    // Loading draws random numbers, so random state is restored last.
+    ::application->component<EngineRandomComponent>()->setState(snapshot.random);
+}
+
 void EngineController::runGameRoutine(GameRoutine routine) {
     _state->gameRoutine = std::move(routine);
     _state.yieldExecution();
@@ -12,6 +12,7 @@
 
 class GUIButton;
 class PlatformEvent;
+struct WorldSnapshot;
 
 /**
  * This is the interface to be used from a control routine to control the game thread.
@@ -84,6 +85,37 @@ class EngineController {
      */
     void loadGame(const Blob &savedGame);
 
+    /**
+     * Makes an in-memory snapshot of the world that can later be restored with `restoreWorld`. Must be called while
+     * on the game screen, restoring a snapshot always brings the game back to the game screen.
+     *
+     * Note that this function is not free - it serializes the current location same as `saveGame` does, and parses
+     * the base level data for the current map.
+     *
+     * @return                          World snapshot.
+     * @throws Exception                If not on the game screen.
+     */
+    WorldSnapshot saveWorld();
+
+    /**
+     * Loads a saved game with `loadGame`, and returns a snapshot of the loaded world. Unlike `saveWorld`, this doesn't
+     * serialize the world, the snapshot references the provided save instead. Restoring the snapshot is then the same
+     * as loading the save again.
+     *
+     * @param savedGame                 Saved game to load.
+     * @return                          World snapshot.
+     */
+    WorldSnapshot loadWorld(Blob savedGame);
+
+    /**
+     * Restores a snapshot made with `saveWorld`. Uses the same code path as `loadGame`, but takes base level data from
+     * the snapshot instead of `games.lod`, and then restores the random engines. World state after this call is the
+     * same as it was when the snapshot was made.
+     *
+     * @param snapshot                  Snapshot to restore.
+     */
+    void restoreWorld(const WorldSnapshot &snapshot);
+
     /**
      * Runs the provided routine in game thread and returns once it's finished. This is mainly for running OpenGL code
      * as the corresponding context is bound in the main thread.
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "Engine/Components/Random/EngineRandomComponent.h"
+#include "Engine/MapEnums.h"
+
+#include "Utility/Memory/Blob.h"
+
+struct IndoorLocation_MM7;
+struct OutdoorLocation_MM7;
+
+/**
+ * In-memory snapshot of the world, see `EngineController::saveWorld`.
+ *
+ * Mutable world state (party, actors, sprite objects, map delta & timers) is stored in the save format. On top of
+ * that the snapshot keeps the parsed base level data for the current map, so that restoring it doesn't need to
+ * read & parse the level from `games.lod`, and the state of all random engines.
+ *
+ * Snapshots are owned by whoever made them, and everything they reference is released once they are destroyed.
+ */
+struct WorldSnapshot {
+    MapId map = MAP_INVALID;
+    Blob save;
+    std::shared_ptr<const IndoorLocation_MM7> indoorData; // Base level data, set if `map` is indoor.
+    std::shared_ptr<const OutdoorLocation_MM7> outdoorData; // Base level data, set if `map` is outdoor.
+    EngineRandomState random;
+};
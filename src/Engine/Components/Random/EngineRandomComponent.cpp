@@ -7,6 +7,7 @@
 
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Random/MersenneTwisterRandomEngine.h"
+#include "Library/Random/PhiloxRandomEngine.h"
 #include "Library/Random/SequentialRandomEngine.h"
 
 #include "TracingRandomEngine.h"
@@ -16,6 +17,8 @@ static EngineRandomComponent *globalRandomComponent = nullptr;
 static std::unique_ptr<RandomEngine> createRandomEngine(RandomEngineType type) {
     if (type == RANDOM_ENGINE_MERSENNE_TWISTER) {
         return std::make_unique<MersenneTwisterRandomEngine>();
+    } else if (type == RANDOM_ENGINE_PHILOX) {
+        return std::make_unique<PhiloxRandomEngine>();
     } else {
         assert(type == RANDOM_ENGINE_SEQUENTIAL);
         return std::make_unique<SequentialRandomEngine>();
@@ -61,6 +64,30 @@ void EngineRandomComponent::seed(int seed) {
         _vrngs[type]->seed(seed);
         _grngs[type]->seed(seed);
     }
+    grngStreamKey = PhiloxRandomEngine::keyForSeed(seed);
+}
+
+EngineRandomState EngineRandomComponent::state() const {
+    EngineRandomState result;
+    result.type = _type;
+    for (RandomEngineType type : _grngs.indices()) {
+        result.grngs[type] = _grngs[type]->clone();
+        result.vrngs[type] = _vrngs[type]->clone();
+    }
+    result.grngStreamKey = grngStreamKey;
+    return result;
+}
+
+void EngineRandomComponent::setState(const EngineRandomState &state) {
+    for (RandomEngineType type : _grngs.indices()) {
+        assert(state.grngs[type] && state.vrngs[type]);
+        _grngs[type] = state.grngs[type]->clone();
+        _vrngs[type] = state.vrngs[type]->clone();
+        _tracingGrngs[type] = std::make_unique<TracingRandomEngine>(application()->platform(), _grngs[type].get());
+    }
+    grngStreamKey = state.grngStreamKey;
+    _type = state.type;
+    swizzleGlobals();
 }
 
 void EngineRandomComponent::installNotify() {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "Engine/Random/RandomEnums.h"
@@ -11,6 +12,16 @@
 class RandomEngine;
 class Platform;
 
+/**
+ * State of all the random engines managed by an `EngineRandomComponent`, see `EngineRandomComponent::state`.
+ */
+struct EngineRandomState {
+    RandomEngineType type = RANDOM_ENGINE_MERSENNE_TWISTER;
+    IndexedArray<std::shared_ptr<const RandomEngine>, RANDOM_ENGINE_FIRST, RANDOM_ENGINE_LAST> grngs;
+    IndexedArray<std::shared_ptr<const RandomEngine>, RANDOM_ENGINE_FIRST, RANDOM_ENGINE_LAST> vrngs;
+    uint64_t grngStreamKey = 0;
+};
+
 class EngineRandomComponent : public PlatformApplicationAware {
  public:
     EngineRandomComponent();
@@ -29,6 +40,19 @@ class EngineRandomComponent : public PlatformApplicationAware {
      */
     void seed(int seed);
 
+    /**
+     * @return                          Copy of the current state of all random engines, including the engine type.
+     */
+    [[nodiscard]] EngineRandomState state() const;
+
+    /**
+     * Restores the state of all random engines. Random numbers drawn after this call are the same as the ones that
+     * were drawn after the corresponding call to `state`.
+     *
+     * @param state                     State to restore, as returned from `state`.
+     */
+    void setState(const EngineRandomState &state);
+
  private:
     virtual void installNotify() override;
     virtual void removeNotify() override;
@@ -1,6 +1,7 @@
 #include "TracingRandomEngine.h"
 
 #include <cassert>
+#include <memory>
 
 #include "Library/Platform/Interface/Platform.h"
 #include "Library/StackTrace/StackTrace.h"
@@ -32,6 +33,10 @@ void TracingRandomEngine::seed(int seed) {
     _base->seed(seed);
 }
 
+std::unique_ptr<RandomEngine> TracingRandomEngine::clone() const {
+    return std::make_unique<TracingRandomEngine>(_platform, _base);
+}
+
 template<class T>
 void TracingRandomEngine::printTrace(const char *function, const T &value) const {
     fmt::println(stderr, "TracingRandomEngine::{} called at {}ms, returning {}, stacktrace:",
@@ -15,6 +15,11 @@ class TracingRandomEngine : public RandomEngine {
     virtual int peek(int hi) const override;
     virtual void seed(int seed) override;
 
+    /**
+     * @return                          Tracing engine that shares the base engine with this one.
+     */
+    [[nodiscard]] virtual std::unique_ptr<RandomEngine> clone() const override;
+
  private:
     template<class T>
     void printTrace(const char *function, const T &value) const;
@@ -35,7 +35,7 @@ void EngineTracePlayer::playTrace(EngineController *game, const EngineTraceRecor
     assert(!isPlaying());
 
     _flags = flags;
-    _trace = std::make_unique<EventTrace>(EventTrace::fromJsonBlob(recording.trace, application()->window()));
+    _trace = std::make_unique<EventTrace>(EventTrace::fromBlob(recording.trace, application()->window()));
 
     MM_AT_SCOPE_EXIT({
         _flags = 0;
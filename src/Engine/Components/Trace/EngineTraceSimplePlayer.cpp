@@ -1,5 +1,6 @@
 #include "EngineTraceSimplePlayer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <utility>
 #include <vector>
@@ -14,6 +15,8 @@
 #include "Utility/ScopeGuard.h"
 #include "Utility/Exception.h"
 
+#include "EngineTraceStateAccessor.h"
+
 EngineTraceSimplePlayer::EngineTraceSimplePlayer() = default;
 EngineTraceSimplePlayer::~EngineTraceSimplePlayer() = default;
 
@@ -26,6 +29,7 @@ void EngineTraceSimplePlayer::playTrace(EngineController *game, std::vector<std:
 
     _traceDisplayPath = traceDisplayPath;
     _flags = flags;
+    _frameIndex = 0;
 
     for (std::unique_ptr<PlatformEvent> &event : events) {
         if (event->type == EVENT_PAINT) {
@@ -34,6 +38,8 @@ void EngineTraceSimplePlayer::playTrace(EngineController *game, std::vector<std:
             const PaintEvent *paintEvent = static_cast<const PaintEvent *>(event.get());
             checkTime(paintEvent);
             checkRng(paintEvent);
+            checkStateHashes(paintEvent);
+            _frameIndex++;
         } else {
             game->postEvent(std::move(event));
         }
@@ -62,3 +68,19 @@ void EngineTraceSimplePlayer::checkRng(const PaintEvent *paintEvent) {
                         _traceDisplayPath, tickCount, paintEvent->randomState, randomState);
     }
 }
+
+void EngineTraceSimplePlayer::checkStateHashes(const PaintEvent *paintEvent) {
+    if ((_flags & TRACE_PLAYBACK_SKIP_STATE_CHECKS) || paintEvent->stateHashes.empty())
+        return;
+
+    // Hashes are checked every frame, so the first mismatch is the frame where the state diverged.
+    std::vector<uint64_t> stateHashes = EngineTraceStateAccessor::makeStateHashes();
+    for (size_t i = 0; i < std::min(stateHashes.size(), paintEvent->stateHashes.size()); i++) {
+        if (stateHashes[i] != paintEvent->stateHashes[i]) {
+            int64_t tickCount = application()->platform()->tickCount();
+            throw Exception("Game state desynchronized when playing back trace '{}' at frame {} ({}ms): {} differ, expected hash {:016x}, got {:016x}",
+                            _traceDisplayPath, _frameIndex, tickCount, EngineTraceStateAccessor::stateHashName(i),
+                            paintEvent->stateHashes[i], stateHashes[i]);
+        }
+    }
+}
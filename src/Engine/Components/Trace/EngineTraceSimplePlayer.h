@@ -44,9 +44,11 @@ class EngineTraceSimplePlayer : private PlatformApplicationAware {
 
     void checkTime(const PaintEvent *paintEvent);
     void checkRng(const PaintEvent *paintEvent);
+    void checkStateHashes(const PaintEvent *paintEvent);
 
  private:
     bool _playing = false;
     std::string _traceDisplayPath;
+    int _frameIndex = 0;
     EngineTracePlaybackFlags _flags;
 };
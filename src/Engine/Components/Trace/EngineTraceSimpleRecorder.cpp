@@ -6,11 +6,14 @@
 #include <vector>
 
 #include "Engine/Random/Random.h"
+#include "Engine/Engine.h"
 
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/Trace/PaintEvent.h"
 #include "Library/Trace/EventTrace.h"
 
+#include "EngineTraceStateAccessor.h"
+
 EngineTraceSimpleRecorder::EngineTraceSimpleRecorder(): PlatformEventFilter(EVENTS_ALL) {}
 EngineTraceSimpleRecorder::~EngineTraceSimpleRecorder() = default;
 
@@ -34,6 +37,8 @@ void EngineTraceSimpleRecorder::swapBuffers() {
         e->type = EVENT_PAINT;
         e->tickCount = application()->platform()->tickCount();
         e->randomState = grng->peek(1024 * 1024);
+        if (engine->config->debug.TraceStateHashes.value())
+            e->stateHashes = EngineTraceStateAccessor::makeStateHashes();
         _events.push_back(std::move(e));
     }
 
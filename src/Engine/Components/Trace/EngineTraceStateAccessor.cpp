@@ -1,6 +1,9 @@
 #include "EngineTraceStateAccessor.h"
 
+#include <cassert>
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "Application/GameConfig.h"
 
@@ -8,10 +11,15 @@
 #include "Engine/Engine.h"
 #include "Engine/MapInfo.h"
 #include "Engine/mm7_data.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/SpriteObject.h"
+#include "Engine/Snapshots/EntitySnapshots.h"
+#include "Engine/Time/Timer.h"
 
 #include "Media/Audio/AudioPlayer.h"
 
 #include "Library/Trace/EventTrace.h"
+#include "Library/Snapshots/CommonSnapshots.h"
 
 #include "Utility/String/Ascii.h"
 
@@ -84,3 +92,57 @@ EventTraceGameState EngineTraceStateAccessor::makeGameState() {
     }
     return result;
 }
+
+/**
+ * FNV-1a over 64-bit words. Not a good general-purpose hash, but it's fast, and it's more than enough to detect
+ * desyncs.
+ */
+static uint64_t hashBytes(const void *data, size_t size) {
+    const char *bytes = static_cast<const char *>(data);
+    uint64_t result = 0xCBF29CE484222325ull;
+
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        result = (result ^ word) * 0x100000001B3ull;
+    }
+    for (; i < size; i++)
+        result = (result ^ static_cast<unsigned char>(bytes[i])) * 0x100000001B3ull;
+
+    return result;
+}
+
+template<class T>
+static uint64_t hashSnapshots(const std::vector<T> &snapshots) {
+    return hashBytes(snapshots.data(), snapshots.size() * sizeof(T));
+}
+
+// Hashing goes through the MM7 snapshot structs. These are packed & zero-initialized, so the hashes are stable. Only
+// the state that's restored on load is hashed, e.g. misc timer is not saved, so it's left out. Otherwise a trace
+// wouldn't match its own playback from the first frame.
+static constexpr std::string_view stateHashNames[] = {"party", "actors", "sprite objects", "event timer"};
+
+std::vector<uint64_t> EngineTraceStateAccessor::makeStateHashes() {
+    Party_MM7 party;
+    std::vector<Actor_MM7> actors;
+    std::vector<SpriteObject_MM7> spriteObjects;
+    Timer_MM7 eventTimer;
+
+    snapshot(*pParty, &party);
+    snapshot(pActors, &actors);
+    snapshot(pSpriteObjects, &spriteObjects);
+    snapshot(*pEventTimer, &eventTimer);
+
+    std::vector<uint64_t> result;
+    result.push_back(hashBytes(&party, sizeof(party)));
+    result.push_back(hashSnapshots(actors));
+    result.push_back(hashSnapshots(spriteObjects));
+    result.push_back(hashBytes(&eventTimer, sizeof(eventTimer)));
+    assert(result.size() == std::size(stateHashNames));
+    return result;
+}
+
+std::string_view EngineTraceStateAccessor::stateHashName(size_t index) {
+    return index < std::size(stateHashNames) ? stateHashNames[index] : "unknown";
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <string_view>
 #include <vector>
 
 #include "Library/Trace/EventTrace.h"
@@ -12,4 +14,20 @@ struct EngineTraceStateAccessor {
     static void prepareForPlayback(GameConfig *config, const ConfigPatch &patch);
 
     static EventTraceGameState makeGameState();
+
+    /**
+     * Computes per-subsystem hashes of the simulation state. These are recorded into the paint events of a trace
+     * if `trace_state_hashes` is set, and compared on playback to find the first frame where the game state diverged.
+     *
+     * Note that this snapshots the whole world, so it's not cheap. See the `StateHashes` benchmark.
+     *
+     * @return                          State hashes, see `stateHashName` for what each of the hashes covers.
+     */
+    static std::vector<uint64_t> makeStateHashes();
+
+    /**
+     * @param index                     Index into the vector returned from `makeStateHashes`.
+     * @return                          Name of the subsystem that the hash at `index` covers.
+     */
+    static std::string_view stateHashName(size_t index);
 };
@@ -1,6 +1,7 @@
 #include <cstring>
 #include <string>
 #include <algorithm>
+#include <chrono>
 #include <memory>
 
 #include "Engine/Engine.h"
@@ -9,6 +10,7 @@
 #include "Engine/AssetsManager.h"
 
 #include "Engine/Events/Processor.h"
+#include "Engine/Graphics/BspRenderer.h"
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/DecalBuilder.h"
 #include "Engine/Objects/DecorationList.h"
@@ -16,6 +18,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LevelMeshBuilder.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Image.h"
@@ -80,6 +83,7 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/BuildInfo/BuildInfo.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/String/Transformations.h"
 
@@ -199,6 +203,7 @@ void Engine::drawHUD() {
 
 //----- (0044103C) --------------------------------------------------------
 void Engine::Draw() {
+    MM_PROFILE_ZONE("Engine::Draw");
     drawWorld();
     drawHUD();
     render->flushAndScale();
@@ -208,6 +213,7 @@ void Engine::Draw() {
 
 
 void Engine::DrawGUI() {
+    MM_PROFILE_ZONE("Engine::DrawGUI");
     render->ResetUIClipRect();
 
     // if (render->pRenderD3D)
@@ -275,6 +281,19 @@ void Engine::DrawGUI() {
                                  fmt::format("Party yaw/pitch:     {} {}", pParty->_viewYaw, pParty->_viewPitch));
         debug_info_offset += 16;
 
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White,
+                                 fmt::format("Vertex uploads:      {} ({} KiB)", render->vertexuploads, render->vertexuploadbytes / 1024));
+        render->vertexuploads = 0;
+        render->vertexuploadbytes = 0;
+        debug_info_offset += 16;
+
+        const VisibilityCache &visibility =
+            uCurrentlyLoadedLevelType == LEVEL_INDOOR ? pBspRenderer->visibility : pOutdoor->bmodelVisibility;
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White,
+                                 fmt::format("Visibility reuse:    {:.1f}% ({:.2f} ms saved)", visibility.reuseRate() * 100,
+                                             std::chrono::duration<double, std::milli>(visibility.timeSaved()).count()));
+        debug_info_offset += 16;
+
         if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
             int sector_id = pBLVRenderParams->uPartySectorID;
             pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
@@ -516,6 +535,7 @@ void PlayButtonClickSound() {
 
 //----- (0046BDC0) --------------------------------------------------------
 void UpdateUserInput_and_MapSpecificStuff() {
+    MM_PROFILE_ZONE("UpdateUserInput_and_MapSpecificStuff");
     if (dword_6BE364_game_settings_1 & GAME_SETTINGS_0080_SKIP_USER_INPUT_THIS_FRAME) {
         dword_6BE364_game_settings_1 &= ~GAME_SETTINGS_0080_SKIP_USER_INPUT_THIS_FRAME;
         return;
@@ -529,7 +549,7 @@ void UpdateUserInput_and_MapSpecificStuff() {
         ODM_UpdateUserInputAndOther();
 
     checkDecorationEvents();
-    evaluateAoeDamage();
+    evaluateAoeDamage(engine->_aoeDamageBuffers.get());
 }
 
 //----- (004646F0) --------------------------------------------------------
@@ -583,6 +603,8 @@ void DoPrepareWorld(bool bLoading, int _1_fullscreen_loading_2_box) {
     bDialogueUI_InitializeActor_NPC_ID = 0;
     engine->_transitionMapId = MAP_INVALID;
     onMapLoad();
+    if (LevelMeshBuilder *builder = render->levelMeshBuilder())
+        builder->finish(); // Needs to happen after onMapLoad, as it might change face textures.
     pGameLoadingUI_ProgressBar->Progress();
     memset(&render->pBillboardRenderListD3D, 0, sizeof(render->pBillboardRenderListD3D));
     pGameLoadingUI_ProgressBar->Release();
@@ -705,25 +727,25 @@ void Engine::SecondaryInitialization() {
     mouse->Initialize();
 
     pMapStats = new MapStats();
-    pMapStats->Initialize(engine->_gameResourceManager->getEventsFile("MapStats.txt"));
+    pMapStats->Initialize(engine->_gameResourceManager->getEventsTable("MapStats.txt"));
 
     pMonsterStats = new MonsterStats();
-    pMonsterStats->Initialize(engine->_gameResourceManager->getEventsFile("monsters.txt"));
-    pMonsterStats->InitializePlacements(engine->_gameResourceManager->getEventsFile("placemon.txt"));
+    pMonsterStats->Initialize(engine->_gameResourceManager->getEventsTable("monsters.txt"));
+    pMonsterStats->InitializePlacements(engine->_gameResourceManager->getEventsTable("placemon.txt"));
 
     pSpellStats = new SpellStats();
-    pSpellStats->Initialize(engine->_gameResourceManager->getEventsFile("spells.txt"));
+    pSpellStats->Initialize(engine->_gameResourceManager->getEventsTable("spells.txt"));
 
     pFactionTable = new FactionTable();
-    pFactionTable->Initialize(engine->_gameResourceManager->getEventsFile("hostile.txt"));
+    pFactionTable->Initialize(engine->_gameResourceManager->getEventsTable("hostile.txt"));
 
     pStorylineText = new StorylineText();
-    pStorylineText->Initialize(engine->_gameResourceManager->getEventsFile("history.txt"));
+    pStorylineText->Initialize(engine->_gameResourceManager->getEventsTable("history.txt"));
 
     pItemTable = new ItemTable();
     pItemTable->Initialize(engine->_gameResourceManager.get());
 
-    initializeBuildings(engine->_gameResourceManager->getEventsFile("2dEvents.txt"));
+    initializeBuildings(engine->_gameResourceManager->getEventsTable("2dEvents.txt"));
 
     //pPaletteManager->SetMistColor(128, 128, 128);
     //pPaletteManager->RecalculateAll();
@@ -756,12 +778,12 @@ void Engine::SecondaryInitialization() {
     pNPCStats = new NPCStats();
     pNPCStats->Initialize(engine->_gameResourceManager.get());
 
-    initializeQuests(engine->_gameResourceManager->getEventsFile("quests.txt"));
-    initializeAutonotes(engine->_gameResourceManager->getEventsFile("autonote.txt"));
-    initializeAwards(engine->_gameResourceManager->getEventsFile("awards.txt"));
-    initializeTransitions(engine->_gameResourceManager->getEventsFile("trans.txt"));
-    initializeMerchants(engine->_gameResourceManager->getEventsFile("merchant.txt"));
-    initializeMessageScrolls(engine->_gameResourceManager->getEventsFile("scroll.txt"));
+    initializeQuests(engine->_gameResourceManager->getEventsTable("quests.txt"));
+    initializeAutonotes(engine->_gameResourceManager->getEventsTable("autonote.txt"));
+    initializeAwards(engine->_gameResourceManager->getEventsTable("awards.txt"));
+    initializeTransitions(engine->_gameResourceManager->getEventsTable("trans.txt"));
+    initializeMerchants(engine->_gameResourceManager->getEventsTable("merchant.txt"));
+    initializeMessageScrolls(engine->_gameResourceManager->getEventsTable("scroll.txt"));
 
     engine->_globalEventMap = EventMap::load(engine->_gameResourceManager->getEventsFile("global.evt"));
 
@@ -776,6 +798,7 @@ void Engine::Initialize() {
     _outdoor = std::make_unique<OutdoorLocation>();
     _stationaryLights = std::make_unique<LightsStack_StationaryLight_>();
     _mobileLights = std::make_unique<LightsStack_MobileLight_>();
+    _aoeDamageBuffers = std::make_unique<AoeDamageBuffers>();
 
     ::pIndoor = _indoor.get();
     ::pOutdoor = _outdoor.get();
@@ -1036,6 +1059,7 @@ void back_to_game() {
 
 //----- (00494035) --------------------------------------------------------
 void _494035_timed_effects__water_walking_damage__etc(Duration dt) {
+    MM_PROFILE_ZONE("_494035_timed_effects__water_walking_damage__etc");
     Time oldTime = pParty->GetPlayingTime();
     Time newTime = oldTime + dt;
     pParty->GetPlayingTime() = newTime;
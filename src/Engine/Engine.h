@@ -41,6 +41,7 @@ struct OutdoorLocation;
 struct LightsStack_StationaryLight_;
 struct LightsStack_MobileLight_;
 class OverlaySystem;
+struct AoeDamageBuffers;
 
 enum class GameState {
     GAME_STATE_PLAYING = 0,
@@ -140,6 +141,7 @@ class Engine {
     std::unique_ptr<OutdoorLocation> _outdoor;
     std::unique_ptr<LightsStack_StationaryLight_> _stationaryLights;
     std::unique_ptr<LightsStack_MobileLight_> _mobileLights;
+    std::unique_ptr<AoeDamageBuffers> _aoeDamageBuffers;
 };
 
 extern Engine *engine;
@@ -19,6 +19,7 @@
 #include "GUI/UI/UIStatusBar.h"
 
 #include "Library/Logger/Logger.h"
+#include "Library/Profiler/Profiler.h"
 
 struct MapTimer {
     Duration interval;
@@ -146,6 +147,7 @@ static void registerTimerTriggers(EventType triggerType, std::vector<MapTimer> *
 }
 
 void eventProcessor(int eventId, Pid targetObj, bool canShowMessages, int startStep) {
+    MM_PROFILE_ZONE("eventProcessor");
     if (!eventId) {
         engine->_statusBar->nothingHere();
         return;
@@ -247,6 +249,7 @@ static void checkTimer(MapTimer &timer) {
 }
 
 void onTimer() {
+    MM_PROFILE_ZONE("onTimer");
     if (pEventTimer->isPaused()) {
         return;
     }
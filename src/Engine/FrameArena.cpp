@@ -0,0 +1,3 @@
+#include "FrameArena.h"
+
+MemoryArena frameArena;
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Utility/Memory/MemoryArena.h"
+
+/**
+ * Arena for transient data that's rebuilt every frame. It is reset in `Renderer::Present`, so memory allocated from
+ * it must not be held across `Present` calls. Should only be used from the game thread.
+ *
+ * Example usage:
+ * ```
+ * FrameVector<int> actorIds(&frameArena);
+ * ```
+ */
+extern MemoryArena frameArena;
+
+template<class T>
+using FrameVector = ArenaVector<T>;
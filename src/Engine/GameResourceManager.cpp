@@ -4,6 +4,9 @@
 #include "EngineFileSystem.h"
 
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/String/Format.h"
 
 GameResourceManager::GameResourceManager() = default;
 GameResourceManager::~GameResourceManager() = default;
@@ -19,3 +22,26 @@ void GameResourceManager::openGameResources() {
 Blob GameResourceManager::getEventsFile(std::string_view filename) {
     return lod::decodeCompressed(_eventsLodReader.read(filename));
 }
+
+TsvTable GameResourceManager::getEventsTable(std::string_view filename) {
+    Blob raw = _eventsLodReader.read(filename);
+    if (!engine || !engine->config->debug.TableCache.value())
+        return TsvTable::parse(lod::decodeCompressed(raw));
+
+    // Cache key is the hash of the raw LOD entry, so that a cache hit doesn't need to decompress anything.
+    uint64_t sourceHash = TsvTable::hash(raw.string_view());
+    std::string cachePath = fmt::format("cache/tables/{}.bin", filename);
+    if (ufs->exists(cachePath)) {
+        TsvTable result = TsvTable::fromCompiled(ufs->read(cachePath), sourceHash);
+        if (!result.empty())
+            return result;
+    }
+
+    TsvTable result = TsvTable::parse(lod::decodeCompressed(raw));
+    try {
+        ufs->write(cachePath, result.compile(sourceHash));
+    } catch (const std::exception &e) {
+        logger->warning("Could not write table cache '{}': {}", cachePath, e.what());
+    }
+    return result;
+}
@@ -5,6 +5,7 @@
 #include "Utility/Memory/Blob.h"
 
 #include "Library/Lod/LodReader.h"
+#include "Library/Tsv/TsvTable.h"
 
 class GameResourceManager {
  public:
@@ -15,6 +16,14 @@ class GameResourceManager {
 
     Blob getEventsFile(std::string_view filename);
 
+    /**
+     * @param filename                  Name of a text table inside `events.lod`.
+     * @return                          Parsed table. If `debug.table_cache` is set, the compiled table is loaded
+     *                                  from the user cache folder when the source data hasn't changed, and is written
+     *                                  there otherwise.
+     */
+    TsvTable getEventsTable(std::string_view filename);
+
  private:
     LodReader _eventsLodReader;
 };
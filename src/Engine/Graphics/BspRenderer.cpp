@@ -1,5 +1,7 @@
 #include "Engine/Graphics/BspRenderer.h"
 
+#include <chrono>
+
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/PortalFunctions.h"
 #include "Engine/Engine.h"
@@ -144,9 +146,24 @@ void BspRenderer::MakeVisibleSectorList() {
     }
 }
 
+bool BspRenderer::isSectorVisible(int sectorId) const {
+    for (unsigned i = 0; i < uNumVisibleNotEmptySectors; i++)
+        if (pVisibleSectorIDs_toDrawDecorsActorsEtcFrom[i] == sectorId)
+            return true;
+    return false;
+}
+
 
 //----- (0043F953) --------------------------------------------------------
 void PrepareBspRenderList_BLV() {
+    // portal clipping depends on the exact camera position, so the cache is only hit when the camera is stationary
+    int sectorId = pBLVRenderParams->uPartySectorID ? pBLVRenderParams->uPartyEyeSectorID : -1;
+    VisibilityCacheKey key = VisibilityCacheKey::fromCamera(sectorId);
+    if (pBspRenderer->visibility.tryReuse(key))
+        return;
+
+    auto startTime = std::chrono::steady_clock::now();
+
     // reset faces list
     pBspRenderer->num_faces = 0;
 
@@ -169,6 +186,8 @@ void PrepareBspRenderList_BLV() {
     }
 
     pBspRenderer->MakeVisibleSectorList();
+
+    pBspRenderer->visibility.store(key, std::chrono::steady_clock::now() - startTime);
 }
 
 
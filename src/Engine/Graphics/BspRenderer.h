@@ -3,6 +3,7 @@
 #include <array>
 
 #include "Engine/Graphics/Camera.h"
+#include "Engine/Graphics/VisibilityCache.h"
 
 #include "Library/Geometry/Plane.h"
 
@@ -23,6 +24,13 @@ struct BspRenderer {
     void AddFaceToRenderList_d3d(int node_id, int uFaceID);
     void MakeVisibleSectorList();
 
+    /**
+     * @param sectorId                  Sector to check.
+     * @return                          Whether the sector is in the visible sector list built by
+     *                                  `MakeVisibleSectorList`.
+     */
+    [[nodiscard]] bool isSectorVisible(int sectorId) const;
+
     unsigned int num_faces = 0;
     std::array<BspFace, 1500> faces = {{}};
 
@@ -31,6 +39,9 @@ struct BspRenderer {
 
     unsigned int uNumVisibleNotEmptySectors = 0;
     std::array<int, 150> pVisibleSectorIDs_toDrawDecorsActorsEtcFrom = {{}};
+
+    // Portal traversal results above are reused while the camera doesn't move. Invalidated when doors move.
+    VisibilityCache visibility;
 };
 
 extern BspRenderer *pBspRenderer;
@@ -71,15 +71,24 @@ char DecalBuilder::BuildAndApplyDecals(int light_level, LocationFlags locationFl
     Camera3D::GetFacetOrientation(static_FacePlane.Normal, &static_FacePlane.field_10, &static_FacePlane.field_1C);
 
     if (this->uNumSplatsThisFace > 0) {
+        // Light all the splats on this face in a batch.
+        splatPoints.clear();
+        BBoxf bounds;
+        for (int i = 0; i < this->uNumSplatsThisFace; ++i) {
+            const Vec3f &pos = bloodsplat_container->pBloodsplats_to_apply[this->WhichSplatsOnThisFace[i]].pos;
+            bounds = i == 0 ? BBoxf::forPoints(pos, pos) : bounds | BBoxf::forPoints(pos, pos);
+            splatPoints.push_back(pos);
+        }
+        splatLightLevels.assign(splatPoints.size(), light_level);
+        GatherPointLights(&splatLights, uSectorID, bounds);
+        GetLightLevelsAtPoints(splatLights, splatPoints, splatLightLevels);
+
         for (int i = 0; i < this->uNumSplatsThisFace; ++i) {
             int thissplat = this->WhichSplatsOnThisFace[i];
             Bloodsplat *buildsplat = &bloodsplat_container->pBloodsplats_to_apply[thissplat];
-            int point_light_level = GetLightLevelAtPoint(
-                    light_level, uSectorID,
-                    buildsplat->pos.x, buildsplat->pos.y, buildsplat->pos.z);
 
             if (!this->Build_Decal_Geometry(
-                point_light_level, locationFlags,
+                splatLightLevels[i], locationFlags,
                 buildsplat,
                 buildsplat->radius,
                 buildsplat->color,
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
+#include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/RenderEntities.h"
 #include "Engine/Tables/TileEnums.h"
 #include "Engine/Time/Duration.h"
@@ -126,4 +128,9 @@ struct DecalBuilder {
     float flt_30C030 = 0;
     float field_30C034 = 0;
     BloodsplatContainer *bloodsplat_container;
+
+    // scratch buffers for lighting the splats on a face
+    std::vector<Vec3f> splatPoints;
+    std::vector<int> splatLightLevels;
+    PointLightList splatLights;
 };
@@ -96,6 +96,7 @@ void GraphicsImage::releaseRenderId() {
 
     render->DeleteTexture(_renderId);
     _renderId = TextureRenderId();
+    _atlasRegion.reset();
 }
 
 bool GraphicsImage::LoadImageData() {
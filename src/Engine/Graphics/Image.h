@@ -2,7 +2,9 @@
 
 #include <string>
 #include <memory>
+#include <optional>
 
+#include "Engine/Graphics/Renderer/TextureAtlasRegion.h"
 #include "Engine/Graphics/Renderer/TextureRenderId.h"
 
 #include "Library/Geometry/Size.h"
@@ -39,6 +41,18 @@ class GraphicsImage {
     [[nodiscard]] TextureRenderId renderId(bool load = true);
     void releaseRenderId();
 
+    /**
+     * @return                          Texture atlas region that this image was packed into by the renderer, if any.
+     *                                  Atlas regions are dropped together with the render id.
+     */
+    [[nodiscard]] const std::optional<TextureAtlasRegion> &atlasRegion() const {
+        return _atlasRegion;
+    }
+
+    void setAtlasRegion(std::optional<TextureAtlasRegion> region) {
+        _atlasRegion = region;
+    }
+
  protected:
     ~GraphicsImage(); // Call Release() instead.
 
@@ -52,6 +66,7 @@ class GraphicsImage {
     GrayscaleImage _indexedImage;
     Palette _palette;
     TextureRenderId _renderId;
+    std::optional<TextureAtlasRegion> _atlasRegion;
 
     bool LoadImageData();
 };
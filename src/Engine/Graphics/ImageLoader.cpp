@@ -1,6 +1,7 @@
 #include "ImageLoader.h"
 
 #include <unordered_set>
+#include <string>
 #include <string_view>
 #include <memory>
 
@@ -13,8 +14,12 @@
 
 #include "Library/Image/ImageFunctions.h"
 #include "Library/Image/PCX.h"
+#include "Library/Lod/LodReader.h"
+#include "Library/LodFormats/LodFormats.h"
 #include "Library/Logger/Logger.h"
 
+#include "Utility/String/Ascii.h"
+
 // List of textures that require additional processing for transparent pixels.
 // TODO: move to OpenEnroth config file.
 static const std::unordered_set<std::string_view> transparentTextures = {
@@ -182,38 +187,50 @@ static Color ProcessTransparentPixel(const GrayscaleImage &image, const Palette
     return Color(static_cast<uint8_t>(r), static_cast<uint8_t>(g), static_cast<uint8_t>(b), 0);
 }
 
+static RgbaImage makeBitmapRgbaImage(std::string_view name, const GrayscaleImage &indexedImage, Palette *palette) {
+    if (!transparentTextures.contains(name))
+        return makeRgbaImage(indexedImage, *palette);
+
+    *palette = MakePaletteAlpha(*palette);
+
+    size_t w = indexedImage.width();
+    size_t h = indexedImage.height();
+    RgbaImage result = RgbaImage::uninitialized(w, h);
+    for (size_t y = 0; y < h; y++) {
+        for (size_t x = 0; x < w; x++) {
+            uint8_t pal = indexedImage[y][x];
+            if (pal == 0) {
+                result[y][x] = ProcessTransparentPixel(indexedImage, *palette, x, y);
+            } else {
+                result[y][x] = palette->colors[pal];
+            }
+        }
+    }
+    return result;
+}
+
 bool Bitmaps_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     Texture_MM7 *tex = lod->loadTexture(this->resource_name);
 
-    size_t w = tex->indexed.width();
-    size_t h = tex->indexed.height();
-
     // TODO(captainurist): no need to copy here.
     *indexedImage = GrayscaleImage::copy(tex->indexed.width(), tex->indexed.height(), tex->indexed.pixels().data()); // NOLINT: this is not std::copy.
 
     // Desaturate bitmaps
     tex->palette = PaletteManager::createLoadedPalette(tex->palette);
 
-    if (!transparentTextures.contains(tex->name)) {
-        *palette = tex->palette;
-        *rgbaImage = makeRgbaImage(*indexedImage, *palette);
-    } else {
-        *palette = MakePaletteAlpha(tex->palette);
+    *palette = tex->palette;
+    *rgbaImage = makeBitmapRgbaImage(tex->name, *indexedImage, palette);
+    return true;
+}
 
-        *rgbaImage = RgbaImage::uninitialized(w, h);
-        for (size_t y = 0; y < h; y++) {
-            for (size_t x = 0; x < w; x++) {
-                uint8_t pal = (*indexedImage)[y][x];
-                if (pal == 0) {
-                    (*rgbaImage)[y][x] = ProcessTransparentPixel(*indexedImage, *palette, x, y);
-                } else {
-                    (*rgbaImage)[y][x] = palette->colors[pal];
-                }
-            }
-        }
-    }
+RgbaImage loadBitmapRgbaImage(const LodReader &reader, std::string_view name, float saturation, float lightness) {
+    std::string lowerName = ascii::toLower(name);
+    if (!reader.exists(lowerName))
+        lowerName = "pending"; // Same fallback as in LodTextureCache::loadTexture.
 
-    return true;
+    LodImage image = lod::decodeImage(reader.read(lowerName));
+    Palette palette = PaletteManager::createLoadedPalette(image.palette, saturation, lightness);
+    return makeBitmapRgbaImage(lowerName, image.image, &palette);
 }
 
 bool Sprites_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
@@ -136,3 +136,15 @@ class Sprites_LOD_Loader : public ImageLoader {
  protected:
     LodSpriteCache *lod;
 };
+
+/**
+ * Decodes a bitmap from `bitmaps.lod` the same way `Bitmaps_LOD_Loader` does, but bypassing all the caches. Unlike
+ * the loaders, this function is thread-safe.
+ *
+ * @param reader                        Reader for `bitmaps.lod`.
+ * @param name                          Bitmap name. Missing bitmaps are replaced with the "pending" placeholder.
+ * @param saturation                    Palette saturation, normally the value of `graphics.Saturation`.
+ * @param lightness                     Palette lightness, normally the value of `graphics.Lightness`.
+ * @return                              Decoded bitmap.
+ */
+RgbaImage loadBitmapRgbaImage(const LodReader &reader, std::string_view name, float saturation, float lightness);
@@ -1,9 +1,12 @@
 #include "Engine/Graphics/Indoor.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <ranges>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -16,6 +19,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LevelMeshBuilder.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/ParticleEngine.h"
 #include "Engine/Graphics/TextureFrameTable.h"
@@ -47,6 +51,7 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/Math/TrigLut.h"
@@ -204,6 +209,7 @@ void IndoorLocation::DrawIndoorFaces(bool bD3D) {
 
 //----- (00441BD4) --------------------------------------------------------
 void IndoorLocation::Draw() {
+    MM_PROFILE_ZONE("IndoorLocation::Draw");
     PrepareDrawLists_BLV();
     if (pBLVRenderParams->uPartySectorID)
         DrawIndoorFaces(true);
@@ -283,24 +289,38 @@ void IndoorLocation::toggleLight(signed int sLightID, unsigned int bToggle) {
     }
 }
 
+std::shared_ptr<const IndoorLocation_MM7> IndoorLocation::loadBaseData(std::string_view filename) {
+    std::string blv_filename = std::string(filename);
+    blv_filename.replace(blv_filename.length() - 4, 4, ".blv");
+
+    std::shared_ptr<IndoorLocation_MM7> result = std::make_shared<IndoorLocation_MM7>();
+    deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), result.get()); // read throws if file doesn't exist.
+    return result;
+}
+
 //----- (00498E0A) --------------------------------------------------------
 void IndoorLocation::Load(std::string_view filename, int num_days_played, int respawn_interval_days, bool *indoor_was_respawned) {
     decal_builder->Reset(0);
 
     assert(!bLoaded); // BLV is already loaded!
 
-    auto blv_filename = std::string(filename);
-    blv_filename.replace(blv_filename.length() - 4, 4, ".blv");
-
     this->filename = std::string(filename);
 
     Release();
 
     bLoaded = true;
+    pBspRenderer->visibility.invalidate();
+    pBspRenderer->visibility.resetStats();
 
-    IndoorLocation_MM7 location;
-    deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
-    reconstruct(location, this);
+    std::shared_ptr<const IndoorLocation_MM7> location;
+    if (preloadedFilename == filename) {
+        location = std::move(preloadedData);
+    } else {
+        location = loadBaseData(filename);
+    }
+    preloadedFilename.clear();
+    preloadedData.reset();
+    reconstruct(*location, this);
 
     std::string dlv_filename = fmt::format("{}.dlv", filename.substr(0, filename.size() - 4));
 
@@ -309,7 +329,7 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
     IndoorDelta_MM7 delta;
     if (Blob blob = lod::decodeCompressed(pSave_LOD->read(dlv_filename))) {
         try {
-            deserialize(blob, &delta, tags::context(location));
+            deserialize(blob, &delta, tags::context(*location));
 
             // Level was changed externally and we have a save there? Don't crash, just respawn.
             if (delta.header.totalFacesCount > 0 && delta.header.decorationCount > 0 &&
@@ -334,12 +354,12 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
     assert(respawnInitial + respawnTimed <= 1);
 
     if (respawnInitial) {
-        deserialize(lod::decodeCompressed(pGames_LOD->read(dlv_filename)), &delta, tags::context(location));
+        deserialize(lod::decodeCompressed(pGames_LOD->read(dlv_filename)), &delta, tags::context(*location));
         *indoor_was_respawned = true;
     } else if (respawnTimed) {
         auto header = delta.header;
         auto visibleOutlines = delta.visibleOutlines;
-        deserialize(lod::decodeCompressed(pGames_LOD->read(dlv_filename)), &delta, tags::context(location));
+        deserialize(lod::decodeCompressed(pGames_LOD->read(dlv_filename)), &delta, tags::context(*location));
         delta.header = header;
         delta.visibleOutlines = visibleOutlines;
         *indoor_was_respawned = true;
@@ -699,7 +719,8 @@ void BLV_UpdateDoors() {
             }
         }
 
-        // adjust verts to how open the door is
+        // adjust verts to how open the door is, this changes what's visible through the portals
+        pBspRenderer->visibility.invalidate();
         for (int j = 0; j < door->uNumVertices; ++j) {
             pIndoor->pVertices[door->pVertexIDs[j]].x = door->vDirection.x * openDistance + door->pXOffsets[j];
             pIndoor->pVertices[door->pVertexIDs[j]].y = door->vDirection.y * openDistance + door->pYOffsets[j];
@@ -890,6 +911,8 @@ void loadAndPrepareBLV(MapId mapid, bool bLoading) {
 
     pStationaryLightsStack->uNumLightsActive = 0;
     pIndoor->Load(mapFilename, pParty->GetPlayingTime().toDays() + 1, respawn_interval, &indoor_was_respawned);
+    if (LevelMeshBuilder *builder = render->levelMeshBuilder())
+        builder->start(LEVEL_INDOOR, mapFilename);
     if (!(dword_6BE364_game_settings_1 & GAME_SETTINGS_LOADING_SAVEGAME_SKIP_RESPAWN)) {
         Actor::InitializeActors();
         SpriteObject::InitializeSpriteObjects();
@@ -1261,166 +1284,6 @@ void IndoorLocation::PrepareDecorationsRenderList_BLV(unsigned int uDecorationID
     }
 }
 
-//----- (00407A1C) --------------------------------------------------------
-bool Check_LineOfSight(const Vec3f &target, const Vec3f &from) {  // target from - true on clear
-    int AngleToTarget = TrigLUT.atan2(from.x - target.x, from.y - target.y);
-    bool LOS_Obscurred = false;
-    bool LOS_Obscurred2 = false;
-    bool LOS_ObscurredStr = false;
-
-    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-        // check straight point to point
-        LOS_ObscurredStr = Check_LOS_Obscurred_Indoors(target, from);
-
-        if (LOS_ObscurredStr) {
-            // offset 32 to side and check LOS
-            Vec3f targetmod = target + Vec3f::fromPolar(32, AngleToTarget + TrigLUT.uIntegerHalfPi, 0);
-            Vec3f frommod = from + Vec3f::fromPolar(32, AngleToTarget + TrigLUT.uIntegerHalfPi, 0);
-            LOS_Obscurred2 = Check_LOS_Obscurred_Indoors(targetmod, frommod);
-
-            if (LOS_Obscurred2) {
-                // offset other side and repeat check
-                targetmod = target + Vec3f::fromPolar(32, AngleToTarget - TrigLUT.uIntegerHalfPi, 0);
-                frommod = from + Vec3f::fromPolar(32, AngleToTarget - TrigLUT.uIntegerHalfPi, 0);
-                LOS_Obscurred = Check_LOS_Obscurred_Indoors(targetmod, frommod);
-            }
-        }
-    } else if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) {
-        // TODO(pskelton): Need to add check against terrain
-        // check straight point to point
-        LOS_ObscurredStr = Check_LOS_Obscurred_Outdoors_Bmodels(target, from);
-
-        if (LOS_ObscurredStr) {
-            // offset 32 to side and check LOS
-            Vec3f targetmod = target + Vec3f::fromPolar(32, AngleToTarget + TrigLUT.uIntegerHalfPi, 0);
-            Vec3f frommod = from + Vec3f::fromPolar(32, AngleToTarget + TrigLUT.uIntegerHalfPi, 0);
-            LOS_Obscurred2 = Check_LOS_Obscurred_Outdoors_Bmodels(targetmod, frommod);
-
-            if (LOS_Obscurred2) {
-                // offset other side and repeat check
-                targetmod = target + Vec3f::fromPolar(32, AngleToTarget - TrigLUT.uIntegerHalfPi, 0);
-                frommod = from + Vec3f::fromPolar(32, AngleToTarget - TrigLUT.uIntegerHalfPi, 0);
-                LOS_Obscurred = Check_LOS_Obscurred_Outdoors_Bmodels(targetmod, frommod);
-            }
-        }
-    }
-
-    bool result{ !LOS_Obscurred2 || !LOS_Obscurred || !LOS_ObscurredStr };
-    return result;  // true if LOS clear
-}
-
-bool Check_LOS_Obscurred_Indoors(const Vec3f &target, const Vec3f &from) {  // true if obscurred
-    Vec3f dir = from - target;
-    float dist = dir.length();
-    dir.normalize();
-
-    BBoxf bbox = BBoxf::forPoints(from, target);
-
-    for (int sectargetrflip = 0; sectargetrflip < 2; sectargetrflip++) {
-        int SectargetrID = 0;
-        if (sectargetrflip)
-            SectargetrID = pIndoor->GetSector(target);
-        else
-            SectargetrID = pIndoor->GetSector(from);
-
-        // loop over sectargetr faces
-        for (int FaceLoop = 0; FaceLoop < pIndoor->pSectors[SectargetrID].uNumFaces; ++FaceLoop) {
-            BLVFace *face = &pIndoor->pFaces[pIndoor->pSectors[SectargetrID].pFaceIDs[FaceLoop]];
-            if (face->isPortal() || face->Ethereal())
-                continue;
-
-            // dot product
-            float dirDotNormal = dot(dir, face->facePlane.normal);
-            bool FaceIsParallel = fuzzyIsNull(dirDotNormal);
-            if (FaceIsParallel)
-                continue;
-
-            // skip further checks
-            if (!bbox.intersects(face->pBounding))
-                continue;
-
-            float NegFacePlaceDist = -face->facePlane.signedDistanceTo(target);
-            // are we on same side of plane
-            if (dirDotNormal <= 0) {
-                if (NegFacePlaceDist > 0)
-                    continue;
-            } else {
-                if (NegFacePlaceDist < 0)
-                    continue;
-            }
-
-            // TODO(captainurist): what's going on in this check?
-            if (std::abs(NegFacePlaceDist) / 16384.0f <= std::abs(dirDotNormal)) {
-                float IntersectionDist = NegFacePlaceDist / dirDotNormal;
-                // less than zero means intersection is behind target point
-                // greater than dist means intersection is behind the caster
-                if (IntersectionDist >= 0.0 && IntersectionDist <= dist) {
-                    Vec3f pos = target + (IntersectionDist * dir);
-                    if (face->Contains(pos, MODEL_INDOOR)) {
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-
-    return false;
-}
-
-bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from) {  // true is obscurred
-    Vec3f dir = from - target;
-    float dist = dir.length();
-    dir.normalize();
-
-    BBoxf bbox = BBoxf::forPoints(from, target);
-
-    for (BSPModel &model : pOutdoor->pBModels) {
-        if (CalcDistPointToLine(target.x, target.y, from.x, from.y, model.vPosition.x, model.vPosition.y) <= model.sBoundingRadius + 128) {
-            for (ODMFace &face : model.pFaces) {
-                if (face.Ethereal()) continue;
-
-                float dirDotNormal = dot(dir, face.facePlane.normal);
-                bool FaceIsParallel = fuzzyIsNull(dirDotNormal);
-                if (FaceIsParallel)
-                    continue;
-
-                // bounds check
-                if (!bbox.intersects(face.pBoundingBox))
-                    continue;
-
-                // point target plane distacne
-                float NegFacePlaceDist = -face.facePlane.signedDistanceTo(target);
-
-                // are we on same side of plane
-                if (dirDotNormal <= 0) {
-                    // angle obtuse - is target underneath plane
-                    if (NegFacePlaceDist > 0)
-                        continue;  // can never hit
-                } else {
-                    // angle acute - is target above plane
-                    if (NegFacePlaceDist < 0)
-                        continue;  // can never hit
-                }
-
-                if (std::abs(NegFacePlaceDist) / 16384.0f <= std::abs(dirDotNormal)) {
-                    // calc how far along line interesction is
-                    float IntersectionDist = NegFacePlaceDist /  dirDotNormal;
-                    // less than zero means intersection is behind target point
-                    // greater than dist means intersection is behind the caster
-                    if (IntersectionDist >= 0.0 && IntersectionDist <= dist) {
-                        Vec3f pos = target + IntersectionDist * dir;
-                        if (face.Contains(pos, model.index)) {
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    return false;
-}
-
 //----- (0046A334) --------------------------------------------------------
 // TODO(Nik-RE-dev): does not belong here, it's common function for interaction for both indoor/outdoor
 // TODO(Nik-RE-dev): get rid of external function declaration inside
@@ -2033,16 +1896,64 @@ void SpawnRandomTreasure(MapInfo *mapInfo, SpawnPoint *a2) {
     a1a.Create(0, 0, 0, 0);
 }
 
+namespace {
+struct BillboardLightingEntry {
+    int sectorId;
+    Vec3i cell;
+    int billboard;
+};
+} // namespace
+
 //----- (0043F515) --------------------------------------------------------
 void FindBillboardsLightLevels_BLV() {
+    std::vector<BillboardLightingEntry> entries;
     for (unsigned i = 0; i < uNumBillboardsToDraw; ++i) {
-        if (pBillboardRenderList[i].field_1E & 2 ||
-            uCurrentlyLoadedLevelType == LEVEL_INDOOR &&
-                !pBillboardRenderList[i].uIndoorSectorID)
+        const RenderBillboard &billboard = pBillboardRenderList[i];
+        if (billboard.field_1E & 2 || uCurrentlyLoadedLevelType == LEVEL_INDOOR && !billboard.uIndoorSectorID) {
             pBillboardRenderList[i].dimming_level = 0;
-        else
-            pBillboardRenderList[i].dimming_level =
-                _43F55F_get_billboard_light_level(&pBillboardRenderList[i], -1);
+        } else {
+            Vec3i cell(std::floor(billboard.world_x / LIGHT_GRID_CELL_SIZE),
+                       std::floor(billboard.world_y / LIGHT_GRID_CELL_SIZE),
+                       std::floor(billboard.world_z / LIGHT_GRID_CELL_SIZE));
+            entries.push_back({billboard.uIndoorSectorID, cell, static_cast<int>(i)});
+        }
+    }
+
+    // Light billboards cell by cell, so that lights are gathered once per sector & grid cell and then applied in a
+    // batch. Billboard index is the last key, so the order is deterministic.
+    auto key = [](const BillboardLightingEntry &e) { return std::tuple(e.sectorId, e.cell.x, e.cell.y, e.cell.z); };
+    std::ranges::sort(entries, std::less(), [&](const BillboardLightingEntry &e) {
+        return std::tuple_cat(key(e), std::tuple(e.billboard));
+    });
+
+    std::vector<Vec3f> points;
+    std::vector<int> lightLevels;
+    PointLightList lights;
+    for (size_t begin = 0, end = 0; begin < entries.size(); begin = end) {
+        int sectorId = entries[begin].sectorId;
+
+        points.clear();
+        lightLevels.clear();
+        BBoxf bounds;
+        for (end = begin; end < entries.size() && key(entries[end]) == key(entries[begin]); ++end) {
+            const RenderBillboard &billboard = pBillboardRenderList[entries[end].billboard];
+            Vec3f point(billboard.world_x, billboard.world_y, billboard.world_z);
+            bounds = end == begin ? BBoxf::forPoints(point, point) : bounds | BBoxf::forPoints(point, point);
+            points.push_back(point);
+
+            // Same base level as in _43F55F_get_billboard_light_level.
+            if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+                lightLevels.push_back(pIndoor->pSectors[sectorId].uMinAmbientLightLevel);
+            } else {
+                lightLevels.push_back(billboard.dimming_level);
+            }
+        }
+
+        GatherPointLights(&lights, sectorId, bounds);
+        GetLightLevelsAtPoints(lights, points, lightLevels);
+
+        for (size_t i = begin; i < end; ++i)
+            pBillboardRenderList[entries[i].billboard].dimming_level = lightLevels[i - begin];
     }
 }
 
@@ -17,6 +17,7 @@
 
 struct BspRenderer;
 struct IndoorLocation;
+struct IndoorLocation_MM7;
 struct MapInfo;
 
 struct BLVLight {
@@ -212,6 +213,15 @@ struct IndoorLocation {
 
     void Release();
     void Load(std::string_view filename, int num_days_played, int respawn_interval_days, bool *indoor_was_respawned);
+
+    /**
+     * Parses base level data from `games.lod`. This is the part of the level that never changes at runtime.
+     *
+     * @param filename                  Map file name, e.g. `"d01.blv"`.
+     * @return                          Parsed base level data.
+     * @throws Exception                If the file doesn't exist.
+     */
+    static std::shared_ptr<const IndoorLocation_MM7> loadBaseData(std::string_view filename);
     void Draw();
 
     /**
@@ -247,6 +257,11 @@ struct IndoorLocation {
     DecalBuilder *decal_builder = nullptr;
     SpellFxRenderer *spell_fx_renderer = nullptr;
     std::shared_ptr<ParticleEngine> particle_engine = nullptr;
+
+    // Base level data to use in the next `Load` call instead of parsing it from `games.lod`, used only if the file
+    // name matches. Reset by `Load`, see `EngineController::restoreWorld`.
+    std::string preloadedFilename;
+    std::shared_ptr<const IndoorLocation_MM7> preloadedData;
 };
 
 extern IndoorLocation *pIndoor;
@@ -339,29 +354,4 @@ float GetIndoorFloorZ(const Vec3f &pos, int *pSectorID, int *pFaceID = nullptr);
  */
 float GetApproximateIndoorFloorZ(const Vec3f &pos, int *pSectorID, int *pFaceID = nullptr);
 
-/**
- * @param target                         Vec3f of position to check line of sight to
- * @param from                           Vec3f of position to check line of sight from
- *
- * @return                              True if line of sight clear to target
- */
-bool Check_LineOfSight(const Vec3f &target, const Vec3f &from);
-
-
-/**
- * @param target                         Vec3f of position to check line of sight to
- * @param from                           Vec3f of position to check line of sight from
- *
- * @return                              True if line of sight obscurred by level geometery
- */
-bool Check_LOS_Obscurred_Indoors(const Vec3f &target, const Vec3f &from);
-
-/**
- * @param target                         Vec3f of position to check line of sight to
- * @param from                           Vec3f of position to check line of sight from
- *
- * @return                              True if line of sight obscurred by outdoor models
- */
-bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from);
-
 extern BspRenderer *pBspRenderer;
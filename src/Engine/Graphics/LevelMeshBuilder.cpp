@@ -0,0 +1,357 @@
+#include "LevelMeshBuilder.h"
+
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Engine/Graphics/BSPModel.h"
+#include "Engine/Graphics/Image.h"
+#include "Engine/Graphics/ImageLoader.h"
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LightmapBuilder.h"
+#include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/TextureFrameTable.h"
+#include "Engine/Engine.h"
+#include "Engine/EngineFileSystem.h"
+#include "Engine/LodTextureCache.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/Exception.h"
+
+static constexpr char LEVEL_MESH_CACHE_MAGIC[8] = {'O', 'E', 'M', 'E', 'S', 'H', 0, 0};
+static constexpr uint32_t LEVEL_MESH_CACHE_VERSION = 1;
+static constexpr int LEVEL_MESH_MAX_TEXTURE_SIZE = 4096; // Sanity check for the cached data.
+static constexpr int WATER_LAYERS = 7;
+
+template<class Callback>
+static void forEachLevelFace(LevelType type, Callback &&callback) {
+    if (type == LEVEL_INDOOR) {
+        for (BLVFace &face : pIndoor->pFaces)
+            callback(face, !face.isPortal());
+    } else {
+        for (BSPModel &model : pOutdoor->pBModels)
+            for (ODMFace &face : model.pFaces)
+                callback(face, !face.Invisible());
+    }
+}
+
+template<class Face>
+static std::vector<std::string> collectFaceTextures(Face &face) {
+    std::vector<std::string> result;
+    if (!face.GetTexture())
+        return result;
+
+    if (!face.IsTextureFrameTable()) {
+        result.push_back(face.GetTexture()->GetName());
+        return result;
+    }
+
+    // Run down the animation, collecting all the frames.
+    // TODO(pskelton): any instances where animTime is not consistent would need checking
+    int64_t frameId = reinterpret_cast<int64_t>(face.resource);
+    Duration animLength = pTextureFrameTable->textureFrameAnimLength(frameId);
+    Duration frame;
+    GraphicsImage *texture = pTextureFrameTable->GetFrameTexture(frameId, frame);
+    while (texture) {
+        result.push_back(texture->GetName());
+        frame += pTextureFrameTable->textureFrameAnimTime(frameId);
+        if (frame >= animLength)
+            break;
+        texture = pTextureFrameTable->GetFrameTexture(frameId, frame);
+    }
+    return result;
+}
+
+static LevelMeshSource collectLevelMeshSource(LevelType type) {
+    LevelMeshSource result;
+    result.type = type;
+    result.saturation = engine->config->graphics.Saturation.value();
+    result.lightness = engine->config->graphics.Lightness.value();
+    forEachLevelFace(type, [&](auto &face, bool drawn) {
+        result.faceTextures.push_back(drawn ? collectFaceTextures(face) : std::vector<std::string>());
+    });
+    return result;
+}
+
+static std::string waterLayerName(int index) {
+    return fmt::format("HDWTR{:03}", index);
+}
+
+void extendLevelMesh(const LevelMeshSource &source, const LodReader &reader, LevelMesh *mesh) {
+    if (mesh->layout.empty()) {
+        // Reserve first layers for water tiles in unit 0.
+        RgbaImage water = loadBitmapRgbaImage(reader, waterLayerName(0), source.saturation, source.lightness);
+        Sizei waterSize(water.width(), water.height());
+        for (int i = 0; i < WATER_LAYERS; i++) {
+            std::string name = waterLayerName(i);
+            mesh->layout.insert(name, waterSize);
+            mesh->images.emplace(name, i == 0 ? std::move(water) :
+                                       loadBitmapRgbaImage(reader, name, source.saturation, source.lightness));
+        }
+    }
+
+    mesh->faceSlots.assign(source.faceTextures.size(), std::nullopt);
+    for (size_t i = 0; i < source.faceTextures.size(); i++) {
+        std::optional<TextureArraySlot> slot;
+        for (const std::string &name : source.faceTextures[i]) {
+            slot = mesh->layout.find(name);
+            if (slot)
+                continue;
+
+            if (name == "wtrtyl") {
+                slot = TextureArraySlot(); // Water tile, drawn from the reserved layers.
+                continue;
+            }
+
+            RgbaImage image = loadBitmapRgbaImage(reader, name, source.saturation, source.lightness);
+            slot = mesh->layout.insert(name, Sizei(image.width(), image.height()));
+            if (slot) {
+                mesh->images.emplace(name, std::move(image));
+            } else {
+                logger->warning("Level mesh texture arrays are full, can't add texture '{}'", name);
+                slot = TextureArraySlot();
+            }
+        }
+        mesh->faceSlots[i] = slot;
+    }
+}
+
+static void hashAppend(uint64_t *hash, const void *data, size_t size) {
+    // FNV-1a.
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; i++) {
+        *hash ^= bytes[i];
+        *hash *= 0x100000001b3ull;
+    }
+}
+
+uint64_t levelMeshSourceHash(const LevelMeshSource &source, const LodReader &reader) {
+    uint64_t result = 0xcbf29ce484222325ull;
+
+    // Decoded textures depend on the palette settings.
+    hashAppend(&result, &source.saturation, sizeof(source.saturation));
+    hashAppend(&result, &source.lightness, sizeof(source.lightness));
+
+    std::unordered_set<std::string> hashed;
+    auto hashTexture = [&](const std::string &name) {
+        hashAppend(&result, name.data(), name.size() + 1);
+        if (!hashed.insert(name).second || !reader.exists(name))
+            return;
+        Blob raw = reader.read(name); // Raw LOD entry, no decompression.
+        hashAppend(&result, raw.data(), raw.size());
+    };
+
+    for (int i = 0; i < WATER_LAYERS; i++)
+        hashTexture(waterLayerName(i));
+    for (const std::vector<std::string> &textures : source.faceTextures) {
+        uint32_t size = textures.size();
+        hashAppend(&result, &size, sizeof(size));
+        for (const std::string &name : textures)
+            hashTexture(name);
+    }
+    return result;
+}
+
+Blob compileLevelMeshCache(const LevelMesh &mesh, uint64_t sourceHash) {
+    Blob result;
+    BlobOutputStream stream(&result);
+    stream.write(LEVEL_MESH_CACHE_MAGIC, sizeof(LEVEL_MESH_CACHE_MAGIC));
+    serialize(LEVEL_MESH_CACHE_VERSION, &stream);
+    serialize(sourceHash, &stream);
+
+    for (const TextureArrayUnit &unit : mesh.layout.units()) {
+        serialize(static_cast<int32_t>(unit.size.w), &stream);
+        serialize(static_cast<int32_t>(unit.size.h), &stream);
+        serialize(static_cast<uint32_t>(unit.layers.size()), &stream);
+        for (const std::string &name : unit.layers) {
+            const RgbaImage &image = mesh.images.at(name);
+            serialize(name, &stream);
+            serialize(static_cast<int32_t>(image.width()), &stream);
+            serialize(static_cast<int32_t>(image.height()), &stream);
+            stream.write(image.pixels().data(), image.pixels().size_bytes());
+        }
+    }
+
+    stream.close();
+    return result;
+}
+
+bool loadLevelMeshCache(const Blob &blob, uint64_t sourceHash, LevelMesh *mesh) {
+    try {
+        BlobInputStream stream(blob);
+
+        char magic[sizeof(LEVEL_MESH_CACHE_MAGIC)];
+        uint32_t version = 0;
+        uint64_t hash = 0;
+        if (stream.read(magic, sizeof(magic)) != sizeof(magic) ||
+            memcmp(magic, LEVEL_MESH_CACHE_MAGIC, sizeof(magic)) != 0)
+            return false;
+        deserialize(stream, &version);
+        deserialize(stream, &hash);
+        if (version != LEVEL_MESH_CACHE_VERSION || hash != sourceHash)
+            return false;
+
+        // Inserting the textures unit by unit reproduces the original layout.
+        for (int i = 0; i < TextureArrayLayout::MAX_UNITS; i++) {
+            int32_t width = 0, height = 0;
+            uint32_t layers = 0;
+            deserialize(stream, &width);
+            deserialize(stream, &height);
+            deserialize(stream, &layers);
+
+            for (uint32_t j = 0; j < layers; j++) {
+                std::string name;
+                int32_t imageWidth = 0, imageHeight = 0;
+                deserialize(stream, &name);
+                deserialize(stream, &imageWidth);
+                deserialize(stream, &imageHeight);
+                if (imageWidth <= 0 || imageHeight <= 0 || imageWidth > LEVEL_MESH_MAX_TEXTURE_SIZE ||
+                    imageHeight > LEVEL_MESH_MAX_TEXTURE_SIZE)
+                    return false;
+
+                RgbaImage image = RgbaImage::uninitialized(imageWidth, imageHeight);
+                if (stream.read(image.pixels().data(), image.pixels().size_bytes()) != image.pixels().size_bytes())
+                    return false;
+
+                std::optional<TextureArraySlot> slot = mesh->layout.insert(name, Sizei(width, height));
+                if (slot != TextureArraySlot(i, static_cast<int>(j)))
+                    return false;
+                mesh->images.emplace(std::move(name), std::move(image));
+            }
+        }
+        return true;
+    } catch (const std::exception &) {
+        return false; // Truncated file.
+    }
+}
+
+/**
+ * Runs on a worker thread, so it must not touch anything but its arguments & the thread-safe LOD reader.
+ *
+ * @param source                        Level faces & palette settings, collected on the game thread.
+ * @param reader                        Reader for `bitmaps.lod`.
+ * @param useCache                      Whether the level mesh cache is enabled.
+ * @param cache                         Contents of the cache file, empty if there is none.
+ * @return                              Built mesh, and new contents for the cache file if it needs to be rewritten.
+ */
+static LevelMeshBuilder::BuildResult buildLevelMesh(const LevelMeshSource &source, const LodReader &reader,
+                                                    bool useCache, const Blob &cache) {
+    LevelMeshBuilder::BuildResult result;
+    result.mesh.type = source.type;
+
+    if (!useCache) {
+        extendLevelMesh(source, reader, &result.mesh);
+        return result;
+    }
+
+    uint64_t sourceHash = levelMeshSourceHash(source, reader);
+    if (cache) {
+        if (loadLevelMeshCache(cache, sourceHash, &result.mesh)) {
+            extendLevelMesh(source, reader, &result.mesh); // Only recalculates face slots, all textures are there.
+            return result;
+        }
+        result.mesh = LevelMesh();
+        result.mesh.type = source.type;
+    }
+
+    extendLevelMesh(source, reader, &result.mesh);
+    result.cache = compileLevelMeshCache(result.mesh, sourceHash);
+    return result;
+}
+
+LevelMeshBuilder::LevelMeshBuilder() = default;
+
+LevelMeshBuilder::~LevelMeshBuilder() {
+    if (_future.valid())
+        _future.wait();
+}
+
+void LevelMeshBuilder::start(LevelType type, std::string_view mapName) {
+    assert(type == LEVEL_INDOOR || type == LEVEL_OUTDOOR);
+
+    if (_future.valid())
+        _future.wait();
+    _future = {};
+    _mesh.reset();
+    _mapName = mapName;
+    _cachePath.clear();
+
+    // The user filesystem is not thread-safe, so the cache is read here, and written in finish().
+    Blob cache;
+    if (engine->config->debug.LevelMeshCache.value() && !mapName.empty()) {
+        _cachePath = fmt::format("cache/meshes/{}.bin", mapName);
+        if (ufs->exists(_cachePath))
+            cache = ufs->read(_cachePath);
+    }
+
+    // Decoding only touches the LOD reader, which is thread-safe. The rest of the texture cache is not.
+    _future = std::async(std::launch::async, [source = collectLevelMeshSource(type), useCache = !_cachePath.empty(),
+                                              cache = std::move(cache), reader = &pBitmaps_LOD->reader()] {
+        return buildLevelMesh(source, *reader, useCache, cache);
+    });
+}
+
+void LevelMeshBuilder::finish() {
+    if (!_future.valid())
+        return;
+
+    BuildResult result = _future.get();
+    LevelMesh mesh = std::move(result.mesh);
+
+    if (result.cache) {
+        try {
+            ufs->write(_cachePath, result.cache);
+        } catch (const std::exception &e) {
+            logger->warning("Could not write level mesh cache '{}': {}", _cachePath, e.what());
+        }
+    }
+
+    // Level scripts might have changed some of the face textures while we were building the mesh.
+    extendLevelMesh(collectLevelMeshSource(mesh.type), pBitmaps_LOD->reader(), &mesh);
+
+    size_t index = 0;
+    forEachLevelFace(mesh.type, [&](auto &face, bool) {
+        if (const std::optional<TextureArraySlot> &slot = mesh.faceSlots[index++]) {
+            face.texunit = slot->unit;
+            face.texlayer = slot->layer;
+        }
+    });
+
+    if (mesh.type == LEVEL_INDOOR) {
+        // Kludge for getting lights in visible sectors.
+        int lightsWithoutSector = 0;
+        for (unsigned i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i) {
+            StationaryLight &light = pStationaryLightsStack->pLights[i];
+            light.uSectorID = pIndoor->GetSector(light.vPosition);
+            if (light.uSectorID == 0)
+                lightsWithoutSector++;
+        }
+        if (lightsWithoutSector)
+            logger->warning("{} lights - sector not found", lightsWithoutSector);
+    }
+
+    _mesh = std::move(mesh);
+}
+
+LevelMesh LevelMeshBuilder::take(LevelType type) {
+    finish();
+
+    if (!_mesh || _mesh->type != type) {
+        start(type, {}); // No caching for out-of-band rebuilds.
+        finish();
+    }
+
+    LevelMesh result = std::move(*_mesh);
+    _mesh.reset();
+    return result;
+}
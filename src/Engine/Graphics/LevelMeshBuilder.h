@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/MapEnums.h"
+
+#include "Library/Image/Image.h"
+#include "Library/Image/TextureArrayLayout.h"
+
+#include "Utility/Memory/Blob.h"
+
+class LodReader;
+
+/**
+ * CPU side of the level geometry that the renderer needs to draw a level, built without touching the renderer.
+ */
+struct LevelMesh {
+    LevelType type = LEVEL_NULL;
+
+    /** Texture array layout for all level faces. */
+    TextureArrayLayout layout;
+
+    /** Texture slot for each level face, `std::nullopt` for faces that are not drawn. Indoors this is indexed by face
+     * id, outdoors faces of all models are laid out one after another. */
+    std::vector<std::optional<TextureArraySlot>> faceSlots;
+
+    /** Decoded textures for all the layers in `layout`, by texture name. Renderer is expected to upload these. */
+    std::unordered_map<std::string, RgbaImage> images;
+};
+
+/**
+ * Everything that's needed to build a level mesh, collected on the game thread.
+ */
+struct LevelMeshSource {
+    LevelType type = LEVEL_NULL;
+    std::vector<std::vector<std::string>> faceTextures; // All textures that a face can show, empty if not drawn.
+    float saturation = 1.0f; // Palette settings that the textures are decoded with.
+    float lightness = 1.0f;
+};
+
+/**
+ * Adds all the textures from `source` into `mesh`, decoding the ones that are not there yet, and recalculates face
+ * texture slots. Can be called repeatedly for the same mesh, e.g. when face textures change.
+ *
+ * @param source                        Level faces & palette settings.
+ * @param reader                        Reader for `bitmaps.lod`.
+ * @param mesh                          Mesh to extend.
+ */
+void extendLevelMesh(const LevelMeshSource &source, const LodReader &reader, LevelMesh *mesh);
+
+/**
+ * @param source                        Level faces & palette settings.
+ * @param reader                        Reader for `bitmaps.lod`.
+ * @return                              Hash of everything that the decoded textures of a level mesh depend on.
+ */
+uint64_t levelMeshSourceHash(const LevelMeshSource &source, const LodReader &reader);
+
+/**
+ * @param mesh                          Mesh to store.
+ * @param sourceHash                    Hash of the mesh source, as returned by `levelMeshSourceHash`.
+ * @return                              Contents of the level mesh cache file for the provided mesh. Only the texture
+ *                                      layout & the decoded textures are stored, face slots are not.
+ */
+Blob compileLevelMeshCache(const LevelMesh &mesh, uint64_t sourceHash);
+
+/**
+ * @param blob                          Contents of the level mesh cache file.
+ * @param sourceHash                    Expected hash of the mesh source.
+ * @param[out] mesh                     Empty mesh to load the texture layout & the decoded textures into. Face slots
+ *                                      are not set, use `extendLevelMesh` to calculate them.
+ * @return                              Whether the cache was loaded. Returns false if the cache is corrupted or is
+ *                                      for a different source, in which case the mesh is left in an unspecified state.
+ */
+bool loadLevelMeshCache(const Blob &blob, uint64_t sourceHash, LevelMesh *mesh);
+
+/**
+ * Builds `LevelMesh` for the currently loaded level.
+ *
+ * Mesh building happens in two steps. `start` collects the face textures, the palette settings and the cached mesh on
+ * the calling thread, and then decodes the textures & packs them into texture arrays on a worker thread, while the
+ * rest of the level is loading. `finish` then waits for the worker, writes out the cache, picks up the faces that have
+ * changed textures in the meantime, and writes the results back into the level data.
+ *
+ * If `debug.level_mesh_cache` is set, the decoded textures are also stored in the user cache folder, keyed by the map
+ * name and a hash of the face textures and of the source LOD data, so that the next load of the same map doesn't
+ * need to decode anything.
+ */
+class LevelMeshBuilder {
+ public:
+    LevelMeshBuilder();
+    ~LevelMeshBuilder();
+
+    /**
+     * Starts building the mesh for the level that was just loaded. Must be called from the game thread, after the
+     * level geometry is loaded. Any mesh that was built before & wasn't taken is dropped.
+     *
+     * @param type                      Type of the loaded level.
+     * @param mapName                   Map file name, used as the cache key.
+     */
+    void start(LevelType type, std::string_view mapName);
+
+    /**
+     * Waits for the mesh that was started with `start`, and finalizes it. Does nothing if there is nothing to finish.
+     * Must be called from the game thread, before the level geometry is modified. The worker thread is joined when
+     * this function returns.
+     */
+    void finish();
+
+    /**
+     * @param type                      Type of the level that the caller wants a mesh for.
+     * @return                          Mesh that was built for the current level, or a newly built mesh if there
+     *                                  is none, e.g. because the previous one was already taken.
+     */
+    [[nodiscard]] LevelMesh take(LevelType type);
+
+    /**
+     * Result of the worker thread, see `start`.
+     */
+    struct BuildResult {
+        LevelMesh mesh;
+        Blob cache; // New contents for the level mesh cache file, empty if it doesn't need to be written.
+    };
+
+ private:
+    std::string _mapName;
+    std::string _cachePath; // Empty if the mesh that's being built is not cached.
+    std::future<BuildResult> _future;
+    std::optional<LevelMesh> _mesh;
+};
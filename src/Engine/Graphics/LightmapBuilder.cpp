@@ -1,5 +1,8 @@
 #include "LightmapBuilder.h"
 
+#include <algorithm>
+#include <cassert>
+
 // TODO(pskelton): rename - lighting functions
 
 #include "Engine/Engine.h"
@@ -36,6 +39,15 @@ void DrawLightsDebugOutlines(
     //}
 }
 
+/**
+ * Outdoor version of `_43F55F_get_billboard_light_level` that uses the lights effect precomputed by
+ * `FindBillboardsLightLevels_ODM`. Returns the same result.
+ */
+static int billboardLightLevelODM(const RenderBillboard *pBillboard, int uBaseLightLevel) {
+    int lightLevel = uBaseLightLevel == -1 ? pBillboard->dimming_level : uBaseLightLevel;
+    return std::clamp(lightLevel + pBillboard->lightLevelDelta, 0, 31);
+}
+
 /**
  *
  * @param max_dimm                      Maximum dimming level allowed (0-31). 31 * 8 ~ 255.
@@ -60,7 +72,7 @@ Color GetActorTintColor(int max_dimm, int min_dimm, float distance, int bNoLight
 
     if (isNight) {
         dimminglevel = 216;
-        if (pBillboard) dimminglevel = 8 * _43F55F_get_billboard_light_level(pBillboard, dimminglevel >> 3);
+        if (pBillboard) dimminglevel = 8 * billboardLightLevelODM(pBillboard, dimminglevel >> 3);
         dimminglevel = std::clamp(dimminglevel, 0, 216);
         return Color(255 - dimminglevel, 255 - dimminglevel, 255 - dimminglevel);
     }
@@ -78,7 +90,7 @@ Color GetActorTintColor(int max_dimm, int min_dimm, float distance, int bNoLight
 
     dimminglevel = static_cast<int>(rangewidth + floorf(pOutdoor->fFogDensity * fog_density_mult + 0.5f));
 
-    if (pBillboard) dimminglevel = 8 * _43F55F_get_billboard_light_level(pBillboard, dimminglevel >> 3);
+    if (pBillboard) dimminglevel = 8 * billboardLightLevelODM(pBillboard, dimminglevel >> 3);
     dimminglevel = std::clamp(dimminglevel, rangewidth, 216);
     if (dimminglevel > 8 * pOutdoor->max_terrain_dimming_level)
         dimminglevel = 8 * pOutdoor->max_terrain_dimming_level;
@@ -95,6 +107,53 @@ Color GetActorTintColor(int max_dimm, int min_dimm, float distance, int bNoLight
     }
 }
 
+namespace {
+
+/**
+ * Branch-free version of the original per-light check, so that the batch loop in `GetLightLevelsAtPoints` can be
+ * vectorized. Computes exactly the same value as the original nested range checks & `int_get_vector_length` call.
+ *
+ * @param distX, distY, distZ           Absolute per-axis distances from the light to the point.
+ * @param lightRadius                   Light radius.
+ * @return                              Change in dimming level caused by the light, zero if the light doesn't reach
+ *                                      the point.
+ */
+inline int lightLevelDelta(float distX, float distY, float distZ, float lightRadius) {
+    bool inRange = distX <= lightRadius && distY <= lightRadius && distZ <= lightRadius;
+
+    // Clamping doesn't change in-range distances, but keeps the int conversion defined for far away points.
+    int x = static_cast<int>(std::min(distX, lightRadius));
+    int y = static_cast<int>(std::min(distY, lightRadius));
+    int z = static_cast<int>(std::min(distZ, lightRadius));
+
+    // Same as int_get_vector_length, w/o the swaps.
+    int max = std::max(std::max(x, y), z);
+    int min = std::min(std::min(x, y), z);
+    int mid = x + y + z - max - min;
+    unsigned int approx_distance = max + (11 * mid >> 5) + (min >> 2);
+
+    // Radius is integral, so std::max only guards against division by zero for zero-radius lights, which never
+    // pass the checks below anyway.
+    int delta = static_cast<int>(30 * approx_distance / std::max(lightRadius, 1.0f)) - 30;
+    return inRange && approx_distance < lightRadius ? delta : 0;
+}
+
+} // namespace
+
+void PointLightList::clear() {
+    x.clear();
+    y.clear();
+    z.clear();
+    radius.clear();
+}
+
+void PointLightList::add(const Vec3f &pos, float lightRadius) {
+    x.push_back(pos.x);
+    y.push_back(pos.y);
+    z.push_back(pos.z);
+    radius.push_back(lightRadius);
+}
+
 /**
  * @offset 0x0043F5C8.
  *
@@ -106,30 +165,12 @@ Color GetActorTintColor(int max_dimm, int min_dimm, float distance, int bNoLight
  */
 int GetLightLevelAtPoint(unsigned int uBaseLightLevel, int uSectorID, float x, float y, float z) {
     int lightlevel = uBaseLightLevel;
-    float light_radius{};
-    float distX{};
-    float distY{};
-    float distZ{};
-    unsigned int approx_distance;
 
     // mobile lights
     for (unsigned i = 0; i < pMobileLightsStack->uNumLightsActive; ++i) {
         MobileLight *p = &pMobileLightsStack->pLights[i];
-        light_radius = p->uRadius;
-
-        distX = std::abs(p->vPosition.x - x);
-        if (distX <= light_radius) {
-            distY = std::abs(p->vPosition.y - y);
-            if (distY <= light_radius) {
-                distZ = std::abs(p->vPosition.z - z);
-                if (distZ <= light_radius) {
-                    approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
-                    if (approx_distance < light_radius)
-                        //* ORIGONAL */lightlevel += ((uint64_t)(30i64 *(signed int)(approx_distance << 16) / light_radius) >> 16) - 30;
-                        lightlevel += static_cast<int> (30 * approx_distance / light_radius) - 30;
-                }
-            }
-        }
+        lightlevel += lightLevelDelta(std::abs(p->vPosition.x - x), std::abs(p->vPosition.y - y),
+                                      std::abs(p->vPosition.z - z), p->uRadius);
     }
 
     // sector lights
@@ -138,48 +179,73 @@ int GetLightLevelAtPoint(unsigned int uBaseLightLevel, int uSectorID, float x, f
 
         for (unsigned i = 0; i < pSector->uNumLights; ++i) {
             BLVLight *this_light = &pIndoor->pLights[pSector->pLights[i]];
-            light_radius = this_light->uRadius;
-
-            if (~this_light->uAtributes & 8) {
-                distX = std::abs(this_light->vPosition.x - x);
-                if (distX <= light_radius) {
-                    distY = std::abs(this_light->vPosition.y - y);
-                    if (distY <= light_radius) {
-                        distZ = std::abs(this_light->vPosition.z - z);
-                        if (distZ <= light_radius) {
-                            approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
-                            if (approx_distance < light_radius)
-                                lightlevel += static_cast<int> (30 * approx_distance / light_radius) - 30;
-                        }
-                    }
-                }
-            }
+            if (~this_light->uAtributes & 8)
+                lightlevel += lightLevelDelta(std::abs(this_light->vPosition.x - x), std::abs(this_light->vPosition.y - y),
+                                              std::abs(this_light->vPosition.z - z), this_light->uRadius);
         }
     }
 
     // stationary lights
     for (unsigned i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i) {
         StationaryLight *p = &pStationaryLightsStack->pLights[i];
-        light_radius = p->uRadius;
-
-        distX = std::abs(p->vPosition.x - x);
-        if (distX <= light_radius) {
-            distY = std::abs(p->vPosition.y - y);
-            if (distY <= light_radius) {
-                distZ = std::abs(p->vPosition.z - z);
-                if (distZ <= light_radius) {
-                    approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY), static_cast<int>(distZ));
-                    if (approx_distance < light_radius)
-                        lightlevel += static_cast<int> (30 * approx_distance / light_radius) - 30;
-                }
-            }
-        }
+        lightlevel += lightLevelDelta(std::abs(p->vPosition.x - x), std::abs(p->vPosition.y - y),
+                                      std::abs(p->vPosition.z - z), p->uRadius);
     }
 
     lightlevel = std::clamp(lightlevel, 0, 31);
     return lightlevel;
 }
 
+void GatherPointLights(PointLightList *lights, int uSectorID, const BBoxf &bounds) {
+    lights->clear();
+
+    // Lights that can't reach the bounds contribute nothing & are skipped. Bounds are inflated by a unit so that
+    // float rounding can't make us drop a light that would have been in range.
+    auto addLight = [&](const Vec3f &pos, int radius) {
+        if (radius > 0 && bounds.intersectsCube(pos, radius + 1.0f))
+            lights->add(pos, radius);
+    };
+
+    for (unsigned i = 0; i < pMobileLightsStack->uNumLightsActive; ++i)
+        addLight(pMobileLightsStack->pLights[i].vPosition, pMobileLightsStack->pLights[i].uRadius);
+
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        BLVSector *pSector = &pIndoor->pSectors[uSectorID];
+        for (unsigned i = 0; i < pSector->uNumLights; ++i) {
+            BLVLight *this_light = &pIndoor->pLights[pSector->pLights[i]];
+            if (~this_light->uAtributes & 8)
+                addLight(this_light->vPosition, this_light->uRadius);
+        }
+    }
+
+    for (unsigned i = 0; i < pStationaryLightsStack->uNumLightsActive; ++i)
+        addLight(pStationaryLightsStack->pLights[i].vPosition, pStationaryLightsStack->pLights[i].uRadius);
+}
+
+void GetLightLevelsAtPoints(const PointLightList &lights, std::span<const Vec3f> points, std::span<int> lightLevels) {
+    AddLightLevelsAtPoints(lights, points, lightLevels);
+
+    for (int &lightLevel : lightLevels)
+        lightLevel = std::clamp(lightLevel, 0, 31);
+}
+
+void AddLightLevelsAtPoints(const PointLightList &lights, std::span<const Vec3f> points, std::span<int> lightLevels) {
+    assert(points.size() == lightLevels.size());
+
+    // Deltas are integers and clamping only happens at the end, so accumulating light-by-light gives the same result
+    // as the point-by-point loop in GetLightLevelAtPoint. Inner loop is over points and vectorizes.
+    for (size_t i = 0; i < lights.size(); ++i) {
+        float lightX = lights.x[i];
+        float lightY = lights.y[i];
+        float lightZ = lights.z[i];
+        float lightRadius = lights.radius[i];
+
+        for (size_t j = 0; j < points.size(); ++j)
+            lightLevels[j] += lightLevelDelta(std::abs(lightX - points[j].x), std::abs(lightY - points[j].y),
+                                              std::abs(lightZ - points[j].z), lightRadius);
+    }
+}
+
 /**
  * @offset 0x0043F55F.
  *
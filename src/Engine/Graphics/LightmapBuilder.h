@@ -1,5 +1,11 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/Vec.h"
+
 // TODO(pskelton): rename - lighting functions
 
 struct LightsStack_StationaryLight_;
@@ -8,9 +14,59 @@ struct RenderBillboard;
 
 #define LIGHTMAP_FLAGS_USE_SPECULAR 0x01
 
+// Size of the grid cells that billboards are bucketed into for lighting. Lights are gathered once per cell, so lights
+// that are far away from all the billboards in a cell are skipped.
+constexpr float LIGHT_GRID_CELL_SIZE = 1024.0f;
+
 extern LightsStack_StationaryLight_ *pStationaryLightsStack;
 extern LightsStack_MobileLight_ *pMobileLightsStack;
 
 void DrawLightsDebugOutlines(char bit_one_for_list1__bit_two_for_list2);
 int _43F55F_get_billboard_light_level(const RenderBillboard *a1, int uBaseLightLevel);
 int GetLightLevelAtPoint(unsigned int uBaseLightLevel, int uSectorID, float x, float y, float z);
+
+/**
+ * Point lights affecting a batch of points, stored in SoA layout so that `GetLightLevelsAtPoints` can process
+ * several points at once.
+ */
+struct PointLightList {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> radius;
+
+    void clear();
+    void add(const Vec3f &pos, float lightRadius);
+    [[nodiscard]] size_t size() const { return x.size(); }
+};
+
+/**
+ * Collects all the lights that `GetLightLevelAtPoint` would consider for the given sector, skipping the ones that
+ * can't reach `bounds`.
+ *
+ * @param lights                        List to fill, cleared first.
+ * @param uSectorID                     Sector ID if indoors or 0.
+ * @param bounds                        Bounding box of the points that will be lit.
+ */
+void GatherPointLights(PointLightList *lights, int uSectorID, const BBoxf &bounds);
+
+/**
+ * Batched version of `GetLightLevelAtPoint`, results are identical to calling it for each of the points.
+ *
+ * @param lights                        Lights to apply, as returned by `GatherPointLights`.
+ * @param points                        Co-ords of the points.
+ * @param lightLevels                   Base dimming levels (0-31) on input, dimming levels with lights effect added
+ *                                      on output. Must be the same size as `points`.
+ */
+void GetLightLevelsAtPoints(const PointLightList &lights, std::span<const Vec3f> points, std::span<int> lightLevels);
+
+/**
+ * Same as `GetLightLevelsAtPoints`, but doesn't clamp the results. Useful when the base dimming levels are not yet
+ * known, as clamping `base + delta` to 0-31 afterwards gives the same result as `GetLightLevelAtPoint`.
+ *
+ * @param lights                        Lights to apply, as returned by `GatherPointLights`.
+ * @param points                        Co-ords of the points.
+ * @param lightLevels                   Dimming levels to add the lights effect to. Must be the same size as
+ *                                      `points`.
+ */
+void AddLightLevelsAtPoints(const PointLightList &lights, std::span<const Vec3f> points, std::span<int> lightLevels);
@@ -0,0 +1,456 @@
+#include "LineOfSight.h"
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LocationFunctions.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/OurMath.h"
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/Plane.h"
+
+#include "Utility/Math/Float.h"
+#include "Utility/Math/TrigLut.h"
+
+namespace {
+
+/** Side of a single cell in the outdoor line of sight grid. */
+constexpr int LOS_GRID_CELL_SIZE = 1024;
+
+LineOfSightRay makeLosRay(const Vec3f &target, const Vec3f &from) {
+    LineOfSightRay result;
+    result.target = target;
+    result.dir = from - target;
+    result.dist = result.dir.length();
+    result.dir.normalize();
+    result.bbox = BBoxf::forPoints(from, target);
+    return result;
+}
+
+/**
+ * Ray/plane part of the ray/face test. Both scalar and batched checks go through this function, so that they
+ * produce bitwise identical results.
+ *
+ * @param ray                           Ray to test.
+ * @param plane                         Face plane.
+ * @param[out] pos                      Intersection point.
+ * @return                              Whether the ray intersects the plane between its endpoints.
+ */
+bool intersectLosRayWithPlane(const LineOfSightRay &ray, const Planef &plane, Vec3f *pos) {
+    float dirDotNormal = dot(ray.dir, plane.normal);
+    if (fuzzyIsNull(dirDotNormal))
+        return false;
+
+    float negFacePlaneDist = -plane.signedDistanceTo(ray.target);
+
+    // are we on same side of plane
+    if (dirDotNormal <= 0) {
+        if (negFacePlaneDist > 0)
+            return false; // angle obtuse - target is underneath plane, can never hit
+    } else {
+        if (negFacePlaneDist < 0)
+            return false; // angle acute - target is above plane, can never hit
+    }
+
+    // TODO(captainurist): what's going on in this check?
+    if (!(std::abs(negFacePlaneDist) / 16384.0f <= std::abs(dirDotNormal)))
+        return false;
+
+    // calc how far along line interesction is
+    float intersectionDist = negFacePlaneDist / dirDotNormal;
+
+    // less than zero means intersection is behind target point
+    // greater than dist means intersection is behind the caster
+    if (!(intersectionDist >= 0.0 && intersectionDist <= ray.dist))
+        return false;
+
+    *pos = ray.target + intersectionDist * ray.dir;
+    return true;
+}
+
+bool losRayHitsSector(const LineOfSightRay &ray, int sectorId) {
+    const BLVSector &sector = pIndoor->pSectors[sectorId];
+    for (int i = 0; i < sector.uNumFaces; ++i) {
+        const BLVFace &face = pIndoor->pFaces[sector.pFaceIDs[i]];
+        if (face.isPortal() || face.Ethereal())
+            continue;
+
+        if (!ray.bbox.intersects(face.pBounding))
+            continue;
+
+        Vec3f pos;
+        if (intersectLosRayWithPlane(ray, face.facePlane, &pos) && face.Contains(pos, MODEL_INDOOR))
+            return true;
+    }
+    return false;
+}
+
+bool losRayPassesModel(const LineOfSightQuery &query, const BSPModel &model) {
+    return CalcDistPointToLine(query.target.x, query.target.y, query.from.x, query.from.y, model.vPosition.x, model.vPosition.y) <= model.sBoundingRadius + 128;
+}
+
+bool losRayHitsOutdoorFace(const LineOfSightRay &ray, const ODMFace &face, int modelIndex) {
+    Vec3f pos;
+    return intersectLosRayWithPlane(ray, face.facePlane, &pos) && face.Contains(pos, modelIndex);
+}
+
+void checkObscuredIndoors(std::span<const LineOfSightQuery> queries, std::span<bool> obscured) {
+    // Batched queries usually share one of the endpoints, e.g. the position of an AOE attack, so we cache the last
+    // sector lookup for each endpoint.
+    Vec3f lastFrom, lastTarget;
+    int lastFromSector = -1, lastTargetSector = -1;
+
+    for (size_t i = 0; i < queries.size(); i++) {
+        if (obscured[i])
+            continue;
+
+        const LineOfSightQuery &query = queries[i];
+        LineOfSightRay ray = makeLosRay(query.target, query.from);
+
+        if (lastFromSector == -1 || !(lastFrom == query.from)) {
+            lastFrom = query.from;
+            lastFromSector = pIndoor->GetSector(query.from);
+        }
+        if (losRayHitsSector(ray, lastFromSector)) {
+            obscured[i] = true;
+            continue;
+        }
+
+        if (lastTargetSector == -1 || !(lastTarget == query.target)) {
+            lastTarget = query.target;
+            lastTargetSector = pIndoor->GetSector(query.target);
+        }
+        obscured[i] = losRayHitsSector(ray, lastTargetSector);
+    }
+}
+
+/**
+ * Single-ray version of `checkObscuredOutdoors`. Faces spanning several cells might be tested more than once, which
+ * doesn't change the result.
+ */
+bool checkObscuredOutdoors(const LineOfSightQuery &query) {
+    const OutdoorLineOfSightGrid &grid = pOutdoor->lineOfSightGrid;
+    if (grid.width == 0)
+        return false; // No models.
+
+    LineOfSightRay ray = makeLosRay(query.target, query.from);
+    int cx1 = grid.cellX(ray.bbox.x1), cx2 = grid.cellX(ray.bbox.x2);
+    int cy1 = grid.cellY(ray.bbox.y1), cy2 = grid.cellY(ray.bbox.y2);
+    for (int cy = cy1; cy <= cy2; cy++) {
+        for (int cx = cx1; cx <= cx2; cx++) {
+            int cell = cy * grid.width + cx;
+            for (uint32_t j = grid.cellStarts[cell]; j < grid.cellStarts[cell + 1]; j++) {
+                uint32_t faceIndex = grid.cellFaces[j];
+                if (!ray.bbox.intersects(grid.faceBounds[faceIndex]))
+                    continue;
+
+                const BSPModel &model = pOutdoor->pBModels[grid.modelIds[faceIndex]];
+                const ODMFace &face = model.pFaces[grid.faceIds[faceIndex]];
+                if (face.Ethereal())
+                    continue;
+
+                if (losRayPassesModel(query, model) && losRayHitsOutdoorFace(ray, face, model.index))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+void checkObscuredOutdoors(std::span<const LineOfSightQuery> queries, std::span<bool> obscured, LineOfSightBuffers *buffers) {
+    OutdoorLineOfSightGrid &grid = pOutdoor->lineOfSightGrid;
+    LineOfSightBuffers &buf = *buffers;
+    if (grid.width == 0)
+        return; // No models.
+
+    buf.rays.clear();
+    buf.rayIndices.clear();
+    BBoxf batchBounds;
+    for (size_t i = 0; i < queries.size(); i++) {
+        if (obscured[i])
+            continue;
+
+        LineOfSightRay &ray = buf.rays.emplace_back(makeLosRay(queries[i].target, queries[i].from));
+        buf.rayIndices.push_back(i);
+        batchBounds = buf.rays.size() == 1 ? ray.bbox : (batchBounds | ray.bbox);
+    }
+
+    size_t rayCount = buf.rays.size();
+    if (rayCount == 0)
+        return;
+
+    buf.x1.resize(rayCount);
+    buf.x2.resize(rayCount);
+    buf.y1.resize(rayCount);
+    buf.y2.resize(rayCount);
+    buf.z1.resize(rayCount);
+    buf.z2.resize(rayCount);
+    buf.candidates.resize(rayCount);
+    for (size_t i = 0; i < rayCount; i++) {
+        const BBoxf &bbox = buf.rays[i].bbox;
+        buf.x1[i] = bbox.x1;
+        buf.x2[i] = bbox.x2;
+        buf.y1[i] = bbox.y1;
+        buf.y2[i] = bbox.y2;
+        buf.z1[i] = bbox.z1;
+        buf.z2[i] = bbox.z2;
+    }
+
+    size_t modelCount = pOutdoor->pBModels.size();
+    buf.modelCulls.assign(rayCount * modelCount, -1);
+
+    // Gather the faces from all the cells that the batch touches.
+    if (++grid.stamp == 0) {
+        std::ranges::fill(grid.faceStamps, 0);
+        grid.stamp = 1;
+    }
+    buf.faces.clear();
+    int cx1 = grid.cellX(batchBounds.x1), cx2 = grid.cellX(batchBounds.x2);
+    int cy1 = grid.cellY(batchBounds.y1), cy2 = grid.cellY(batchBounds.y2);
+    for (int cy = cy1; cy <= cy2; cy++) {
+        for (int cx = cx1; cx <= cx2; cx++) {
+            int cell = cy * grid.width + cx;
+            for (uint32_t j = grid.cellStarts[cell]; j < grid.cellStarts[cell + 1]; j++) {
+                uint32_t face = grid.cellFaces[j];
+                if (grid.faceStamps[face] == grid.stamp)
+                    continue;
+                grid.faceStamps[face] = grid.stamp;
+                buf.faces.push_back(face);
+            }
+        }
+    }
+
+    size_t unresolved = rayCount;
+    for (uint32_t faceIndex : buf.faces) {
+        const BBoxf &bounds = grid.faceBounds[faceIndex];
+        if (!batchBounds.intersects(bounds))
+            continue;
+
+        int modelIndex = grid.modelIds[faceIndex];
+        const BSPModel &model = pOutdoor->pBModels[modelIndex];
+        const ODMFace &face = model.pFaces[grid.faceIds[faceIndex]];
+        if (face.Ethereal())
+            continue; // Can be changed at runtime, so it's not baked into the grid.
+
+        // Bounding box prefilter for all rays in the batch, this loop is auto-vectorized.
+        uint8_t anyCandidates = 0;
+        for (size_t i = 0; i < rayCount; i++) {
+            uint8_t candidate =
+                (bounds.x1 <= buf.x2[i]) & (bounds.x2 >= buf.x1[i]) &
+                (bounds.y1 <= buf.y2[i]) & (bounds.y2 >= buf.y1[i]) &
+                (bounds.z1 <= buf.z2[i]) & (bounds.z2 >= buf.z1[i]);
+            buf.candidates[i] = candidate;
+            anyCandidates |= candidate;
+        }
+        if (!anyCandidates)
+            continue;
+
+        for (size_t i = 0; i < rayCount; i++) {
+            if (!buf.candidates[i])
+                continue;
+
+            int rayIndex = buf.rayIndices[i];
+            if (obscured[rayIndex])
+                continue;
+
+            int8_t &cull = buf.modelCulls[i * modelCount + modelIndex];
+            if (cull == -1)
+                cull = !losRayPassesModel(queries[rayIndex], model);
+            if (cull)
+                continue;
+
+            if (losRayHitsOutdoorFace(buf.rays[i], face, model.index)) {
+                obscured[rayIndex] = true;
+                if (--unresolved == 0)
+                    return;
+            }
+        }
+    }
+}
+
+bool checkObscured(const LineOfSightQuery &query) {
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        return Check_LOS_Obscurred_Indoors(query.target, query.from);
+    } else {
+        return checkObscuredOutdoors(query);
+    }
+}
+
+LineOfSightQuery sideQuery(const LineOfSightQuery &query, int side) {
+    const Vec3f &target = query.target;
+    const Vec3f &from = query.from;
+    int angleToTarget = TrigLUT.atan2(from.x - target.x, from.y - target.y);
+    return {target + Vec3f::fromPolar(32, angleToTarget + side * TrigLUT.uIntegerHalfPi, 0),
+            from + Vec3f::fromPolar(32, angleToTarget + side * TrigLUT.uIntegerHalfPi, 0)};
+}
+
+} // namespace
+
+//----- (00407A1C) --------------------------------------------------------
+bool Check_LineOfSight(const Vec3f &target, const Vec3f &from) {  // target from - true on clear
+    if (uCurrentlyLoadedLevelType != LEVEL_INDOOR && uCurrentlyLoadedLevelType != LEVEL_OUTDOOR)
+        return true;
+
+    // TODO(pskelton): Need to add check against terrain
+    // check straight point to point
+    LineOfSightQuery query = {target, from};
+    if (!checkObscured(query))
+        return true;
+
+    // If obscured, offset 32 to side and check LOS, then offset the other side and repeat the check.
+    for (int side : {1, -1})
+        if (!checkObscured(sideQuery(query, side)))
+            return true;
+    return false;
+}
+
+void Check_LineOfSight(std::span<const LineOfSightQuery> queries, std::span<bool> results, LineOfSightBuffers *buffers) {
+    assert(queries.size() == results.size());
+
+    // Results hold the "obscured" flag until the very end.
+    std::ranges::fill(results, false);
+
+    if (uCurrentlyLoadedLevelType != LEVEL_INDOOR && uCurrentlyLoadedLevelType != LEVEL_OUTDOOR) {
+        std::ranges::fill(results, true);
+        return;
+    }
+
+    // TODO(pskelton): Need to add check against terrain
+    // check straight point to point
+    Check_LOS_Obscurred(queries, results, buffers);
+
+    // If obscured, offset 32 to side and check LOS, then offset the other side and repeat the check.
+    LineOfSightBuffers &buf = *buffers;
+    for (int side : {1, -1}) {
+        buf.sideQueries.clear();
+        buf.sideIndices.clear();
+        for (size_t i = 0; i < queries.size(); i++) {
+            if (!results[i])
+                continue;
+
+            buf.sideQueries.push_back(sideQuery(queries[i], side));
+            buf.sideIndices.push_back(i);
+        }
+
+        if (buf.sideQueries.empty())
+            break;
+
+        std::span<bool> sideObscured = buf.sideObscured.resize(buf.sideQueries.size());
+        std::ranges::fill(sideObscured, false);
+        Check_LOS_Obscurred(buf.sideQueries, sideObscured, buffers);
+        for (size_t i = 0; i < buf.sideQueries.size(); i++)
+            results[buf.sideIndices[i]] = sideObscured[i];
+    }
+
+    for (bool &result : results)
+        result = !result; // true if LOS clear
+}
+
+void Check_LOS_Obscurred(std::span<const LineOfSightQuery> queries, std::span<bool> obscured, LineOfSightBuffers *buffers) {
+    assert(queries.size() == obscured.size());
+
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        checkObscuredIndoors(queries, obscured);
+    } else if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) {
+        checkObscuredOutdoors(queries, obscured, buffers);
+    }
+}
+
+bool Check_LOS_Obscurred_Indoors(const Vec3f &target, const Vec3f &from) {  // true if obscurred
+    LineOfSightRay ray = makeLosRay(target, from);
+    return losRayHitsSector(ray, pIndoor->GetSector(from)) || losRayHitsSector(ray, pIndoor->GetSector(target));
+}
+
+bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from) {  // true is obscurred
+    LineOfSightQuery query = {target, from};
+    LineOfSightRay ray = makeLosRay(target, from);
+
+    for (const BSPModel &model : pOutdoor->pBModels) {
+        if (!losRayPassesModel(query, model))
+            continue;
+
+        for (const ODMFace &face : model.pFaces) {
+            if (face.Ethereal())
+                continue;
+
+            // bounds check
+            if (!ray.bbox.intersects(face.pBoundingBox))
+                continue;
+
+            if (losRayHitsOutdoorFace(ray, face, model.index))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+void OutdoorLineOfSightGrid::build(const std::vector<BSPModel> &models) {
+    OutdoorLineOfSightGrid &grid = *this;
+    grid = OutdoorLineOfSightGrid();
+
+    BBoxf bounds;
+    bool first = true;
+    for (size_t modelId = 0; modelId < models.size(); modelId++) {
+        const BSPModel &model = models[modelId];
+        for (size_t faceId = 0; faceId < model.pFaces.size(); faceId++) {
+            const ODMFace &face = model.pFaces[faceId];
+            grid.modelIds.push_back(modelId);
+            grid.faceIds.push_back(faceId);
+            grid.faceBounds.push_back(face.pBoundingBox);
+            bounds = first ? face.pBoundingBox : (bounds | face.pBoundingBox);
+            first = false;
+        }
+    }
+
+    if (grid.faceBounds.empty())
+        return;
+
+    grid.originX = std::floor(bounds.x1);
+    grid.originY = std::floor(bounds.y1);
+    grid.width = static_cast<int>((bounds.x2 - grid.originX) / LOS_GRID_CELL_SIZE) + 1;
+    grid.height = static_cast<int>((bounds.y2 - grid.originY) / LOS_GRID_CELL_SIZE) + 1;
+    grid.faceStamps.assign(grid.faceBounds.size(), 0);
+
+    // Counting sort of face references into cells.
+    grid.cellStarts.assign(grid.width * grid.height + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        for (uint32_t face = 0; face < grid.faceBounds.size(); face++) {
+            const BBoxf &faceBounds = grid.faceBounds[face];
+            for (int cy = grid.cellY(faceBounds.y1); cy <= grid.cellY(faceBounds.y2); cy++) {
+                for (int cx = grid.cellX(faceBounds.x1); cx <= grid.cellX(faceBounds.x2); cx++) {
+                    int cell = cy * grid.width + cx;
+                    if (pass == 0) {
+                        grid.cellStarts[cell + 1]++;
+                    } else {
+                        grid.cellFaces[grid.cellStarts[cell]++] = face;
+                    }
+                }
+            }
+        }
+
+        if (pass == 0) {
+            for (size_t i = 1; i < grid.cellStarts.size(); i++)
+                grid.cellStarts[i] += grid.cellStarts[i - 1];
+            grid.cellFaces.resize(grid.cellStarts.back());
+        } else {
+            // Second pass has shifted the starts by one cell, shift them back.
+            for (size_t i = grid.cellStarts.size() - 1; i > 0; i--)
+                grid.cellStarts[i] = grid.cellStarts[i - 1];
+            grid.cellStarts[0] = 0;
+        }
+    }
+}
+
+int OutdoorLineOfSightGrid::cellX(float x) const {
+    return std::clamp(static_cast<int>(std::floor((x - originX) / LOS_GRID_CELL_SIZE)), 0, width - 1);
+}
+
+int OutdoorLineOfSightGrid::cellY(float y) const {
+    return std::clamp(static_cast<int>(std::floor((y - originY) / LOS_GRID_CELL_SIZE)), 0, height - 1);
+}
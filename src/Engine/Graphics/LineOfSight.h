@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/Vec.h"
+
+struct BSPModel;
+
+struct LineOfSightQuery {
+    Vec3f target; // Position to check line of sight to.
+    Vec3f from; // Position to check line of sight from.
+};
+
+struct LineOfSightRay {
+    Vec3f target;
+    Vec3f dir;
+    float dist = 0;
+    BBoxf bbox;
+};
+
+/**
+ * Uniform XY grid over all model faces of an outdoor level. Face bounding boxes are stored in SoA layout so that the
+ * bounding box prefilter runs over a batch of rays at once.
+ *
+ * @see OutdoorLocation::lineOfSightGrid
+ */
+struct OutdoorLineOfSightGrid {
+    int originX = 0;
+    int originY = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> cellStarts; // Size is width * height + 1, offsets into cellFaces.
+    std::vector<uint32_t> cellFaces; // Indices into the per-face arrays below.
+
+    std::vector<uint16_t> modelIds;
+    std::vector<uint16_t> faceIds;
+    std::vector<BBoxf> faceBounds;
+    std::vector<uint32_t> faceStamps; // Scratch, used to deduplicate faces that span several cells.
+    uint32_t stamp = 0;
+
+    /**
+     * Rebuilds the grid. Must be called after the models of an outdoor level are loaded, face attributes are read
+     * live and can change afterwards.
+     *
+     * @param models                    Models of the outdoor level.
+     */
+    void build(const std::vector<BSPModel> &models);
+
+    [[nodiscard]] int cellX(float x) const;
+    [[nodiscard]] int cellY(float y) const;
+};
+
+/**
+ * Reusable array of bools for batch results. Needed because `std::vector<bool>` can't be viewed as a
+ * `std::span<bool>`.
+ */
+class LineOfSightResults {
+ public:
+    /**
+     * @param size                      Number of results.
+     * @return                          Span of `size` bools, valid until the next call. Contents are unspecified.
+     */
+    std::span<bool> resize(size_t size) {
+        if (size > _capacity) {
+            _data = std::make_unique<bool[]>(size);
+            _capacity = size;
+        }
+        return {_data.get(), size};
+    }
+
+ private:
+    std::unique_ptr<bool[]> _data;
+    size_t _capacity = 0;
+};
+
+/**
+ * Scratch buffers for the batched line of sight checks. Owned by the caller and reused between calls, so that the
+ * checks don't allocate once the buffers have grown.
+ */
+struct LineOfSightBuffers {
+    std::vector<LineOfSightRay> rays;
+    std::vector<int> rayIndices; // Indices into the queries span.
+
+    // Ray bounding boxes in SoA layout.
+    std::vector<float> x1, x2, y1, y2, z1, z2;
+    std::vector<uint8_t> candidates;
+
+    std::vector<int8_t> modelCulls; // [ray * modelCount + model], -1 means not yet calculated.
+    std::vector<uint32_t> faces;
+
+    std::vector<LineOfSightQuery> sideQueries;
+    std::vector<int> sideIndices;
+    LineOfSightResults sideObscured;
+};
+
+/**
+ * @param target                         Vec3f of position to check line of sight to
+ * @param from                           Vec3f of position to check line of sight from
+ *
+ * @return                              True if line of sight clear to target
+ */
+bool Check_LineOfSight(const Vec3f &target, const Vec3f &from);
+
+/**
+ * Batched version of `Check_LineOfSight`, returns exactly the same results.
+ *
+ * Same as the single-query version, straight rays are traced first, and the side rays are traced only for the
+ * queries that were obscured.
+ *
+ * @param queries                       Line of sight queries.
+ * @param[out] results                  Output span of the same size as `queries`, true if line of sight is clear.
+ * @param buffers                       Scratch buffers to use.
+ */
+void Check_LineOfSight(std::span<const LineOfSightQuery> queries, std::span<bool> results, LineOfSightBuffers *buffers);
+
+/**
+ * @param target                         Vec3f of position to check line of sight to
+ * @param from                           Vec3f of position to check line of sight from
+ *
+ * @return                              True if line of sight obscurred by level geometery
+ */
+bool Check_LOS_Obscurred_Indoors(const Vec3f &target, const Vec3f &from);
+
+/**
+ * @param target                         Vec3f of position to check line of sight to
+ * @param from                           Vec3f of position to check line of sight from
+ *
+ * @return                              True if line of sight obscurred by outdoor models
+ */
+bool Check_LOS_Obscurred_Outdoors_Bmodels(const Vec3f &target, const Vec3f &from);
+
+/**
+ * Batched version of `Check_LOS_Obscurred_Indoors` & `Check_LOS_Obscurred_Outdoors_Bmodels`, calls into the right one
+ * depending on the currently loaded level type. Returns exactly the same results.
+ *
+ * Indoors, sector lookups are shared between queries with the same endpoints. Outdoors, faces are looked up in
+ * `OutdoorLocation::lineOfSightGrid` instead of walking all the models for each ray.
+ *
+ * @param queries                       Line of sight queries.
+ * @param[out] obscured                 Output span of the same size as `queries`. Entries that are already set to
+ *                                      true are not traced.
+ * @param buffers                       Scratch buffers to use.
+ */
+void Check_LOS_Obscurred(std::span<const LineOfSightQuery> queries, std::span<bool> obscured, LineOfSightBuffers *buffers);
@@ -1,8 +1,13 @@
 #include "Engine/Graphics/Outdoor.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -15,6 +20,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LevelMeshBuilder.h"
 #include "Engine/Graphics/ParticleEngine.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/Viewport.h"
@@ -49,6 +55,8 @@
 
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Parallel/WorkerPool.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/Memory/FreeDeleter.h"
@@ -209,6 +217,7 @@ void OutdoorLocation::ExecDraw(unsigned int bRedraw) {
         render->PrepareDecorationsRenderList_ODM();
 
     render->DrawSpriteObjects();
+    FindBillboardsLightLevels_ODM();
     render->TransformBillboardsAndSetPalettesODM();
 
     // temp hack to show snow every third day in winter
@@ -226,6 +235,7 @@ void OutdoorLocation::ExecDraw(unsigned int bRedraw) {
 
 //----- (00441CFF) --------------------------------------------------------
 void OutdoorLocation::Draw() {
+    MM_PROFILE_ZONE("OutdoorLocation::Draw");
     pOutdoor->ExecDraw(true);
 
     engine->DrawParticles();
@@ -823,6 +833,15 @@ void OutdoorLocation::Release() {
     viewparams->location_minimap = nullptr;
 }
 
+std::shared_ptr<const OutdoorLocation_MM7> OutdoorLocation::loadBaseData(std::string_view filename) {
+    std::string odm_filename = std::string(filename);
+    odm_filename.replace(odm_filename.length() - 4, 4, ".odm");
+
+    std::shared_ptr<OutdoorLocation_MM7> result = std::make_shared<OutdoorLocation_MM7>();
+    deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), result.get()); // read throws.
+    return result;
+}
+
 void OutdoorLocation::Load(std::string_view filename, int days_played, int respawn_interval_days, bool *outdoors_was_respawned) {
     //if (engine->IsUnderwater()) {
     //    pPaletteManager->pPalette_tintColor[0] = 0x10;
@@ -846,12 +865,18 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
         viewparams->location_minimap->Release();
     viewparams->location_minimap = assets->getImage_Solid(minimap_filename);
 
-    std::string odm_filename = std::string(filename);
-    odm_filename.replace(odm_filename.length() - 4, 4, ".odm");
-
-    OutdoorLocation_MM7 location;
-    deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
-    reconstruct(location, this);
+    std::shared_ptr<const OutdoorLocation_MM7> location;
+    if (preloadedFilename == filename) {
+        location = std::move(preloadedData);
+    } else {
+        location = loadBaseData(filename);
+    }
+    preloadedFilename.clear();
+    preloadedData.reset();
+    reconstruct(*location, this);
+    lineOfSightGrid.build(pBModels);
+    bmodelVisibility.invalidate();
+    bmodelVisibility.resetStats();
 
     // ****************.ddm file*********************//
 
@@ -862,7 +887,7 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     OutdoorDelta_MM7 delta;
     if (Blob blob = lod::decodeCompressed(pSave_LOD->read(ddm_filename))) {
         try {
-            deserialize(blob, &delta, tags::context(location));
+            deserialize(blob, &delta, tags::context(*location));
 
             size_t totalFaces = 0;
             for (BSPModel &model : pBModels)
@@ -891,13 +916,13 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     assert(respawnInitial + respawnTimed <= 1);
 
     if (respawnInitial) {
-        deserialize(lod::decodeCompressed(pGames_LOD->read(ddm_filename)), &delta, tags::context(location));
+        deserialize(lod::decodeCompressed(pGames_LOD->read(ddm_filename)), &delta, tags::context(*location));
         *outdoors_was_respawned = true;
     } else if (respawnTimed) {
         auto header = delta.header;
         auto fullyRevealedCells = delta.fullyRevealedCells;
         auto partiallyRevealedCells = delta.partiallyRevealedCells;
-        deserialize(lod::decodeCompressed(pGames_LOD->read(ddm_filename)), &delta, tags::context(location));
+        deserialize(lod::decodeCompressed(pGames_LOD->read(ddm_filename)), &delta, tags::context(*location));
         delta.header = header;
         delta.fullyRevealedCells = fullyRevealedCells;
         delta.partiallyRevealedCells = partiallyRevealedCells;
@@ -1270,11 +1295,31 @@ bool OutdoorLocation::LoadTileGroupIds() {
 //  combined with IndoorLocation::PrepareActorRenderList_BLV() (0043FDED) ----
 //----- (0047B42C) --------------------------------------------------------
 void OutdoorLocation::PrepareActorsDrawList() {
-    unsigned int Angle_To_Cam;   // eax@11
     Duration Cur_Action_Time;    // eax@16
     SpriteFrame *frame;  // eax@24
     int Sprite_Octant;           // [sp+24h] [bp-3Ch]@11
 
+    // view culling, done in parallel as it only depends on the camera
+    actorCulling.resize(pActors.size());
+    render->renderListPool().parallelFor(pActors.size(), RENDER_LIST_CHUNK_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const Actor &actor = pActors[i];
+            BillboardCullInfo &cull = actorCulling[i];
+
+            if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+                cull.inFrustum = pBspRenderer->isSectorVisible(actor.sectorId);
+            } else {
+                cull.inFrustum = IsCylinderInFrustum(actor.pos, actor.radius);
+            }
+            if (!cull.inFrustum)
+                continue;
+
+            int angle = TrigLUT.atan2(actor.pos.x - pCamera3D->vCameraPos.x, actor.pos.y - pCamera3D->vCameraPos.y);
+            cull.octant = ((signed int)(TrigLUT.uIntegerPi + ((signed int)TrigLUT.uIntegerPi >> 3) +
+                                        actor.yawAngle - angle) >> 8) & 7;
+        }
+    });
+
     for (int i = 0; i < pActors.size(); ++i) {
         pActors[i].attributes &= ~ACTOR_VISIBLE;
         if (pActors[i].aiState == Removed || pActors[i].aiState == Disabled) {
@@ -1284,28 +1329,13 @@ void OutdoorLocation::PrepareActorsDrawList() {
         if (uNumBillboardsToDraw >= 500) return;
 
         // view culling
-        if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-            bool onlist = false;
-            for (unsigned j = 0; j < pBspRenderer->uNumVisibleNotEmptySectors; j++) {
-                if (pBspRenderer->pVisibleSectorIDs_toDrawDecorsActorsEtcFrom[j] == pActors[i].sectorId) {
-                    onlist = true;
-                    break;
-                }
-            }
-            if (!onlist) continue;
-        } else {
-            if (!IsCylinderInFrustum(pActors[i].pos, pActors[i].radius)) continue;
-        }
+        if (!actorCulling[i].inFrustum) continue;
 
         int z = pActors[i].pos.z;
         int x = pActors[i].pos.x;
         int y = pActors[i].pos.y;
 
-        Angle_To_Cam = TrigLUT.atan2(pActors[i].pos.x - pCamera3D->vCameraPos.x, pActors[i].pos.y - pCamera3D->vCameraPos.y);
-
-        Sprite_Octant = ((signed int)(TrigLUT.uIntegerPi +
-                                      ((signed int)TrigLUT.uIntegerPi >> 3) + pActors[i].yawAngle -
-                                      Angle_To_Cam) >> 8) & 7;
+        Sprite_Octant = actorCulling[i].octant;
 
         Cur_Action_Time = pActors[i].currentActionTime;
         if (pParty->bTurnBasedModeOn) {
@@ -1595,6 +1625,21 @@ void OutdoorLocation::LoadActualSkyFrame() {
         fmt::format("TERRA{:03}", pParty->uCurrentMinute / 6 + 10 * pParty->uCurrentHour));
 }
 
+const std::vector<bool> &OutdoorLocation::visibleBModels() {
+    VisibilityCacheKey key = VisibilityCacheKey::fromCamera(0);
+    if (bmodelVisibility.tryReuse(key) && pBModelsVisible.size() == pBModels.size())
+        return pBModelsVisible;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    pBModelsVisible.resize(pBModels.size());
+    for (size_t i = 0; i < pBModels.size(); i++)
+        pBModelsVisible[i] = IsBModelInFrustum(pBModels[i], bmodelVisibility.slack());
+
+    bmodelVisibility.store(key, std::chrono::steady_clock::now() - startTime);
+    return pBModelsVisible;
+}
+
 OutdoorLocation::OutdoorLocation() {
     this->decal_builder = EngineIocContainer::ResolveDecalBuilder();
     this->spell_fx_renderer = EngineIocContainer::ResolveSpellFxRenderer();
@@ -2482,6 +2527,8 @@ static void loadAndPrepareODMInternal(MapId mapid, ODMRenderParams *thisa) {
     }
     day_attrib &= ~MAP_WEATHER_FOGGY;
     pOutdoor->Initialize(mapFilename, pParty->GetPlayingTime().toDays() + 1, respawn_interval, &outdoor_was_respawned);
+    if (LevelMeshBuilder *builder = render->levelMeshBuilder())
+        builder->start(LEVEL_OUTDOOR, mapFilename);
 
     if (!(dword_6BE364_game_settings_1 & GAME_SETTINGS_LOADING_SAVEGAME_SKIP_RESPAWN)) {
         Actor::InitializeActors();
@@ -2821,6 +2868,45 @@ double OutdoorLocation::GetPolygonMaxZ(RenderVertexSoft *pVertex, unsigned int u
     return result;
 }
 
+void FindBillboardsLightLevels_ODM() {
+    // Same as in FindBillboardsLightLevels_BLV, lights are gathered once per grid cell. There are no sector lights
+    // outdoors, so there is no need to bucket by sector.
+    auto cellOf = [](const RenderBillboard &billboard) {
+        return std::tuple(std::floor(billboard.world_x / LIGHT_GRID_CELL_SIZE),
+                          std::floor(billboard.world_y / LIGHT_GRID_CELL_SIZE),
+                          std::floor(billboard.world_z / LIGHT_GRID_CELL_SIZE));
+    };
+
+    std::vector<int> order(uNumBillboardsToDraw);
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, std::less(), [&](int i) {
+        return std::tuple_cat(cellOf(pBillboardRenderList[i]), std::tuple(i));
+    });
+
+    std::vector<Vec3f> points;
+    std::vector<int> deltas;
+    PointLightList lights;
+    for (size_t begin = 0, end = 0; begin < order.size(); begin = end) {
+        auto cell = cellOf(pBillboardRenderList[order[begin]]);
+
+        points.clear();
+        BBoxf bounds;
+        for (end = begin; end < order.size() && cellOf(pBillboardRenderList[order[end]]) == cell; ++end) {
+            const RenderBillboard &billboard = pBillboardRenderList[order[end]];
+            Vec3f point(billboard.world_x, billboard.world_y, billboard.world_z);
+            bounds = end == begin ? BBoxf::forPoints(point, point) : bounds | BBoxf::forPoints(point, point);
+            points.push_back(point);
+        }
+        deltas.assign(points.size(), 0);
+
+        GatherPointLights(&lights, 0, bounds);
+        AddLightLevelsAtPoints(lights, points, deltas);
+
+        for (size_t i = begin; i < end; ++i)
+            pBillboardRenderList[order[i]].lightLevelDelta = deltas[i - begin];
+    }
+}
+
 void TeleportToStartingPoint(MapStartPoint point) {
     std::string pName = toString(point);
 
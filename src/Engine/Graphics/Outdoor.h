@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -13,6 +14,9 @@
 #include "Library/Color/Color.h"
 
 #include "BSPModel.h"
+#include "LineOfSight.h"
+#include "RenderEntities.h"
+#include "VisibilityCache.h"
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
@@ -22,6 +26,7 @@ struct SpellFxRenderer;
 class TileDesc;
 struct RenderVertexSoft;
 struct ODMRenderParams;
+struct OutdoorLocation_MM7;
 
 struct OutdoorLocationTileType {
     Tileset tileset;
@@ -59,6 +64,10 @@ struct OutdoorLocationTerrain {
     int field_1C = 0;
 };
 
+// Distance the camera can move before the outdoor model visibility is recomputed, see
+// `OutdoorLocation::visibleBModels`.
+static constexpr float BMODEL_VISIBILITY_SLACK = 256.0f;
+
 struct OutdoorLocation {
     OutdoorLocation();
     // int New_SKY_NIGHT_ID;
@@ -67,6 +76,14 @@ struct OutdoorLocation {
     void CreateDebugLocation();
     void Release();
     void Load(std::string_view filename, int days_played, int respawn_interval_days, bool *outdoors_was_respawned);
+
+    /**
+     * Same as `IndoorLocation::loadBaseData`, but for outdoor maps.
+     *
+     * @param filename                  Map file name, e.g. `"out01.odm"`.
+     */
+    static std::shared_ptr<const OutdoorLocation_MM7> loadBaseData(std::string_view filename);
+
     int getTileIdByTileMapId(signed int a2);
 
     /**
@@ -130,6 +147,14 @@ struct OutdoorLocation {
 
     static void LoadActualSkyFrame();
 
+    /**
+     * Frustum-culls the models. The results are conservative & are reused across frames while the camera keeps
+     * its orientation and stays within `BMODEL_VISIBILITY_SLACK` of where they were computed.
+     *
+     * @return                          Visibility flags, indexed by model position in `pBModels`.
+     */
+    const std::vector<bool> &visibleBModels();
+
     ODMFace &face(Pid pid) {
         assert(pid.type() == OBJECT_Face);
         return pBModels[pid.id() >> 6].pFaces[pid.id() & 0x3F];
@@ -148,6 +173,10 @@ struct OutdoorLocation {
     OutdoorLocationTerrain pTerrain;
     std::array<uint16_t, 128 * 128> pCmap; // Unused
     std::vector<BSPModel> pBModels;
+    std::vector<bool> pBModelsVisible; // See visibleBModels().
+    std::vector<BillboardCullInfo> actorCulling; // Scratch buffer for PrepareActorsDrawList(), indexed by actor id.
+    VisibilityCache bmodelVisibility{BMODEL_VISIBILITY_SLACK};
+    OutdoorLineOfSightGrid lineOfSightGrid; // Face grid for the batched line of sight checks, see `Check_LOS_Obscurred`.
     std::vector<Pid> pFaceIDLIST;
     std::array<uint32_t, 128 * 128> pOMAP;
     GraphicsImage *sky_texture = nullptr;        // signed int sSky_TextureID;
@@ -203,6 +232,10 @@ struct OutdoorLocation {
 
     DecalBuilder *decal_builder = nullptr;
     SpellFxRenderer *spell_fx_renderer = nullptr;
+
+    // Same as in `IndoorLocation`.
+    std::string preloadedFilename;
+    std::shared_ptr<const OutdoorLocation_MM7> preloadedData;
 };
 
 extern OutdoorLocation *pOutdoor;
@@ -218,6 +251,13 @@ void ODM_ProcessPartyActions();
 void SetUnderwaterFog();
 void sub_487DA9();
 
+/**
+ * Computes the point lights effect for all the billboards in `pBillboardRenderList` in a batch, and stores it in
+ * `RenderBillboard::lightLevelDelta`. This is then used instead of `_43F55F_get_billboard_light_level` when the
+ * billboards are transformed, as the base dimming level is only known at that point.
+ */
+void FindBillboardsLightLevels_ODM();
+
 /**
  * @offset 0x4610AA
  */
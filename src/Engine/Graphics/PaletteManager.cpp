@@ -58,15 +58,17 @@ Palette PaletteManager::createGrayscalePalette() {
 }
 
 Palette PaletteManager::createLoadedPalette(const Palette &palette) {
-    Palette result;
-    float satConfig = engine->config->graphics.Saturation.value();
-    float lightConfig = engine->config->graphics.Lightness.value();
+    return createLoadedPalette(palette, engine->config->graphics.Saturation.value(),
+                               engine->config->graphics.Lightness.value());
+}
 
+Palette PaletteManager::createLoadedPalette(const Palette &palette, float saturation, float lightness) {
+    Palette result;
     for (size_t i = 0; i < 256; i++) {
         HsvColorf hsv = palette.colors[i].toColorf().toHsv();
 
-        hsv.v = std::clamp(hsv.v * lightConfig, 0.0f, 1.0f);
-        hsv.s = std::clamp(hsv.s * satConfig, 0.0f, 1.0f);
+        hsv.v = std::clamp(hsv.v * lightness, 0.0f, 1.0f);
+        hsv.s = std::clamp(hsv.s * saturation, 0.0f, 1.0f);
 
         result.colors[i] = hsv.toRgb().toColor();
     }
@@ -27,6 +27,16 @@ class PaletteManager {
     static Palette createGrayscalePalette();
     static Palette createLoadedPalette(const Palette &palette);
 
+    /**
+     * Same as the overload above, but takes the palette settings explicitly, and thus doesn't touch the config. This
+     * makes it safe to call from worker threads.
+     *
+     * @param palette                   Palette to adjust.
+     * @param saturation                Saturation multiplier, see `graphics.Saturation`.
+     * @param lightness                 Lightness multiplier, see `graphics.Lightness`.
+     */
+    static Palette createLoadedPalette(const Palette &palette, float saturation, float lightness);
+
  private:
     std::vector<int> _paletteIds;
     std::vector<Palette> _palettes;
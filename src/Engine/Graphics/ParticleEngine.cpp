@@ -7,6 +7,8 @@
 #include "Engine/OurMath.h"
 #include "Engine/Time/Timer.h"
 
+#include "Library/Profiler/Profiler.h"
+
 #include "Utility/Math/TrigLut.h"
 
 #include "Outdoor.h"
@@ -114,6 +116,7 @@ void ParticleEngine::Draw() {
 }
 
 void ParticleEngine::UpdateParticles() {
+    MM_PROFILE_ZONE("ParticleEngine::UpdateParticles");
     unsigned uCurrentEnd = 0;
     unsigned uCurrentBegin = PARTICLES_ARRAY_SIZE;
 
@@ -30,10 +30,26 @@ struct RenderBillboard {
     int32_t screen_space_z;
     Pid object_pid;
     uint16_t dimming_level;
+    int lightLevelDelta; // Outdoors only, point lights effect at the billboard, see `FindBillboardsLightLevels_ODM`.
     Color sTintColor;
     SpriteFrame *pSpriteFrame;
 };
 
+/**
+ * Camera-dependent part of billboard render list building. Depends only on the camera & the billboard position, so
+ * it's computed for all billboards in parallel before the render list is filled in on the main thread.
+ */
+struct BillboardCullInfo {
+    bool inFrustum = false; // Whether the billboard passed view culling, the rest is only set if it did.
+    int octant = 0; // Sprite octant facing the camera.
+    bool inViewRange = false; // Result of `Camera3D::ViewClip`.
+    int viewX = 0;
+    int viewY = 0;
+    int viewZ = 0;
+    int screenX = 0; // Projected position, only set if `inViewRange` and the billboard is within the view cone.
+    int screenY = 0;
+};
+
 /*   88 */
 struct ODMRenderParams {
     ODMRenderParams() {
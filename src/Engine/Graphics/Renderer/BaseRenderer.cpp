@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "Engine/AssetsManager.h"
 #include "Engine/Engine.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Party.h"
@@ -28,10 +29,14 @@
 #include "Engine/Random/Random.h"
 
 #include "Library/Logger/Logger.h"
+#include "Library/Parallel/WorkerPool.h"
 
 #include "Utility/Math/TrigLut.h"
 #include "Utility/Memory/MemSet.h"
 
+// Billboards are few, but lighting them is expensive, so jobs are smaller than in the culling passes.
+static constexpr size_t TRANSFORM_CHUNK_SIZE = 64;
+
 bool BaseRenderer::Initialize() {
     updateRenderDimensions();
     CreateZBuffer();
@@ -91,6 +96,29 @@ unsigned int BaseRenderer::Billboard_ProbablyAddToListAndSortByZOrder(float z) {
 // TODO: Move this to sprites ?
 // combined with IndoorLocation::PrepareItemsRenderList_BLV() (0044028F)
 void BaseRenderer::DrawSpriteObjects() {
+    // view culling, done in parallel as it only depends on the camera
+    _spriteObjectCulling.resize(pSpriteObjects.size());
+    renderListPool().parallelFor(pSpriteObjects.size(), RENDER_LIST_CHUNK_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const SpriteObject &object = pSpriteObjects[i];
+            BillboardCullInfo &cull = _spriteObjectCulling[i];
+
+            if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+                cull.inFrustum = pBspRenderer->isSectorVisible(object.uSectorID);
+            } else {
+                cull.inFrustum = IsCylinderInFrustum(object.vPosition, 512.0f);
+            }
+            if (!cull.inFrustum)
+                continue;
+
+            // sprite angle to camera
+            int x = object.vPosition.x;
+            int y = object.vPosition.y;
+            unsigned int angle = TrigLUT.atan2(x - pCamera3D->vCameraPos.x, y - pCamera3D->vCameraPos.y);
+            cull.octant = ((TrigLUT.uIntegerPi + (TrigLUT.uIntegerPi >> 3) + object.uFacing - angle) >> 8) & 7;
+        }
+    });
+
     for (unsigned int i = 0; i < pSpriteObjects.size(); ++i) {
         // exit if we are at max sprites
         if (::uNumBillboardsToDraw >= 500) {
@@ -111,18 +139,8 @@ void BaseRenderer::DrawSpriteObjects() {
         int z = object->vPosition.z;
 
         // view culling
-        if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-            bool onlist = false;
-            for (unsigned j = 0; j < pBspRenderer->uNumVisibleNotEmptySectors; j++) {
-                if (pBspRenderer->pVisibleSectorIDs_toDrawDecorsActorsEtcFrom[j] == object->uSectorID) {
-                    onlist = true;
-                    break;
-                }
-            }
-            if (!onlist) continue;
-        } else {
-            if (!IsCylinderInFrustum(object->vPosition, 512.0f)) continue;
-        }
+        const BillboardCullInfo &cull = _spriteObjectCulling[i];
+        if (!cull.inFrustum) continue;
 
         // render as sprte 500 - 9081
         if (spell_fx_renderer->RenderAsSprite(object) ||
@@ -135,9 +153,7 @@ void BaseRenderer::DrawSpriteObjects() {
                 continue;
             }
 
-            // sprite angle to camera
-            unsigned int angle = TrigLUT.atan2(x - pCamera3D->vCameraPos.x, y - pCamera3D->vCameraPos.y);
-            int octant = ((TrigLUT.uIntegerPi + (TrigLUT.uIntegerPi >> 3) + object->uFacing - angle) >> 8) & 7;
+            int octant = cull.octant;
 
             pBillboardRenderList[::uNumBillboardsToDraw].hwsprite = frame->hw_sprites[octant];
             // error catching
@@ -230,6 +246,29 @@ void BaseRenderer::PrepareDecorationsRenderList_ODM() {
     Particle_sw local_0;    // [sp+Ch] [bp-98h]@7
     int v38;                // [sp+88h] [bp-1Ch]@9
 
+    // view culling & projection, done in parallel as they only depend on the camera
+    _decorationCulling.resize(pLevelDecorations.size());
+    renderListPool().parallelFor(pLevelDecorations.size(), RENDER_LIST_CHUNK_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const LevelDecoration &decor = pLevelDecorations[i];
+            BillboardCullInfo &cull = _decorationCulling[i];
+
+            cull.inFrustum = IsCylinderInFrustum(decor.vPosition, 512.0f);
+            if (!cull.inFrustum)
+                continue;
+
+            int angle = TrigLUT.atan2(decor.vPosition.x - pCamera3D->vCameraPos.x,
+                                      decor.vPosition.y - pCamera3D->vCameraPos.y);
+            cull.octant = ((signed int)(TrigLUT.uIntegerPi + ((signed int)TrigLUT.uIntegerPi >> 3) +
+                                        decor._yawAngle - (int64_t)angle) >> 8) & 7;
+
+            cull.inViewRange = pCamera3D->ViewClip(decor.vPosition.x, decor.vPosition.y, decor.vPosition.z,
+                                                   &cull.viewX, &cull.viewY, &cull.viewZ);
+            if (cull.inViewRange && 2 * std::abs(cull.viewX) >= std::abs(cull.viewY))
+                pCamera3D->Project(cull.viewX, cull.viewY, cull.viewZ, &cull.screenX, &cull.screenY);
+        }
+    });
+
     for (unsigned int i = 0; i < pLevelDecorations.size(); ++i) {
         if (::uNumBillboardsToDraw >= 500) {
             logger->warning("Billboards Full");
@@ -237,7 +276,8 @@ void BaseRenderer::PrepareDecorationsRenderList_ODM() {
         }
 
         // view cull
-        if (!IsCylinderInFrustum(pLevelDecorations[i].vPosition, 512.0f)) continue;
+        const BillboardCullInfo &cull = _decorationCulling[i];
+        if (!cull.inFrustum) continue;
 
         // LevelDecoration *decor = &pLevelDecorations[i];
         if ((!(pLevelDecorations[i].uFlags & LEVEL_DECORATION_OBELISK_CHEST) ||
@@ -264,16 +304,8 @@ void BaseRenderer::PrepareDecorationsRenderList_ODM() {
                     // v8 = pSpriteFrameTable->GetFrame(decor_desc->uSpriteID,
                     // v6 + v7);
 
-                    int v10 = TrigLUT.atan2(pLevelDecorations[i].vPosition.x - pCamera3D->vCameraPos.x,
-                                            pLevelDecorations[i].vPosition.y - pCamera3D->vCameraPos.y);
                     v38 = 0;
-                    v13 = ((signed int)(TrigLUT.uIntegerPi +
-                        ((signed int)TrigLUT.uIntegerPi >>
-                            3) +
-                        pLevelDecorations[i]._yawAngle -
-                        (int64_t)v10) >>
-                        8) &
-                        7;
+                    v13 = cull.octant;
                     int v37 = v13;
                     if (frame->uFlags & 2) v38 = 2;
                     if ((256 << v13) & frame->uFlags) v38 |= 4;
@@ -295,28 +327,13 @@ void BaseRenderer::PrepareDecorationsRenderList_ODM() {
                             frame->uGlowRadius, color, _4E94D0_light_type);
                     }  // for light
 
-                       // v17 = (pLevelDecorations[i].vPosition.x -
-                       // pCamera3D->vCameraPos.x) << 16; v40 =
-                       // (pLevelDecorations[i].vPosition.y -
-                       // pCamera3D->vCameraPos.y) << 16;
-                    int party_to_decor_x = static_cast<int>(pLevelDecorations[i].vPosition.x - pCamera3D->vCameraPos.x);
-                    int party_to_decor_y = static_cast<int>(pLevelDecorations[i].vPosition.y - pCamera3D->vCameraPos.y);
-                    int party_to_decor_z = static_cast<int>(pLevelDecorations[i].vPosition.z - pCamera3D->vCameraPos.z);
-
-                    int view_x = 0;
-                    int view_y = 0;
-                    int view_z = 0;
-                    bool visible = pCamera3D->ViewClip(
-                        pLevelDecorations[i].vPosition.x,
-                        pLevelDecorations[i].vPosition.y,
-                        pLevelDecorations[i].vPosition.z, &view_x, &view_y,
-                        &view_z);
-
-                    if (visible) {
+                    int view_x = cull.viewX;
+                    int view_y = cull.viewY;
+
+                    if (cull.inViewRange) {
                         if (2 * std::abs(view_x) >= std::abs(view_y)) {
-                            int projected_x = 0;
-                            int projected_y = 0;
-                            pCamera3D->Project(view_x, view_y, view_z, &projected_x, &projected_y);
+                            int projected_x = cull.screenX;
+                            int projected_y = cull.screenY;
 
                             float _v41 = frame->scale * (pCamera3D->ViewPlaneDistPixels) / (view_x);
 
@@ -382,20 +399,40 @@ void BaseRenderer::TransformBillboardsAndSetPalettesODM() {
     billboard.uViewportW = pViewport->uViewportBR_Y;
     pODMRenderParams->uNumBillboards = ::uNumBillboardsToDraw;
 
+    // error catching, textures are loaded lazily so this has to be done on the main thread
     for (unsigned int i = 0; i < ::uNumBillboardsToDraw; ++i) {
-        RenderBillboard *p = &pBillboardRenderList[i];
-        if (p->hwsprite) {
-            billboard.screen_space_x = p->screen_space_x;
-            billboard.screen_space_y = p->screen_space_y;
-            billboard.screen_space_z = p->screen_space_z;
-            billboard.sParentBillboardID = i;
-            billboard.screenspace_projection_factor_x = p->screenspace_projection_factor_x;
-            billboard.screenspace_projection_factor_y = p->screenspace_projection_factor_y;
-            billboard.sTintColor = p->sTintColor;
-            billboard.object_pid = p->object_pid;
-            billboard.uFlags = p->field_1E;
-
-            TransformBillboard(&billboard, p);
+        Sprite *pSprite = pBillboardRenderList[i].hwsprite;
+        if (pSprite && (pSprite->texture->height() == 0 || pSprite->texture->width() == 0))
+            assert(false);
+    }
+
+    // lighting & vertex transform is done in parallel, then billboards are added to the z-sorted list in order
+    _transformedBillboards.resize(::uNumBillboardsToDraw);
+    renderListPool().parallelFor(::uNumBillboardsToDraw, TRANSFORM_CHUNK_SIZE, [&](size_t begin, size_t end) {
+        SoftwareBillboard local = billboard;
+        for (size_t i = begin; i < end; ++i) {
+            const RenderBillboard *p = &pBillboardRenderList[i];
+            if (!p->hwsprite)
+                continue;
+
+            local.screen_space_x = p->screen_space_x;
+            local.screen_space_y = p->screen_space_y;
+            local.screen_space_z = p->screen_space_z;
+            local.sParentBillboardID = i;
+            local.screenspace_projection_factor_x = p->screenspace_projection_factor_x;
+            local.screenspace_projection_factor_y = p->screenspace_projection_factor_y;
+            local.sTintColor = p->sTintColor;
+            local.object_pid = p->object_pid;
+            local.uFlags = p->field_1E;
+
+            _transformedBillboards[i] = TransformBillboard(&local, p);
+        }
+    });
+
+    for (unsigned int i = 0; i < ::uNumBillboardsToDraw; ++i) {
+        if (pBillboardRenderList[i].hwsprite) {
+            unsigned int index = Billboard_ProbablyAddToListAndSortByZOrder(pBillboardRenderList[i].screen_space_z);
+            pBillboardRenderListD3D[index] = _transformedBillboards[i];
         } else {
             logger->trace("Billboard with no sprite!");
         }
@@ -410,14 +447,11 @@ Color BlendColors(Color a1, Color a2) {
     return Color(red, green, blue, alpha);
 }
 
-void BaseRenderer::TransformBillboard(const SoftwareBillboard *pSoftBillboard, const RenderBillboard *pBillboard) {
+RenderBillboardD3D BaseRenderer::TransformBillboard(const SoftwareBillboard *pSoftBillboard,
+                                                    const RenderBillboard *pBillboard) const {
     Sprite *pSprite = pBillboard->hwsprite;
-    // error catching
-    if (pSprite->texture->height() == 0 || pSprite->texture->width() == 0)
-        assert(false);
-
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(pSoftBillboard->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D result;
+    RenderBillboardD3D *billboard = &result;
 
     float scr_proj_x = pSoftBillboard->screenspace_projection_factor_x;
     float scr_proj_y = pSoftBillboard->screenspace_projection_factor_y;
@@ -502,6 +536,7 @@ void BaseRenderer::TransformBillboard(const SoftwareBillboard *pSoftBillboard, c
     billboard->object_pid = pSoftBillboard->object_pid;
     billboard->sParentBillboardID = pSoftBillboard->sParentBillboardID;
     billboard->PaletteIndex = pBillboard->uPaletteIndex;
+    return result;
 }
 
 void BaseRenderer::MakeParticleBillboardAndPush(SoftwareBillboard *a2,
@@ -693,10 +728,45 @@ void BaseRenderer::DrawSpecialEffectsQuad(GraphicsImage *texture, int palette) {
 
 void BaseRenderer::DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene() {
     engine->draw_debug_outlines();
-    render->DoRenderBillboards_D3D();
+    recordBillboardCommands();
+    render->drawCommandList(commandList);
     spell_fx_renderer->RenderSpecialEffects();
 }
 
+void BaseRenderer::recordBillboardCommands() {
+    commandList.clear();
+
+    float oneon = 1.0f / (pCamera3D->GetNearClip() * 2.0f);
+    float oneof = 1.0f / (pCamera3D->GetFarClip());
+
+    // Billboard list is sorted front to back, and we need to record back to front.
+    for (int i = uNumBillboardsToDraw - 1; i >= 0; --i) {
+        const RenderBillboardD3D &billboard = pBillboardRenderListD3D[i];
+
+        BillboardDrawCommand command;
+        if (billboard.texture) {
+            command.texture = billboard.texture;
+        } else {
+            if (!_effpar03)
+                _effpar03 = assets->getBitmap("effpar03");
+            command.texture = _effpar03;
+        }
+        command.paletteIndex = billboard.PaletteIndex;
+        command.opacity = billboard.opacity;
+        command.depth = (1.0f / billboard.screen_space_z - oneon) / (oneof - oneon);
+        command.screenSpaceZ = billboard.screen_space_z;
+        command.vertices = billboard.pQuads;
+
+        // Triangles have zeroed out 4th vertex.
+        const Vec3f &last = billboard.pQuads[3].pos;
+        command.numVertices = (last.x != 0.0f && last.y != 0.0f && last.z != 0.0f) ? 4 : 3;
+
+        commandList.addBillboard(command);
+    }
+
+    commandList.sort();
+}
+
 void BaseRenderer::PresentBlackScreen() {
     BeginScene2D();
     ClearBlack();
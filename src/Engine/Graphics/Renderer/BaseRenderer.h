@@ -53,7 +53,17 @@ class BaseRenderer : public Renderer {
 
  protected:
     unsigned int Billboard_ProbablyAddToListAndSortByZOrder(float z);
-    void TransformBillboard(const SoftwareBillboard *a2, const RenderBillboard *pBillboard);
+
+    /**
+     * Builds a screen-space billboard. Only reads the scene state, so it's safe to call from several threads at once.
+     */
+    [[nodiscard]] RenderBillboardD3D TransformBillboard(const SoftwareBillboard *a2,
+                                                        const RenderBillboard *pBillboard) const;
+
+    /**
+     * Records the billboards from `pBillboardRenderListD3D` into `commandList`, and sorts the resulting list.
+     */
+    void recordBillboardCommands();
 
  protected:
     Sizei outputRender = {0, 0};
@@ -61,4 +71,12 @@ class BaseRenderer : public Renderer {
 
  private:
     void updateRenderDimensions();
+
+ private:
+    // Per-frame scratch buffers for the parallel render list passes, indexed by object / billboard index.
+    std::vector<BillboardCullInfo> _spriteObjectCulling;
+    std::vector<BillboardCullInfo> _decorationCulling;
+    std::vector<RenderBillboardD3D> _transformedBillboards;
+
+    GraphicsImage *_effpar03 = nullptr; // Drawn for billboards that have no texture, loaded on first use.
 };
@@ -3,6 +3,7 @@
 #include "Engine/EngineGlobals.h"
 #include "Engine/Engine.h"
 #include "Engine/EngineCallObserver.h"
+#include "Engine/FrameArena.h"
 #include "Engine/Graphics/Image.h"
 
 #include "Library/Platform/Application/PlatformApplication.h"
@@ -24,6 +25,7 @@ RgbaImage NullRenderer::ReadScreenPixels() {
 void NullRenderer::ClearTarget(Color uColor) {}
 
 void NullRenderer::Present() {
+    frameArena.reset();
     swapBuffers();
 }
 
@@ -132,12 +134,15 @@ void NullRenderer::DrawIndoorFaces() {}
 
 void NullRenderer::ReleaseTerrain() {}
 void NullRenderer::ReleaseBSP() {}
+LevelMeshBuilder *NullRenderer::levelMeshBuilder() { return nullptr; }
 
 void NullRenderer::DrawTwodVerts() {}
 
 bool NullRenderer::ReloadShaders() { return true; }
 
-void NullRenderer::DoRenderBillboards_D3D() {}
+void NullRenderer::drawCommandList(const RenderCommandList &commands) {
+    commands.validate();
+}
 
 void NullRenderer::beginOverlays() {}
 void NullRenderer::endOverlays() {}
@@ -99,12 +99,13 @@ class NullRenderer : public BaseRenderer {
 
     virtual void ReleaseTerrain() override;
     virtual void ReleaseBSP() override;
+    virtual LevelMeshBuilder *levelMeshBuilder() override;
 
     virtual void DrawTwodVerts() override;
 
     virtual bool ReloadShaders() override;
 
-    virtual void DoRenderBillboards_D3D() override;
+    virtual void drawCommandList(const RenderCommandList &commands) override;
 
     virtual void flushAndScale() override;
     virtual void swapBuffers() override;
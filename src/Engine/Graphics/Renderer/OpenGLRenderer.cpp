@@ -4,8 +4,10 @@
 #include <memory>
 #include <utility>
 #include <map>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <glad/gl.h> // NOLINT: not a C system header.
 
@@ -18,6 +20,7 @@
 #include "Engine/Engine.h"
 #include "Engine/EngineFileSystem.h"
 #include "Engine/EngineGlobals.h"
+#include "Engine/FrameArena.h"
 #include "Engine/Graphics/BspRenderer.h"
 #include "Engine/Graphics/Image.h"
 #include "Engine/Graphics/ImageLoader.h"
@@ -48,6 +51,7 @@
 #include "Library/Logger/Logger.h"
 #include "Library/Geometry/Size.h"
 #include "Library/Image/ImageFunctions.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/String/Format.h"
 #include "Utility/Memory/MemSet.h"
@@ -241,6 +245,14 @@ void OpenGLRenderer::ClearTarget(Color uColor) {
     return;
 }
 
+// Makes sure that `count` more vertices can be written into the vertex store at index `size`. Vertex stores only
+// grow, all the data is streamed to the gpu through a single stream buffer on flush.
+template<class T>
+static void growVertexStore(std::vector<T> &store, int size, int count) {
+    if (store.size() < size + count)
+        store.resize(size + count);
+}
+
 struct linesverts {
     GLfloat x;
     GLfloat y;
@@ -258,12 +270,9 @@ void OpenGLRenderer::BeginLines2D() {
 
     if (lineVAO == 0) {
         glGenVertexArrays(1, &lineVAO);
-        glGenBuffers(1, &lineVBO);
 
         glBindVertexArray(lineVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, lineVBO);
-
-        glBufferData(GL_ARRAY_BUFFER, sizeof(lineshaderstore), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
         // position attribute
         glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(linesverts), (void *)offsetof(linesverts, x));
@@ -278,10 +287,7 @@ void OpenGLRenderer::EndLines2D() {
     if (!linevertscnt) return;
 
     // update buffer
-    glBindBuffer(GL_ARRAY_BUFFER, lineVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(lineshaderstore), NULL, GL_DYNAMIC_DRAW);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(linesverts) * linevertscnt, lineshaderstore);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    int first = _stream_vertices(lineshaderstore, linevertscnt);
 
     glBindVertexArray(lineVAO);
     glEnableVertexAttribArray(0);
@@ -289,12 +295,8 @@ void OpenGLRenderer::EndLines2D() {
 
     lineshader.use();
 
-    //// set projection
-    glUniformMatrix4fv(lineshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    //// set view
-    glUniformMatrix4fv(lineshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
-    glDrawArrays(GL_LINES, 0, (linevertscnt));
+    glDrawArrays(GL_LINES, first, (linevertscnt));
     drawcalls++;
 
     glUseProgram(0);
@@ -526,7 +528,7 @@ struct twodverts {
     GLfloat paletteid;
 };
 
-twodverts twodshaderstore[500] = {};
+std::vector<twodverts> twodshaderstore;
 int twodvertscnt = 0;
 
 void OpenGLRenderer::ScreenFade(Color color, float t) {
@@ -543,6 +545,7 @@ void OpenGLRenderer::ScreenFade(Color color, float t) {
 
     // 0 1 2 / 0 2 3
 
+    growVertexStore(twodshaderstore, twodvertscnt, 6);
     twodshaderstore[twodvertscnt].x = drawx;
     twodshaderstore[twodvertscnt].y = drawy;
     twodshaderstore[twodvertscnt].z = 0;
@@ -605,7 +608,6 @@ void OpenGLRenderer::ScreenFade(Color color, float t) {
     twodshaderstore[twodvertscnt].paletteid = 0;
     twodvertscnt++;
 
-    if (twodvertscnt > 490) DrawTwodVerts();
     return;
 }
 
@@ -641,20 +643,30 @@ void OpenGLRenderer::DrawImage(GraphicsImage *img, const Recti &rect, int palett
     if (clippedRect.isEmpty())
         return;
 
-    float gltexid = static_cast<float>(img->renderId().value());
+    // paletted images are sampled as indices, so they can't go into the rgba atlas
+    TextureAtlasRegion region;
+    if (paletteid) {
+        region.texture = img->renderId();
+    } else {
+        region = _ui_texture_region(img);
+    }
+    float gltexid = static_cast<float>(region.texture.value());
 
     float drawx = clippedRect.x;
     float drawy = clippedRect.y;
     float drawz = clippedRect.x + clippedRect.w;
     float draww = clippedRect.y + clippedRect.h;
 
-    float texx = (drawx - x) / float(z - x);
-    float texy = (drawy - y) / float(w - y);
-    float texz = (drawz - x) / float(z - x);
-    float texw = (draww - y) / float(w - y);
+    Vec2f tex0 = region.map(Vec2f((drawx - x) / float(z - x), (drawy - y) / float(w - y)));
+    Vec2f tex1 = region.map(Vec2f((drawz - x) / float(z - x), (draww - y) / float(w - y)));
+    float texx = tex0.x;
+    float texy = tex0.y;
+    float texz = tex1.x;
+    float texw = tex1.y;
 
     // 0 1 2 / 0 2 3
 
+    growVertexStore(twodshaderstore, twodvertscnt, 6);
     twodshaderstore[twodvertscnt].x = drawx;
     twodshaderstore[twodvertscnt].y = drawy;
     twodshaderstore[twodvertscnt].z = 0;
@@ -717,7 +729,6 @@ void OpenGLRenderer::DrawImage(GraphicsImage *img, const Recti &rect, int palett
     twodshaderstore[twodvertscnt].paletteid = paletteid;
     twodvertscnt++;
 
-    if (twodvertscnt > 490) DrawTwodVerts();
     return;
 }
 
@@ -1064,12 +1075,9 @@ void OpenGLRenderer::BeginDecals() {
 
     if (decalVAO == 0) {
         glGenVertexArrays(1, &decalVAO);
-        glGenBuffers(1, &decalVBO);
 
         glBindVertexArray(decalVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, decalVBO);
-
-        glBufferData(GL_ARRAY_BUFFER, sizeof(GLdecalverts) * 10000, decalshaderstore, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
         // position attribute
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLdecalverts), (void *)offsetof(GLdecalverts, x));
@@ -1097,27 +1105,17 @@ void OpenGLRenderer::BeginDecals() {
 void OpenGLRenderer::EndDecals() {
     // draw here
 
-    if (numdecalverts) {
-            glBindBuffer(GL_ARRAY_BUFFER, decalVBO);
-            // orphan buffer
-            glBufferData(GL_ARRAY_BUFFER, sizeof(GLdecalverts) * 10000, NULL, GL_DYNAMIC_DRAW);
-            // update buffer
-            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLdecalverts) * numdecalverts, decalshaderstore);
-    } else {
+    if (!numdecalverts)
         return;
-    }
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    // update buffer
+    int first = _stream_vertices(decalshaderstore, numdecalverts);
 
     // ?
     _set_3d_projection_matrix();
     _set_3d_modelview_matrix();
 
     decalshader.use();
-    // set projection
-    glUniformMatrix4fv(decalshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    // set view
-    glUniformMatrix4fv(decalshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
     // set fog uniforms
     glUniform3f(decalshader.uniformLocation("fog.color"), fog.r, fog.g, fog.b);
@@ -1142,7 +1140,7 @@ void OpenGLRenderer::EndDecals() {
     glEnableVertexAttribArray(3);
     glEnableVertexAttribArray(4);
 
-    glDrawArrays(GL_TRIANGLES, 0, numdecalverts);
+    glDrawArrays(GL_TRIANGLES, first, numdecalverts);
     drawcalls++;
 
     // unload
@@ -1271,6 +1269,7 @@ void OpenGLRenderer::DrawFromSpriteSheet(Recti *pSrcRect, Pointi *pTargetPoint,
 
     // 0 1 2 / 0 2 3
 
+    growVertexStore(twodshaderstore, twodvertscnt, 6);
     twodshaderstore[twodvertscnt].x = drawx;
     twodshaderstore[twodvertscnt].y = drawy;
     twodshaderstore[twodvertscnt].z = 0;
@@ -1333,12 +1332,13 @@ void OpenGLRenderer::DrawFromSpriteSheet(Recti *pSrcRect, Pointi *pTargetPoint,
     twodshaderstore[twodvertscnt].paletteid = 0;
     twodvertscnt++;
 
-    if (twodvertscnt > 490) DrawTwodVerts();
     return;
 }
 
 void OpenGLRenderer::Update_Texture(GraphicsImage *texture) {
     UpdateTexture(texture->renderId(), texture->rgba());
+    if (!uiatlas.update(texture))
+        fontatlas.update(texture);
 }
 
 TextureRenderId OpenGLRenderer::CreateTexture(RgbaImageView image) {
@@ -1361,10 +1361,32 @@ void OpenGLRenderer::DeleteTexture(TextureRenderId id) {
     if (!id)
         return;
 
+    if (!uiatlas.remove(id))
+        fontatlas.remove(id);
+
     GLuint glId = id.value();
     glDeleteTextures(1, &glId);
 }
 
+TextureAtlasRegion OpenGLRenderer::_ui_texture_region(GraphicsImage *img) {
+    // only named images that were loaded from lods are packed, generated images like the minimap or movie frames
+    // are updated every frame & would just waste atlas space
+    if (!img->atlasRegion() && !img->GetName().empty()) {
+        Sizei size = img->size();
+        if (size.w > 0 && size.h > 0 && size.w <= UI_ATLAS_MAX_IMAGE_SIZE && size.h <= UI_ATLAS_MAX_IMAGE_SIZE) {
+            GraphicsImage *images[] = {img};
+            uiatlas.insert(images);
+        }
+    }
+
+    if (img->atlasRegion())
+        return *img->atlasRegion();
+
+    TextureAtlasRegion result;
+    result.texture = img->renderId();
+    return result;
+}
+
 void OpenGLRenderer::UpdateTexture(TextureRenderId id, RgbaImageView image) {
     assert(image);
     assert(id);
@@ -1381,6 +1403,8 @@ void OpenGLRenderer::_set_3d_projection_matrix() {
 
     // build projection matrix with glm
     projmat = glm::perspective(glm::radians(pCamera3D->fov_y_deg), pCamera3D->aspect, near_clip, far_clip);
+
+    _update_camera_uniforms();
 }
 
 // TODO(pskelton): to camera?
@@ -1397,6 +1421,8 @@ void OpenGLRenderer::_set_3d_modelview_matrix() {
     glm::vec3 upvec = glm::vec3(0.0f, 0.0f, 1.0f);
 
     viewmat = glm::lookAtLH(campos, eyepos, upvec);
+
+    _update_camera_uniforms();
 }
 
 // TODO(pskelton): to camera?
@@ -1408,14 +1434,56 @@ void OpenGLRenderer::_set_ortho_projection(bool gameviewport) {
         glViewport(game_viewport_x, outputRender.h-game_viewport_w-1, game_viewport_width, game_viewport_height);
         projmat = glm::ortho(float(game_viewport_x), float(game_viewport_z), float(game_viewport_w), float(game_viewport_y), float(1), float(-1));
     }
+
+    _update_camera_uniforms();
 }
 
 // TODO(pskelton): to camera?
 void OpenGLRenderer::_set_ortho_modelview() {
     // load identity matrix
     viewmat = glm::mat4x4(1);
+
+    _update_camera_uniforms();
+}
+
+
+static constexpr GLuint CAMERA_UNIFORMS_BINDING = 0;
+
+void OpenGLRenderer::_update_camera_uniforms() {
+    if (cameraUBO == 0) {
+        glGenBuffers(1, &cameraUBO);
+        glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+        glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_UNIFORMS_BINDING, cameraUBO);
+    } else if (cameraUBOprojmat == projmat && cameraUBOviewmat == viewmat) {
+        return;
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+    }
+
+    // layout matches the std140 CameraUniforms block in the shaders
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), &projmat[0][0]);
+    glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4), &viewmat[0][0]);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    cameraUBOprojmat = projmat;
+    cameraUBOviewmat = viewmat;
 }
 
+std::vector<OpenGLRenderer::PointLightUniforms> OpenGLRenderer::resolvePointLightUniforms(const OpenGLShader &shader, int count) {
+    std::vector<PointLightUniforms> result(count);
+    for (int i = 0; i < count; i++) {
+        std::string prefix = fmt::format("fspointlights[{}].", i);
+        result[i].type = shader.uniform<float>(prefix + "type");
+        result[i].position = shader.uniform<Vec3f>(prefix + "position");
+        result[i].sector = shader.uniform<float>(prefix + "sector");
+        result[i].radius = shader.uniform<float>(prefix + "radius");
+        result[i].ambient = shader.uniform<Vec3f>(prefix + "ambient");
+        result[i].diffuse = shader.uniform<Vec3f>(prefix + "diffuse");
+        result[i].specular = shader.uniform<Vec3f>(prefix + "specular");
+    }
+    return result;
+}
 
 // ---------------------- terrain -----------------------
 const int terrain_block_scale = 512;
@@ -1440,6 +1508,7 @@ struct GLshaderverts {
 GLshaderverts terrshaderstore[127 * 127 * 6] = {};
 
 void OpenGLRenderer::DrawOutdoorTerrain() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawOutdoorTerrain");
     // shader version
     // draws entire terrain in one go at the moment
     // textures must all be square and same size
@@ -1724,10 +1793,6 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
     // use the terrain shader
     terrainshader.use();
 
-    // set projection matrix
-    glUniformMatrix4fv(terrainshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    // set view matrix
-    glUniformMatrix4fv(terrainshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
     // set animated water frame
     glUniform1i(terrainshader.uniformLocation("waterframe"), GLint(this->hd_water_current_frame));
     // set texture unit location
@@ -1784,7 +1849,7 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
         if (pMobileLightsStack->uNumLightsActive < 1) continue;
 
         MobileLight &test = pMobileLightsStack->pLights[i];
-        std::string slotnum = std::to_string(num_lights);
+        const PointLightUniforms &light = terrainpointlights[num_lights];
 
         float x = pMobileLightsStack->pLights[i].vPosition.x;
         float y = pMobileLightsStack->pLights[i].vPosition.y;
@@ -1792,13 +1857,13 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
 
         Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
 
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
+        light.type.set(2.0f);
+        light.position.set(Vec3f(x, y, z));
+        light.sector.set(0);
+        light.ambient.set(Vec3f(color.r, color.g, color.b));
+        light.diffuse.set(Vec3f(color.r, color.g, color.b));
+        light.specular.set(Vec3f(0, 0, 0));
+        light.radius.set(test.uRadius);
         num_lights++;
     }
 
@@ -1807,7 +1872,7 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
         // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
         if (num_lights >= 20) break;
 
-        std::string slotnum = std::to_string(num_lights);
+        const PointLightUniforms &light = terrainpointlights[num_lights];
         StationaryLight &test = pStationaryLightsStack->pLights[i];
 
         float x = test.vPosition.x;
@@ -1818,12 +1883,12 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
 
         float lightrad = test.uRadius;
 
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 1.0);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
+        light.type.set(1.0);
+        light.position.set(Vec3f(x, y, z));
+        light.ambient.set(Vec3f(color.r, color.g, color.b));
+        light.diffuse.set(Vec3f(color.r, color.g, color.b));
+        light.specular.set(Vec3f(color.r, color.g, color.b));
+        light.radius.set(lightrad);
 
         num_lights++;
     }
@@ -1834,7 +1899,7 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
         // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
         if (num_lights >= 20) break;
 
-        std::string slotnum = std::to_string(num_lights);
+        const PointLightUniforms &light = terrainpointlights[num_lights];
         MobileLight &test = pMobileLightsStack->pLights[i];
 
         float x = pMobileLightsStack->pLights[i].vPosition.x;
@@ -1845,20 +1910,20 @@ void OpenGLRenderer::DrawOutdoorTerrain() {
 
         float lightrad = pMobileLightsStack->pLights[i].uRadius;
 
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
+        light.type.set(2.0);
+        light.position.set(Vec3f(x, y, z));
+        light.ambient.set(Vec3f(color.r, color.g, color.b));
+        light.diffuse.set(Vec3f(color.r, color.g, color.b));
+        light.specular.set(Vec3f(color.r, color.g, color.b));
+        light.radius.set(lightrad);
 
         num_lights++;
     }
 
     // blank the rest of the lights
     for (int blank = num_lights; blank < 20; blank++) {
-        std::string slotnum = std::to_string(blank);
-        glUniform1f(terrainshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 0.0);
+        const PointLightUniforms &light = terrainpointlights[blank];
+        light.type.set(0.0);
     }
 
     // actually draw the whole terrain
@@ -2270,12 +2335,9 @@ void OpenGLRenderer::DrawForcePerVerts() {
 
     if (forceperVAO == 0) {
         glGenVertexArrays(1, &forceperVAO);
-        glGenBuffers(1, &forceperVBO);
 
         glBindVertexArray(forceperVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, forceperVBO);
-
-        glBufferData(GL_ARRAY_BUFFER, sizeof(forceperstore), forceperstore, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
         // position attribute
         glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(forcepersverts), (void *)offsetof(forcepersverts, x));
@@ -2292,11 +2354,7 @@ void OpenGLRenderer::DrawForcePerVerts() {
     }
 
     // update buffer
-    glBindBuffer(GL_ARRAY_BUFFER, forceperVBO);
-
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(forcepersverts) * forceperstorecnt, forceperstore);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    int first = _stream_vertices(forceperstore, forceperstorecnt);
 
     glBindVertexArray(forceperVAO);
     glEnableVertexAttribArray(0);
@@ -2309,10 +2367,6 @@ void OpenGLRenderer::DrawForcePerVerts() {
     // set sampler to texure0
     glUniform1i(forcepershader.uniformLocation("texture0"), GLint(0));
 
-    //// set projection
-    glUniformMatrix4fv(forcepershader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    //// set view
-    glUniformMatrix4fv(forcepershader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
 
     // set fog - force perspective is handled slightly differently becuase of the sky
@@ -2364,7 +2418,7 @@ void OpenGLRenderer::DrawForcePerVerts() {
             }
         } while (forceperstore[offset + (cnt * 3)].texid == thistex);
 
-        glDrawArrays(GL_TRIANGLES, offset, (3 * cnt));
+        glDrawArrays(GL_TRIANGLES, first + offset, (3 * cnt));
         drawcalls++;
 
         offset += (3 * cnt);
@@ -2425,11 +2479,11 @@ struct billbverts {
     GLfloat paletteindex;
 };
 
-billbverts billbstore[1000] {};
+std::vector<billbverts> billbstore;
 int billbstorecnt{ 0 };
 
 //----- (004A1C1E) --------------------------------------------------------
-void OpenGLRenderer::DoRenderBillboards_D3D() {
+void OpenGLRenderer::drawCommandList(const RenderCommandList &commands) {
     glEnable(GL_BLEND);
     glDepthMask(GL_FALSE);  // in theory billboards all sorted by depth so dont cull by depth test
     glDisable(GL_CULL_FACE);  // some quads are reversed to reuse sprites opposite hand
@@ -2440,131 +2494,35 @@ void OpenGLRenderer::DoRenderBillboards_D3D() {
     if (billbstorecnt)
         logger->trace("Billboard shader store isnt empty!");
 
-    // track loaded tex
-    float gltexid{ 0 };
-    // track blend mode
-    //RenderBillboardD3D::OpacityType blendtrack{ RenderBillboardD3D::NoBlend };
-
-    float oneon = 1.0f / (pCamera3D->GetNearClip() * 2.0f);
-    float oneof = 1.0f / (pCamera3D->GetFarClip());
-
-    for (int i = uNumBillboardsToDraw - 1; i >= 0; --i) {
-        //if (pBillboardRenderListD3D[i].opacity != RenderBillboardD3D::NoBlend) {
-        //    if (blendtrack != pBillboardRenderListD3D[i].opacity) {
-        //        blendtrack = pBillboardRenderListD3D[i].opacity;
-        //        SetBillboardBlendOptions(blendtrack);
-        //    }
-        //}
-
-        //int palette{ pBillboardRenderListD3D[i].PaletteID};
-        int paletteindex{ pBillboardRenderListD3D[i].PaletteIndex };
+    // commands are already sorted by state, so we just need to fill the store - draw calls get merged by texture
+    // and blend mode in DrawBillboards
+    for (const RenderCommand &command : commands.commands()) {
+        const BillboardDrawCommand &billboard = command.billboard;
 
-        if (pBillboardRenderListD3D[i].texture) {
-            auto texture = pBillboardRenderListD3D[i].texture;
-            gltexid = texture->renderId().value();
-        } else {
-            static GraphicsImage *effpar03 = assets->getBitmap("effpar03");
-            gltexid = static_cast<float>(effpar03->renderId().value());
-        }
-
-        //if (gltexid != testtexid) {
-        //    gltexid = testtexid;
-        //    glBindTexture(GL_TEXTURE_2D, gltexid);
-        //}
-
-        auto billboard = &pBillboardRenderListD3D[i];
-        auto b = &pBillboardRenderList[i];
-
-        float oneoz = 1.0f / billboard->screen_space_z;
-        float thisdepth = (oneoz - oneon) / (oneof - oneon);
-
-        float thisblend = static_cast<float>(billboard->opacity);
+        float gltexid = billboard.texture->renderId().value();
+        float thisblend = static_cast<float>(billboard.opacity);
 
         // 0 1 2 / 0 2 3
-
-        billbstore[billbstorecnt].x = billboard->pQuads[0].pos.x;
-        billbstore[billbstorecnt].y = billboard->pQuads[0].pos.y;
-        billbstore[billbstorecnt].z = thisdepth;
-        billbstore[billbstorecnt].u = std::clamp(billboard->pQuads[0].texcoord.x, 0.01f, 0.99f);
-        billbstore[billbstorecnt].v = std::clamp(billboard->pQuads[0].texcoord.y, 0.01f, 0.99f);
-        billbstore[billbstorecnt].color = billboard->pQuads[0].diffuse.toColorf();
-        billbstore[billbstorecnt].screenspace = billboard->screen_space_z;
-        billbstore[billbstorecnt].texid = gltexid;
-        billbstore[billbstorecnt].blend = thisblend;
-        billbstore[billbstorecnt].paletteindex = paletteindex;
-        billbstorecnt++;
-
-        billbstore[billbstorecnt].x = billboard->pQuads[1].pos.x;
-        billbstore[billbstorecnt].y = billboard->pQuads[1].pos.y;
-        billbstore[billbstorecnt].z = thisdepth;
-        billbstore[billbstorecnt].u = std::clamp(billboard->pQuads[1].texcoord.x, 0.01f, 0.99f);
-        billbstore[billbstorecnt].v = std::clamp(billboard->pQuads[1].texcoord.y, 0.01f, 0.99f);
-        billbstore[billbstorecnt].color = billboard->pQuads[1].diffuse.toColorf();
-        billbstore[billbstorecnt].screenspace = billboard->screen_space_z;
-        billbstore[billbstorecnt].texid = gltexid;
-        billbstore[billbstorecnt].blend = thisblend;
-        billbstore[billbstorecnt].paletteindex = paletteindex;
-        billbstorecnt++;
-
-        billbstore[billbstorecnt].x = billboard->pQuads[2].pos.x;
-        billbstore[billbstorecnt].y = billboard->pQuads[2].pos.y;
-        billbstore[billbstorecnt].z = thisdepth;
-        billbstore[billbstorecnt].u = std::clamp(billboard->pQuads[2].texcoord.x, 0.01f, 0.99f);
-        billbstore[billbstorecnt].v = std::clamp(billboard->pQuads[2].texcoord.y, 0.01f, 0.99f);
-        billbstore[billbstorecnt].color = billboard->pQuads[2].diffuse.toColorf();
-        billbstore[billbstorecnt].screenspace = billboard->screen_space_z;
-        billbstore[billbstorecnt].texid = gltexid;
-        billbstore[billbstorecnt].blend = thisblend;
-        billbstore[billbstorecnt].paletteindex = paletteindex;
-        billbstorecnt++;
-
-        ////////////////////////////////
-
-        if (billboard->pQuads[3].pos.x != 0.0f && billboard->pQuads[3].pos.y != 0.0f && billboard->pQuads[3].pos.z != 0.0f) {
-            billbstore[billbstorecnt].x = billboard->pQuads[0].pos.x;
-            billbstore[billbstorecnt].y = billboard->pQuads[0].pos.y;
-            billbstore[billbstorecnt].z = thisdepth;
-            billbstore[billbstorecnt].u = std::clamp(billboard->pQuads[0].texcoord.x, 0.01f, 0.99f);
-            billbstore[billbstorecnt].v = std::clamp(billboard->pQuads[0].texcoord.y, 0.01f, 0.99f);
-            billbstore[billbstorecnt].color = billboard->pQuads[0].diffuse.toColorf();
-            billbstore[billbstorecnt].screenspace = billboard->screen_space_z;
-            billbstore[billbstorecnt].texid = gltexid;
-            billbstore[billbstorecnt].blend = thisblend;
-            billbstore[billbstorecnt].paletteindex = paletteindex;
-            billbstorecnt++;
-
-            billbstore[billbstorecnt].x = billboard->pQuads[2].pos.x;
-            billbstore[billbstorecnt].y = billboard->pQuads[2].pos.y;
-            billbstore[billbstorecnt].z = thisdepth;
-            billbstore[billbstorecnt].u = std::clamp(billboard->pQuads[2].texcoord.x, 0.01f, 0.99f);
-            billbstore[billbstorecnt].v = std::clamp(billboard->pQuads[2].texcoord.y, 0.01f, 0.99f);
-            billbstore[billbstorecnt].color = billboard->pQuads[2].diffuse.toColorf();
-            billbstore[billbstorecnt].screenspace = billboard->screen_space_z;
-            billbstore[billbstorecnt].texid = gltexid;
-            billbstore[billbstorecnt].blend = thisblend;
-            billbstore[billbstorecnt].paletteindex = paletteindex;
-            billbstorecnt++;
-
-            billbstore[billbstorecnt].x = billboard->pQuads[3].pos.x;
-            billbstore[billbstorecnt].y = billboard->pQuads[3].pos.y;
-            billbstore[billbstorecnt].z = thisdepth;
-            billbstore[billbstorecnt].u = std::clamp(billboard->pQuads[3].texcoord.x, 0.01f, 0.99f);
-            billbstore[billbstorecnt].v = std::clamp(billboard->pQuads[3].texcoord.y, 0.01f, 0.99f);
-            billbstore[billbstorecnt].color = billboard->pQuads[3].diffuse.toColorf();
-            billbstore[billbstorecnt].screenspace = billboard->screen_space_z;
-            billbstore[billbstorecnt].texid = gltexid;
-            billbstore[billbstorecnt].blend = thisblend;
-            billbstore[billbstorecnt].paletteindex = paletteindex;
-            billbstorecnt++;
-        }
-
-        if (billbstorecnt > 990) {
-            DrawBillboards();
+        static constexpr int triangleVertices[2][3] = {{0, 1, 2}, {0, 2, 3}};
+        for (int triangle = 0; triangle < billboard.numVertices - 2; triangle++) {
+            for (int vertex : triangleVertices[triangle]) {
+                const RenderVertexD3D3 &src = billboard.vertices[vertex];
+                growVertexStore(billbstore, billbstorecnt, 1);
+                billbverts &dst = billbstore[billbstorecnt++];
+                dst.x = src.pos.x;
+                dst.y = src.pos.y;
+                dst.z = billboard.depth;
+                dst.u = std::clamp(src.texcoord.x, 0.01f, 0.99f);
+                dst.v = std::clamp(src.texcoord.y, 0.01f, 0.99f);
+                dst.color = src.diffuse.toColorf();
+                dst.screenspace = billboard.screenSpaceZ;
+                dst.texid = gltexid;
+                dst.blend = thisblend;
+                dst.paletteindex = billboard.paletteIndex;
+            }
         }
     }
 
-    // uNumBillboardsToDraw = 0;
-
     DrawBillboards();
 
     //glDisable(GL_BLEND);
@@ -2573,16 +2531,14 @@ void OpenGLRenderer::DoRenderBillboards_D3D() {
 
 // name better
 void OpenGLRenderer::DrawBillboards() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawBillboards");
     if (!billbstorecnt) return;
 
     if (billbVAO == 0) {
         glGenVertexArrays(1, &billbVAO);
-        glGenBuffers(1, &billbVBO);
 
         glBindVertexArray(billbVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, billbVBO);
-
-        glBufferData(GL_ARRAY_BUFFER, sizeof(billbstore), billbstore, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
         // position attribute
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(billbverts), (void *)offsetof(billbverts, x));
@@ -2618,9 +2574,7 @@ void OpenGLRenderer::DrawBillboards() {
     }
 
     // update buffer
-    glBindBuffer(GL_ARRAY_BUFFER, billbVBO);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(billbverts) * billbstorecnt, billbstore);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    int first = _stream_vertices(billbstore.data(), billbstorecnt);
 
     glBindVertexArray(billbVAO);
     glEnableVertexAttribArray(0);
@@ -2643,10 +2597,6 @@ void OpenGLRenderer::DrawBillboards() {
     // set sampler to texure0
     glUniform1i(billbshader.uniformLocation("texture0"), GLint(0));
 
-    //// set projection
-    glUniformMatrix4fv(billbshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    //// set view
-    glUniformMatrix4fv(billbshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
     glUniform1f(billbshader.uniformLocation("gamma"), gamma);
 
@@ -2690,7 +2640,7 @@ void OpenGLRenderer::DrawBillboards() {
             }
         } while (billbstore[offset + (cnt * 3)].texid == thistex && billbstore[offset + (cnt * 3)].blend == thisblend);
 
-        glDrawArrays(GL_TRIANGLES, offset, (3 * cnt));
+        glDrawArrays(GL_TRIANGLES, first + offset, (3 * cnt));
         drawcalls++;
 
         offset += (3 * cnt);
@@ -2770,20 +2720,24 @@ void OpenGLRenderer::DrawTextureNew(float u, float v, GraphicsImage *tex, Color
     if (clippedRect.isEmpty())
         return;
 
-    float gltexid = tex->renderId().value();
+    TextureAtlasRegion region = _ui_texture_region(tex);
+    float gltexid = region.texture.value();
 
     float drawx = clippedRect.x;
     float drawy = clippedRect.y;
     float drawz = clippedRect.x + clippedRect.w;
     float draww = clippedRect.y + clippedRect.h;
 
-    float texx = (drawx - x) / float(width);
-    float texy = (drawy - y) / float(height);
-    float texz = (drawz - x) / float(width);
-    float texw = (draww - y) / float(height);
+    Vec2f tex0 = region.map(Vec2f((drawx - x) / float(width), (drawy - y) / float(height)));
+    Vec2f tex1 = region.map(Vec2f((drawz - x) / float(width), (draww - y) / float(height)));
+    float texx = tex0.x;
+    float texy = tex0.y;
+    float texz = tex1.x;
+    float texw = tex1.y;
 
     // 0 1 2 / 0 2 3
 
+    growVertexStore(twodshaderstore, twodvertscnt, 6);
     twodshaderstore[twodvertscnt].x = drawx;
     twodshaderstore[twodvertscnt].y = drawy;
     twodshaderstore[twodvertscnt].z = 0;
@@ -2846,7 +2800,6 @@ void OpenGLRenderer::DrawTextureNew(float u, float v, GraphicsImage *tex, Color
     twodshaderstore[twodvertscnt].paletteid = 0;
     twodvertscnt++;
 
-    if (twodvertscnt > 490) DrawTwodVerts();
     return;
 }
 
@@ -2889,6 +2842,7 @@ void OpenGLRenderer::DrawTextureCustomHeight(float u, float v, GraphicsImage *im
 
     // 0 1 2 / 0 2 3
 
+    growVertexStore(twodshaderstore, twodvertscnt, 6);
     twodshaderstore[twodvertscnt].x = drawx;
     twodshaderstore[twodvertscnt].y = drawy;
     twodshaderstore[twodvertscnt].z = 0;
@@ -2951,12 +2905,11 @@ void OpenGLRenderer::DrawTextureCustomHeight(float u, float v, GraphicsImage *im
     twodshaderstore[twodvertscnt].paletteid = 0;
     twodvertscnt++;
 
-    if (twodvertscnt > 490) DrawTwodVerts();
     return;
 }
 
 
-twodverts textshaderstore[10000] = {};
+std::vector<twodverts> textshaderstore;
 int textvertscnt = 0;
 
 void OpenGLRenderer::BeginTextNew(GraphicsImage *main, GraphicsImage *shadow) {
@@ -2965,16 +2918,30 @@ void OpenGLRenderer::BeginTextNew(GraphicsImage *main, GraphicsImage *shadow) {
         DrawTwodVerts();
     }
 
-    GLuint texmainidcheck = main->renderId().value();
+    if (!main->atlasRegion() && !shadow->atlasRegion()) {
+        GraphicsImage *images[] = {main, shadow};
+        fontatlas.insert(images);
+    }
 
-    // if we are changing font draw whats in the text buffer
-    if (texmainidcheck != texmain) {
-        EndTextNew();
+    GLuint newtexmain, newtexshadow;
+    if (main->atlasRegion() && shadow->atlasRegion()) {
+        textregion = *main->atlasRegion();
+        newtexmain = main->atlasRegion()->texture.value();
+        newtexshadow = shadow->atlasRegion()->texture.value();
+    } else {
+        textregion = TextureAtlasRegion();
+        newtexmain = main->renderId().value();
+        newtexshadow = shadow->renderId().value();
     }
 
-    texmain = main->renderId().value();
+    // if we are changing font texture draw whats in the text buffer, text buffer uvs are already remapped so fonts
+    // sharing an atlas can go into the same batch
+    if (newtexmain != texmain) {
+        EndTextNew();
+    }
 
-    texshadow = shadow->renderId().value();
+    texmain = newtexmain;
+    texshadow = newtexshadow;
 
     // set up buffers
     // set up counts
@@ -2992,12 +2959,9 @@ void OpenGLRenderer::EndTextNew() {
 
     if (textVAO == 0) {
         glGenVertexArrays(1, &textVAO);
-        glGenBuffers(1, &textVBO);
 
         glBindVertexArray(textVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-
-        glBufferData(GL_ARRAY_BUFFER, sizeof(textshaderstore), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
         // position attribute
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(twodverts), (void *)offsetof(twodverts, x));
@@ -3014,13 +2978,7 @@ void OpenGLRenderer::EndTextNew() {
     }
 
     // update buffer
-    glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-    // orphan
-    glBufferData(GL_ARRAY_BUFFER, sizeof(textshaderstore), NULL, GL_DYNAMIC_DRAW);
-    // update buffer
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(twodverts) * textvertscnt, textshaderstore);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    int first = _stream_vertices(textshaderstore.data(), textvertscnt);
 
     glBindVertexArray(textVAO);
     glEnableVertexAttribArray(0);
@@ -3038,10 +2996,6 @@ void OpenGLRenderer::EndTextNew() {
     glUniform1i(textshader.uniformLocation("texture0"), GLint(0));
     glUniform1i(textshader.uniformLocation("texture1"), GLint(1));
 
-    //// set projection
-    glUniformMatrix4fv(textshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    //// set view
-    glUniformMatrix4fv(textshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
     // set textures
     glActiveTexture(GL_TEXTURE0);
@@ -3049,7 +3003,7 @@ void OpenGLRenderer::EndTextNew() {
     glActiveTexture(GL_TEXTURE0 + 1);
     glBindTexture(GL_TEXTURE_2D, texshadow);
 
-    glDrawArrays(GL_TRIANGLES, 0, textvertscnt);
+    glDrawArrays(GL_TRIANGLES, first, textvertscnt);
     drawcalls++;
 
     glUseProgram(0);
@@ -3094,12 +3048,15 @@ void OpenGLRenderer::DrawTextNew(int x, int y, int width, int h, float u1, float
     float drawz = static_cast<float>(z);
 
     float depth = 0;
-    float texx = u1;
-    float texy = v1;
-    float texz = u2;
-    float texw = v2;
+    Vec2f tex0 = textregion.map(Vec2f(u1, v1));
+    Vec2f tex1 = textregion.map(Vec2f(u2, v2));
+    float texx = tex0.x;
+    float texy = tex0.y;
+    float texz = tex1.x;
+    float texw = tex1.y;
 
     // 0 1 2 / 0 2 3
+    growVertexStore(textshaderstore, textvertscnt, 6);
     textshaderstore[textvertscnt].x = drawx;
     textshaderstore[textvertscnt].y = drawy;
     textshaderstore[textvertscnt].z = 0;
@@ -3161,7 +3118,6 @@ void OpenGLRenderer::DrawTextNew(int x, int y, int width, int h, float u1, float
     textshaderstore[textvertscnt].paletteid = 0;
     textvertscnt++;
 
-    if (textvertscnt > 9990) EndTextNew();
 }
 
 void OpenGLRenderer::flushAndScale() {
@@ -3212,14 +3168,34 @@ void OpenGLRenderer::swapBuffers() {
 }
 
 void OpenGLRenderer::Present() {
+    MM_PROFILE_ZONE("OpenGLRenderer::Present");
     flushAndScale();
+    streambuffer.fence(); // All the draws reading from the stream buffer are issued by now.
+    frameArena.reset();
     swapBuffers();
 }
 
+template<class T>
+void OpenGLRenderer::_stream_units(T *const (&units)[16], const int (&counts)[16], int (&firsts)[16]) {
+    FrameVector<T> vertices(&frameArena);
+    for (int l = 0; l < 16; l++) {
+        firsts[l] = vertices.size();
+        vertices.insert(vertices.end(), units[l], units[l] + counts[l]);
+    }
+
+    if (vertices.empty())
+        return;
+
+    int first = _stream_vertices(vertices.data(), vertices.size());
+    for (int l = 0; l < 16; l++)
+        firsts[l] += first;
+}
+
 GLshaderverts *outbuildshaderstore[16] = { nullptr };
 int numoutbuildverts[16] = { 0 };
 
 void OpenGLRenderer::DrawOutdoorBuildings() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawOutdoorBuildings");
     // shader
     // verts are streamed to gpu as required
     // textures can be different sizes
@@ -3260,145 +3236,18 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             outbuildshaderstore[i] = (GLshaderverts *)malloc(sizeof(GLshaderverts) * 20000);
         }
 
-        // reserve first 7 layers for water tiles in unit 0
-        auto wtrtexture = this->hd_water_tile_anim[0];
-        //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
-        //numterraintexloaded[0]++;
-        outbuildtexturewidths[0] = wtrtexture->width();
-        outbuildtextureheights[0] = wtrtexture->height();
-
-        for (int buff = 0; buff < 7; buff++) {
-            std::string container_name = fmt::format("HDWTR{:03}", buff);
-            outbuildtexmap.insert(std::make_pair(container_name, outbuildtexmap.size()));
-            numoutbuildtexloaded[0]++;
-        }
-
+        // textures & face texture slots are prepared by the level mesh builder during map load
+        LevelMesh mesh = _levelMeshBuilder.take(LEVEL_OUTDOOR);
+        outbuildlayout = std::move(mesh.layout);
 
-
-
-
-        for (BSPModel &model : pOutdoor->pBModels) {
-            //int reachable;
-            //if (IsBModelVisible(&model, &reachable)) {
+        for (BSPModel &model : pOutdoor->pBModels)
             model.field_40 |= 1;
-            if (!model.pFaces.empty()) {
-                for (ODMFace &face : model.pFaces) {
-                    if (!face.Invisible()) {
-                        // TODO(pskelton): Same as indoors. When ODM and BLV face is combined - seperate out function
-
-                        if (!face.GetTexture()) continue;
-                        GraphicsImage *tex = face.GetTexture();
-
-                        std::string texname = tex->GetName();
-
-                        Duration animLength;
-                        Duration frame;
-                        if (face.IsTextureFrameTable()) {
-                            tex = pTextureFrameTable->GetFrameTexture((int64_t)face.resource, frame);
-                            animLength = pTextureFrameTable->textureFrameAnimLength((int64_t)face.resource);
-                            texname = tex->GetName();
-                        }
-                        // gather up all texture and shaderverts data
-
-                        //auto tile = pOutdoor->getTileDescByGrid(x, y);
-
-                        int texunit = 0;
-                        int texlayer = 0;
-                        int attribflags = 0;
-
-                        if (face.uAttributes & FACE_IsFluid) attribflags |= 2;
-                        if (face.uAttributes & FACE_INDOOR_SKY) attribflags |= 0x400;
-
-                        if (face.uAttributes & FACE_FlowDown)
-                            attribflags |= 0x400;
-                        else if (face.uAttributes & FACE_FlowUp)
-                            attribflags |= 0x800;
-
-                        if (face.uAttributes & FACE_FlowRight)
-                            attribflags |= 0x2000;
-                        else if (face.uAttributes & FACE_FlowLeft)
-                            attribflags |= 0x1000;
-
-                        if (face.uAttributes & FACE_IsLava)
-                            attribflags |= 0x4000;
-
-                        // loop while running down animlength with frame animtimes
-                        do {
-                            // check if tile->name is already in list
-                            auto mapiter = outbuildtexmap.find(texname);
-                            if (mapiter != outbuildtexmap.end()) {
-                                // if so, extract unit and layer
-                                int unitlayer = mapiter->second;
-                                texlayer = unitlayer & 0xFF;
-                                texunit = (unitlayer & 0xFF00) >> 8;
-                            } else if (texname == "wtrtyl") {
-                                // water tile
-                                texunit = 0;
-                                texlayer = 0;
-                            } else {
-                                // else need to add it
-                                auto thistexture = assets->getBitmap(texname);
-                                int width = thistexture->width();
-                                int height = thistexture->height();
-                                // check size to see what unit it needs
-                                int i;
-                                for (i = 0; i < 16; i++) {
-                                    if ((outbuildtexturewidths[i] == width && outbuildtextureheights[i] == height) || outbuildtexturewidths[i] == 0) break;
-                                }
-
-                                if (i == 16) {
-                                    logger->warning("Texture unit full - draw building!");
-                                    texunit = 0;
-                                    texlayer = 0;
-                                } else {
-                                    if (outbuildtexturewidths[i] == 0) {
-                                        outbuildtexturewidths[i] = width;
-                                        outbuildtextureheights[i] = height;
-                                    }
-
-                                    texunit = i;
-                                    texlayer = numoutbuildtexloaded[i];
-
-                                    // encode unit and layer together
-                                    int encode = (texunit << 8) | texlayer;
-
-                                    if (numoutbuildtexloaded[i] < 256) {
-                                        // intsert into tex map
-                                        outbuildtexmap.insert(std::make_pair(texname, encode));
-                                        numoutbuildtexloaded[i]++;
-                                    } else {
-                                        logger->warning("Texture layer full - draw building!");
-                                        texunit = 0;
-                                        texlayer = 0;
-                                    }
-                                }
-                            }
-
-                            if (face.IsTextureFrameTable()) {
-                                // TODO(pskelton): any instances where animTime is not consistent would need checking
-                                frame += pTextureFrameTable->textureFrameAnimTime((int64_t)face.resource);
-                                tex = pTextureFrameTable->GetFrameTexture((int64_t)face.resource, frame);
-                                if (!tex) break;
-                                texname = tex->GetName();
-                            }
-                        } while (animLength > frame);
-
-                        face.texunit = texunit;
-                        face.texlayer = texlayer;
-                    }
-                }
-            }
-            //}
-        }
 
         for (int l = 0; l < 16; l++) {
             glGenVertexArrays(1, &outbuildVAO[l]);
-            glGenBuffers(1, &outbuildVBO[l]);
 
             glBindVertexArray(outbuildVAO[l]);
-            glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-
-            glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, outbuildshaderstore[l], GL_DYNAMIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
             // position attribute
             glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
@@ -3422,53 +3271,26 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
         // loop over all units
         for (int unit = 0; unit < 16; unit++) {
-            assert(numoutbuildtexloaded[unit] <= 256);
+            const TextureArrayUnit &textures = outbuildlayout.units()[unit];
             // skip if textures are empty
-            if (numoutbuildtexloaded[unit] == 0) continue;
+            if (textures.layers.empty()) continue;
 
             glGenTextures(1, &outbuildtextures[unit]);
             glActiveTexture(GL_TEXTURE0);
             glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
 
             // create blank memory for later texture submission
-            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, outbuildtexturewidths[unit], outbuildtextureheights[unit], numoutbuildtexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-            std::map<std::string, int>::iterator it = outbuildtexmap.begin();
-            while (it != outbuildtexmap.end()) {
-                // skip if wtrtyl
-                //if ((it->first).substr(0, 6) == "wtrtyl") {
-                //    std::cout << "skipped  " << it->first << std::endl;
-                 //   it++;
-                 //   continue;
-                //}
-
-                int comb = it->second;
-                int tlayer = comb & 0xFF;
-                int tunit = (comb & 0xFF00) >> 8;
-
-                if (tunit == unit) {
-                    // get texture
-                    auto texture = assets->getBitmap(it->first);
-
-                    glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                        0,
-                        0, 0, tlayer,
-                        outbuildtexturewidths[unit], outbuildtextureheights[unit], 1,
-                        GL_RGBA,
-                        GL_UNSIGNED_BYTE,
-                        texture->rgba().pixels().data());
-                }
-
-                it++;
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, textures.size.w, textures.size.h, textures.layers.size(), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+            for (size_t layer = 0; layer < textures.layers.size(); layer++) {
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                    0,
+                    0, 0, layer,
+                    textures.size.w, textures.size.h, 1,
+                    GL_RGBA,
+                    GL_UNSIGNED_BYTE,
+                    mesh.images.at(textures.layers[layer]).pixels().data());
             }
 
-            //iterate through terrain tex map
-            //ignore wtrtyl
-            //laod in
-
-            //auto tile = pOutdoor->getTileDescByGrid(0, 0);
-            //bool border = tile->IsWaterBorderTile();
-
-
             glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
             glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
             glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -3483,9 +3305,10 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             numoutbuildverts[i] = 0;
         }
 
-        for (BSPModel &model : pOutdoor->pBModels) {
-            bool reachable;
-            if (IsBModelVisible(&model, 256, &reachable)) {
+        const std::vector<bool> &visibleModels = pOutdoor->visibleBModels();
+        for (size_t modelIndex = 0; modelIndex < pOutdoor->pBModels.size(); modelIndex++) {
+            BSPModel &model = pOutdoor->pBModels[modelIndex];
+            if (visibleModels[modelIndex]) {
                 //if (model.index == 35) continue;
                 model.field_40 |= 1;
                 if (!model.pFaces.empty()) {
@@ -3508,12 +3331,10 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
                                 if (texlayer == -1) { // texture has been reset - see if its in the map
                                     GraphicsImage *tex = face.GetTexture();
                                     std::string texname = tex->GetName();
-                                    auto mapiter = bsptexmap.find(texname);
-                                    if (mapiter != bsptexmap.end()) {
+                                    if (std::optional<TextureArraySlot> slot = outbuildlayout.find(texname)) {
                                         // if so, extract unit and layer
-                                        int unitlayer = mapiter->second;
-                                        face.texlayer = texlayer = unitlayer & 0xFF;
-                                        face.texunit = texunit = (unitlayer & 0xFF00) >> 8;
+                                        face.texlayer = texlayer = slot->layer;
+                                        face.texunit = texunit = slot->unit;
                                     } else {
                                         logger->warning("Texture not found in map!");
                                         // TODO(pskelton): set to water for now - fountains in walls of mist
@@ -3588,15 +3409,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             }
         }
 
-        for (int l = 0; l < 16; l++) {
-            if (numoutbuildverts[l]) {
-                glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-                // orphan buffer
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                // update buffer
-                glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numoutbuildverts[l], outbuildshaderstore[l]);
-            }
-        }
+        _stream_units(outbuildshaderstore, numoutbuildverts, outbuildfirst);
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
 
@@ -3607,10 +3420,6 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 
     outbuildshader.use();
-    // set projection
-    glUniformMatrix4fv(outbuildshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    // set view
-    glUniformMatrix4fv(outbuildshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
     glUniform1i(outbuildshader.uniformLocation("waterframe"), GLint(this->hd_water_current_frame));
     glUniform1i(outbuildshader.uniformLocation("flowtimer"), GLint(pMiscTimer->time().realtimeMilliseconds() >> 4));
@@ -3660,7 +3469,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
         if (pMobileLightsStack->uNumLightsActive < 1) continue;
 
         MobileLight &test = pMobileLightsStack->pLights[i];
-        std::string slotnum = std::to_string(num_lights);
+        const PointLightUniforms &light = outbuildpointlights[num_lights];
 
         float x = pMobileLightsStack->pLights[i].vPosition.x;
         float y = pMobileLightsStack->pLights[i].vPosition.y;
@@ -3668,13 +3477,13 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
         Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
 
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
+        light.type.set(2.0f);
+        light.position.set(Vec3f(x, y, z));
+        light.sector.set(0);
+        light.ambient.set(Vec3f(color.r, color.g, color.b));
+        light.diffuse.set(Vec3f(color.r, color.g, color.b));
+        light.specular.set(Vec3f(0, 0, 0));
+        light.radius.set(test.uRadius);
         num_lights++;
     }
 
@@ -3683,7 +3492,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
         // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
         if (num_lights >= 20) break;
 
-        std::string slotnum = std::to_string(num_lights);
+        const PointLightUniforms &light = outbuildpointlights[num_lights];
         StationaryLight &test = pStationaryLightsStack->pLights[i];
 
         float x = test.vPosition.x;
@@ -3694,12 +3503,12 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
         float lightrad = test.uRadius;
 
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 1.0);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
+        light.type.set(1.0);
+        light.position.set(Vec3f(x, y, z));
+        light.ambient.set(Vec3f(color.r, color.g, color.b));
+        light.diffuse.set(Vec3f(color.r, color.g, color.b));
+        light.specular.set(Vec3f(color.r, color.g, color.b));
+        light.radius.set(lightrad);
 
         num_lights++;
     }
@@ -3710,7 +3519,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
         // TODO(pskelton): make this configurable - also lights should be sorted by distance so nearest are used first
         if (num_lights >= 20) break;
 
-        std::string slotnum = std::to_string(num_lights);
+        const PointLightUniforms &light = outbuildpointlights[num_lights];
         MobileLight &test = pMobileLightsStack->pLights[i];
 
         float x = pMobileLightsStack->pLights[i].vPosition.x;
@@ -3721,20 +3530,20 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
         float lightrad = pMobileLightsStack->pLights[i].uRadius;
 
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-        glUniform3f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), color.r, color.g, color.b);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), lightrad);
+        light.type.set(2.0);
+        light.position.set(Vec3f(x, y, z));
+        light.ambient.set(Vec3f(color.r, color.g, color.b));
+        light.diffuse.set(Vec3f(color.r, color.g, color.b));
+        light.specular.set(Vec3f(color.r, color.g, color.b));
+        light.radius.set(lightrad);
 
         num_lights++;
     }
 
     // blank the rest of the lights
     for (int blank = num_lights; blank < 20; blank++) {
-        std::string slotnum = std::to_string(blank);
-        glUniform1f(outbuildshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 0.0);
+        const PointLightUniforms &light = outbuildpointlights[blank];
+        light.type.set(0.0);
     }
 
 
@@ -3753,7 +3562,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
             glBindVertexArray(outbuildVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numoutbuildverts[unit]));
+            glDrawArrays(GL_TRIANGLES, outbuildfirst[unit], numoutbuildverts[unit]);
             drawcalls++;
         //}
     }
@@ -3850,6 +3659,7 @@ GLshaderverts *BSPshaderstore[16] = { nullptr };
 int numBSPverts[16] = { 0 };
 
 void OpenGLRenderer::DrawIndoorFaces() {
+    MM_PROFILE_ZONE("OpenGLRenderer::DrawIndoorFaces");
     // void RenderOpenGL::DrawIndoorBSP() {
 
     // TODO(pskelton): might have to pass a texture width through for the waterr flow textures to size right
@@ -3868,21 +3678,6 @@ void OpenGLRenderer::DrawIndoorFaces() {
         _set_3d_modelview_matrix();
 
         if (bspVAO[0] == 0) {
-            // lights setup
-            int cntnosect = 0;
-
-            for (int lightscnt = 0; lightscnt < pStationaryLightsStack->uNumLightsActive; ++lightscnt) {
-                StationaryLight &test = pStationaryLightsStack->pLights[lightscnt];
-
-
-                // kludge for getting lights in  visible sectors
-                pStationaryLightsStack->pLights[lightscnt].uSectorID = pIndoor->GetSector(test.vPosition);
-
-                if (pStationaryLightsStack->pLights[lightscnt].uSectorID == 0) cntnosect++;
-            }
-            if (cntnosect)
-                logger->warning("{} lights - sector not found", cntnosect);
-
             for (int i = 0; i < 16; i++) {
                 numBSPverts[i] = 0;
                 free(BSPshaderstore[i]);
@@ -3891,136 +3686,15 @@ void OpenGLRenderer::DrawIndoorFaces() {
             }
 
 
-            // reserve first 7 layers for water tiles in unit 0
-            auto wtrtexture = this->hd_water_tile_anim[0];
-            //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
-            //numterraintexloaded[0]++;
-            bsptexturewidths[0] = wtrtexture->width();
-            bsptextureheights[0] = wtrtexture->height();
-
-            for (int buff = 0; buff < 7; buff++) {
-                std::string container_name = fmt::format("HDWTR{:03}", buff);
-                bsptexmap.insert(std::make_pair(container_name, bsptexmap.size()));
-                bsptexloaded[0]++;
-            }
-
-
-            for (int test = 0; test < pIndoor->pFaces.size(); test++) {
-                BLVFace *face = &pIndoor->pFaces[test];
-
-                if (face->isPortal()) continue;
-                if (!face->GetTexture()) continue;
-                //if (face->uAttributes & FACE_IS_DOOR) continue;
-
-                // TODO(pskelton): Same as outdoors. When ODM and BLV face is combined - seperate out function
-                GraphicsImage *tex = face->GetTexture();
-                std::string texname = tex->GetName();
-
-                Duration animLength;
-                Duration frame;
-                if (face->IsTextureFrameTable()) {
-                    tex = pTextureFrameTable->GetFrameTexture((int64_t)face->resource, frame);
-                    animLength = pTextureFrameTable->textureFrameAnimLength((int64_t)face->resource);
-                    texname = tex->GetName();
-                }
-
-                int texunit = 0;
-                int texlayer = 0;
-                int attribflags = 0;
-
-                if (face->uAttributes & FACE_IsFluid) attribflags |= 2;
-                if (face->uAttributes & FACE_INDOOR_SKY) attribflags |= 0x400;
-
-                if (face->uAttributes & FACE_FlowDown)
-                    attribflags |= 0x400;
-                else if (face->uAttributes & FACE_FlowUp)
-                    attribflags |= 0x800;
-
-                if (face->uAttributes & FACE_FlowRight)
-                    attribflags |= 0x2000;
-                else if (face->uAttributes & FACE_FlowLeft)
-                    attribflags |= 0x1000;
-
-                if (face->uAttributes & FACE_IsLava)
-                    attribflags |= 0x4000;
-
-                if (face->uAttributes & (FACE_OUTLINED | FACE_IsSecret))
-                    attribflags |= 0x00010000;
-
-                // loop while running down animlength with frame animtimes
-                do {
-                    // check if tile->name is already in list
-                    auto mapiter = bsptexmap.find(texname);
-                    if (mapiter != bsptexmap.end()) {
-                        // if so, extract unit and layer
-                        int unitlayer = mapiter->second;
-                        // TODO(pskelton): make this a pair/struct rather than encoding
-                        texlayer = unitlayer & 0xFF;
-                        texunit = (unitlayer & 0xFF00) >> 8;
-                    } else if (texname == "wtrtyl") {
-                        // water tile
-                        texunit = 0;
-                        texlayer = 0;
-                    } else {
-                        // else need to add it
-                        auto thistexture = assets->getBitmap(texname);
-                        int width = thistexture->width();
-                        int height = thistexture->height();
-                        // check size to see what unit it needs
-                        int i;
-                        for (i = 0; i < 16; i++) {
-                            if ((bsptexturewidths[i] == width && bsptextureheights[i] == height) || bsptexturewidths[i] == 0) break;
-                        }
-
-                        if (i == 16) {
-                            logger->warning("Texture unit full - draw Indoor faces!");
-                            texunit = 0;
-                            texlayer = 0;
-                        } else {
-                            if (bsptexturewidths[i] == 0) {
-                                bsptexturewidths[i] = width;
-                                bsptextureheights[i] = height;
-                            }
-
-                            texunit = i;
-                            texlayer = bsptexloaded[i];
-
-                            // encode unit and layer together
-                            int encode = (texunit << 8) | texlayer;
-
-                            if (bsptexloaded[i] < 256) {
-                                // intsert into tex map
-                                bsptexmap.insert(std::make_pair(texname, encode));
-                                bsptexloaded[i]++;
-                            } else {
-                                logger->warning("Texture layer full - draw indoor faces!");
-                                texunit = 0;
-                                texlayer = 0;
-                            }
-                        }
-                    }
-
-                    if (face->IsTextureFrameTable()) {
-                        // TODO(pskelton): any instances where animTime is not consistent would need checking
-                        frame += pTextureFrameTable->textureFrameAnimTime((int64_t)face->resource);
-                        tex = pTextureFrameTable->GetFrameTexture((int64_t)face->resource, frame);
-                        if (!tex) break;
-                        texname = tex->GetName();
-                    }
-                } while (animLength > frame);
-
-                face->texunit = texunit;
-                face->texlayer = texlayer;
-            }
+            // textures, face texture slots & light sectors are prepared by the level mesh builder during map load
+            LevelMesh mesh = _levelMeshBuilder.take(LEVEL_INDOOR);
+            bsplayout = std::move(mesh.layout);
 
             for (int l = 0; l < 16; l++) {
                 glGenVertexArrays(1, &bspVAO[l]);
-                glGenBuffers(1, &bspVBO[l]);
 
                 glBindVertexArray(bspVAO[l]);
-                glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
+                glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
                 // position attribute
                 glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
@@ -4047,42 +3721,25 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
             // loop over all units
             for (int unit = 0; unit < 16; unit++) {
-                assert(bsptexloaded[unit] <= 256);
+                const TextureArrayUnit &textures = bsplayout.units()[unit];
                 // skip if textures are empty
-                if (bsptexloaded[unit] == 0) continue;
+                if (textures.layers.empty()) continue;
 
                 glGenTextures(1, &bsptextures[unit]);
                 glActiveTexture(GL_TEXTURE0);
                 glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
-                glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, bsptexturewidths[unit], bsptextureheights[unit], bsptexloaded[unit], 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-
-                std::map<std::string, int>::iterator it = bsptexmap.begin();
-                while (it != bsptexmap.end()) {
-                    int comb = it->second;
-                    int tlayer = comb & 0xFF;
-                    int tunit = (comb & 0xFF00) >> 8;
-
-                    if (tunit == unit) {
-                        // get texture
-                        auto texture = assets->getBitmap(it->first);
-
-                        glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
-                            0,
-                            0, 0, tlayer,
-                            bsptexturewidths[unit], bsptextureheights[unit], 1,
-                            GL_RGBA,
-                            GL_UNSIGNED_BYTE,
-                            texture->rgba().pixels().data());
-
-                        //numterraintexloaded[0]++;
-                    }
+                glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, textures.size.w, textures.size.h, textures.layers.size(), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
 
-                    it++;
+                for (size_t layer = 0; layer < textures.layers.size(); layer++) {
+                    glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                        0,
+                        0, 0, layer,
+                        textures.size.w, textures.size.h, 1,
+                        GL_RGBA,
+                        GL_UNSIGNED_BYTE,
+                        mesh.images.at(textures.layers[layer]).pixels().data());
                 }
 
-
-
-
                 glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
                 glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
                 glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
@@ -4201,12 +3858,10 @@ void OpenGLRenderer::DrawIndoorFaces() {
                             if (texlayer == -1) { // texture has been reset - see if its in the map
                                 GraphicsImage *tex = face->GetTexture();
                                 std::string texname = tex->GetName();
-                                auto mapiter = bsptexmap.find(texname);
-                                if (mapiter != bsptexmap.end()) {
+                                if (std::optional<TextureArraySlot> slot = bsplayout.find(texname)) {
                                     // if so, extract unit and layer
-                                    int unitlayer = mapiter->second;
-                                    face->texlayer = texlayer = unitlayer & 0xFF;
-                                    face->texunit = texunit = (unitlayer & 0xFF00) >> 8;
+                                    face->texlayer = texlayer = slot->layer;
+                                    face->texunit = texunit = slot->unit;
                                 } else {
                                     logger->warning("Texture not found in map!");
                                     // TODO(pskelton): set to water for now - fountains in walls of mist
@@ -4268,15 +3923,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
                 }
             }
 
-            for (int l = 0; l < 16; l++) {
-                if (numBSPverts[l]) {
-                    glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-                    // orphan buffer
-                    glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                    // update buffer
-                    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numBSPverts[l], BSPshaderstore[l]);
-                }
-            }
+            _stream_units(BSPshaderstore, numBSPverts, bspfirst);
 
             glBindBuffer(GL_ARRAY_BUFFER, 0);
 
@@ -4304,10 +3951,6 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
         bspshader.use();
 
-        //// set projection
-        glUniformMatrix4fv(bspshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-        //// set view
-        glUniformMatrix4fv(bspshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
         glUniform1i(bspshader.uniformLocation("waterframe"), GLint(this->hd_water_current_frame));
         glUniform1i(bspshader.uniformLocation("flowtimer"), GLint(pMiscTimer->time().realtimeMilliseconds() >> 4));
@@ -4363,7 +4006,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
             if (pMobileLightsStack->uNumLightsActive < 1) continue;
 
             MobileLight &test = pMobileLightsStack->pLights[i];
-            std::string slotnum = std::to_string(num_lights);
+            const PointLightUniforms &light = bsppointlights[num_lights];
 
             float x = pMobileLightsStack->pLights[i].vPosition.x;
             float y = pMobileLightsStack->pLights[i].vPosition.y;
@@ -4371,13 +4014,13 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
             Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
 
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
+            light.type.set(2.0f);
+            light.position.set(Vec3f(x, y, z));
+            light.sector.set(0);
+            light.ambient.set(Vec3f(color.r, color.g, color.b));
+            light.diffuse.set(Vec3f(color.r, color.g, color.b));
+            light.specular.set(Vec3f(0, 0, 0));
+            light.radius.set(test.uRadius);
             num_lights++;
         }
 
@@ -4421,7 +4064,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
             }
             if (!visinfrustum) continue;
 
-            std::string slotnum = std::to_string(num_lights);
+            const PointLightUniforms &light = bsppointlights[num_lights];
 
             float x = test.vPosition.x;
             float y = test.vPosition.y;
@@ -4429,13 +4072,13 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
             Colorf color = test.uLightColor.toColorf();
 
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 1.0f);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), test.uSectorID);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
+            light.type.set(1.0f);
+            light.position.set(Vec3f(x, y, z));
+            light.sector.set(test.uSectorID);
+            light.ambient.set(Vec3f(color.r, color.g, color.b));
+            light.diffuse.set(Vec3f(color.r, color.g, color.b));
+            light.specular.set(Vec3f(0, 0, 0));
+            light.radius.set(test.uRadius);
             num_lights++;
         }
 
@@ -4447,7 +4090,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
             MobileLight &test = pMobileLightsStack->pLights[i];
             if (!IsSphereInFrustum(test.vPosition, test.uRadius)) continue;
 
-            std::string slotnum = std::to_string(num_lights);
+            const PointLightUniforms &light = bsppointlights[num_lights];
 
             float x = pMobileLightsStack->pLights[i].vPosition.x;
             float y = pMobileLightsStack->pLights[i].vPosition.y;
@@ -4455,20 +4098,20 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
             Colorf color = pMobileLightsStack->pLights[i].uLightColor.toColorf();
 
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 2.0f);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].position").c_str()), x, y, z);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].sector").c_str()), 0);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].ambient").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].diffuse").c_str()), color.r, color.g, color.b);
-            glUniform3f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].specular").c_str()), 0, 0, 0);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].radius").c_str()), test.uRadius);
+            light.type.set(2.0f);
+            light.position.set(Vec3f(x, y, z));
+            light.sector.set(0);
+            light.ambient.set(Vec3f(color.r, color.g, color.b));
+            light.diffuse.set(Vec3f(color.r, color.g, color.b));
+            light.specular.set(Vec3f(0, 0, 0));
+            light.radius.set(test.uRadius);
             num_lights++;
         }
 
         // blank any lights not used
         for (int blank = num_lights; blank < 40; blank++) {
-            std::string slotnum = std::to_string(blank);
-            glUniform1f(bspshader.uniformLocation(("fspointlights[" + slotnum + "].type").c_str()), 0.0);
+            const PointLightUniforms &light = bsppointlights[blank];
+            light.type.set(0.0);
         }
 
 
@@ -4488,7 +4131,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
             glBindVertexArray(bspVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numBSPverts[unit]));
+            glDrawArrays(GL_TRIANGLES, bspfirst[unit], numBSPverts[unit]);
             drawcalls++;
             //}
         }
@@ -4746,6 +4389,7 @@ void OpenGLRenderer::FillRectFast(int x, int y, int width, int height, Color col
 
     // 0 1 2 / 0 2 3
 
+    growVertexStore(twodshaderstore, twodvertscnt, 6);
     twodshaderstore[twodvertscnt].x = drawx;
     twodshaderstore[twodvertscnt].y = drawy;
     twodshaderstore[twodvertscnt].z = 0;
@@ -4808,7 +4452,6 @@ void OpenGLRenderer::FillRectFast(int x, int y, int width, int height, Color col
     twodshaderstore[twodvertscnt].paletteid = 0;
     twodvertscnt++;
 
-    if (twodvertscnt > 490) DrawTwodVerts();
     return;
 }
 
@@ -4924,40 +4567,24 @@ bool OpenGLRenderer::ReloadShaders() {
         glDeleteVertexArrays(1, &textVAO);
         textVAO = 0;
     }
-    if (textVBO) {
-        glDeleteBuffers(1, &textVBO);
-        textVBO = 0;
-    }
     textvertscnt = 0;
 
     if (lineVAO) {
         glDeleteVertexArrays(1, &lineVAO);
         lineVAO = 0;
     }
-    if (lineVBO) {
-        glDeleteBuffers(1, &lineVBO);
-        lineVBO = 0;
-    }
     linevertscnt = 0;
 
     if (twodVAO) {
         glDeleteVertexArrays(1, &twodVAO);
         twodVAO = 0;
     }
-    if (twodVBO) {
-        glDeleteBuffers(1, &twodVBO);
-        twodVBO = 0;
-    }
     twodvertscnt = 0;
 
     if (billbVAO) {
         glDeleteVertexArrays(1, &billbVAO);
         billbVAO = 0;
     }
-    if (billbVBO) {
-        glDeleteBuffers(1, &billbVBO);
-        billbVBO = 0;
-    }
     if (paltex) {
         glDeleteTextures(1, &paltex);
         paltex = 0;
@@ -4972,20 +4599,12 @@ bool OpenGLRenderer::ReloadShaders() {
         glDeleteVertexArrays(1, &decalVAO);
         decalVAO = 0;
     }
-    if (decalVBO) {
-        glDeleteBuffers(1, &decalVBO);
-        decalVBO = 0;
-    }
     numdecalverts = 0;
 
     if (forceperVAO) {
         glDeleteVertexArrays(1, &forceperVAO);
         forceperVAO = 0;
     }
-    if (forceperVBO) {
-        glDeleteBuffers(1, &forceperVBO);
-        forceperVBO = 0;
-    }
     forceperstorecnt = 0;
 
     const std::initializer_list<std::tuple<OpenGLShader *, std::string_view, std::string_view>> shaders = {
@@ -5007,8 +4626,17 @@ bool OpenGLRenderer::ReloadShaders() {
                                      fmt::format("{} shader failed to compile!\nPlease consult the log and consider issuing a bug report!", readableName));
             return false;
         }
+        shader->bindUniformBlock("CameraUniforms", CAMERA_UNIFORMS_BINDING);
     }
 
+    // sizes match num_point_lights in the shaders
+    terrainpointlights = resolvePointLightUniforms(terrainshader, 20);
+    outbuildpointlights = resolvePointLightUniforms(outbuildshader, 20);
+    bsppointlights = resolvePointLightUniforms(bspshader, 40);
+
+    // make sure the camera uniform buffer exists before anything is drawn
+    _update_camera_uniforms();
+
     logger->info("Shaders reloaded.");
     return true;
 }
@@ -5047,24 +4675,12 @@ void OpenGLRenderer::ReleaseTerrain() {
     terrainVBO = 0;
     terrainVAO = 0;
 
-    /*GLuint outbuildVBO, outbuildVAO;
-    GLuint outbuildtextures[8];
-    unsigned numoutbuildtexloaded[8];
-    unsigned outbuildtexturewidths[8];
-    unsigned outbuildtextureheights[8];
-    std::map<std::string, int> outbuildtexmap;*/
-
-    outbuildtexmap.clear();
+    outbuildlayout = TextureArrayLayout();
 
     for (int i = 0; i < 16; i++) {
         glDeleteTextures(1, &outbuildtextures[i]);
         outbuildtextures[i] = 0;
-        numoutbuildtexloaded[i] = 0;
-        outbuildtexturewidths[i] = 0;
-        outbuildtextureheights[i] = 0;
-        glDeleteBuffers(1, &outbuildVBO[i]);
         glDeleteVertexArrays(1, &outbuildVAO[i]);
-        outbuildVBO[i] = 0;
         outbuildVAO[i] = 0;
         if (outbuildshaderstore[i]) {
             free(outbuildshaderstore[i]);
@@ -5074,25 +4690,13 @@ void OpenGLRenderer::ReleaseTerrain() {
 }
 
 void OpenGLRenderer::ReleaseBSP() {
-    /*GLuint bspVBO, bspVAO;
-    GLuint bsptextures[16];
-    unsigned bsptexloaded[16];
-    unsigned bsptexturewidths[16];
-    unsigned bsptextureheights[16];
-    std::map<std::string, int> bsptexmap;*/
-
-    bsptexmap.clear();
+    bsplayout = TextureArrayLayout();
 
     for (int i = 0; i < 16; i++) {
         glDeleteTextures(1, &bsptextures[i]);
         bsptextures[i] = 0;
-        bsptexloaded[i] = 0;
-        bsptexturewidths[i] = 0;
-        bsptextureheights[i] = 0;
-        glDeleteBuffers(1, &bspVBO[i]);
         glDeleteVertexArrays(1, &bspVAO[i]);
         bspVAO[i] = 0;
-        bspVBO[i] = 0;
         if (BSPshaderstore[i]) {
             free(BSPshaderstore[i]);
             BSPshaderstore[i] = nullptr;
@@ -5101,6 +4705,10 @@ void OpenGLRenderer::ReleaseBSP() {
 }
 
 
+LevelMeshBuilder *OpenGLRenderer::levelMeshBuilder() {
+    return &_levelMeshBuilder;
+}
+
 void OpenGLRenderer::DrawTwodVerts() {
     if (!twodvertscnt) return;
 
@@ -5109,12 +4717,9 @@ void OpenGLRenderer::DrawTwodVerts() {
 
     if (twodVAO == 0) {
         glGenVertexArrays(1, &twodVAO);
-        glGenBuffers(1, &twodVBO);
 
         glBindVertexArray(twodVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, twodVBO);
-
-        glBufferData(GL_ARRAY_BUFFER, sizeof(twodshaderstore), twodshaderstore, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, streambuffer.id());
 
         // position attribute
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(twodverts), (void*)offsetof(twodverts, x));
@@ -5147,9 +4752,7 @@ void OpenGLRenderer::DrawTwodVerts() {
     }
 
     // update buffer
-    glBindBuffer(GL_ARRAY_BUFFER, twodVBO);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(twodverts) * twodvertscnt, twodshaderstore);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    int first = _stream_vertices(twodshaderstore.data(), twodvertscnt);
 
     glBindVertexArray(twodVAO);
     glEnableVertexAttribArray(0);
@@ -5173,10 +4776,6 @@ void OpenGLRenderer::DrawTwodVerts() {
     // set sampler to texure0
     glUniform1i(twodshader.uniformLocation("texture0"), GLint(0));
 
-    //// set projection
-    glUniformMatrix4fv(twodshader.uniformLocation("projection"), 1, GL_FALSE, &projmat[0][0]);
-    //// set view
-    glUniformMatrix4fv(twodshader.uniformLocation("view"), 1, GL_FALSE, &viewmat[0][0]);
 
     int offset = 0;
     while (offset < twodvertscnt) {
@@ -5200,7 +4799,7 @@ void OpenGLRenderer::DrawTwodVerts() {
             }
         } while (twodshaderstore[offset + (cnt * 6)].texid == thistex);
 
-        glDrawArrays(GL_TRIANGLES, offset, (6*cnt));
+        glDrawArrays(GL_TRIANGLES, first + offset, (6*cnt));
         drawcalls++;
 
         offset += (6*cnt);
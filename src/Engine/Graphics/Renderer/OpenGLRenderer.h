@@ -3,17 +3,21 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <span>
 #include <vector>
 
 #include <glad/gl.h> // NOLINT: this is not a C system include.
 #include <glm/glm.hpp>
 
 #include "Engine/Graphics/FrameLimiter.h"
+#include "Engine/Graphics/LevelMeshBuilder.h"
 #include "BaseRenderer.h"
 
 #include "Library/Color/Colorf.h"
 
 #include "OpenGLShader.h"
+#include "OpenGLStreamBuffer.h"
+#include "OpenGLTextureAtlas.h"
 
 class PlatformOpenGLContext;
 
@@ -116,6 +120,7 @@ class OpenGLRenderer : public BaseRenderer {
 
     virtual void ReleaseTerrain() override;
     virtual void ReleaseBSP() override;
+    virtual LevelMeshBuilder *levelMeshBuilder() override;
 
     virtual void DrawTwodVerts() override;
     void DrawBillboards();
@@ -129,8 +134,9 @@ class OpenGLRenderer : public BaseRenderer {
     virtual void beginOverlays() override;
     virtual void endOverlays() override;
 
+    virtual void drawCommandList(const RenderCommandList &commands) override;
+
  protected:
-    virtual void DoRenderBillboards_D3D() override;
     void SetBillboardBlendOptions(RenderBillboardD3D::OpacityType a1);
 
     void DrawOutdoorSkyPolygon(Polygon *pSkyPolygon);
@@ -144,6 +150,7 @@ class OpenGLRenderer : public BaseRenderer {
     void _shutdownImGui();
 
     FrameLimiter _frameLimiter;
+    LevelMeshBuilder _levelMeshBuilder;
 
     // these are the view and projection matrices for submission to shaders
     glm::mat4 projmat = glm::mat4x4(1);
@@ -152,6 +159,13 @@ class OpenGLRenderer : public BaseRenderer {
     void _set_3d_modelview_matrix();
     void _set_ortho_projection(bool gameviewport = false);
     void _set_ortho_modelview();
+    void _update_camera_uniforms();
+
+    // projection and view matrices are shared by all shaders through a uniform buffer, which is only updated when
+    // the matrices change
+    GLuint cameraUBO{};
+    glm::mat4 cameraUBOprojmat = glm::mat4x4(1);
+    glm::mat4 cameraUBOviewmat = glm::mat4x4(1);
 
     Recti clipRect;
 
@@ -173,6 +187,21 @@ class OpenGLRenderer : public BaseRenderer {
     OpenGLShader decalshader;
     OpenGLShader forcepershader;
 
+    // point light uniform handles, resolved on shader load
+    struct PointLightUniforms {
+        OpenGLUniform<float> type;
+        OpenGLUniform<Vec3f> position;
+        OpenGLUniform<float> sector;
+        OpenGLUniform<float> radius;
+        OpenGLUniform<Vec3f> ambient;
+        OpenGLUniform<Vec3f> diffuse;
+        OpenGLUniform<Vec3f> specular;
+    };
+    static std::vector<PointLightUniforms> resolvePointLightUniforms(const OpenGLShader &shader, int count);
+    std::vector<PointLightUniforms> terrainpointlights;
+    std::vector<PointLightUniforms> outbuildpointlights;
+    std::vector<PointLightUniforms> bsppointlights;
+
     // terrain shader
     GLuint terrainVBO{}, terrainVAO{};
     // all terrain textures are square
@@ -182,40 +211,57 @@ class OpenGLRenderer : public BaseRenderer {
     std::map<std::string, int> terraintexmap;
 
     // outside building shader
-    GLuint outbuildVBO[16]{}, outbuildVAO[16]{};
+    GLuint outbuildVAO[16]{};
+    int outbuildfirst[16]{}; // first vertex of each unit in the stream buffer
     GLuint outbuildtextures[16]{};
-    unsigned int numoutbuildtexloaded[16]{};
-    unsigned int outbuildtexturewidths[16]{};
-    unsigned int outbuildtextureheights[16]{};
-    std::map<std::string, int> outbuildtexmap;
+    TextureArrayLayout outbuildlayout;
 
     // indoors bsp shader
-    GLuint bspVBO[16]{}, bspVAO[16]{};
+    GLuint bspVAO[16]{};
+    int bspfirst[16]{}; // first vertex of each unit in the stream buffer
     GLuint bsptextures[16]{};
-    unsigned int bsptexloaded[16]{};
-    unsigned int bsptexturewidths[16]{};
-    unsigned int bsptextureheights[16]{};
-    std::map<std::string, int> bsptexmap;
+    TextureArrayLayout bsplayout;
+
+    // all the dynamic passes stream their vertices through a single ring buffer
+    OpenGLStreamBuffer streambuffer;
+    template<class T>
+    int _stream_vertices(const T *vertices, int count) {
+        vertexuploads++;
+        vertexuploadbytes += sizeof(T) * count;
+        return streambuffer.append(std::span<const T>(vertices, count));
+    }
+
+    // streams the vertices of all texture units with a single append, the units are drawn only after all of them are
+    // uploaded, and an append can orphan the buffer
+    template<class T>
+    void _stream_units(T *const (&units)[16], const int (&counts)[16], int (&firsts)[16]);
 
     // text shader
-    GLuint textVBO{}, textVAO{};
+    GLuint textVAO{};
     GLuint texmain{}, texshadow{};
+    // fonts are packed into a shared atlas, so switching fonts doesn't require a flush
+    OpenGLTextureAtlas fontatlas{Sizei(2048, 2048), 1, 2, 0};
+    TextureAtlasRegion textregion;
 
     // lines shader
-    GLuint lineVBO{}, lineVAO{};
+    GLuint lineVAO{};
 
     // two d shader
-    GLuint twodVBO{}, twodVAO{};
+    GLuint twodVAO{};
+    // small ui images are packed into atlases on first use, so that consecutive draws can be batched
+    static constexpr int UI_ATLAS_MAX_IMAGE_SIZE = 512;
+    OpenGLTextureAtlas uiatlas{Sizei(2048, 2048), 4, 1, 1};
+    TextureAtlasRegion _ui_texture_region(GraphicsImage *img);
 
     // billboards shader
-    GLuint billbVBO{}, billbVAO{};
+    GLuint billbVAO{};
     GLuint palbuf{}, paltex{};
 
     // decal shader
-    GLuint decalVBO{}, decalVAO{};
+    GLuint decalVAO{};
 
     // forced perspective shader
-    GLuint forceperVBO{}, forceperVAO{};
+    GLuint forceperVAO{};
 
     // Fog parameters
     Colorf fog;
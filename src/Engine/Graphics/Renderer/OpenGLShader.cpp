@@ -1,5 +1,6 @@
 #include "OpenGLShader.h"
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 
@@ -7,6 +8,8 @@
 
 #include "Library/Logger/Logger.h"
 
+#include "Utility/String/Format.h"
+
 static std::string compileErrors(int shader) {
     GLint success = 1;
     GLchar infoLog[2048];
@@ -76,6 +79,7 @@ bool OpenGLShader::load(const Blob &vertSource, const Blob &fragSource, bool ope
     }
 
     _id = result;
+    resolveUniformLocations();
     return true;
 }
 
@@ -85,12 +89,14 @@ void OpenGLShader::release() {
 
     glDeleteProgram(_id);
     _id = 0;
+    _uniformLocations.clear();
 }
 
-int OpenGLShader::uniformLocation(const char *name) {
+int OpenGLShader::uniformLocation(std::string_view name) const {
     assert(isValid());
 
-    return glGetUniformLocation(_id, name);
+    auto pos = _uniformLocations.find(name);
+    return pos == _uniformLocations.end() ? -1 : pos->second;
 }
 
 int OpenGLShader::attribLocation(const char *name) {
@@ -99,6 +105,14 @@ int OpenGLShader::attribLocation(const char *name) {
     return glGetAttribLocation(_id, name);
 }
 
+void OpenGLShader::bindUniformBlock(const char *name, unsigned binding) {
+    assert(isValid());
+
+    GLuint index = glGetUniformBlockIndex(_id, name);
+    if (index != GL_INVALID_INDEX)
+        glUniformBlockBinding(_id, index, binding);
+}
+
 void OpenGLShader::use() {
     assert(isValid());
 
@@ -129,3 +143,52 @@ unsigned OpenGLShader::loadShader(const Blob &source, int type, bool openGLES) {
 
     return result;
 }
+
+void OpenGLShader::resolveUniformLocations() {
+    _uniformLocations.clear();
+
+    GLint count = 0, maxLength = 0;
+    glGetProgramiv(_id, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::string name(std::max(maxLength, 1), '\0');
+    for (GLint i = 0; i < count; i++) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(_id, i, name.size(), &length, &size, &type, name.data());
+        std::string_view uniformName(name.data(), length);
+
+        GLint location = glGetUniformLocation(_id, name.c_str());
+        if (location == -1)
+            continue; // Uniform block member, these don't have locations.
+
+        // Arrays of basic types are reported as a single "name[0]" uniform. Array elements can be referenced either as
+        // "name[i]" or as "name" for the first one, and their locations are not guaranteed to be consecutive.
+        if (uniformName.ends_with("[0]")) {
+            std::string_view baseName = uniformName.substr(0, uniformName.size() - 3);
+            _uniformLocations.emplace(baseName, location);
+            for (GLint j = 0; j < size; j++) {
+                std::string elementName = fmt::format("{}[{}]", baseName, j);
+                _uniformLocations.emplace(elementName, glGetUniformLocation(_id, elementName.c_str()));
+            }
+        } else {
+            _uniformLocations.emplace(uniformName, location);
+        }
+    }
+}
+
+template<>
+void OpenGLUniform<int>::set(const int &value) const {
+    glUniform1i(_location, value);
+}
+
+template<>
+void OpenGLUniform<float>::set(const float &value) const {
+    glUniform1f(_location, value);
+}
+
+template<>
+void OpenGLUniform<Vec3f>::set(const Vec3f &value) const {
+    glUniform3f(_location, value.x, value.y, value.z);
+}
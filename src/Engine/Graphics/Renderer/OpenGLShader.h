@@ -1,8 +1,49 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Library/Geometry/Vec.h"
 
 #include "Utility/Memory/Blob.h"
+#include "Utility/String/TransparentFunctors.h"
+
+/**
+ * Typed handle to a shader uniform. Handles are resolved once after the shader is loaded, and are then used to set
+ * uniform values without any name lookups.
+ *
+ * Setting a uniform through a handle that wasn't found in the shader is a no-op, same as in OpenGL.
+ *
+ * @tparam T                            Uniform type. Only `int`, `float` and `Vec3f` are supported.
+ */
+template<class T>
+class OpenGLUniform {
+ public:
+    OpenGLUniform() = default;
+    explicit OpenGLUniform(int location) : _location(location) {}
+
+    [[nodiscard]] bool isValid() const {
+        return _location != -1;
+    }
+
+    [[nodiscard]] int location() const {
+        return _location;
+    }
+
+    /**
+     * Sets the uniform value for the currently bound shader program. Note that the handle must have been resolved
+     * from the same program.
+     */
+    void set(const T &value) const;
+
+ private:
+    int _location = -1;
+};
+
+template<> void OpenGLUniform<int>::set(const int &value) const;
+template<> void OpenGLUniform<float>::set(const float &value) const;
+template<> void OpenGLUniform<Vec3f>::set(const Vec3f &value) const;
 
 /**
  * Class for loading in and building gl shaders.
@@ -23,14 +64,37 @@ class OpenGLShader {
     [[nodiscard]] bool load(const Blob &vertSource, const Blob &fragSource, bool openGLES);
     void release();
 
-    [[nodiscard]] int uniformLocation(const char *name);
+    /**
+     * @param name                      Uniform name, e.g. `"fog.color"` or `"lights[2].position"`.
+     * @return                          Uniform location, or -1 if there is no such active uniform in this shader.
+     *                                  Locations are resolved when the shader is linked, so this function doesn't
+     *                                  make any GL calls.
+     */
+    [[nodiscard]] int uniformLocation(std::string_view name) const;
+
+    template<class T>
+    [[nodiscard]] OpenGLUniform<T> uniform(std::string_view name) const {
+        return OpenGLUniform<T>(uniformLocation(name));
+    }
+
     [[nodiscard]] int attribLocation(const char *name);
 
+    /**
+     * Binds a uniform block in this shader to the provided uniform buffer binding point. Does nothing if the shader
+     * doesn't use the block.
+     *
+     * @param name                      Uniform block name.
+     * @param binding                   Binding point index, as used in `glBindBufferBase`.
+     */
+    void bindUniformBlock(const char *name, unsigned binding);
+
     void use();
 
  private:
     [[nodiscard]] unsigned loadShader(const Blob &source, int type, bool openGLES);
+    void resolveUniformLocations();
 
  private:
     unsigned _id = 0;
+    std::unordered_map<TransparentString, int, TransparentStringHash, TransparentStringEquals> _uniformLocations;
 };
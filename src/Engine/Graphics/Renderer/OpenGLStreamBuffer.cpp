@@ -0,0 +1,138 @@
+#include "OpenGLStreamBuffer.h"
+
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+#include <glad/gl.h> // NOLINT: this is not a C system include.
+
+OpenGLStreamBuffer::~OpenGLStreamBuffer() {
+    release();
+}
+
+unsigned OpenGLStreamBuffer::id() {
+    if (_id == 0)
+        create();
+    return _id;
+}
+
+int OpenGLStreamBuffer::append(const void *data, size_t size, size_t stride) {
+    assert(data && size > 0 && stride > 0 && size % stride == 0);
+
+    if (_id == 0)
+        create();
+
+    if (size > _capacity / SEGMENT_COUNT)
+        allocate(std::bit_ceil(size * SEGMENT_COUNT));
+
+    // Vertex arrays point at the start of the buffer, so the offset must be a multiple of the vertex size.
+    size_t offset = (_head + stride - 1) / stride * stride;
+    if (offset + size > _capacity)
+        offset = 0;
+
+    bool unfenced = false;
+    if (!acquire(offset, size, &unfenced)) {
+        // Either the GPU is still reading from the range, or the draws reading from it were not even fenced yet.
+        // Orphan instead of stalling, and grow in the latter case so that this doesn't happen every frame.
+        allocate(unfenced ? _capacity * 2 : _capacity);
+        offset = 0;
+        [[maybe_unused]] bool acquired = acquire(offset, size, &unfenced);
+        assert(acquired);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, _id);
+    void *dst = glMapBufferRange(GL_ARRAY_BUFFER, offset, size,
+                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (dst) {
+        memcpy(dst, data, size);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    _head = offset + size;
+    return offset / stride;
+}
+
+void OpenGLStreamBuffer::fence() {
+    for (size_t segment = 0; segment < SEGMENT_COUNT; segment++) {
+        if (!_written[segment])
+            continue;
+
+        // A newer fence covers everything the older one did.
+        if (_fences[segment])
+            glDeleteSync(static_cast<GLsync>(_fences[segment]));
+        _fences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        _written[segment] = false;
+    }
+}
+
+void OpenGLStreamBuffer::release() {
+    deleteFences();
+    if (_id) {
+        glDeleteBuffers(1, &_id);
+        _id = 0;
+    }
+    _capacity = 0;
+    _head = 0;
+}
+
+void OpenGLStreamBuffer::create() {
+    glGenBuffers(1, &_id);
+    allocate(DEFAULT_CAPACITY);
+    _reallocations = 0;
+}
+
+void OpenGLStreamBuffer::allocate(size_t capacity) {
+    // Orphans the old storage, draws that are still using it are not affected.
+    glBindBuffer(GL_ARRAY_BUFFER, _id);
+    glBufferData(GL_ARRAY_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    deleteFences();
+    _reallocations++;
+    _capacity = capacity;
+    _head = 0;
+}
+
+bool OpenGLStreamBuffer::acquire(size_t offset, size_t size, bool *unfenced) {
+    size_t segmentSize = _capacity / SEGMENT_COUNT;
+    size_t firstSegment = offset / segmentSize;
+    size_t lastSegment = (offset + size - 1) / segmentSize;
+
+    // Segment that the head is in, writing past the head there is fine. Wrapping around to it is not.
+    bool wrapped = offset < _head;
+    size_t headSegment = _head == 0 ? 0 : (_head - 1) / segmentSize;
+
+    for (size_t segment = firstSegment; segment <= lastSegment; segment++) {
+        if (!wrapped && segment == headSegment)
+            continue;
+
+        if (_written[segment]) {
+            *unfenced = true;
+            return false;
+        }
+
+        if (_fences[segment]) {
+            GLenum status = glClientWaitSync(static_cast<GLsync>(_fences[segment]), 0, 0);
+            if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED)
+                return false;
+            glDeleteSync(static_cast<GLsync>(_fences[segment]));
+            _fences[segment] = nullptr;
+        }
+    }
+
+    for (size_t segment = firstSegment; segment <= lastSegment; segment++)
+        _written[segment] = true;
+    return true;
+}
+
+void OpenGLStreamBuffer::deleteFences() {
+    for (void *&fence : _fences) {
+        if (fence)
+            glDeleteSync(static_cast<GLsync>(fence));
+        fence = nullptr;
+    }
+    _written.fill(false);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+/**
+ * Ring buffer for streaming per-frame vertex data to the GPU. All the dynamic passes append their vertices here, so
+ * that there is no need for a separate fixed-size vertex buffer per pass.
+ *
+ * Data is written at the ring head through unsynchronized buffer mapping, so uploads don't stall on the draws that
+ * are still reading from the earlier parts of the buffer. The ring is split into segments. Calling `fence` after the
+ * draws that read the uploaded data puts a fence on all the segments written since the previous `fence` call. If the
+ * head then wraps around into a segment that the GPU hasn't finished reading from yet, then instead of waiting on the
+ * fence the buffer is orphaned, and the driver hands out fresh storage.
+ *
+ * Uploads that don't fit into a single segment grow the buffer. So does wrapping around into a segment that was
+ * written to but wasn't fenced yet, as this means that there is more data between two `fence` calls than the buffer
+ * can hold.
+ */
+class OpenGLStreamBuffer {
+ public:
+    static constexpr size_t SEGMENT_COUNT = 4;
+    static constexpr size_t DEFAULT_CAPACITY = 4 * 1024 * 1024;
+
+    OpenGLStreamBuffer() = default;
+    ~OpenGLStreamBuffer();
+
+    /**
+     * @return                          GL buffer id, for setting up the vertex arrays. The buffer is created on
+     *                                  first use, and keeps its id when it is orphaned or grown.
+     */
+    [[nodiscard]] unsigned id();
+
+    /**
+     * Appends vertex data to the buffer.
+     *
+     * @param data                      Vertex data.
+     * @param size                      Size of vertex data, in bytes. Must be a multiple of `stride`.
+     * @param stride                    Vertex size, in bytes.
+     * @return                          Index of the first uploaded vertex in the buffer, to be passed to
+     *                                  `glDrawArrays`.
+     */
+    int append(const void *data, size_t size, size_t stride);
+
+    template<class T>
+    int append(std::span<const T> vertices) {
+        return append(vertices.data(), vertices.size_bytes(), sizeof(T));
+    }
+
+    /**
+     * Fences all the segments written to since the last call. Must be called after the draws that use the uploaded
+     * data are issued, e.g. at the end of a frame.
+     */
+    void fence();
+
+    void release();
+
+    [[nodiscard]] size_t capacity() const {
+        return _capacity;
+    }
+
+    /**
+     * @return                          Number of times the buffer was orphaned or grown since it was created.
+     */
+    [[nodiscard]] int reallocations() const {
+        return _reallocations;
+    }
+
+ private:
+    void create();
+    void allocate(size_t capacity);
+    void deleteFences();
+
+    /**
+     * Checks that the `[offset, offset + size)` range can be written to, and marks the segments it spans as written.
+     *
+     * @return                          Whether the range is free. If not, nothing is marked and the buffer has to be
+     *                                  orphaned.
+     */
+    bool acquire(size_t offset, size_t size, bool *unfenced);
+
+ private:
+    unsigned _id = 0;
+    size_t _capacity = 0;
+    size_t _head = 0;
+    std::array<void *, SEGMENT_COUNT> _fences = {}; // GLsync by segment, set in `fence`.
+    std::array<bool, SEGMENT_COUNT> _written = {}; // Whether the segment was written to since the last `fence` call.
+    int _reallocations = 0;
+};
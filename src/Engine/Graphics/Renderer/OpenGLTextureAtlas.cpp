@@ -0,0 +1,136 @@
+#include "OpenGLTextureAtlas.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include <glad/gl.h> // NOLINT: this is not a C system include.
+
+#include "Engine/Graphics/Image.h"
+
+#include "Library/Image/Image.h"
+
+OpenGLTextureAtlas::OpenGLTextureAtlas(Sizei pageSize, int maxPages, int layers, int padding) :
+    _pageSize(pageSize), _maxPages(maxPages), _layers(layers), _padding(padding) {
+    assert(pageSize.w > 0 && pageSize.h > 0 && maxPages > 0 && layers > 0 && padding >= 0);
+}
+
+OpenGLTextureAtlas::~OpenGLTextureAtlas() {
+    release();
+}
+
+bool OpenGLTextureAtlas::insert(std::span<GraphicsImage *const> images) {
+    assert(images.size() == _layers);
+
+    Sizei size = images[0]->size();
+    for (GraphicsImage *image : images)
+        if (image->size() != size)
+            return false;
+
+    if (_rejectedSize && size.w >= _rejectedSize->w && size.h >= _rejectedSize->h)
+        return false;
+
+    Sizei paddedSize(size.w + 2 * _padding, size.h + 2 * _padding);
+    if (paddedSize.w > _pageSize.w || paddedSize.h > _pageSize.h)
+        return false;
+
+    int page = 0;
+    std::optional<Pointi> pos;
+    for (; page < _pages.size(); page++)
+        if ((pos = _pages[page].packer.insert(paddedSize)))
+            break;
+
+    if (!pos) {
+        if (_pages.size() == _maxPages) {
+            _rejectedSize = size;
+            return false;
+        }
+
+        Page &newPage = _pages.emplace_back();
+        newPage.packer = TextureAtlasPacker(_pageSize);
+        newPage.textures.resize(_layers);
+        glGenTextures(_layers, newPage.textures.data());
+        for (unsigned texture : newPage.textures) {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, _pageSize.w, _pageSize.h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        page = _pages.size() - 1;
+        pos = newPage.packer.insert(paddedSize);
+        assert(pos);
+    }
+
+    Recti rect(pos->x + _padding, pos->y + _padding, size.w, size.h);
+    for (int layer = 0; layer < _layers; layer++) {
+        GraphicsImage *image = images[layer];
+        unsigned texture = _pages[page].textures[layer];
+        upload(texture, rect, image);
+
+        TextureAtlasRegion region;
+        region.texture = TextureRenderId(texture);
+        region.uvOffset = Vec2f(static_cast<float>(rect.x) / _pageSize.w, static_cast<float>(rect.y) / _pageSize.h);
+        region.uvScale = Vec2f(static_cast<float>(rect.w) / _pageSize.w, static_cast<float>(rect.h) / _pageSize.h);
+        image->setAtlasRegion(region);
+
+        _entries[image->renderId().value()] = Entry(page, layer, rect);
+        _pages[page].images++;
+    }
+
+    return true;
+}
+
+bool OpenGLTextureAtlas::update(GraphicsImage *image) {
+    auto pos = _entries.find(image->renderId(false).value());
+    if (pos == _entries.end())
+        return false;
+
+    const Entry &entry = pos->second;
+    if (image->size() != entry.rect.size())
+        return false; // Resized images can't be updated in place. Shouldn't really happen.
+
+    upload(_pages[entry.page].textures[entry.layer], entry.rect, image);
+    return true;
+}
+
+bool OpenGLTextureAtlas::remove(TextureRenderId owner) {
+    auto pos = _entries.find(owner.value());
+    if (pos == _entries.end())
+        return false;
+
+    Page &page = _pages[pos->second.page];
+    _entries.erase(pos);
+    if (--page.images == 0)
+        page.packer.clear(); // Textures are kept around, they will be overwritten by the images packed later.
+    _rejectedSize.reset();
+    return true;
+}
+
+void OpenGLTextureAtlas::release() {
+    for (Page &page : _pages)
+        glDeleteTextures(page.textures.size(), page.textures.data());
+    _pages.clear();
+    _entries.clear();
+    _rejectedSize.reset();
+}
+
+void OpenGLTextureAtlas::upload(unsigned texture, Recti rect, GraphicsImage *image) {
+    RgbaImageView src = image->rgba();
+
+    // Copy the image into a padded buffer, replicating the edge pixels into the padding.
+    RgbaImage padded = RgbaImage::uninitialized(rect.w + 2 * _padding, rect.h + 2 * _padding);
+    for (int y = 0; y < padded.height(); y++) {
+        std::span<const Color> srcLine = src[std::clamp<int>(y - _padding, 0, rect.h - 1)];
+        std::span<Color> dstLine = padded[y];
+        for (int x = 0; x < padded.width(); x++)
+            dstLine[x] = srcLine[std::clamp<int>(x - _padding, 0, rect.w - 1)];
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x - _padding, rect.y - _padding, padded.width(), padded.height(),
+                    GL_RGBA, GL_UNSIGNED_BYTE, padded.pixels().data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Library/Geometry/Rect.h"
+#include "Library/Geometry/Size.h"
+#include "Library/Image/TextureAtlasPacker.h"
+
+#include "TextureAtlasRegion.h"
+#include "TextureRenderId.h"
+
+class GraphicsImage;
+
+/**
+ * Set of large textures that small images are packed into at runtime, so that the images can be drawn without
+ * switching textures.
+ *
+ * An atlas can have several layers, e.g. font & font shadow textures. Images that are packed together get the same
+ * rect in each of the layers, so a single set of uvs can be used to sample all of them.
+ *
+ * Space is reclaimed a whole page at a time, when all the images on the page are removed.
+ */
+class OpenGLTextureAtlas {
+ public:
+    /**
+     * @param pageSize                  Size of a single atlas texture.
+     * @param maxPages                  Max number of atlas textures per layer.
+     * @param layers                    Number of layers.
+     * @param padding                   Number of edge pixels to replicate around each image, so that linear
+     *                                  filtering doesn't pick up the neighbouring images.
+     */
+    OpenGLTextureAtlas(Sizei pageSize, int maxPages, int layers, int padding);
+    ~OpenGLTextureAtlas();
+
+    /**
+     * Packs the provided images into the atlas, one image per layer, and sets their atlas regions.
+     *
+     * @param images                    Images to pack, all of the same size.
+     * @return                          Whether the images were packed. Returns false if there is no space left.
+     */
+    bool insert(std::span<GraphicsImage *const> images);
+
+    /**
+     * Uploads new pixel data for an image that's in this atlas.
+     *
+     * @param image                     Image to update.
+     * @return                          Whether the image is in this atlas.
+     */
+    bool update(GraphicsImage *image);
+
+    /**
+     * Releases the atlas space taken by an image. Note that the image's atlas region is not reset.
+     *
+     * @param owner                     Render id of the image, as it was when the image was inserted.
+     * @return                          Whether the image was in this atlas.
+     */
+    bool remove(TextureRenderId owner);
+
+    void release();
+
+    [[nodiscard]] size_t pageCount() const {
+        return _pages.size();
+    }
+
+ private:
+    struct Page {
+        std::vector<unsigned> textures; // By layer.
+        TextureAtlasPacker packer;
+        int images = 0;
+    };
+
+    struct Entry {
+        int page = 0;
+        int layer = 0;
+        Recti rect;
+    };
+
+    void upload(unsigned texture, Recti rect, GraphicsImage *image);
+
+ private:
+    Sizei _pageSize;
+    int _maxPages = 0;
+    int _layers = 0;
+    int _padding = 0;
+    std::vector<Page> _pages;
+    std::unordered_map<intptr_t, Entry> _entries; // By owner render id.
+    // Size that didn't fit even with all the pages allocated. Images that are at least as large are skipped until
+    // some atlas space is freed.
+    std::optional<Sizei> _rejectedSize;
+};
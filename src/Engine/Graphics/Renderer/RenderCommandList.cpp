@@ -0,0 +1,76 @@
+#include "RenderCommandList.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "Utility/Exception.h"
+
+// Key layout, from the most significant bits:
+// 32 bits  - layer, ordering group that must be drawn in recording order.
+// 1 bit    - blend mode, 0 for alpha-blended & 1 for additive.
+// 31 bits  - texture index.
+static constexpr int LAYER_SHIFT = 32;
+static constexpr int BLEND_SHIFT = 31;
+static constexpr uint64_t TEXTURE_MASK = (1ull << BLEND_SHIFT) - 1;
+
+static bool isAdditive(RenderBillboardD3D::OpacityType opacity) {
+    return opacity != RenderBillboardD3D::Transparent;
+}
+
+void RenderCommandList::clear() {
+    _commands.clear();
+    _textureIndices.clear();
+    _layer = 0;
+    _additiveLayerOpen = false;
+}
+
+void RenderCommandList::addBillboard(const BillboardDrawCommand &command) {
+    assert(command.texture);
+
+    bool additive = isAdditive(command.opacity);
+    if (!additive) {
+        _layer++; // Each alpha-blended billboard gets a layer of its own.
+        _additiveLayerOpen = false;
+    } else if (!_additiveLayerOpen) {
+        _layer++;
+        _additiveLayerOpen = true;
+    }
+
+    uint64_t texture = _textureIndices.emplace(command.texture, _textureIndices.size()).first->second;
+
+    RenderCommand &result = _commands.emplace_back();
+    result.key = (static_cast<uint64_t>(_layer) << LAYER_SHIFT) | (static_cast<uint64_t>(additive) << BLEND_SHIFT) |
+                 (texture & TEXTURE_MASK);
+    result.billboard = command;
+}
+
+void RenderCommandList::sort() {
+    std::ranges::stable_sort(_commands, std::ranges::less(), &RenderCommand::key);
+}
+
+void RenderCommandList::validate() const {
+    for (size_t i = 0; i < _commands.size(); i++) {
+        const RenderCommand &command = _commands[i];
+        const BillboardDrawCommand &billboard = command.billboard;
+
+        if (i > 0 && _commands[i - 1].key > command.key)
+            throw Exception("Render command #{} is out of order", i);
+        if (!billboard.texture)
+            throw Exception("Render command #{} has no texture", i);
+        if (billboard.numVertices != 3 && billboard.numVertices != 4)
+            throw Exception("Render command #{} has invalid number of vertices {}", i, billboard.numVertices);
+        if (((command.key >> BLEND_SHIFT) & 1) != isAdditive(billboard.opacity))
+            throw Exception("Render command #{} has a state key that doesn't match its blend mode", i);
+    }
+}
+
+size_t RenderCommandList::stateChanges() const {
+    size_t result = 0;
+    for (size_t i = 1; i < _commands.size(); i++) {
+        const BillboardDrawCommand &prev = _commands[i - 1].billboard;
+        const BillboardDrawCommand &next = _commands[i].billboard;
+        if (prev.texture != next.texture || isAdditive(prev.opacity) != isAdditive(next.opacity))
+            result++;
+    }
+    return result;
+}
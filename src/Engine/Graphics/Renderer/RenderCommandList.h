@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Graphics/RenderEntities.h"
+
+class GraphicsImage;
+
+/**
+ * Billboard draw in screen space, as recorded by the engine. Doesn't reference any renderer-specific state.
+ */
+struct BillboardDrawCommand {
+    GraphicsImage *texture = nullptr;
+    int paletteIndex = 0;
+    RenderBillboardD3D::OpacityType opacity = RenderBillboardD3D::Transparent;
+    float depth = 0; // Normalized depth for the depth test against the level geometry.
+    float screenSpaceZ = 0;
+    int numVertices = 0; // 3 or 4, quads are drawn as two triangles.
+    std::array<RenderVertexD3D3, 4> vertices;
+};
+
+struct RenderCommand {
+    uint64_t key = 0; // State key, see `RenderCommandList::sort`.
+    BillboardDrawCommand billboard;
+};
+
+/**
+ * API-neutral list of draw commands for a single frame.
+ *
+ * Scene traversal records commands back to front, and then calls `sort`, which reorders the commands to minimize
+ * render state changes. The list is then handed over to the renderer, which doesn't need to know anything about
+ * the scene.
+ *
+ * Only billboards are recorded for now. Terrain, BSP geometry, decals and overlays are still drawn by the renderer
+ * directly.
+ */
+class RenderCommandList {
+ public:
+    void clear();
+
+    /**
+     * Records a billboard draw. Billboards are expected to be recorded back to front.
+     *
+     * @param command                   Billboard to draw. Texture must not be null.
+     */
+    void addBillboard(const BillboardDrawCommand &command);
+
+    /**
+     * Sorts the recorded commands by their state keys.
+     *
+     * Alpha-blended billboards are drawn in recording order. Additive billboards are order-independent, so additive
+     * billboards recorded between two alpha-blended ones are grouped by texture. The resulting image is the same as
+     * the one that would have been produced if the commands were drawn in recording order.
+     */
+    void sort();
+
+    /**
+     * Checks the invariants of this list, e.g. that it's sorted & that all the commands are well-formed.
+     *
+     * @throws Exception                If this list is not valid.
+     */
+    void validate() const;
+
+    /**
+     * @return                          Number of times the renderer will have to switch texture or blend mode
+     *                                  when drawing the commands in the current order.
+     */
+    [[nodiscard]] size_t stateChanges() const;
+
+    [[nodiscard]] std::span<const RenderCommand> commands() const {
+        return _commands;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _commands.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _commands.empty();
+    }
+
+ private:
+    std::vector<RenderCommand> _commands;
+    std::unordered_map<GraphicsImage *, uint32_t> _textureIndices; // Texture index by texture, in recording order.
+    uint32_t _layer = 0;
+    bool _additiveLayerOpen = false;
+};
@@ -1,6 +1,12 @@
 #include "Renderer.h"
 
+#include <algorithm>
 #include <memory>
+#include <thread>
+
+#include "Application/GameConfig.h"
+
+#include "Library/Parallel/WorkerPool.h"
 
 Renderer *render = nullptr;
 
@@ -23,6 +29,24 @@ Renderer::Renderer(
     memset(pBillboardRenderListD3D, 0, sizeof(pBillboardRenderListD3D));
     uNumBillboardsToDraw = 0;
     drawcalls = 0;
+    vertexuploads = 0;
+    vertexuploadbytes = 0;
 }
 
 Renderer::~Renderer() = default;
+
+WorkerPool &Renderer::renderListPool() {
+    int threadCount = config->graphics.RenderListThreads.value();
+    if (threadCount == 0) {
+        // Render lists are small, past a few threads synchronization costs more than it saves.
+        threadCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4);
+    }
+
+    if (!_renderListPool || _renderListPool->threadCount() != threadCount)
+        _renderListPool = std::make_unique<WorkerPool>(threadCount);
+    return *_renderListPool;
+}
+
+void Renderer::releaseRenderListPool() {
+    _renderListPool.reset();
+}
@@ -10,9 +10,12 @@
 #include "Library/Geometry/Rect.h"
 
 #include "TextureRenderId.h"
+#include "RenderCommandList.h"
 #include "Engine/Graphics/RenderEntities.h"
 
 class Actor;
+class LevelMeshBuilder;
+class WorkerPool;
 class GraphicsImage;
 class GameConfig;
 class Sprite;
@@ -30,6 +33,9 @@ struct nk_context;
 
 bool PauseGameDrawing();
 
+// Minimal number of billboards to cull in a single render list job, see `Renderer::renderListPool`.
+static constexpr size_t RENDER_LIST_CHUNK_SIZE = 256;
+
 class Renderer {
  public:
     Renderer(
@@ -170,19 +176,43 @@ class Renderer {
     virtual void ReleaseTerrain() = 0;
     virtual void ReleaseBSP() = 0;
 
+    /**
+     * @return                          Builder for the level geometry that this renderer draws, or `nullptr` if this
+     *                                  renderer doesn't draw level geometry. Level loading code feeds the builder so
+     *                                  that the geometry is ready by the time the first frame is drawn.
+     */
+    virtual LevelMeshBuilder *levelMeshBuilder() = 0;
+
     virtual void DrawTwodVerts() = 0;
 
     virtual Sizei GetRenderDimensions() = 0;
     virtual Sizei GetPresentDimensions() = 0;
     virtual bool Reinitialize(bool firstInit = false) = 0;
     virtual bool ReloadShaders() = 0;
-    virtual void DoRenderBillboards_D3D() = 0;
+
+    /**
+     * Draws the provided command list. Command list is expected to be sorted.
+     *
+     * @param commands                  Commands to draw.
+     */
+    virtual void drawCommandList(const RenderCommandList &commands) = 0;
 
     virtual void flushAndScale() = 0;
     virtual void swapBuffers() = 0;
     virtual void beginOverlays() = 0;
     virtual void endOverlays() = 0;
 
+    /**
+     * @return                          Worker pool for building the per-frame billboard render lists. Recreated when
+     *                                  `graphics.render_list_threads` changes.
+     */
+    WorkerPool &renderListPool();
+
+    /**
+     * Destroys the render list worker pool, joining its threads. It is recreated on the next `renderListPool` call.
+     */
+    void releaseRenderListPool();
+
     std::shared_ptr<GameConfig> config = nullptr;
     int *pActiveZBuffer;
     Color uFogColor;
@@ -191,13 +221,19 @@ class Renderer {
     RenderBillboardD3D pBillboardRenderListD3D[1000];
     unsigned int uNumBillboardsToDraw; // TODO(captainurist): this is not properly cleared if BeginScene3D is not called,
                                        //                     resulting in dangling textures in pBillboardRenderListD3D.
+    RenderCommandList commandList; // Commands for the last drawn frame.
 
     int drawcalls;
+    int vertexuploads; // Number of dynamic vertex buffer uploads, reset together with `drawcalls`.
+    size_t vertexuploadbytes; // Size of dynamic vertex data uploaded, reset together with `drawcalls`.
 
     DecalBuilder *decal_builder = nullptr;
     SpellFxRenderer *spell_fx_renderer = nullptr;
     std::shared_ptr<ParticleEngine> particle_engine = nullptr;
     Vis *vis = nullptr;
+
+ private:
+    std::unique_ptr<WorkerPool> _renderListPool;
 };
 
 extern Renderer *render;
@@ -0,0 +1,81 @@
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/Renderer/RenderCommandList.h"
+
+// Command list only uses textures as keys, so these are never dereferenced.
+static GraphicsImage *const texture0 = reinterpret_cast<GraphicsImage *>(0x10);
+static GraphicsImage *const texture1 = reinterpret_cast<GraphicsImage *>(0x20);
+static GraphicsImage *const texture2 = reinterpret_cast<GraphicsImage *>(0x30);
+
+static BillboardDrawCommand billboard(GraphicsImage *texture, RenderBillboardD3D::OpacityType opacity) {
+    BillboardDrawCommand result;
+    result.texture = texture;
+    result.opacity = opacity;
+    result.numVertices = 4;
+    return result;
+}
+
+static std::vector<GraphicsImage *> textures(const RenderCommandList &list) {
+    std::vector<GraphicsImage *> result;
+    for (const RenderCommand &command : list.commands())
+        result.push_back(command.billboard.texture);
+    return result;
+}
+
+UNIT_TEST(RenderCommandList, Sort) {
+    // Sorting should group additive billboards by texture, without reordering them relative to the alpha-blended ones.
+    RenderCommandList list;
+    list.addBillboard(billboard(texture0, RenderBillboardD3D::Opaque_1));
+    list.addBillboard(billboard(texture1, RenderBillboardD3D::Opaque_2));
+    list.addBillboard(billboard(texture0, RenderBillboardD3D::Opaque_1));
+    list.addBillboard(billboard(texture1, RenderBillboardD3D::Opaque_3));
+    list.addBillboard(billboard(texture2, RenderBillboardD3D::Transparent));
+    list.addBillboard(billboard(texture1, RenderBillboardD3D::Transparent));
+    list.addBillboard(billboard(texture0, RenderBillboardD3D::NoBlend));
+    list.addBillboard(billboard(texture2, RenderBillboardD3D::Opaque_1));
+    list.addBillboard(billboard(texture0, RenderBillboardD3D::Opaque_1));
+    EXPECT_EQ(list.size(), 9);
+    EXPECT_EQ(list.stateChanges(), 8);
+    EXPECT_ANY_THROW(list.validate());
+
+    list.sort();
+    EXPECT_NO_THROW(list.validate());
+    EXPECT_EQ(list.stateChanges(), 5);
+    EXPECT_EQ(textures(list), std::vector<GraphicsImage *>({texture0, texture0, texture1, texture1, texture2, texture1,
+                                                            texture0, texture0, texture2}));
+}
+
+UNIT_TEST(RenderCommandList, SortKeepsAlphaBlendedOrder) {
+    RenderCommandList list;
+    list.addBillboard(billboard(texture2, RenderBillboardD3D::Transparent));
+    list.addBillboard(billboard(texture0, RenderBillboardD3D::Transparent));
+    list.addBillboard(billboard(texture1, RenderBillboardD3D::NoBlend));
+    list.addBillboard(billboard(texture0, RenderBillboardD3D::Transparent));
+    EXPECT_NO_THROW(list.validate());
+
+    list.sort();
+    EXPECT_EQ(textures(list), std::vector<GraphicsImage *>({texture2, texture0, texture1, texture0}));
+    EXPECT_EQ(list.stateChanges(), 3);
+}
+
+UNIT_TEST(RenderCommandList, Validate) {
+    RenderCommandList list;
+    EXPECT_NO_THROW(list.validate());
+    EXPECT_EQ(list.stateChanges(), 0);
+
+    BillboardDrawCommand triangle = billboard(texture0, RenderBillboardD3D::Opaque_1);
+    triangle.numVertices = 3;
+    list.addBillboard(triangle);
+    EXPECT_NO_THROW(list.validate());
+
+    BillboardDrawCommand broken = billboard(texture0, RenderBillboardD3D::Opaque_1);
+    broken.numVertices = 5;
+    list.addBillboard(broken);
+    EXPECT_ANY_THROW(list.validate());
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_NO_THROW(list.validate());
+}
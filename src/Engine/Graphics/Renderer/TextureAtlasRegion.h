@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Library/Geometry/Vec.h"
+
+#include "TextureRenderId.h"
+
+/**
+ * Part of a texture atlas that a single image was packed into.
+ *
+ * Images in an atlas are drawn by binding the atlas texture & remapping the image uvs with `map`, so that images
+ * sharing an atlas can be drawn in a single batch.
+ */
+struct TextureAtlasRegion {
+    TextureRenderId texture; // Atlas texture.
+    Vec2f uvOffset;
+    Vec2f uvScale = Vec2f(1.0f, 1.0f);
+
+    /**
+     * @param uv                        Texture coordinates inside the image.
+     * @return                          Corresponding texture coordinates inside the atlas texture.
+     */
+    [[nodiscard]] Vec2f map(Vec2f uv) const {
+        return Vec2f(uvOffset.x + uv.x * uvScale.x, uvOffset.y + uv.y * uvScale.y);
+    }
+};
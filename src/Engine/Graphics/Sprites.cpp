@@ -177,12 +177,11 @@ int SpriteFrameTable::FastFindSprite(std::string_view pSpriteName) {
 //----- (0044D8D0) --------------------------------------------------------
 SpriteFrame *SpriteFrameTable::GetFrame(int uSpriteID, Duration uTime) {
     SpriteFrame *v4 = &pSpriteSFrames[uSpriteID];
-    if (~v4->uFlags & 1 || !v4->uAnimLength)
+    if (!_animationIndex.isAnimated(uSpriteID))
         return v4;
 
     // uAnimLength / uAnimTime = actual number of frames in sprite
-    for (Duration t = uTime % v4->uAnimLength; t >= v4->uAnimTime; ++v4)
-        t -= v4->uAnimTime;
+    v4 = &pSpriteSFrames[_animationIndex.frame(uSpriteID, uTime % v4->uAnimLength)];
 
     // TODO(pskelton): investigate and fix properly - dragon breath is missing last two frames??
     // quick fix so it doesnt return empty sprite
@@ -197,13 +196,18 @@ SpriteFrame *SpriteFrameTable::GetFrame(int uSpriteID, Duration uTime) {
 //----- (0044D91F) --------------------------------------------------------
 SpriteFrame *SpriteFrameTable::GetFrameReversed(int uSpriteID, Duration time) {
     SpriteFrame *sprite = &pSpriteSFrames[uSpriteID];
-    if (!(sprite->uFlags & 1) || !sprite->uAnimLength)
+    if (!_animationIndex.isAnimated(uSpriteID))
         return sprite;
 
-    for (Duration t = sprite->uAnimLength - time % sprite->uAnimLength; t >= sprite->uAnimTime; ++sprite)
-        t -= sprite->uAnimTime;
+    return &pSpriteSFrames[_animationIndex.frame(uSpriteID, sprite->uAnimLength - time % sprite->uAnimLength)];
+}
 
-    return sprite;
+void SpriteFrameTable::buildAnimationIndex() {
+    _animationIndex.build(pSpriteSFrames.size(), [&](size_t i) {
+        return pSpriteSFrames[i].uAnimTime;
+    }, [&](size_t i) {
+        return (pSpriteSFrames[i].uFlags & 1) ? pSpriteSFrames[i].uAnimLength : Duration();
+    });
 }
 
 // new
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "Engine/Tables/FrameAnimationIndex.h"
 #include "Engine/Time/Duration.h"
 
 struct LODSprite;
@@ -61,6 +62,12 @@ struct SpriteFrameTable {
     SpriteFrame *GetFrame(int uSpriteID, Duration uTime);
     SpriteFrame *GetFrameReversed(int uSpriteID, Duration time);
 
+    /**
+     * Rebuilds the animation index used by `GetFrame` & `GetFrameReversed`. Must be called after `pSpriteSFrames`
+     * is loaded.
+     */
+    void buildAnimationIndex();
+
     /**
      * Resets the uPaletteIndex of all loaded pSpriteSFrames. Called by PaletteManager on reset.
      */
@@ -71,6 +78,9 @@ struct SpriteFrameTable {
     /** Indices into `pSpriteSFrames`, sorted by sprite name. Note that `pSpriteSFrames` itself is not sorted.
      * Contains only indices for 'a' (frontal?) sprites, so smaller in size than `pSpriteSFrames`. */
     std::vector<uint16_t> pSpriteEFrames;
+
+ private:
+    FrameAnimationIndex _animationIndex;
 };
 
 extern SpriteFrameTable *pSpriteFrameTable;
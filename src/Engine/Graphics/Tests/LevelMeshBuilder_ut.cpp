@@ -0,0 +1,179 @@
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/LevelMeshBuilder.h"
+
+#include "Library/Lod/LodReader.h"
+#include "Library/Lod/LodWriter.h"
+#include "Library/LodFormats/LodFormatSnapshots.h"
+
+#include "Utility/Streams/BlobOutputStream.h"
+
+struct TestTexture {
+    std::string name;
+    int size = 0;
+    uint8_t pixel = 0;
+};
+
+// Same layout as the LOD_FILE_IMAGE entries in bitmaps.lod: header, pixels, 256-color palette.
+static Blob makeLodImage(const TestTexture &texture) {
+    LodImageHeader_MM6 header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.name.data(), texture.name.data(), std::min(texture.name.size(), header.name.size() - 1));
+    header.size = texture.size * texture.size;
+    header.dataSize = header.size;
+    header.width = texture.size;
+    header.height = texture.size;
+
+    std::vector<uint8_t> pixels(header.size, texture.pixel);
+    std::vector<uint8_t> palette(0x300);
+    for (size_t i = 0; i < palette.size(); i++)
+        palette[i] = i / 3;
+
+    return Blob::concat(Blob::concat(Blob::view(&header, sizeof(header)), Blob::view(pixels.data(), pixels.size())),
+                        Blob::view(palette.data(), palette.size()));
+}
+
+static LodReader makeBitmapsLod(const std::vector<TestTexture> &textures) {
+    LodInfo info;
+    info.version = LOD_VERSION_MM7;
+    info.rootName = "bitmaps";
+
+    Blob lod;
+    BlobOutputStream stream(&lod, "bitmaps.lod");
+    LodWriter writer(&stream, info);
+    for (int i = 0; i < 7; i++)
+        writer.write(fmt::format("hdwtr{:03}", i), makeLodImage({fmt::format("hdwtr{:03}", i), 128, 1}));
+    for (const TestTexture &texture : textures)
+        writer.write(texture.name, makeLodImage(texture));
+    writer.close();
+    stream.close();
+
+    return LodReader(std::move(lod));
+}
+
+static LevelMeshSource makeSource(std::vector<std::vector<std::string>> faceTextures) {
+    LevelMeshSource result;
+    result.type = LEVEL_INDOOR;
+    result.faceTextures = std::move(faceTextures);
+    return result;
+}
+
+UNIT_TEST(LevelMeshBuilder, Extend) {
+    LodReader reader = makeBitmapsLod({{"pending", 32, 2}, {"wall", 64, 3}, {"door1", 64, 4}, {"door2", 64, 5}});
+    LevelMeshSource source = makeSource({
+        {"wall"},
+        {}, // Not drawn.
+        {"wtrtyl"},
+        {"door1", "door2"}, // Animated, face shows the last frame.
+        {"missing"}, // Not in the LOD, falls back to "pending".
+    });
+
+    LevelMesh mesh;
+    extendLevelMesh(source, reader, &mesh);
+
+    // Water layers go first.
+    EXPECT_EQ(mesh.layout.find("HDWTR000"), TextureArraySlot(0, 0));
+    EXPECT_EQ(mesh.layout.find("HDWTR006"), TextureArraySlot(0, 6));
+    EXPECT_EQ(mesh.layout.units()[0].size, Sizei(128, 128));
+
+    ASSERT_EQ(mesh.faceSlots.size(), 5);
+    EXPECT_EQ(mesh.faceSlots[0], mesh.layout.find("wall"));
+    EXPECT_EQ(mesh.faceSlots[1], std::nullopt);
+    EXPECT_EQ(mesh.faceSlots[2], TextureArraySlot());
+    EXPECT_EQ(mesh.faceSlots[3], mesh.layout.find("door2"));
+    EXPECT_EQ(mesh.faceSlots[4], mesh.layout.find("missing"));
+
+    // 7 water layers, wall, 2 door frames & the missing texture.
+    EXPECT_EQ(mesh.layout.size(), 11);
+    EXPECT_EQ(mesh.images.size(), 11);
+    EXPECT_FALSE(mesh.layout.find("wtrtyl"));
+    EXPECT_EQ(mesh.layout.find("wall")->unit, mesh.layout.find("door1")->unit);
+    EXPECT_EQ(mesh.images.at("wall").width(), 64);
+    EXPECT_EQ(mesh.images.at("missing").width(), 32);
+    EXPECT_NE(mesh.layout.find("missing")->unit, mesh.layout.find("wall")->unit);
+
+    // Texture change on a face only decodes the new texture.
+    source.faceTextures[0] = {"door1"};
+    source.faceTextures.push_back({"wall"});
+    extendLevelMesh(source, reader, &mesh);
+    EXPECT_EQ(mesh.layout.size(), 11);
+    ASSERT_EQ(mesh.faceSlots.size(), 6);
+    EXPECT_EQ(mesh.faceSlots[0], mesh.layout.find("door1"));
+    EXPECT_EQ(mesh.faceSlots[5], mesh.layout.find("wall"));
+}
+
+UNIT_TEST(LevelMeshBuilder, CacheRoundTrip) {
+    LodReader reader = makeBitmapsLod({{"pending", 32, 2}, {"wall", 64, 3}, {"floor", 256, 4}});
+    LevelMeshSource source = makeSource({{"wall"}, {"floor"}, {}, {"wall"}});
+    uint64_t hash = levelMeshSourceHash(source, reader);
+
+    LevelMesh mesh;
+    extendLevelMesh(source, reader, &mesh);
+    Blob cache = compileLevelMeshCache(mesh, hash);
+
+    LevelMesh loaded;
+    ASSERT_TRUE(loadLevelMeshCache(cache, hash, &loaded));
+    EXPECT_EQ(loaded.layout.size(), mesh.layout.size());
+    for (const TextureArrayUnit &unit : mesh.layout.units()) {
+        for (const std::string &name : unit.layers) {
+            EXPECT_EQ(loaded.layout.find(name), mesh.layout.find(name));
+            EXPECT_EQ(loaded.images.at(name).pixels().size_bytes(), mesh.images.at(name).pixels().size_bytes());
+            EXPECT_EQ(memcmp(loaded.images.at(name).pixels().data(), mesh.images.at(name).pixels().data(),
+                             mesh.images.at(name).pixels().size_bytes()), 0);
+        }
+    }
+
+    // Face slots are recalculated w/o decoding anything.
+    extendLevelMesh(source, reader, &loaded);
+    EXPECT_EQ(loaded.faceSlots, mesh.faceSlots);
+    EXPECT_EQ(loaded.images.size(), mesh.images.size());
+}
+
+UNIT_TEST(LevelMeshBuilder, CacheRejectsStaleOrCorruptData) {
+    LodReader reader = makeBitmapsLod({{"pending", 32, 2}, {"wall", 64, 3}});
+    LevelMeshSource source = makeSource({{"wall"}});
+    uint64_t hash = levelMeshSourceHash(source, reader);
+
+    LevelMesh mesh;
+    extendLevelMesh(source, reader, &mesh);
+    Blob cache = compileLevelMeshCache(mesh, hash);
+
+    LevelMesh loaded;
+    EXPECT_FALSE(loadLevelMeshCache(cache, hash + 1, &loaded));
+
+    loaded = LevelMesh();
+    EXPECT_FALSE(loadLevelMeshCache(cache.subBlob(0, cache.size() / 2), hash, &loaded));
+
+    std::string corrupted(cache.string_view());
+    corrupted[0] = 'X';
+    loaded = LevelMesh();
+    EXPECT_FALSE(loadLevelMeshCache(Blob::fromString(corrupted), hash, &loaded));
+}
+
+UNIT_TEST(LevelMeshBuilder, SourceHash) {
+    LodReader reader = makeBitmapsLod({{"pending", 32, 2}, {"wall", 64, 3}, {"door", 64, 4}});
+    LodReader otherReader = makeBitmapsLod({{"pending", 32, 2}, {"wall", 64, 7}, {"door", 64, 4}});
+    LevelMeshSource source = makeSource({{"wall"}, {"door"}});
+    uint64_t hash = levelMeshSourceHash(source, reader);
+
+    EXPECT_EQ(levelMeshSourceHash(source, reader), hash);
+
+    // Texture contents.
+    EXPECT_NE(levelMeshSourceHash(source, otherReader), hash);
+
+    // Palette settings.
+    LevelMeshSource brighter = source;
+    brighter.lightness = 1.5f;
+    EXPECT_NE(levelMeshSourceHash(brighter, reader), hash);
+
+    // Face texture assignment.
+    LevelMeshSource swapped = makeSource({{"door"}, {"wall"}});
+    EXPECT_NE(levelMeshSourceHash(swapped, reader), hash);
+    LevelMeshSource merged = makeSource({{"wall", "door"}});
+    EXPECT_NE(levelMeshSourceHash(merged, reader), hash);
+}
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/LightmapBuilder.h"
+#include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LocationFunctions.h"
+#include "Engine/OurMath.h"
+
+// Per-light check from GetLightLevelAtPoint as it was before it was made branch-free.
+static int originalLightLevelDelta(const Vec3f &lightPos, float lightRadius, const Vec3f &point) {
+    float distX = std::abs(lightPos.x - point.x);
+    if (distX <= lightRadius) {
+        float distY = std::abs(lightPos.y - point.y);
+        if (distY <= lightRadius) {
+            float distZ = std::abs(lightPos.z - point.z);
+            if (distZ <= lightRadius) {
+                unsigned int approx_distance = int_get_vector_length(static_cast<int>(distX), static_cast<int>(distY),
+                                                                     static_cast<int>(distZ));
+                if (approx_distance < lightRadius)
+                    return static_cast<int>(30 * approx_distance / lightRadius) - 30;
+            }
+        }
+    }
+    return 0;
+}
+
+static Vec3f randomPoint(std::mt19937 &gen, float range) {
+    std::uniform_real_distribution<float> dist(-range, range);
+    return Vec3f(dist(gen), dist(gen), dist(gen));
+}
+
+UNIT_TEST(LightmapBuilder, BatchMatchesOriginalPerLightCheck) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> radiusDist(0, 2048);
+
+    PointLightList lights;
+    std::vector<Vec3f> points(1);
+    std::vector<int> lightLevels(1);
+    for (int i = 0; i < 1'000'000; i++) {
+        Vec3f lightPos = randomPoint(gen, 4096);
+        float lightRadius = radiusDist(gen);
+        points[0] = lightPos + randomPoint(gen, lightRadius * 1.5f + 1);
+
+        lights.clear();
+        lights.add(lightPos, lightRadius);
+
+        // Base level of 31 & deltas in [-30, 0] mean there is no clamping, so this checks the exact delta.
+        lightLevels[0] = 31;
+        GetLightLevelsAtPoints(lights, points, lightLevels);
+        ASSERT_EQ(lightLevels[0], 31 + originalLightLevelDelta(lightPos, lightRadius, points[0]))
+            << "light = " << lightPos.x << ", " << lightPos.y << ", " << lightPos.z << ", radius = " << lightRadius
+            << ", point = " << points[0].x << ", " << points[0].y << ", " << points[0].z;
+    }
+}
+
+UNIT_TEST(LightmapBuilder, BatchMatchesScalar) {
+    auto mobileLights = std::make_unique<LightsStack_MobileLight_>();
+    auto stationaryLights = std::make_unique<LightsStack_StationaryLight_>();
+
+    LightsStack_MobileLight_ *savedMobileLights = pMobileLightsStack;
+    LightsStack_StationaryLight_ *savedStationaryLights = pStationaryLightsStack;
+    LevelType savedLevelType = uCurrentlyLoadedLevelType;
+    pMobileLightsStack = mobileLights.get();
+    pStationaryLightsStack = stationaryLights.get();
+    uCurrentlyLoadedLevelType = LEVEL_OUTDOOR; // Sector lights need a loaded indoor level.
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> radiusDist(64, 1024);
+    std::uniform_int_distribution<int> baseDist(0, 31);
+    for (int round = 0; round < 100; round++) {
+        mobileLights->uNumLightsActive = 0;
+        stationaryLights->uNumLightsActive = 0;
+        for (int i = 0; i < 20; i++) {
+            mobileLights->AddLight(randomPoint(gen, 2048), 0, radiusDist(gen), Color(), 0);
+            stationaryLights->AddLight(randomPoint(gen, 2048), radiusDist(gen), Color(), 0);
+        }
+
+        std::vector<Vec3f> points;
+        std::vector<int> lightLevels;
+        BBoxf bounds;
+        for (int i = 0; i < 100; i++) {
+            points.push_back(randomPoint(gen, 512));
+            lightLevels.push_back(baseDist(gen));
+            bounds = i == 0 ? BBoxf::forPoints(points[i], points[i]) : bounds | BBoxf::forPoints(points[i], points[i]);
+        }
+        std::vector<int> baseLevels = lightLevels;
+
+        PointLightList lights;
+        GatherPointLights(&lights, 0, bounds);
+        GetLightLevelsAtPoints(lights, points, lightLevels);
+
+        // Unclamped deltas applied to the base levels afterwards, this is how outdoor billboards are lit.
+        std::vector<int> deltas(points.size(), 0);
+        AddLightLevelsAtPoints(lights, points, deltas);
+
+        for (size_t i = 0; i < points.size(); i++) {
+            int expected = GetLightLevelAtPoint(baseLevels[i], 0, points[i].x, points[i].y, points[i].z);
+            ASSERT_EQ(lightLevels[i], expected);
+            ASSERT_EQ(std::clamp(baseLevels[i] + deltas[i], 0, 31), expected);
+        }
+    }
+
+    pMobileLightsStack = savedMobileLights;
+    pStationaryLightsStack = savedStationaryLights;
+    uCurrentlyLoadedLevelType = savedLevelType;
+}
@@ -0,0 +1,115 @@
+#include <chrono>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Graphics/VisibilityCache.h"
+
+using namespace std::chrono_literals; // NOLINT
+
+static VisibilityCacheKey makeKey(int sectorId, Vec3f cameraPos) {
+    VisibilityCacheKey result;
+    result.sectorId = sectorId;
+    result.cameraPos = cameraPos;
+    result.frustumNormals = {Vec3f(1, 0, 0), Vec3f(-1, 0, 0), Vec3f(0, 0, 1), Vec3f(0, 0, -1)};
+    return result;
+}
+
+UNIT_TEST(VisibilityCache, EmptyCacheMisses) {
+    VisibilityCache cache(10.0f);
+    EXPECT_FALSE(cache.tryReuse(makeKey(1, Vec3f(0, 0, 0))));
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 1);
+}
+
+UNIT_TEST(VisibilityCache, ZeroSlack) {
+    VisibilityCache cache;
+    VisibilityCacheKey key = makeKey(1, Vec3f(100, 200, 300));
+    cache.store(key, 1ms);
+
+    EXPECT_TRUE(cache.tryReuse(key));
+    EXPECT_FALSE(cache.tryReuse(makeKey(1, Vec3f(100, 200, 300.5f))));
+}
+
+UNIT_TEST(VisibilityCache, Slack) {
+    VisibilityCache cache(10.0f);
+    EXPECT_EQ(cache.slack(), 10.0f);
+    cache.store(makeKey(1, Vec3f(0, 0, 0)), 1ms);
+
+    // Distance is checked, not per-axis offsets.
+    EXPECT_TRUE(cache.tryReuse(makeKey(1, Vec3f(10, 0, 0))));
+    EXPECT_TRUE(cache.tryReuse(makeKey(1, Vec3f(6, 8, 0))));
+    EXPECT_TRUE(cache.tryReuse(makeKey(1, Vec3f(0, -6, -8))));
+    EXPECT_FALSE(cache.tryReuse(makeKey(1, Vec3f(8, 8, 0))));
+    EXPECT_FALSE(cache.tryReuse(makeKey(1, Vec3f(0, 0, 10.5f))));
+
+    // Slack is measured from where the result was stored, so small steps don't add up into a big one.
+    EXPECT_TRUE(cache.tryReuse(makeKey(1, Vec3f(9, 0, 0))));
+    EXPECT_FALSE(cache.tryReuse(makeKey(1, Vec3f(18, 0, 0))));
+}
+
+UNIT_TEST(VisibilityCache, SectorAndFrustumMustMatch) {
+    VisibilityCache cache(10.0f);
+    VisibilityCacheKey key = makeKey(1, Vec3f(0, 0, 0));
+    cache.store(key, 1ms);
+
+    EXPECT_FALSE(cache.tryReuse(makeKey(2, Vec3f(0, 0, 0))));
+
+    VisibilityCacheKey rotated = key;
+    rotated.frustumNormals[0] = Vec3f(0, 1, 0);
+    EXPECT_FALSE(cache.tryReuse(rotated));
+
+    EXPECT_TRUE(cache.tryReuse(key));
+}
+
+UNIT_TEST(VisibilityCache, Invalidation) {
+    VisibilityCache cache(10.0f);
+    VisibilityCacheKey key = makeKey(1, Vec3f(0, 0, 0));
+    cache.store(key, 1ms);
+    EXPECT_TRUE(cache.tryReuse(key));
+
+    cache.invalidate();
+    EXPECT_FALSE(cache.tryReuse(key));
+    EXPECT_FALSE(cache.tryReuse(key)); // Stays invalid until the result is stored again.
+
+    cache.store(key, 1ms);
+    EXPECT_TRUE(cache.tryReuse(key));
+
+    // Storing for a new key replaces the old one.
+    VisibilityCacheKey other = makeKey(1, Vec3f(100, 0, 0));
+    cache.store(other, 1ms);
+    EXPECT_FALSE(cache.tryReuse(key));
+    EXPECT_TRUE(cache.tryReuse(other));
+}
+
+UNIT_TEST(VisibilityCache, Stats) {
+    VisibilityCache cache;
+    EXPECT_EQ(cache.reuseRate(), 0.0f);
+    EXPECT_EQ(cache.timeSaved(), 0ns);
+
+    VisibilityCacheKey key = makeKey(1, Vec3f(0, 0, 0));
+    VisibilityCacheKey other = makeKey(2, Vec3f(0, 0, 0));
+
+    // 2 misses that took 3ms & 5ms to recompute, 6 hits.
+    EXPECT_FALSE(cache.tryReuse(key));
+    cache.store(key, 3ms);
+    for (int i = 0; i < 3; i++)
+        EXPECT_TRUE(cache.tryReuse(key));
+    EXPECT_FALSE(cache.tryReuse(other));
+    cache.store(other, 5ms);
+    for (int i = 0; i < 3; i++)
+        EXPECT_TRUE(cache.tryReuse(other));
+
+    EXPECT_EQ(cache.hits(), 6);
+    EXPECT_EQ(cache.misses(), 2);
+    EXPECT_EQ(cache.reuseRate(), 0.75f);
+    EXPECT_EQ(cache.timeSaved(), 24ms); // 6 hits * 4ms on average per miss.
+
+    // Hits only, no recompute time to estimate from.
+    cache.resetStats();
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 0);
+    EXPECT_EQ(cache.reuseRate(), 0.0f);
+    EXPECT_TRUE(cache.tryReuse(other)); // Resetting the stats doesn't drop the cached result.
+    EXPECT_EQ(cache.reuseRate(), 1.0f);
+    EXPECT_EQ(cache.timeSaved(), 0ns);
+}
@@ -31,14 +31,8 @@ GraphicsImage *TextureFrameTable::GetFrameTexture(int64_t frameId, Duration offs
         return nullptr;
     }
 
-    Duration animationDuration = textures[frameId].animationDuration;
-    if ((textures[frameId].flags & TEXTURE_FRAME_TABLE_MORE_FRAMES) && animationDuration) {
-        offset = offset % animationDuration;
-        while (offset >= textures[frameId].frameDuration) {
-            offset -= textures[frameId].frameDuration;
-            ++frameId;
-        }
-    }
+    if (_animationIndex.isAnimated(frameId))
+        frameId = _animationIndex.frame(frameId, offset % textures[frameId].animationDuration);
 
     assert(frameId < textures.size() && "TextureFrameTable::GetFrameTexture animated frame OOB");
     return textures[frameId].GetTexture();
@@ -62,3 +56,11 @@ Duration TextureFrameTable::textureFrameAnimTime(int64_t frameID) {
     }
     return textures[frameID].frameDuration;
 }
+
+void TextureFrameTable::buildAnimationIndex() {
+    _animationIndex.build(textures.size(), [&](size_t i) {
+        return textures[i].frameDuration;
+    }, [&](size_t i) {
+        return (textures[i].flags & TEXTURE_FRAME_TABLE_MORE_FRAMES) ? textures[i].animationDuration : Duration();
+    });
+}
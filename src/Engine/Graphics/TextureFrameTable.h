@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "Engine/Tables/FrameAnimationIndex.h"
 #include "Engine/Time/Duration.h"
 
 #include "Utility/Memory/Blob.h"
@@ -50,7 +51,15 @@ struct TextureFrameTable {
 
     int64_t FindTextureByName(std::string_view Str2);
 
+    /**
+     * Rebuilds the animation index used by `GetFrameTexture`. Must be called after `textures` is loaded.
+     */
+    void buildAnimationIndex();
+
     std::vector<TextureFrame> textures;
+
+ private:
+    FrameAnimationIndex _animationIndex;
 };
 
 extern TextureFrameTable *pTextureFrameTable;
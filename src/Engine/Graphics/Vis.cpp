@@ -312,11 +312,16 @@ bool IsBModelVisible(BSPModel *model, int reachable_depth, bool *reachable) {
     *reachable = false;
     if (dist < model->sBoundingRadius + reachable_depth) *reachable = true;
 
+    return IsBModelInFrustum(*model);
+}
+
+bool IsBModelInFrustum(const BSPModel &model, float slack) {
     // to avoid small objects not showing up give a more generous radius
-    float radius{ model->sBoundingRadius };
+    float radius{ model.sBoundingRadius };
     if (radius < 512.0f) radius = 512.0f;
 
-    return IsSphereInFrustum(model->vBoundingCenter, radius);
+    // frustum planes pass through the camera, so moving it by slack can't move any plane further than that
+    return IsSphereInFrustum(model.vBoundingCenter, radius + slack);
 }
 
 bool IsSphereInFrustum(Vec3f center, float radius, Planef *frustum) {
@@ -160,6 +160,16 @@ class Vis {
  */
 bool IsBModelVisible(BSPModel *model, int reachable_depth, bool *reachable);
 
+/**
+ * @param model                         Model to check.
+ * @param slack                         Distance the camera can move off its current position without changing its
+ *                                      orientation. If this function returns false, the model is guaranteed to stay
+ *                                      outside the frustum for all such camera positions.
+ *
+ * @return                              Whether the bounding sphere of the model is within the camera frustum planes.
+ */
+bool IsBModelInFrustum(const BSPModel &model, float slack = 0.0f);
+
 /**
  * @param center                        Vec3f of centre point of sphere.
  * @param radius                        Float of sphere radius.
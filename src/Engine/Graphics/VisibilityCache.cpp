@@ -0,0 +1,48 @@
+#include "VisibilityCache.h"
+
+#include "Engine/Graphics/Camera.h"
+
+VisibilityCacheKey VisibilityCacheKey::fromCamera(int sectorId) {
+    VisibilityCacheKey result;
+    result.sectorId = sectorId;
+    result.cameraPos = Vec3f(pCamera3D->vCameraPos.x, pCamera3D->vCameraPos.y, pCamera3D->vCameraPos.z);
+    for (int i = 0; i < 4; i++) {
+        const glm::vec4 &plane = pCamera3D->FrustumPlanes[i];
+        result.frustumNormals[i] = Vec3f(plane.x, plane.y, plane.z);
+    }
+    return result;
+}
+
+bool VisibilityCache::tryReuse(const VisibilityCacheKey &key) {
+    bool result = _valid &&
+                  key.sectorId == _key.sectorId &&
+                  key.frustumNormals == _key.frustumNormals &&
+                  (key.cameraPos - _key.cameraPos).lengthSqr() <= _slack * _slack;
+    if (result) {
+        _hits++;
+    } else {
+        _misses++;
+    }
+    return result;
+}
+
+void VisibilityCache::store(const VisibilityCacheKey &key, std::chrono::nanoseconds computeTime) {
+    _valid = true;
+    _key = key;
+    _computeTime += computeTime;
+}
+
+void VisibilityCache::resetStats() {
+    _hits = 0;
+    _misses = 0;
+    _computeTime = {};
+}
+
+float VisibilityCache::reuseRate() const {
+    int64_t lookups = _hits + _misses;
+    return lookups ? static_cast<float>(_hits) / lookups : 0.0f;
+}
+
+std::chrono::nanoseconds VisibilityCache::timeSaved() const {
+    return _misses ? _computeTime * _hits / _misses : std::chrono::nanoseconds();
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Camera state that a visibility result was computed for.
+ */
+struct VisibilityCacheKey {
+    int sectorId = 0; // Party eye sector indoors, always 0 outdoors.
+    Vec3f cameraPos;
+    std::array<Vec3f, 4> frustumNormals; // Orientation & field of view, frustum planes pass through `cameraPos`.
+
+    /**
+     * @param sectorId                  Sector the camera is in, or 0 outdoors.
+     * @return                          Key for the current state of `pCamera3D`.
+     */
+    [[nodiscard]] static VisibilityCacheKey fromCamera(int sectorId);
+};
+
+/**
+ * Temporal cache for a per-frame visibility result, e.g. the list of visible sectors built by the portal traversal.
+ *
+ * The result is reused for as long as the camera looks exactly the same way from the same sector, and doesn't move
+ * further than `slack` away from where the result was computed. The caller is responsible for making the result
+ * conservative for the given slack, so that nothing visible from any of the camera positions it's reused for gets
+ * culled. Any change to the level geometry must be reported with a call to `invalidate`.
+ */
+class VisibilityCache {
+ public:
+    /**
+     * @param slack                     Distance the camera can move before the cached result has to be recomputed.
+     */
+    explicit VisibilityCache(float slack = 0.0f) : _slack(slack) {}
+
+    /**
+     * @param key                       Current camera state.
+     * @return                          Whether the cached result can be used for the provided camera state. Updates
+     *                                  the stats.
+     */
+    [[nodiscard]] bool tryReuse(const VisibilityCacheKey &key);
+
+    /**
+     * Marks the cached result as valid for the provided camera state. Should be called after the result was
+     * recomputed following a failed `tryReuse` call.
+     *
+     * @param key                       Camera state the result was computed for.
+     * @param computeTime               Time it took to compute the result.
+     */
+    void store(const VisibilityCacheKey &key, std::chrono::nanoseconds computeTime);
+
+    /**
+     * Drops the cached result, should be called when something that affects visibility changes, e.g. a door moves.
+     */
+    void invalidate() {
+        _valid = false;
+    }
+
+    void resetStats();
+
+    [[nodiscard]] float slack() const {
+        return _slack;
+    }
+
+    [[nodiscard]] int64_t hits() const {
+        return _hits;
+    }
+
+    [[nodiscard]] int64_t misses() const {
+        return _misses;
+    }
+
+    /**
+     * @return                          Share of lookups that reused the cached result, in [0, 1].
+     */
+    [[nodiscard]] float reuseRate() const;
+
+    /**
+     * @return                          Estimated time saved by the cache, computed as the number of hits times the
+     *                                  average time it took to recompute the result on a miss.
+     */
+    [[nodiscard]] std::chrono::nanoseconds timeSaved() const;
+
+ private:
+    float _slack = 0.0f;
+    bool _valid = false;
+    VisibilityCacheKey _key;
+    int64_t _hits = 0;
+    int64_t _misses = 0;
+    std::chrono::nanoseconds _computeTime = {}; // Total time spent recomputing the result.
+};
@@ -1,6 +1,5 @@
 #include "Localization.h"
 
-#include <cstring>
 #include <string>
 #include <vector>
 
@@ -8,8 +7,9 @@
 #include "Engine/Engine.h"
 #include "Engine/GameResourceManager.h"
 
+#include "Library/Tsv/TsvTable.h"
+
 #include "Utility/String/Transformations.h"
-#include "Utility/String/Split.h"
 
 Localization *localization = nullptr;
 
@@ -19,49 +19,19 @@ const std::string &Localization::GetString(unsigned int index) const {
 
 //----- (00452C49) --------------------------------------------------------
 bool Localization::Initialize() {
-    char *tmp_pos;     // eax@3
-    int step;          // ebp@4
-    unsigned char c;   // dl@5
-    int temp_str_len;  // ecx@5
-    bool string_end;   // [sp+14h] [bp-4h]@4
-
-    this->localization_raw = engine->_gameResourceManager->getEventsFile("global.txt").string_view();
-    if (this->localization_raw.empty()) {
+    TsvTable table = engine->_gameResourceManager->getEventsTable("global.txt");
+    if (table.empty()) {
         return false;
     }
 
     this->localization_strings.resize(MAX_LOC_STRINGS);
 
-    strtok(this->localization_raw.data(), "\r");
-    strtok(NULL, "\r");
-
+    TsvReader reader(table);
+    reader.skipRows(1);
     for (int i = 0; i < MM7_LOC_STRINGS; ++i) {
-        char *test_string = strtok(NULL, "\r") + 1;
-        step = 0;
-        string_end = false;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            if (c != '\t') {
-                do {
-                    if (!c) break;
-                    c = *(test_string + temp_str_len + 1);
-                    temp_str_len++;
-                } while (c != '\t');
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) string_end = true;
-
-            *tmp_pos = 0;
-            if (temp_str_len == 0) {
-                string_end = true;
-            } else {
-                if (step == 1)
-                    this->localization_strings[i] = removeQuotes(test_string);
-            }
-            ++step;
-            test_string = tmp_pos + 1;
-        } while (step <= 2 && !string_end);
+        TsvRow row = reader.readRow();
+        if (!row[0].empty() && !row[1].empty())
+            this->localization_strings[i] = removeQuotes(row[1]);
     }
 
     // TODO: should be moved to localization files eventually
@@ -281,20 +251,20 @@ void Localization::InitializeSkillNames() {
     //    "But there is not much room to improve finesse or mastery for such a rudimentary weapon though. "
     //    "So don't expect to become thwonking killer and devastating anyone beyond weaklings.";
 
-    skill_desc_raw = engine->_gameResourceManager->getEventsFile("skilldes.txt").string_view();
-    strtok(skill_desc_raw.data(), "\r");
+    TsvTable table = engine->_gameResourceManager->getEventsTable("skilldes.txt");
+    TsvReader reader(table);
+    reader.skipRows(1);
     for (CharacterSkillType i : allVisibleSkills()) {
-        char *test_string = strtok(NULL, "\r") + 1;
+        TsvRow row = reader.readRow();
 
-        if (test_string != NULL && strlen(test_string) > 0) {
-            auto tokens = tokenize(test_string, '\t');
-            assert(tokens.size() >= 6 && "Invalid number of tokens");
+        if (row.size() > 1 || !row[0].empty()) {
+            assert(row.size() >= 6 && "Invalid number of tokens");
 
-            this->skill_descriptions[i] = removeQuotes(tokens[1]);
-            this->skill_descriptions_normal[i] = removeQuotes(tokens[2]);
-            this->skill_descriptions_expert[i] = removeQuotes(tokens[3]);
-            this->skill_descriptions_master[i] = removeQuotes(tokens[4]);
-            this->skill_descriptions_grand[i] = removeQuotes(tokens[5]);
+            this->skill_descriptions[i] = removeQuotes(row[1]);
+            this->skill_descriptions_normal[i] = removeQuotes(row[2]);
+            this->skill_descriptions_expert[i] = removeQuotes(row[3]);
+            this->skill_descriptions_master[i] = removeQuotes(row[4]);
+            this->skill_descriptions_grand[i] = removeQuotes(row[5]);
         }
     }
 }
@@ -345,13 +315,13 @@ void Localization::InitializeClassNames() {
     this->class_names[CLASS_ARCHAMGE] = this->localization_strings[261];  // Archmage
     this->class_names[CLASS_LICH] = this->localization_strings[49];   // Lich
 
-    this->class_desc_raw = engine->_gameResourceManager->getEventsFile("class.txt").string_view();
-    strtok(this->class_desc_raw.data(), "\r");
+    TsvTable table = engine->_gameResourceManager->getEventsTable("class.txt");
+    TsvReader reader(table);
+    reader.skipRows(1);
     for (CharacterClass i : class_desciptions.indices()) {
-        char *test_string = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(test_string, '\t');
-        assert(tokens.size() == 3 && "Invalid number of tokens");
-        class_desciptions[i] = removeQuotes(tokens[1]);
+        TsvRow row = reader.readRow();
+        assert(row.size() == 3 && "Invalid number of tokens");
+        class_desciptions[i] = removeQuotes(row[1]);
     }
 }
 
@@ -423,11 +393,11 @@ void Localization::InitializeAttributeNames() {
     this->attribute_names[CHARACTER_ATTRIBUTE_SPEED]        = this->localization_strings[211];
     this->attribute_names[CHARACTER_ATTRIBUTE_LUCK]         = this->localization_strings[136];
 
-    this->attribute_desc_raw = engine->_gameResourceManager->getEventsFile("stats.txt").string_view();
-    strtok(this->attribute_desc_raw.data(), "\r");
+    TsvTable table = engine->_gameResourceManager->getEventsTable("stats.txt");
+    TsvReader reader(table);
+    reader.skipRows(1);
     for (int i = 0; i < 26; ++i) {
-        char *test_string = strtok(NULL, "\r") + 1;
-        std::vector<std::string_view> tokens = split(test_string, '\t');
+        TsvRow tokens = reader.readRow();
         assert(tokens.size() == 2 && "Invalid number of tokens");
         switch (i) {
             case 0:
@@ -27,6 +27,14 @@ class LodTextureCache {
 
     Blob LoadCompressedTexture(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
 
+    /**
+     * @return                          Underlying LOD reader. Unlike the rest of this class, it can be used from any
+     *                                  thread.
+     */
+    const LodReader &reader() const {
+        return _reader;
+    }
+
  private:
     bool LoadTextureFromLOD(Texture_MM7 *pOutTex, std::string_view pContainer);
 
@@ -2,10 +2,10 @@
 
 #include <cstdlib>
 #include <cstring>
-#include <sstream>
 #include <string>
 
-#include "Utility/Memory/Blob.h"
+#include "Library/Tsv/TsvTable.h"
+
 #include "Utility/String/Ascii.h"
 #include "Utility/String/Transformations.h"
 
@@ -40,27 +40,20 @@ const char *location_type[] = {
     "PSYCHOTIC"
 };
 
-void MapStats::Initialize(const Blob &mapStats) {
-    std::string pMapStatsTXT(mapStats.string_view());
-    std::stringstream stream(pMapStatsTXT);
-    std::string tmpString;
-    std::getline(stream, tmpString);
-    std::getline(stream, tmpString);
-    std::getline(stream, tmpString);
+void MapStats::Initialize(const TsvTable &mapStats) {
+    TsvReader reader(mapStats);
+    reader.skipRows(3);
 
     char work_str[32];
     int work_str_pos;
     int work_str_len;
 
     MapId i = MAP_FIRST;
-    while (!stream.eof()) {
-        std::getline(stream, tmpString);
-        std::stringstream line(tmpString);
-        size_t decode_step = 0;
-        while (!line.eof()) {
-            std::getline(line, tmpString, '\t');
-            char test_string[1024];
-            strncpy(test_string, tmpString.c_str(), sizeof(test_string) - 1);
+    while (!reader.atEnd()) {
+        TsvRow row = reader.readRow();
+        for (size_t decode_step = 0; decode_step < row.size(); decode_step++) {
+            std::string cell(row[decode_step]);
+            const char *test_string = cell.c_str();
             switch (decode_step) {
                 case 1:
                     pInfos[i].name = removeQuotes(test_string);  // randoms crashes here  // got 1 too
@@ -198,7 +191,6 @@ void MapStats::Initialize(const Blob &mapStats) {
                     }
                 } break;
             }
-            decode_step++;
         }
         i = static_cast<MapId>(std::to_underlying(i) + 1);
     }
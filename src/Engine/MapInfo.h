@@ -11,7 +11,7 @@
 #include "MapEnumFunctions.h"
 #include "MapEnums.h"
 
-class Blob;
+class TsvTable;
 
 struct MapInfo {
     std::string name; // Display name, e.g. "The Tularean Forest".
@@ -52,7 +52,7 @@ struct MapInfo {
 };
 
 struct MapStats {
-    void Initialize(const Blob &mapStats);
+    void Initialize(const TsvTable &mapStats);
     MapId GetMapInfo(std::string_view Str2);
     IndexedArray<MapInfo, MAP_FIRST, MAP_LAST> pInfos;
 };
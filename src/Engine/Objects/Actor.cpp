@@ -2,16 +2,20 @@
 
 #include <algorithm>
 #include <deque>
+#include <memory>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 #include <optional>
 
 #include "Engine/Engine.h"
+#include "Engine/FrameArena.h"
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/DecalBuilder.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LineOfSight.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Graphics/Overlays.h"
 #include "Engine/Graphics/Sprites.h"
@@ -41,6 +45,7 @@
 #include "Media/Audio/AudioPlayer.h"
 
 #include "Library/Logger/Logger.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "Utility/Math/TrigLut.h"
 
@@ -2507,6 +2512,7 @@ void Actor::SummonMinion(int summonerId) {
 
 //----- (00401A91) --------------------------------------------------------
 void Actor::UpdateActorAI() {
+    MM_PROFILE_ZONE("Actor::UpdateActorAI");
     double v42;              // st7@176
     double v43;              // st6@176
     ActorAbility v45;                 // eax@192
@@ -3914,7 +3920,7 @@ void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag,
 
 //----- (004014E6) --------------------------------------------------------
 void Actor::MakeActorAIList_ODM() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
+    FrameVector<std::pair<int, int>> activeActorsDistances(&frameArena); // pair<id, distance>
 
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
@@ -3965,8 +3971,8 @@ void Actor::MakeActorAIList_ODM() {
 
 //----- (004016FA) --------------------------------------------------------
 int Actor::MakeActorAIList_BLV() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
-    std::vector<int> pickedActorIds;
+    FrameVector<std::pair<int, int>> activeActorsDistances(&frameArena); // pair<id, distance>
+    FrameVector<int> pickedActorIds(&frameArena);
 
     // reset party alert level
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
@@ -4530,7 +4536,7 @@ void SpawnEncounter(MapInfo *pMapInfo, SpawnPoint *spawn, int a3, int a4, int a5
     // while ( (signed int)v53 < NumToSpawn );
 }
 
-void evaluateAoeDamage() {
+void evaluateAoeDamage(AoeDamageBuffers *buffers) {
     SpriteObject *pSpriteObj = nullptr;
 
     for (AttackDescription &attack : attackList) {
@@ -4596,20 +4602,50 @@ void evaluateAoeDamage() {
                 }
             }
 
+            auto isInRange = [&](const Actor &actor) {
+                Vec3f distanceVec = actor.pos + Vec3f(0, 0, actor.height / 2) - attack.pos;
+                float distanceSq = distanceVec.lengthSqr();
+                float attackRange = attack.attackRange + actor.radius;
+                float attackRangeSq = attackRange * attackRange;
+                return distanceSq < attackRangeSq;
+            };
+
+            // Line of sight depends only on actor positions & level geometry, and dealing damage changes neither,
+            // so we can check it for all actors in range in one batch.
+            std::vector<LineOfSightQuery> &losQueries = buffers->losQueries;
+            std::vector<int> &losActorIds = buffers->losActorIds;
+            losQueries.clear();
+            losActorIds.clear();
+            for (int actorID = 0; actorID < pActors.size(); ++actorID) {
+                if (pActors[actorID].CanAct() && isInRange(pActors[actorID])) {
+                    losQueries.push_back({pActors[actorID].pos + Vec3f(0, 0, 50), attack.pos});
+                    losActorIds.push_back(actorID);
+                }
+            }
+            std::span<bool> losResults = buffers->losResults.resize(losQueries.size());
+            Check_LineOfSight(losQueries, losResults, &buffers->losBuffers);
+
+            size_t losIndex = 0;
             for (int actorID = 0; actorID < pActors.size(); ++actorID) {
                 if (pActors[actorID].CanAct()) {
                     Vec3f distanceVec = pActors[actorID].pos + Vec3f(0, 0, pActors[actorID].height / 2) - attack.pos;
-                    float distanceSq = distanceVec.lengthSqr();
-                    float attackRange = attack.attackRange + pActors[actorID].radius;
-                    float attackRangeSq = attackRange * attackRange;
                     // TODO: using absolute Z here is BS, it's used as speed in ItemDamageFromActor
                     Vec3f attVF = Vec3f(distanceVec.x, distanceVec.y, pActors[actorID].pos.z);
                     attVF.normalize();
 
                     // check range
-                    if (distanceSq < attackRangeSq) {
+                    if (isInRange(pActors[actorID])) {
                         // check line of sight
-                        if (Check_LineOfSight(pActors[actorID].pos + Vec3f(0, 0, 50), attack.pos)) {
+                        while (losIndex < losActorIds.size() && losActorIds[losIndex] < actorID)
+                            losIndex++;
+                        bool hasLineOfSight;
+                        if (losIndex < losActorIds.size() && losActorIds[losIndex] == actorID) {
+                            hasLineOfSight = losResults[losIndex];
+                        } else {
+                            hasLineOfSight = Check_LineOfSight(pActors[actorID].pos + Vec3f(0, 0, 50), attack.pos); // Wasn't in range when we were batching.
+                        }
+
+                        if (hasLineOfSight) {
                             switch (attackerType) {
                                 case OBJECT_Character:
                                     Actor::DamageMonsterFromParty(attack.pid, actorID, attVF);
@@ -21,6 +21,7 @@ class Actor;
 class Vis;
 struct SpawnPoint;
 struct MapInfo;
+struct AoeDamageBuffers;
 
 struct stru319 {
     int which_player_to_attack(Actor *pActor);
@@ -264,9 +265,10 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID);
 void Spawn_Light_Elemental(int spell_power, CharacterSkillMastery caster_skill_mastery, Duration duration);
 void SpawnEncounter(MapInfo *pMapInfo, SpawnPoint *spawn, int a3, int a4, int a5);
 /**
+ * @param buffers                       Scratch buffers to use.
  * @offset 0x438F8F
  */
-void evaluateAoeDamage();
+void evaluateAoeDamage(AoeDamageBuffers *buffers);
 double sub_43AE12(signed int a1);
 void ItemDamageFromActor(Pid uObjID, unsigned int uActorID, const Vec3f &pVelocity);
 
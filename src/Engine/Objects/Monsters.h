@@ -21,7 +21,7 @@
 #include "ItemEnums.h"
 #include "MonsterEnums.h"
 
-class Blob;
+class TsvTable;
 
 struct MonsterInfo {
     std::string name;
@@ -83,8 +83,8 @@ struct MonsterInfo {
 };
 
 struct MonsterStats {
-    void Initialize(const Blob &monsters);
-    void InitializePlacements(const Blob &placements);
+    void Initialize(const TsvTable &monsters);
+    void InitializePlacements(const TsvTable &placements);
     MonsterId FindMonsterByTextureName(std::string_view Str2);
 
     IndexedArray<MonsterInfo, MONSTER_FIRST, MONSTER_LAST> infos;
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "Engine/Engine.h"
+#include "Engine/FrameArena.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Image.h"
@@ -1088,7 +1089,7 @@ bool Party::addItemToParty(ItemGen *pItem, bool isSilent) {
 }
 
 int Party::getRandomActiveCharacterId(RandomEngine *rng) const {
-    std::vector<int> activeCharacters = {};
+    FrameVector<int> activeCharacters(&frameArena);
     for (int i = 0; i < pCharacters.size(); i++) {
         if (pCharacters[i].CanAct()) {
             activeCharacters.push_back(i);
@@ -1,4 +1,12 @@
 #include "Random.h"
 
+#include <utility>
+
 RandomEngine *grng = nullptr;
 RandomEngine *vrng = nullptr;
+uint64_t grngStreamKey = PhiloxRandomEngine::keyForSeed(0);
+
+PhiloxRandomEngine grngSubstream(int64_t frame, Pid pid, RandomStreamPurpose purpose) {
+    uint64_t entityKey = (static_cast<uint64_t>(pid.packed()) << 8) | std::to_underlying(purpose);
+    return PhiloxRandomEngine(grngStreamKey, 0).substream(static_cast<uint64_t>(frame)).substream(entityKey);
+}
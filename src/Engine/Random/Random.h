@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
+#include "Engine/Pid.h"
+
+#include "Library/Random/PhiloxRandomEngine.h"
 #include "Library/Random/RandomEngine.h"
 
+#include "RandomEnums.h"
+
 /**
  * @file
  *
@@ -30,3 +36,23 @@ extern RandomEngine *grng;
  * `vrng` is managed externally by an instance of `EngineRandomComponent`. Create the component before using `vrng`.
  */
 extern RandomEngine *vrng;
+
+/**
+ * Key for the gameplay random substreams, derived from the seed that `grng` was last seeded with.
+ *
+ * Managed externally by an instance of `EngineRandomComponent`.
+ */
+extern uint64_t grngStreamKey;
+
+/**
+ * Creates a gameplay random substream. Unlike `grng`, substreams are safe to use from code that runs out of order,
+ * e.g. from worker threads, as the numbers drawn from a substream depend only on the last `grng` seed and on the
+ * parameters passed to this function.
+ *
+ * @param frame                         Frame number, or another monotonic timestamp that's the same for all the work
+ *                                      done in a single game tick.
+ * @param pid                           Entity that the random numbers are drawn for.
+ * @param purpose                       What the random numbers are for.
+ * @return                              Random engine for the substream.
+ */
+PhiloxRandomEngine grngSubstream(int64_t frame, Pid pid, RandomStreamPurpose purpose);
@@ -4,5 +4,6 @@
 
 MM_DEFINE_ENUM_SERIALIZATION_FUNCTIONS(RandomEngineType, CASE_INSENSITIVE, {
     {RANDOM_ENGINE_MERSENNE_TWISTER, "mersenne_twister"},
-    {RANDOM_ENGINE_SEQUENTIAL, "sequential"}
+    {RANDOM_ENGINE_SEQUENTIAL, "sequential"},
+    {RANDOM_ENGINE_PHILOX, "philox"}
 })
@@ -5,9 +5,21 @@
 enum class RandomEngineType {
     RANDOM_ENGINE_MERSENNE_TWISTER,
     RANDOM_ENGINE_SEQUENTIAL,
+    RANDOM_ENGINE_PHILOX,
 
     RANDOM_ENGINE_FIRST = RANDOM_ENGINE_MERSENNE_TWISTER,
-    RANDOM_ENGINE_LAST = RANDOM_ENGINE_SEQUENTIAL,
+    RANDOM_ENGINE_LAST = RANDOM_ENGINE_PHILOX,
 };
 using enum RandomEngineType;
 MM_DECLARE_SERIALIZATION_FUNCTIONS(RandomEngineType)
+
+/**
+ * Purpose of a random substream, see `grngSubstream`. Substreams with different purposes are independent, so that
+ * adding random calls to, say, AI code doesn't change the loot that drops.
+ */
+enum class RandomStreamPurpose {
+    RANDOM_STREAM_AI,
+    RANDOM_STREAM_PARTICLES,
+    RANDOM_STREAM_LOOT,
+};
+using enum RandomStreamPurpose;
@@ -0,0 +1,55 @@
+#include <set>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Random/Random.h"
+
+#include "Utility/ScopeGuard.h"
+
+static std::vector<int> draw(PhiloxRandomEngine rng, int count = 16) {
+    std::vector<int> result;
+    for (int i = 0; i < count; i++)
+        result.push_back(rng.random(1000000));
+    return result;
+}
+
+UNIT_TEST(Random, SubstreamReproducible) {
+    uint64_t savedKey = grngStreamKey;
+    MM_AT_SCOPE_EXIT(grngStreamKey = savedKey);
+
+    grngStreamKey = PhiloxRandomEngine::keyForSeed(42);
+    std::vector<int> expected = draw(grngSubstream(100, Pid::actor(5), RANDOM_STREAM_AI));
+
+    // Drawing from other substreams in between doesn't matter.
+    draw(grngSubstream(100, Pid::actor(6), RANDOM_STREAM_AI), 100);
+    draw(grngSubstream(101, Pid::actor(5), RANDOM_STREAM_AI), 100);
+    EXPECT_EQ(draw(grngSubstream(100, Pid::actor(5), RANDOM_STREAM_AI)), expected);
+
+    // Substreams depend on the last grng seed.
+    grngStreamKey = PhiloxRandomEngine::keyForSeed(43);
+    EXPECT_NE(draw(grngSubstream(100, Pid::actor(5), RANDOM_STREAM_AI)), expected);
+    grngStreamKey = PhiloxRandomEngine::keyForSeed(42);
+    EXPECT_EQ(draw(grngSubstream(100, Pid::actor(5), RANDOM_STREAM_AI)), expected);
+}
+
+UNIT_TEST(Random, SubstreamIndependent) {
+    uint64_t savedKey = grngStreamKey;
+    MM_AT_SCOPE_EXIT(grngStreamKey = savedKey);
+    grngStreamKey = PhiloxRandomEngine::keyForSeed(0);
+
+    // Every combination of (frame, pid, purpose) should get a stream of its own.
+    std::set<std::vector<int>> streams;
+    int count = 0;
+    std::vector<Pid> pids = {Pid(), Pid::actor(0), Pid::actor(1), Pid::actor(Pid::ID_MAX), Pid::item(0),
+                             Pid::character(0)};
+    for (int64_t frame : {0ll, 1ll, 2ll, 1000000ll, -1ll}) {
+        for (Pid pid : pids) {
+            for (RandomStreamPurpose purpose : {RANDOM_STREAM_AI, RANDOM_STREAM_PARTICLES, RANDOM_STREAM_LOOT}) {
+                streams.insert(draw(grngSubstream(frame, pid, purpose)));
+                count++;
+            }
+        }
+    }
+    EXPECT_EQ(streams.size(), count);
+}
@@ -33,6 +33,8 @@ void deserialize(const TriBlob &src, PlayerFrameTable *dst) {
         deserialize(src.mm8, &dst->pFrames, tags::append, tags::via<PlayerFrame_MM7>);
 
     assert(!dst->pFrames.empty());
+
+    dst->buildAnimationIndex();
 }
 
 void deserialize(const TriBlob &src, ChestDescList *dst) {
@@ -69,6 +71,8 @@ void deserialize(const TriBlob &src, IconFrameTable *dst) {
         dst->pIcons[i].id = i;
 
     assert(!dst->pIcons.empty());
+
+    dst->buildAnimationIndex();
 }
 
 void deserialize(const TriBlob &src, MonsterList *dst) {
@@ -115,12 +119,16 @@ void deserialize(const TriBlob &src, OverlayList *dst) {
 
 void deserialize(const TriBlob &src, SpriteFrameTable *dst) {
     deserialize(src.mm7, dst, tags::via<SpriteFrameTable_MM7>);
+
+    dst->buildAnimationIndex();
 }
 
 void deserialize(const TriBlob &src, TextureFrameTable *dst) {
     deserialize(src.mm7, &dst->textures, tags::append, tags::via<TextureFrame_MM7>);
 
     assert(!dst->textures.empty());
+
+    dst->buildAnimationIndex();
 }
 
 void deserialize(const TriBlob &src, TileTable *dst) {
@@ -1,6 +1,5 @@
 #include "Engine/Spells/Spells.h"
 
-#include <cstring>
 #include <algorithm>
 #include <map>
 #include <string>
@@ -16,11 +15,12 @@
 #include "Engine/TurnEngine/TurnEngine.h"
 #include "Engine/Spells/SpellEnumFunctions.h"
 
+#include "Library/Tsv/TsvTable.h"
+
 #include "Media/Audio/AudioPlayer.h"
 
 #include "Utility/Math/TrigLut.h"
 #include "Utility/String/Ascii.h"
-#include "Utility/String/Split.h"
 #include "Utility/String/Transformations.h"
 #include "Utility/MapAccess.h"
 
@@ -479,7 +479,7 @@ bool SpellBuff::Apply(Time expire_time, CharacterSkillMastery uSkillMastery,
     return true;
 }
 
-void SpellStats::Initialize(const Blob &spells) {
+void SpellStats::Initialize(const TsvTable &spells) {
     std::map<std::string, DamageType, ascii::NoCaseLess> spellSchoolMaps; // TODO(captainurist): #enum, use enum serialization
     spellSchoolMaps["fire"] = DAMAGE_FIRE;
     spellSchoolMaps["air"] = DAMAGE_AIR;
@@ -492,31 +492,30 @@ void SpellStats::Initialize(const Blob &spells) {
     spellSchoolMaps["dark"] = DAMAGE_DARK;
     spellSchoolMaps["magic"] = DAMAGE_MAGIC;
 
-    char *test_string;
-
-    std::string txtRaw(spells.string_view());
-
-    strtok(txtRaw.data(), "\r");
+    TsvReader reader(spells);
+    reader.skipRows(1);
     for (SpellId uSpellID : allRegularSpells()) {
-        if (((std::to_underlying(uSpellID) % 11) - 1) == 0) {
-            strtok(NULL, "\r");
-        }
-        test_string = strtok(NULL, "\r") + 1;
-
-        auto tokens = tokenize(test_string, '\t');
-
-        pInfos[uSpellID].name = removeQuotes(tokens[2]);
-        pInfos[uSpellID].damageType = valueOr(spellSchoolMaps, tokens[3], DAMAGE_PHYSICAL);
-        pInfos[uSpellID].pShortName = removeQuotes(tokens[4]);
-        pInfos[uSpellID].pDescription = removeQuotes(tokens[5]);
-        pInfos[uSpellID].pBasicSkillDesc = removeQuotes(tokens[6]);
-        pInfos[uSpellID].pExpertSkillDesc = removeQuotes(tokens[7]);
-        pInfos[uSpellID].pMasterSkillDesc = removeQuotes(tokens[8]);
-        pInfos[uSpellID].pGrandmasterSkillDesc = removeQuotes(tokens[9]);
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'm') || strchr(tokens[10], 'M') ? SPELL_CASTABLE_BY_MONSTER : SpellFlag();
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'e') || strchr(tokens[10], 'E') ? SPELL_CASTABLE_BY_EVENT : SpellFlag();
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'c') || strchr(tokens[10], 'C') ? SPELL_SHIFT_CLICK_CASTABLE : SpellFlag();
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'x') || strchr(tokens[10], 'X') ? SPELL_FLAG_8 : SpellFlag();
+        if (((std::to_underlying(uSpellID) % 11) - 1) == 0)
+            reader.skipRows(1);
+
+        TsvRow row = reader.readRow();
+        std::string_view flags = row[10];
+        auto hasFlag = [&](char flag) {
+            return flags.contains(flag) || flags.contains(ascii::toUpper(flag));
+        };
+
+        pInfos[uSpellID].name = removeQuotes(row[2]);
+        pInfos[uSpellID].damageType = valueOr(spellSchoolMaps, row[3], DAMAGE_PHYSICAL);
+        pInfos[uSpellID].pShortName = removeQuotes(row[4]);
+        pInfos[uSpellID].pDescription = removeQuotes(row[5]);
+        pInfos[uSpellID].pBasicSkillDesc = removeQuotes(row[6]);
+        pInfos[uSpellID].pExpertSkillDesc = removeQuotes(row[7]);
+        pInfos[uSpellID].pMasterSkillDesc = removeQuotes(row[8]);
+        pInfos[uSpellID].pGrandmasterSkillDesc = removeQuotes(row[9]);
+        pSpellDatas[uSpellID].flags |= hasFlag('m') ? SPELL_CASTABLE_BY_MONSTER : SpellFlag();
+        pSpellDatas[uSpellID].flags |= hasFlag('e') ? SPELL_CASTABLE_BY_EVENT : SpellFlag();
+        pSpellDatas[uSpellID].flags |= hasFlag('c') ? SPELL_SHIFT_CLICK_CASTABLE : SpellFlag();
+        pSpellDatas[uSpellID].flags |= hasFlag('x') ? SPELL_FLAG_8 : SpellFlag();
     }
 }
 
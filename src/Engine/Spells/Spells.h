@@ -14,7 +14,7 @@
 
 #include "SpellEnums.h"
 
-class Blob;
+class TsvTable;
 
 struct SpellInfo {
     std::string name;
@@ -32,7 +32,7 @@ struct SpellStats {
     /**
      * @offset 0x45384A
      */
-    void Initialize(const Blob &spells);
+    void Initialize(const TsvTable &spells);
 
     IndexedArray<SpellInfo, SPELL_FIRST_REGULAR, SPELL_LAST_REGULAR> pInfos;
 };
@@ -4,7 +4,7 @@
 #include <cstdint>
 #include <string>
 
-class Blob;
+class TsvTable;
 
 enum class AutonoteType : uint32_t {
     AUTONOTE_POTION_RECIPE = 0,
@@ -24,6 +24,6 @@ struct Autonote {
 /**
  * @offset 0x476750
  */
-void initializeAutonotes(const Blob &autonotes);
+void initializeAutonotes(const TsvTable &autonotes);
 
 extern std::array<Autonote, 196> pAutonoteTxt;
@@ -1,48 +1,24 @@
 #include "AwardTable.h"
 
-#include <cstring>
 #include <string>
 
-#include "Utility/Memory/Blob.h"
+#include "Library/Tsv/TsvTable.h"
+
 #include "Utility/String/Transformations.h"
 
 std::array<Award, 105> pAwards;
 
-void initializeAwards(const Blob &awards) {
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(awards.string_view());
-    strtok(txtRaw.data(), "\r");
+void initializeAwards(const TsvTable &awards) {
+    TsvReader reader(awards);
+    reader.skipRows(1);
 
     for (int i = 1; i < pAwards.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    pAwards[i].pText = removeQuotes(test_string);
-                else if (decode_step == 2)
-                    pAwards[i].uPriority = atoi(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 3) && !break_loop);
+        TsvRow row = reader.readRow();
+        for (int step = 0; step < 3 && !row[step].empty(); ++step) {
+            if (step == 1)
+                pAwards[i].pText = removeQuotes(row[step]);
+            else if (step == 2)
+                pAwards[i].uPriority = tsvToInt(row[step]);
+        }
     }
 }
@@ -4,7 +4,7 @@
 #include <array>
 #include <string>
 
-class Blob;
+class TsvTable;
 
 enum AwardType : uint32_t {
     Award_Invalid = 0,
@@ -122,6 +122,6 @@ struct Award {
 /**
  * @offset 0x4763E0
  */
-void initializeAwards(const Blob &awards);
+void initializeAwards(const TsvTable &awards);
 
 extern std::array<Award, 105> pAwards;
@@ -8,7 +8,7 @@
 #include "GUI/UI/UIHouseEnums.h"
 #include "Utility/IndexedArray.h"
 
-class Blob;
+class TsvTable;
 
 enum class BuildingType : uint16_t {
     BUILDING_INVALID = 0,
@@ -73,6 +73,6 @@ struct BuildingDesc {
     int16_t field_32;
 };
 
-void initializeBuildings(const Blob &buildings);
+void initializeBuildings(const TsvTable &buildings);
 
 extern IndexedArray<BuildingDesc, HOUSE_FIRST, HOUSE_LAST> buildingTable;
@@ -1,5 +1,7 @@
 #include "CharacterFrameTable.h"
 
+#include <cassert>
+
 #include "Engine/Random/Random.h"
 
 
@@ -20,18 +22,14 @@ Duration PlayerFrameTable::GetDurationByExpression(CharacterExpressionID express
 
 //----- (00494B10) --------------------------------------------------------
 PlayerFrame *PlayerFrameTable::GetFrameBy_x(int uFramesetID, Duration gameTime) {
-    if (this->pFrames[uFramesetID].uFlags & 1 && this->pFrames[uFramesetID].uAnimLength) {
+    if (_animationIndex.isAnimated(uFramesetID)) {
         // Processing animated character expressions - e.g., CHARACTER_EXPRESSION_YES & CHARACTER_EXPRESSION_NO.
-        Duration time = gameTime % this->pFrames[uFramesetID].uAnimLength;
-
-        while (true) {
-            Duration frameTime = this->pFrames[uFramesetID].uAnimTime;
-            if (time < frameTime)
-                break;
-            time -= frameTime;
-            ++uFramesetID;
-            assert(this->pFrames[uFramesetID].expression == CHARACTER_EXPRESSION_INVALID); // Shouldn't jump into another expression.
-        }
+        int startFramesetID = uFramesetID;
+        uFramesetID = _animationIndex.frame(uFramesetID, gameTime % this->pFrames[uFramesetID].uAnimLength);
+
+        // Shouldn't jump into another expression.
+        for (int i = startFramesetID + 1; i <= uFramesetID; i++)
+            assert(this->pFrames[i].expression == CHARACTER_EXPRESSION_INVALID);
     }
     return &this->pFrames[uFramesetID];
 }
@@ -51,3 +49,11 @@ PlayerFrame *PlayerFrameTable::GetFrameBy_y(int *pFramesetID, Duration *pAnimTim
     }
     return &this->pFrames[*pFramesetID];
 }
+
+void PlayerFrameTable::buildAnimationIndex() {
+    _animationIndex.build(pFrames.size(), [&](size_t i) {
+        return pFrames[i].uAnimTime;
+    }, [&](size_t i) {
+        return (pFrames[i].uFlags & 1) ? pFrames[i].uAnimLength : Duration();
+    });
+}
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "Engine/Objects/CharacterEnums.h"
+#include "Engine/Tables/FrameAnimationIndex.h"
 #include "Engine/Time/Duration.h"
 
 #include "Utility/Memory/Blob.h"
@@ -21,7 +22,15 @@ struct PlayerFrameTable {
     PlayerFrame *GetFrameBy_x(int uFramesetID, Duration gameTime);
     PlayerFrame *GetFrameBy_y(int *a2, Duration *a3, Duration a4);
 
+    /**
+     * Rebuilds the animation index used by `GetFrameBy_x`. Must be called after `pFrames` is loaded.
+     */
+    void buildAnimationIndex();
+
     std::vector<PlayerFrame> pFrames;
+
+ private:
+    FrameAnimationIndex _animationIndex;
 };
 
 extern PlayerFrameTable *pPlayerFrameTable;  // idb
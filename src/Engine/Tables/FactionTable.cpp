@@ -1,50 +1,23 @@
 #include "FactionTable.h"
 
-#include <cstring>
 #include <string>
 
-#include "Utility/Memory/Blob.h"
+#include "Library/Tsv/TsvTable.h"
+
 
 FactionTable *pFactionTable;
 
 //----- (004547E4) --------------------------------------------------------
-void FactionTable::Initialize(const Blob &factions) {
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-    //  int item_counter;
-
+void FactionTable::Initialize(const TsvTable &factions) {
     for (auto &line : relations)
         line.fill(HOSTILITY_FRIENDLY);
 
-    std::string txtRaw(factions.string_view());
-    strtok(txtRaw.data(), "\r");
-    for (i = 0; i < 89; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char*)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step >= 1 && decode_step < 90)
-                    relations[static_cast<MonsterType>(decode_step - 1)][static_cast<MonsterType>(i)] = static_cast<MonsterHostility>(atoi(test_string));
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 92) && !break_loop);
+    TsvReader reader(factions);
+    reader.skipRows(1);
+    for (int i = 0; i < 89; ++i) {
+        TsvRow row = reader.readRow();
+        for (int step = 0; step < 92 && !row[step].empty(); ++step)
+            if (step >= 1 && step < 90)
+                relations[static_cast<MonsterType>(step - 1)][static_cast<MonsterType>(i)] = static_cast<MonsterHostility>(tsvToInt(row[step]));
     }
 }
@@ -4,10 +4,10 @@
 
 #include "Utility/IndexedArray.h"
 
-class Blob;
+class TsvTable;
 
 struct FactionTable {
-    void Initialize(const Blob &factions);
+    void Initialize(const TsvTable &factions);
 
     // Original table was 89x89 elements, in OE it was expanded to include unused monster types.
     IndexedArray<IndexedArray<MonsterHostility, MONSTER_TYPE_INVALID, MONSTER_TYPE_LAST>, MONSTER_TYPE_INVALID, MONSTER_TYPE_LAST> relations;
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Time/Duration.h"
+
+/**
+ * Lookup index for the animated frame sequences in frame tables (sprites, textures, icons, portraits).
+ *
+ * All these tables store animations the same way: the first frame of a sequence has the total animation length, and
+ * each frame has its own display time. The original code then finds the current frame by walking the sequence and
+ * subtracting frame times one by one, which is linear in the number of frames, and is done for every visible sprite
+ * and face every frame.
+ *
+ * This class precomputes the cumulative frame end times for each sequence at load time, so that the lookup becomes a
+ * binary search. Results are exactly the same as with the linear walk, including the corner cases like zero-length
+ * frames and offsets equal to the animation length.
+ */
+class FrameAnimationIndex {
+ public:
+    /**
+     * @param frameCount                Number of frames in the table.
+     * @param frameTime                 Callable `Duration(size_t)` returning the display time of the given frame.
+     * @param animationLength           Callable `Duration(size_t)` returning the length of an animation starting at
+     *                                  the given frame, or zero if the frame is not animated.
+     */
+    template<class FrameTime, class AnimationLength>
+    void build(size_t frameCount, FrameTime &&frameTime, AnimationLength &&animationLength) {
+        _sequences.assign(frameCount, Sequence());
+        _ends.clear();
+
+        for (size_t i = 0; i < frameCount; i++) {
+            Duration length = animationLength(i);
+            if (!length)
+                continue;
+
+            // Offsets passed to `frame` are in [0, length], so we stop at the first frame that ends after `length`.
+            Sequence &sequence = _sequences[i];
+            sequence.begin = _ends.size();
+            Duration end;
+            for (size_t j = i; j < frameCount && end <= length; j++) {
+                end += frameTime(j);
+                _ends.push_back(end);
+            }
+            sequence.size = _ends.size() - sequence.begin;
+        }
+    }
+
+    /**
+     * @param frameId                   Index of the first frame of an animation.
+     * @return                          Whether the animation starting at `frameId` was indexed, i.e. whether it has
+     *                                  a non-zero length.
+     */
+    [[nodiscard]] bool isAnimated(size_t frameId) const {
+        assert(frameId < _sequences.size());
+        return _sequences[frameId].size != 0;
+    }
+
+    /**
+     * @param frameId                   Index of the first frame of an animation, must be animated.
+     * @param offset                    Offset into the animation, in `[0, length]`.
+     * @return                          Index of the frame that's displayed at `offset`. Sequences that run past the
+     *                                  end of the table are clamped to the last frame.
+     */
+    [[nodiscard]] size_t frame(size_t frameId, Duration offset) const {
+        assert(isAnimated(frameId));
+
+        const Sequence &sequence = _sequences[frameId];
+        auto begin = _ends.begin() + sequence.begin;
+        auto end = begin + sequence.size;
+        size_t index = std::upper_bound(begin, end, offset) - begin;
+        return frameId + std::min<size_t>(index, sequence.size - 1);
+    }
+
+ private:
+    struct Sequence {
+        uint32_t begin = 0; // Index of the first frame end time in `_ends`.
+        uint32_t size = 0;
+    };
+
+    std::vector<Sequence> _sequences;
+    std::vector<Duration> _ends; // Cumulative frame end times for all sequences, relative to sequence start.
+};
@@ -36,16 +36,16 @@ unsigned int IconFrameTable::FindIcon(std::string_view pIconName) {
 
 //----- (00494F70) --------------------------------------------------------
 Icon *IconFrameTable::GetFrame(unsigned int uIconID, Duration frame_time) {
-    if (this->pIcons[uIconID].uFlags & 1 && this->pIcons[uIconID].GetAnimLength()) {
-        Duration t = frame_time;
+    if (!_animationIndex.isAnimated(uIconID))
+        return &this->pIcons[uIconID];
 
-        t = t % this->pIcons[uIconID].GetAnimLength();
+    return &this->pIcons[_animationIndex.frame(uIconID, frame_time % this->pIcons[uIconID].GetAnimLength())];
+}
 
-        int i;
-        for (i = uIconID; t >= this->pIcons[i].GetAnimTime(); i++)
-            t -= this->pIcons[i].GetAnimTime();
-        return &this->pIcons[i];
-    } else {
-        return &this->pIcons[uIconID];
-    }
+void IconFrameTable::buildAnimationIndex() {
+    _animationIndex.build(pIcons.size(), [&](size_t i) {
+        return pIcons[i].GetAnimTime();
+    }, [&](size_t i) {
+        return (pIcons[i].uFlags & 1) ? pIcons[i].GetAnimLength() : Duration();
+    });
 }
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "Engine/Tables/FrameAnimationIndex.h"
 #include "Engine/Time/Duration.h"
 
 #include "Utility/Memory/Blob.h"
@@ -50,7 +51,15 @@ struct IconFrameTable {
     unsigned int FindIcon(std::string_view pIconName);
     Icon *GetFrame(unsigned int uIconID, Duration frame_time);
 
+    /**
+     * Rebuilds the animation index used by `GetFrame`. Must be called after `pIcons` is loaded.
+     */
+    void buildAnimationIndex();
+
     std::vector<Icon> pIcons;
+
+ private:
+    FrameAnimationIndex _animationIndex;
 };
 
 class UIAnimation {
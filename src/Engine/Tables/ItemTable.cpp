@@ -16,16 +16,15 @@
 #include "GUI/UI/UIHouses.h"
 
 #include "Library/Logger/Logger.h"
+#include "Library/Tsv/TsvTable.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/MapAccess.h"
 #include "Utility/String/Transformations.h"
 #include "Utility/String/Split.h"
 
-static void strtokSkipLines(int n) {
-    for (int i = 0; i < n; ++i) {
-        (void)strtok(NULL, "\r");
-    }
+static char firstChar(std::string_view s) {
+    return s.empty() ? '\0' : s.front();
 }
 
 //----- (00456D84) --------------------------------------------------------
@@ -75,100 +74,93 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     materialMap["relic"] = RARITY_RELIC;
     materialMap["special"] = RARITY_SPECIAL;
 
-    char *lineContent;
-
-    LoadPotions(resourceManager->getEventsFile("potion.txt"));
-    LoadPotionNotes(resourceManager->getEventsFile("potnotes.txt"));
+    LoadPotions(resourceManager->getEventsTable("potion.txt"));
+    LoadPotionNotes(resourceManager->getEventsTable("potnotes.txt"));
 
-    std::string txtRaw;
-
-    txtRaw = resourceManager->getEventsFile("stditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(3);
+    TsvTable stdItems = resourceManager->getEventsTable("stditems.txt");
+    TsvReader stdItemsReader(stdItems);
+    stdItemsReader.skipRows(4);
     // Standard Bonuses by Group
     chanceByItemTypeSums.fill(0);
     for (CharacterAttributeType i : allEnchantableAttributes()) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
+        TsvRow tokens = stdItemsReader.readRow();
         standardEnchantments[i].pBonusStat = removeQuotes(tokens[0]);
         standardEnchantments[i].pOfName = removeQuotes(tokens[1]);
 
         int k = 2;
         for (ItemType equipType : standardEnchantments[i].chancesByItemType.indices()) {
-            standardEnchantments[i].chancesByItemType[equipType] = atoi(tokens[k++]);
+            standardEnchantments[i].chancesByItemType[equipType] = tsvToInt(tokens[k++]);
             chanceByItemTypeSums[equipType] += standardEnchantments[i].chancesByItemType[equipType];
         }
     }
 
     // Bonus range for Standard by Level
-    strtokSkipLines(5);
+    stdItemsReader.skipRows(5);
     for (ItemTreasureLevel i : bonusRanges.indices()) {  // counted from 1
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
+        TsvRow tokens = stdItemsReader.readRow();
         assert(tokens.size() == 4 && "Invalid number of tokens");
-        bonusRanges[i].minR = atoi(tokens[2]);
-        bonusRanges[i].maxR = atoi(tokens[3]);
+        bonusRanges[i].minR = tsvToInt(tokens[2]);
+        bonusRanges[i].maxR = tsvToInt(tokens[3]);
     }
 
-    txtRaw = resourceManager->getEventsFile("spcitems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(3);
+    TsvTable spcItems = resourceManager->getEventsTable("spcitems.txt");
+    TsvReader spcItemsReader(spcItems);
+    spcItemsReader.skipRows(4);
     for (ItemEnchantment i : pSpecialEnchantments.indices()) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
+        TsvRow tokens = spcItemsReader.readRow();
         assert(tokens.size() >= 17 && "Invalid number of tokens");
         pSpecialEnchantments[i].pBonusStatement = removeQuotes(tokens[0]);
         pSpecialEnchantments[i].pNameAdd = removeQuotes(tokens[1]);
 
         int k = 2;
         for (ItemType j : pSpecialEnchantments[i].to_item_apply.indices())
-            pSpecialEnchantments[i].to_item_apply[j] = atoi(tokens[k++]);
+            pSpecialEnchantments[i].to_item_apply[j] = tsvToInt(tokens[k++]);
 
-        int res = atoi(tokens[14]);
+        std::string_view valueToken = tokens[14];
+        int res = tsvToInt(valueToken);
         int mask = 0;
         if (!res) {
-            ++tokens[14];
-            while (*tokens[14] == ' ')  // fix X 2 case
-                ++tokens[14];
-            res = atoi(tokens[14]);
+            if (!valueToken.empty())
+                valueToken.remove_prefix(1);
+            while (valueToken.starts_with(' '))  // fix X 2 case
+                valueToken.remove_prefix(1);
+            res = tsvToInt(valueToken);
             mask = 4;  // bit encode for when we need to multiply value
         }
         pSpecialEnchantments[i].iValue = res;
-        pSpecialEnchantments[i].iTreasureLevel = (tolower(tokens[15][0]) - 'a') | mask;
+        pSpecialEnchantments[i].iTreasureLevel = (tolower(firstChar(tokens[15])) - 'a') | mask;
     }
 
     pSpecialEnchantments_count = 72;
 
-    txtRaw = resourceManager->getEventsFile("items.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(1);
+    TsvTable items = resourceManager->getEventsTable("items.txt");
+    TsvReader itemsReader(items);
+    itemsReader.skipRows(2);
     for (size_t line = 0; line < 799; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
+        TsvRow tokens = itemsReader.readRow();
 
-        ItemId item_counter = ItemId(atoi(tokens[0]));
+        ItemId item_counter = ItemId(tsvToInt(tokens[0]));
         pItems[item_counter].iconName = removeQuotes(tokens[1]);
         pItems[item_counter].name = removeQuotes(tokens[2]);
-        pItems[item_counter].uValue = atoi(tokens[3]);
+        pItems[item_counter].uValue = tsvToInt(tokens[3]);
         pItems[item_counter].uEquipType = valueOr(equipStatMap, tokens[4], ITEM_TYPE_NONE);
         pItems[item_counter].uSkillType = valueOr(equipSkillMap, tokens[5], CHARACTER_SKILL_MISC);
-        auto diceRollTokens = tokenize(tokens[6], 'd');
+        std::vector<std::string_view> diceRollTokens = split(tokens[6], 'd');
         if (diceRollTokens.size() == 2) {
-            pItems[item_counter].uDamageDice = atoi(diceRollTokens[0]);
-            pItems[item_counter].uDamageRoll = atoi(diceRollTokens[1]);
-        } else if (tolower(diceRollTokens[0][0]) != 's') {
-            pItems[item_counter].uDamageDice = atoi(diceRollTokens[0]);
+            pItems[item_counter].uDamageDice = tsvToInt(diceRollTokens[0]);
+            pItems[item_counter].uDamageRoll = tsvToInt(diceRollTokens[1]);
+        } else if (tolower(firstChar(diceRollTokens[0])) != 's') {
+            pItems[item_counter].uDamageDice = tsvToInt(diceRollTokens[0]);
             pItems[item_counter].uDamageRoll = 1;
         } else {
             pItems[item_counter].uDamageDice = 0;
             pItems[item_counter].uDamageRoll = 0;
         }
-        pItems[item_counter].uDamageMod = atoi(tokens[7]);
+        pItems[item_counter].uDamageMod = tsvToInt(tokens[7]);
         pItems[item_counter].uMaterial = valueOr(materialMap, tokens[8], RARITY_COMMON);
-        pItems[item_counter].uItemID_Rep_St = atoi(tokens[9]);
+        pItems[item_counter].uItemID_Rep_St = tsvToInt(tokens[9]);
         pItems[item_counter].pUnidentifiedName = removeQuotes(tokens[10]);
-        pItems[item_counter].uSpriteID = static_cast<SpriteId>(atoi(tokens[11]));
-
+        pItems[item_counter].uSpriteID = static_cast<SpriteId>(tsvToInt(tokens[11]));
         pItems[item_counter]._additional_value = ITEM_ENCHANTMENT_NULL;
         pItems[item_counter]._bonus_type = {};
         if (pItems[item_counter].uMaterial == RARITY_SPECIAL) {
@@ -189,7 +181,7 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
 
         if ((pItems[item_counter].uMaterial == RARITY_SPECIAL) &&
             (pItems[item_counter]._bonus_type)) {
-            char b_s = atoi(tokens[13]);
+            char b_s = tsvToInt(tokens[13]);
             if (b_s)
                 pItems[item_counter]._bonus_strength = b_s;
             else
@@ -197,26 +189,25 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         } else {
             pItems[item_counter]._bonus_strength = 0;
         }
-        pItems[item_counter].uEquipX = atoi(tokens[14]);
-        pItems[item_counter].uEquipY = atoi(tokens[15]);
+        pItems[item_counter].uEquipX = tsvToInt(tokens[14]);
+        pItems[item_counter].uEquipY = tsvToInt(tokens[15]);
         pItems[item_counter].pDescription = removeQuotes(tokens[16]);
     }
 
-    txtRaw = resourceManager->getEventsFile("rnditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(3);
+    TsvTable rndItems = resourceManager->getEventsTable("rnditems.txt");
+    TsvReader rndItemsReader(rndItems);
+    rndItemsReader.skipRows(4);
     for(size_t line = 0; line < 618; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
+        TsvRow tokens = rndItemsReader.readRow();
         assert(tokens.size() > 7 && "Invalid number of tokens");
 
-        ItemId item_counter = ItemId(atoi(tokens[0]));
-        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+        ItemId item_counter = ItemId(tsvToInt(tokens[0]));
+        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_1] = tsvToInt(tokens[2]);
+        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_2] = tsvToInt(tokens[3]);
+        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_3] = tsvToInt(tokens[4]);
+        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_4] = tsvToInt(tokens[5]);
+        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_5] = tsvToInt(tokens[6]);
+        pItems[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_6] = tsvToInt(tokens[7]);
     }
 
     // ChanceByTreasureLvl Summ - to calculate chance
@@ -225,39 +216,40 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         for (ItemId j : pItems.indices())
             chanceByTreasureLevelSums[i] += pItems[j].uChanceByTreasureLvl[i];
 
-    strtokSkipLines(5);
+    rndItemsReader.skipRows(5);
     for (int i = 0; i < 3; ++i) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
+        TsvRow tokens = rndItemsReader.readRow();
         assert(tokens.size() > 7 && "Invalid number of tokens");
         switch (i) {
             case 0:
-                uBonusChanceStandart[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-                uBonusChanceStandart[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-                uBonusChanceStandart[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-                uBonusChanceStandart[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-                uBonusChanceStandart[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-                uBonusChanceStandart[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+                uBonusChanceStandart[ITEM_TREASURE_LEVEL_1] = tsvToInt(tokens[2]);
+                uBonusChanceStandart[ITEM_TREASURE_LEVEL_2] = tsvToInt(tokens[3]);
+                uBonusChanceStandart[ITEM_TREASURE_LEVEL_3] = tsvToInt(tokens[4]);
+                uBonusChanceStandart[ITEM_TREASURE_LEVEL_4] = tsvToInt(tokens[5]);
+                uBonusChanceStandart[ITEM_TREASURE_LEVEL_5] = tsvToInt(tokens[6]);
+                uBonusChanceStandart[ITEM_TREASURE_LEVEL_6] = tsvToInt(tokens[7]);
                 break;
             case 1:
-                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_1] = tsvToInt(tokens[2]);
+                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_2] = tsvToInt(tokens[3]);
+                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_3] = tsvToInt(tokens[4]);
+                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_4] = tsvToInt(tokens[5]);
+                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_5] = tsvToInt(tokens[6]);
+                uBonusChanceSpecial[ITEM_TREASURE_LEVEL_6] = tsvToInt(tokens[7]);
                 break;
             case 2:
-                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_1] = tsvToInt(tokens[2]);
+                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_2] = tsvToInt(tokens[3]);
+                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_3] = tsvToInt(tokens[4]);
+                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_4] = tsvToInt(tokens[5]);
+                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_5] = tsvToInt(tokens[6]);
+                uBonusChanceWpSpecial[ITEM_TREASURE_LEVEL_6] = tsvToInt(tokens[7]);
                 break;
         }
     }
 
+    initializeRandomTables();
+
     ItemGen::PopulateSpecialBonusMap();
     ItemGen::PopulateArtifactBonusMap();
     ItemGen::PopulateRegularBonusMap();
@@ -286,220 +278,230 @@ bool ItemTable::IsMaterialNonCommon(const ItemGen *pItem) {
 }
 
 //----- (00453B3C) --------------------------------------------------------
-void ItemTable::LoadPotions(const Blob &potions) {
-    //    char Text[90];
-    char *test_string;
-    uint8_t potion_value;
-
-    std::vector<char *> tokens;
-    std::string txtRaw(potions.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
-    while (test_string) {
-        tokens = tokenize(test_string, '\t');
-        if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
-    }
-    if (!test_string) {
-        logger->error("Error Pre-Parsing Potion Table");
-        return;
-    }
+void ItemTable::LoadPotions(const TsvTable &potions) {
+    TsvReader reader(potions);
+    TsvRow tokens;
+    do {
+        if (reader.atEnd()) {
+            logger->error("Error Pre-Parsing Potion Table");
+            return;
+        }
+        tokens = reader.readRow();
+    } while (tokens[0] != "222");
 
     for (ItemId row : Segment<ItemId>(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
+        if (row != ITEM_FIRST_REAL_POTION) {
+            if (reader.atEnd()) {
+                logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), 0);
+                return;
+            }
+            tokens = reader.readRow();
+        }
+
         if (tokens.size() < 50) {
             logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), tokens.size());
             return;
         }
         for (ItemId column : Segment<ItemId>(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
             int flatPotionId = std::to_underlying(column) - std::to_underlying(ITEM_FIRST_REAL_POTION);
-            char *currValue = tokens[flatPotionId + 7];
-            potion_value = atoi(currValue);
-            if (!potion_value && currValue[0] == 'E') {
+            std::string_view currValue = tokens[flatPotionId + 7];
+            uint8_t potion_value = tsvToInt(currValue);
+            if (!potion_value && currValue.starts_with('E')) {
                 // values like "E{x}" represent damage level {x} when using invalid potion combination
-                potion_value = atoi(currValue + 1);
+                potion_value = tsvToInt(currValue.substr(1));
             }
             this->potionCombination[row][column] = (ItemId)potion_value;
         }
-
-        test_string = strtok(NULL, "\r") + 1;
-        if (!test_string) {
-            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), 0);
-            return;
-        }
-        tokens = tokenize(test_string, '\t');
     }
 }
 
 //----- (00453CE5) --------------------------------------------------------
-void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
-    //  char Text[90];
-    char *test_string;
-    uint8_t potion_note;
-
-    std::vector<char *> tokens;
-    std::string txtRaw(potionNotes.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
-    while (test_string) {
-        tokens = tokenize(test_string, '\t');
-        if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
-    }
-    if (!test_string) {
-        logger->error("Error Pre-Parsing Potion Table");
-        return;
-    }
+void ItemTable::LoadPotionNotes(const TsvTable &potionNotes) {
+    TsvReader reader(potionNotes);
+    TsvRow tokens;
+    do {
+        if (reader.atEnd()) {
+            logger->error("Error Pre-Parsing Potion Table");
+            return;
+        }
+        tokens = reader.readRow();
+    } while (tokens[0] != "222");
 
     for (ItemId row : Segment<ItemId>(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
+        if (row != ITEM_FIRST_REAL_POTION) {
+            if (reader.atEnd()) {
+                logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
+                return;
+            }
+            tokens = reader.readRow();
+        }
+
         if (tokens.size() < 50) {
             logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), tokens.size());
             return;
         }
         for (ItemId column : Segment<ItemId>(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
             int flatPotionId = std::to_underlying(column) - std::to_underlying(ITEM_FIRST_REAL_POTION);
-            char *currValue = tokens[flatPotionId + 7];
-            this->potionNotes[row][column] = atoi(currValue);
+            this->potionNotes[row][column] = tsvToInt(tokens[flatPotionId + 7]);
         }
+    }
+}
 
-        test_string = strtok(NULL, "\r") + 1;
-        if (!test_string) {
-            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
-            return;
+static ItemWeightTable<ItemId> buildRandomItemTable(const ItemTable &table, ItemTreasureLevel treasureLevel, RandomItemType uTreasureType) {
+    ItemType requestedEquip = ITEM_TYPE_NONE;
+    CharacterSkillType requestedSkill = CHARACTER_SKILL_INVALID;
+    switch (uTreasureType) {
+        case RANDOM_ITEM_WEAPON:
+            requestedEquip = ITEM_TYPE_SINGLE_HANDED;
+            break;
+        case RANDOM_ITEM_ARMOR:
+            requestedEquip = ITEM_TYPE_ARMOUR;
+            break;
+        case RANDOM_ITEM_MICS:
+            requestedSkill = CHARACTER_SKILL_MISC;
+            break;
+        case RANDOM_ITEM_SWORD:
+            requestedSkill = CHARACTER_SKILL_SWORD;
+            break;
+        case RANDOM_ITEM_DAGGER:
+            requestedSkill = CHARACTER_SKILL_DAGGER;
+            break;
+        case RANDOM_ITEM_AXE:
+            requestedSkill = CHARACTER_SKILL_AXE;
+            break;
+        case RANDOM_ITEM_SPEAR:
+            requestedSkill = CHARACTER_SKILL_SPEAR;
+            break;
+        case RANDOM_ITEM_BOW:
+            requestedSkill = CHARACTER_SKILL_BOW;
+            break;
+        case RANDOM_ITEM_MACE:
+            requestedSkill = CHARACTER_SKILL_MACE;
+            break;
+        case RANDOM_ITEM_CLUB:
+            requestedSkill = CHARACTER_SKILL_CLUB;
+            break;
+        case RANDOM_ITEM_STAFF:
+            requestedSkill = CHARACTER_SKILL_STAFF;
+            break;
+        case RANDOM_ITEM_LEATHER_ARMOR:
+            requestedSkill = CHARACTER_SKILL_LEATHER;
+            break;
+        case RANDOM_ITEM_CHAIN_ARMOR:
+            requestedSkill = CHARACTER_SKILL_CHAIN;
+            break;
+        case RANDOM_ITEM_PLATE_ARMOR:
+            requestedSkill = CHARACTER_SKILL_PLATE;
+            break;
+        case RANDOM_ITEM_SHIELD:
+            requestedEquip = ITEM_TYPE_SHIELD;
+            break;
+        case RANDOM_ITEM_HELMET:
+            requestedEquip = ITEM_TYPE_HELMET;
+            break;
+        case RANDOM_ITEM_BELT:
+            requestedEquip = ITEM_TYPE_BELT;
+            break;
+        case RANDOM_ITEM_CLOAK:
+            requestedEquip = ITEM_TYPE_CLOAK;
+            break;
+        case RANDOM_ITEM_GAUNTLETS:
+            requestedEquip = ITEM_TYPE_GAUNTLETS;
+            break;
+        case RANDOM_ITEM_BOOTS:
+            requestedEquip = ITEM_TYPE_BOOTS;
+            break;
+        case RANDOM_ITEM_RING:
+            requestedEquip = ITEM_TYPE_RING;
+            break;
+        case RANDOM_ITEM_AMULET:
+            requestedEquip = ITEM_TYPE_AMULET;
+            break;
+        case RANDOM_ITEM_WAND:
+            requestedEquip = ITEM_TYPE_WAND;
+            break;
+        case RANDOM_ITEM_SPELL_SCROLL:
+            requestedEquip = ITEM_TYPE_SPELL_SCROLL;
+            break;
+        case RANDOM_ITEM_POTION:
+            requestedEquip = ITEM_TYPE_POTION;
+            break;
+        case RANDOM_ITEM_REAGENT:
+            requestedEquip = ITEM_TYPE_REAGENT;
+            break;
+        case RANDOM_ITEM_GEM:
+            requestedEquip = ITEM_TYPE_GEM;
+            break;
+        default:
+            assert(false);  // check this condition
+            // TODO(captainurist): explore
+            requestedEquip = static_cast<ItemType>(std::to_underlying(uTreasureType) - 1);
+            break;
+    }
+
+    ItemWeightTable<ItemId> result;
+    for (ItemId itemId : allSpawnableItems()) {
+        const ItemDesc &desc = table.pItems[itemId];
+        bool matches = requestedSkill == CHARACTER_SKILL_INVALID ? desc.uEquipType == requestedEquip : desc.uSkillType == requestedSkill;
+        if (matches)
+            result.add(itemId, desc.uChanceByTreasureLvl[treasureLevel]);
+    }
+    return result;
+}
+
+static bool isSpecialEnchantmentAvailable(const ItemSpecialEnchantmentTable &enchantment, ItemTreasureLevel treasureLevel) {
+    int tr_lv = enchantment.iTreasureLevel & 3;
+
+    // tr_lv  0 = treasure level 3/4
+    // tr_lv  1 = treasure level 3/4/5
+    // tr_lv  2 = treasure level 4/5
+    // tr_lv  3 = treasure level 5/6
+
+    return (treasureLevel == ITEM_TREASURE_LEVEL_3) && (tr_lv == 1 || tr_lv == 0) ||
+           (treasureLevel == ITEM_TREASURE_LEVEL_4) && (tr_lv == 2 || tr_lv == 1 || tr_lv == 0) ||
+           (treasureLevel == ITEM_TREASURE_LEVEL_5) && (tr_lv == 3 || tr_lv == 2 || tr_lv == 1) ||
+           (treasureLevel == ITEM_TREASURE_LEVEL_6) && (tr_lv == 3);
+}
+
+void ItemTable::initializeRandomTables() {
+    for (ItemTreasureLevel level : randomItems.indices()) {
+        randomItems[level] = {};
+        for (ItemId itemId : allSpawnableItems())
+            randomItems[level].add(itemId, pItems[itemId].uChanceByTreasureLvl[level]);
+
+        for (RandomItemType type : allSpawnableRandomItemTypes())
+            randomItemsByType[level][type] = buildRandomItemTable(*this, level, type);
+
+        for (ItemType type : randomSpecialEnchantments[level].indices()) {
+            ItemWeightTable<ItemEnchantment> &enchantments = randomSpecialEnchantments[level][type];
+            enchantments = {};
+            for (ItemEnchantment ench : pSpecialEnchantments.indices())
+                if (isSpecialEnchantmentAvailable(pSpecialEnchantments[ench], level))
+                    enchantments.add(ench, pSpecialEnchantments[ench].to_item_apply[type]);
         }
-        tokens = tokenize(test_string, '\t');
     }
 }
 
 void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTreasureType, ItemGen *outItem) {
     assert(isRandomTreasureLevel(treasureLevel));
 
-    std::vector<ItemId> possibleItems;
-    std::vector<ItemEnchantment> possibleEnchantments;
-    std::vector<int> cumulativeWeights;
-    int weightSum = 0;
-
     assert(outItem != NULL);
     *outItem = ItemGen();
 
     if (uTreasureType != RANDOM_ITEM_ANY) {  // generate known treasure type
-        ItemType requestedEquip;
-        CharacterSkillType requestedSkill = CHARACTER_SKILL_INVALID;
-        switch (uTreasureType) {
-            case RANDOM_ITEM_WEAPON:
-                requestedEquip = ITEM_TYPE_SINGLE_HANDED;
-                break;
-            case RANDOM_ITEM_ARMOR:
-                requestedEquip = ITEM_TYPE_ARMOUR;
-                break;
-            case RANDOM_ITEM_MICS:
-                requestedSkill = CHARACTER_SKILL_MISC;
-                break;
-            case RANDOM_ITEM_SWORD:
-                requestedSkill = CHARACTER_SKILL_SWORD;
-                break;
-            case RANDOM_ITEM_DAGGER:
-                requestedSkill = CHARACTER_SKILL_DAGGER;
-                break;
-            case RANDOM_ITEM_AXE:
-                requestedSkill = CHARACTER_SKILL_AXE;
-                break;
-            case RANDOM_ITEM_SPEAR:
-                requestedSkill = CHARACTER_SKILL_SPEAR;
-                break;
-            case RANDOM_ITEM_BOW:
-                requestedSkill = CHARACTER_SKILL_BOW;
-                break;
-            case RANDOM_ITEM_MACE:
-                requestedSkill = CHARACTER_SKILL_MACE;
-                break;
-            case RANDOM_ITEM_CLUB:
-                requestedSkill = CHARACTER_SKILL_CLUB;
-                break;
-            case RANDOM_ITEM_STAFF:
-                requestedSkill = CHARACTER_SKILL_STAFF;
-                break;
-            case RANDOM_ITEM_LEATHER_ARMOR:
-                requestedSkill = CHARACTER_SKILL_LEATHER;
-                break;
-            case RANDOM_ITEM_CHAIN_ARMOR:
-                requestedSkill = CHARACTER_SKILL_CHAIN;
-                break;
-            case RANDOM_ITEM_PLATE_ARMOR:
-                requestedSkill = CHARACTER_SKILL_PLATE;
-                break;
-            case RANDOM_ITEM_SHIELD:
-                requestedEquip = ITEM_TYPE_SHIELD;
-                break;
-            case RANDOM_ITEM_HELMET:
-                requestedEquip = ITEM_TYPE_HELMET;
-                break;
-            case RANDOM_ITEM_BELT:
-                requestedEquip = ITEM_TYPE_BELT;
-                break;
-            case RANDOM_ITEM_CLOAK:
-                requestedEquip = ITEM_TYPE_CLOAK;
-                break;
-            case RANDOM_ITEM_GAUNTLETS:
-                requestedEquip = ITEM_TYPE_GAUNTLETS;
-                break;
-            case RANDOM_ITEM_BOOTS:
-                requestedEquip = ITEM_TYPE_BOOTS;
-                break;
-            case RANDOM_ITEM_RING:
-                requestedEquip = ITEM_TYPE_RING;
-                break;
-            case RANDOM_ITEM_AMULET:
-                requestedEquip = ITEM_TYPE_AMULET;
-                break;
-            case RANDOM_ITEM_WAND:
-                requestedEquip = ITEM_TYPE_WAND;
-                break;
-            case RANDOM_ITEM_SPELL_SCROLL:
-                requestedEquip = ITEM_TYPE_SPELL_SCROLL;
-                break;
-            case RANDOM_ITEM_POTION:
-                requestedEquip = ITEM_TYPE_POTION;
-                break;
-            case RANDOM_ITEM_REAGENT:
-                requestedEquip = ITEM_TYPE_REAGENT;
-                break;
-            case RANDOM_ITEM_GEM:
-                requestedEquip = ITEM_TYPE_GEM;
-                break;
-            default:
-                assert(false);  // check this condition
-                // TODO(captainurist): explore
-                requestedEquip = static_cast<ItemType>(std::to_underlying(uTreasureType) - 1);
-                break;
-        }
-
-        if (requestedSkill == CHARACTER_SKILL_INVALID) {  // no skill for this item needed
-            for (ItemId itemId : allSpawnableItems()) {
-                if (pItems[itemId].uEquipType == requestedEquip) {
-                    if (pItems[itemId].uChanceByTreasureLvl[treasureLevel]) {
-                        weightSum += pItems[itemId].uChanceByTreasureLvl[treasureLevel];
-                        possibleItems.push_back(itemId);
-                        cumulativeWeights.push_back(weightSum);
-                    }
-                }
-            }
-        } else {  // have needed skill
-            for (ItemId itemId : allSpawnableItems()) {
-                if (pItems[itemId].uSkillType == requestedSkill) {
-                    if (pItems[itemId].uChanceByTreasureLvl[treasureLevel]) {
-                        weightSum += pItems[itemId].uChanceByTreasureLvl[treasureLevel];
-                        possibleItems.push_back(itemId);
-                        cumulativeWeights.push_back(weightSum);
-                    }
-                }
-            }
+        const ItemWeightTable<ItemId> *table;
+        ItemWeightTable<ItemId> fallbackTable;
+        if (uTreasureType >= RANDOM_ITEM_FIRST_SPAWNABLE && uTreasureType <= RANDOM_ITEM_LAST_SPAWNABLE) {
+            table = &randomItemsByType[treasureLevel][uTreasureType];
+        } else {
+            fallbackTable = buildRandomItemTable(*this, treasureLevel, uTreasureType);
+            table = &fallbackTable;
         }
 
-        if (weightSum) {
-            int pickedWeight = grng->random(weightSum) + 1;
-            auto foundWeight = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pickedWeight);
-
-            assert(foundWeight != cumulativeWeights.end());
-
-            outItem->uItemID = possibleItems[std::distance(cumulativeWeights.begin(), foundWeight)];
+        if (int weightSum = table->totalWeight()) {
+            const ItemId *pickedItem = table->pick(grng->random(weightSum) + 1);
+            assert(pickedItem);
+            outItem->uItemID = *pickedItem;
         } else {
             outItem->uItemID = ITEM_CRUDE_LONGSWORD;
         }
@@ -521,14 +523,10 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
         }
 
         // Otherwise try to spawn any random item
+        // Note that chanceByTreasureLevelSums also covers non-spawnable items, so the roll might miss.
         int randomWeight = grng->random(this->chanceByTreasureLevelSums[treasureLevel]) + 1;
-        for (ItemId itemId : allSpawnableItems()) {
-            weightSum += pItems[itemId].uChanceByTreasureLvl[treasureLevel];
-            if (weightSum >= randomWeight) {
-                outItem->uItemID = itemId;
-                break;
-            }
-        }
+        if (const ItemId *pickedItem = randomItems[treasureLevel].pick(randomWeight))
+            outItem->uItemID = *pickedItem;
     }
     if (outItem->isPotion() && outItem->uItemID != ITEM_POTION_BOTTLE) {  // if it potion set potion spec
         outItem->potionPower = grng->randomDice(2, 4) * std::to_underlying(treasureLevel);
@@ -602,31 +600,8 @@ void ItemTable::generateItem(ItemTreasureLevel treasureLevel, RandomItemType uTr
             return;
     }
 
-    cumulativeWeights.clear();
-    weightSum = 0;
-    for (ItemEnchantment ench : pSpecialEnchantments.indices()) {
-        int tr_lv = (pSpecialEnchantments[ench].iTreasureLevel) & 3;
-
-        // tr_lv  0 = treasure level 3/4
-        // tr_lv  1 = treasure level 3/4/5
-        // tr_lv  2 = treasure level 4/5
-        // tr_lv  3 = treasure level 5/6
-
-        if ((treasureLevel == ITEM_TREASURE_LEVEL_3) && (tr_lv == 1 || tr_lv == 0) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_4) && (tr_lv == 2 || tr_lv == 1 || tr_lv == 0) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_5) && (tr_lv == 3 || tr_lv == 2 || tr_lv == 1) ||
-            (treasureLevel == ITEM_TREASURE_LEVEL_6) && (tr_lv == 3)) {
-            int spc = pSpecialEnchantments[ench].to_item_apply[outItem->GetItemEquipType()];
-            if (spc) {
-                weightSum += spc;
-                possibleEnchantments.push_back(ench);
-                cumulativeWeights.push_back(weightSum);
-            }
-        }
-    }
-
-    int pickedWeight = grng->random(weightSum) + 1;
-    auto foundWeight = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), pickedWeight);
-    assert(foundWeight != cumulativeWeights.end());
-    outItem->special_enchantment = possibleEnchantments[std::distance(cumulativeWeights.begin(), foundWeight)];
+    const ItemWeightTable<ItemEnchantment> &enchantments = randomSpecialEnchantments[treasureLevel][outItem->GetItemEquipType()];
+    const ItemEnchantment *pickedEnchantment = enchantments.pick(grng->random(enchantments.totalWeight()) + 1);
+    assert(pickedEnchantment);
+    outItem->special_enchantment = *pickedEnchantment;
 }
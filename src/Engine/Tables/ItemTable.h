@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "Engine/Objects/ItemEnchantment.h"
 #include "Engine/Objects/Items.h"
@@ -8,17 +10,50 @@
 #include "Utility/IndexedArray.h"
 
 class GameResourceManager;
-class Blob;
+class TsvTable;
 
 struct BonusRange {
     unsigned int minR;
     unsigned int maxR;
 }; // TODO(captainurist): Segment<int>?
 
+/**
+ * Precomputed weighted distribution used by `ItemTable::generateItem`. Only entries with non-zero weight are stored,
+ * so `cumulativeWeights` is strictly increasing.
+ */
+template<class T>
+struct ItemWeightTable {
+    std::vector<T> values;
+    std::vector<int> cumulativeWeights;
+
+    void add(T value, int weight) {
+        if (weight == 0)
+            return;
+        values.push_back(value);
+        cumulativeWeights.push_back(totalWeight() + weight);
+    }
+
+    [[nodiscard]] int totalWeight() const {
+        return cumulativeWeights.empty() ? 0 : cumulativeWeights.back();
+    }
+
+    /**
+     * @param weight                    Weight roll, in `[1, totalWeight()]`.
+     * @return                          Pointer to the first value whose cumulative weight is not less than `weight`,
+     *                                  or `nullptr` if the roll is out of range.
+     */
+    [[nodiscard]] const T *pick(int weight) const {
+        auto pos = std::lower_bound(cumulativeWeights.begin(), cumulativeWeights.end(), weight);
+        if (pos == cumulativeWeights.end())
+            return nullptr;
+        return &values[pos - cumulativeWeights.begin()];
+    }
+};
+
 struct ItemTable {
     void Initialize(GameResourceManager *resourceManager);
-    void LoadPotions(const Blob &potions);
-    void LoadPotionNotes(const Blob &potionNotes);
+    void LoadPotions(const TsvTable &potions);
+    void LoadPotionNotes(const TsvTable &potionNotes);
 
     /**
      * @offset 0x456620
@@ -28,6 +63,11 @@ struct ItemTable {
     bool IsMaterialSpecial(const ItemGen *pItem);
     bool IsMaterialNonCommon(const ItemGen *pItem);
 
+    /**
+     * Fills in the `generateItem` lookup tables. Called from `Initialize` once all the item tables are loaded.
+     */
+    void initializeRandomTables();
+
     IndexedArray<ItemDesc, ITEM_FIRST_VALID, ITEM_LAST_VALID> pItems;                   // 4-9604h
     IndexedArray<ItemEnchantmentTable, CHARACTER_ATTRIBUTE_FIRST_ENCHANTABLE, CHARACTER_ATTRIBUTE_LAST_ENCHANTABLE> standardEnchantments;                // 9604h
     IndexedArray<ItemSpecialEnchantmentTable, ITEM_ENCHANTMENT_FIRST_VALID, ITEM_ENCHANTMENT_LAST_VALID> pSpecialEnchantments;  // 97E4h -9FC4h
@@ -47,6 +87,12 @@ struct ItemTable {
     IndexedArray<unsigned int, ITEM_TYPE_FIRST_NORMAL_ENCHANTABLE, ITEM_TYPE_LAST_NORMAL_ENCHANTABLE> chanceByItemTypeSums; // 116E4h -11708h
     IndexedArray<BonusRange, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> bonusRanges;                 // 45C2h*4 =11708h
     unsigned int pSpecialEnchantments_count;    // 11798h
+
+    // Lookup tables for generateItem, indexed by treasure level. Entries follow table order, and picking from them
+    // consumes random numbers exactly like the original linear scans did.
+    IndexedArray<ItemWeightTable<ItemId>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> randomItems;
+    IndexedArray<IndexedArray<ItemWeightTable<ItemId>, RANDOM_ITEM_FIRST_SPAWNABLE, RANDOM_ITEM_LAST_SPAWNABLE>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> randomItemsByType;
+    IndexedArray<IndexedArray<ItemWeightTable<ItemEnchantment>, ITEM_TYPE_FIRST_SPECIAL_ENCHANTABLE, ITEM_TYPE_LAST_SPECIAL_ENCHANTABLE>, ITEM_TREASURE_LEVEL_FIRST_RANDOM, ITEM_TREASURE_LEVEL_LAST_RANDOM> randomSpecialEnchantments;
     char field_1179C;
     char field_1179D;
     char field_1179E;
@@ -1,11 +1,11 @@
 #include "MerchantTable.h"
 
-#include <cstring>
 #include <string>
 
 #include "Engine/Objects/NPCEnumFunctions.h"
 
-#include "Utility/Memory/Blob.h"
+#include "Library/Tsv/TsvTable.h"
+
 #include "Utility/String/Transformations.h"
 
 IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsBuyPhrases;
@@ -13,51 +13,27 @@ IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchant
 IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsRepairPhrases;
 IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsIdentifyPhrases;
 
-void initializeMerchants(const Blob &merchants) {
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(merchants.string_view());
-    strtok(txtRaw.data(), "\r");
+void initializeMerchants(const TsvTable &merchants) {
+    TsvReader reader(merchants);
+    reader.skipRows(1);
 
     for (MerchantPhrase i : allMerchantPhrases()) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                switch (decode_step) {
-                    case 1:
-                        pMerchantsBuyPhrases[i] = removeQuotes(test_string);
-                        break;
-                    case 2:
-                        pMerchantsSellPhrases[i] = removeQuotes(test_string);
-                        break;
-                    case 3:
-                        pMerchantsRepairPhrases[i] = removeQuotes(test_string);
-                        break;
-                    case 4:
-                        pMerchantsIdentifyPhrases[i] = removeQuotes(test_string);
-                        break;
-                }
-            } else {
-                break_loop = true;
+        TsvRow row = reader.readRow();
+        for (int step = 0; step < 5 && !row[step].empty(); ++step) {
+            switch (step) {
+                case 1:
+                    pMerchantsBuyPhrases[i] = removeQuotes(row[step]);
+                    break;
+                case 2:
+                    pMerchantsSellPhrases[i] = removeQuotes(row[step]);
+                    break;
+                case 3:
+                    pMerchantsRepairPhrases[i] = removeQuotes(row[step]);
+                    break;
+                case 4:
+                    pMerchantsIdentifyPhrases[i] = removeQuotes(row[step]);
+                    break;
             }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 5) && !break_loop);
+        }
     }
 }
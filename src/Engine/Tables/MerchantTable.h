@@ -5,12 +5,12 @@
 #include "Engine/Objects/NPCEnums.h"
 #include "Utility/IndexedArray.h"
 
-class Blob;
+class TsvTable;
 
 /**
  * @offset 0x476590
  */
-void initializeMerchants(const Blob &merchants);
+void initializeMerchants(const TsvTable &merchants);
 
 extern IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsBuyPhrases;
 extern IndexedArray<std::string, MERCHANT_PHRASE_FIRST, MERCHANT_PHRASE_LAST> pMerchantsSellPhrases;
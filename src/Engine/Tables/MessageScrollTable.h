@@ -5,11 +5,11 @@
 #include "Engine/Objects/ItemEnums.h"
 #include "Utility/IndexedArray.h"
 
-class Blob;
+class TsvTable;
 
 /**
  * @offset 0x4764C2
  */
-void initializeMessageScrolls(const Blob &scrolls);
+void initializeMessageScrolls(const TsvTable &scrolls);
 
 extern IndexedArray<std::string, ITEM_FIRST_MESSAGE_SCROLL, ITEM_LAST_MESSAGE_SCROLL> pMessageScrolls;
@@ -1,6 +1,5 @@
 #include "NPCTable.h"
 
-#include <cstring>
 #include <string>
 
 #include "Engine/Objects/NPC.h"
@@ -9,6 +8,8 @@
 #include "Engine/GameResourceManager.h"
 #include "Engine/Random/Random.h"
 
+#include "Library/Tsv/TsvTable.h"
+
 #include "Utility/String/Transformations.h"
 
 std::array<NPCTopic, 789> pNPCTopics;
@@ -18,119 +19,41 @@ int NPCStats::dword_AE336C_LastMispronouncedNameFirstLetter = -1;
 int NPCStats::dword_AE3370_LastMispronouncedNameResult = -1;
 
 //----- (00476977) --------------------------------------------------------
-void NPCStats::InitializeNPCText(const Blob &npcText) {
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(npcText.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    for (i = 0; i < 789; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    pNPCTopics[i].pText = removeQuotes(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+void NPCStats::InitializeNPCText(const TsvTable &npcText) {
+    TsvReader reader(npcText);
+    reader.skipRows(1);
+
+    for (int i = 0; i < 789; ++i) {
+        TsvRow row = reader.readRow();
+        if (!row[0].empty() && !row[1].empty())
+            pNPCTopics[i].pText = removeQuotes(row[1]);
     }
 }
 
-void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
-    std::string txtRaw(npcTopics.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+void NPCStats::InitializeNPCTopics(const TsvTable &npcTopics) {
+    TsvReader reader(npcTopics);
+    reader.skipRows(1);
 
     for (int i = 1; i <= 579; ++i) {  // NPC topics count limit
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    pNPCTopics[i].pTopic = removeQuotes(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        TsvRow row = reader.readRow();
+        if (!row[0].empty() && !row[1].empty())
+            pNPCTopics[i].pTopic = removeQuotes(row[1]);
     }
 }
 
-void NPCStats::InitializeNPCDist(const Blob &npcDist) {
-    std::string txtRaw(npcDist.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+void NPCStats::InitializeNPCDist(const TsvTable &npcDist) {
+    TsvReader reader(npcDist);
+    reader.skipRows(2);
 
     for (int i = 1; i < 59; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
+        TsvRow row = reader.readRow();
+        for (int step = 0; step < 78 && !row[step].empty(); ++step) {
+            if ((step > 0) && (step < 77)) {
+                pProfessionChance[step].professionChancePerArea[i] = tsvToInt(row[step]);
+            } else if (step == 0) {
+                pProfessionChance[0].professionChancePerArea[i] = 10;
             }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if ((decode_step > 0) && (decode_step < 77)) {
-                    pProfessionChance[decode_step].professionChancePerArea[i] = atoi(test_string);
-                } else if (decode_step == 0) {
-                    pProfessionChance[0].professionChancePerArea[i] = 10;
-                }
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 78) && !break_loop);
+        }
     }
 
     for (int i = 0; i < 77; ++i) {
@@ -155,313 +78,163 @@ void NPCStats::setNPCNamesOnLoad() {
 }
 
 //----- (00476CB5) --------------------------------------------------------
-void NPCStats::InitializeNPCData(const Blob &npcData) {
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(npcData.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-
-    for (i = 0; i < 500; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
+void NPCStats::InitializeNPCData(const TsvTable &npcData) {
+    TsvReader reader(npcData);
+    reader.skipRows(2);
+
+    for (int i = 0; i < 500; ++i) {
+        TsvRow row = reader.readRow();
+        for (int step = 0; step < 16; ++step) {
+            std::string_view cell = row[step];
+            if (cell.empty())
+                continue;
+
+            switch (step) {
+                case 1:
+                    pNPCUnicNames[i] = removeQuotes(cell);
+                    pOriginalNPCData[i + 1].name = pNPCUnicNames[i];
+                    break;
+                case 2:
+                    pOriginalNPCData[i + 1].uPortraitID = tsvToInt(cell);
+                    break;
+                case 6:
+                    pOriginalNPCData[i + 1].Location2D = static_cast<HouseId>(tsvToInt(cell));
+                    break;
+                case 7:
+                    pOriginalNPCData[i + 1].profession = static_cast<NpcProfession>(tsvToInt(cell));
+                    break;
+                case 8:
+                    pOriginalNPCData[i + 1].greet = tsvToInt(cell);
+                    break;
+                case 9:
+                    pOriginalNPCData[i + 1].is_joinable = (cell[0] == 'y') ? 1 : 0;
+                    break;
+                case 10:
+                    pOriginalNPCData[i + 1].dialogue_1_evt_id = tsvToInt(cell);
+                    break;
+                case 11:
+                    pOriginalNPCData[i + 1].dialogue_2_evt_id = tsvToInt(cell);
+                    break;
+                case 12:
+                    pOriginalNPCData[i + 1].dialogue_3_evt_id = tsvToInt(cell);
+                    break;
+                case 13:
+                    pOriginalNPCData[i + 1].dialogue_4_evt_id = tsvToInt(cell);
+                    break;
+                case 14:
+                    pOriginalNPCData[i + 1].dialogue_5_evt_id = tsvToInt(cell);
+                    break;
+                case 15:
+                    pOriginalNPCData[i + 1].dialogue_6_evt_id = tsvToInt(cell);
+                    break;
             }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                switch (decode_step) {
-                    case 1:
-                        pNPCUnicNames[i] = removeQuotes(test_string);
-                        pOriginalNPCData[i + 1].name = pNPCUnicNames[i];
-                        break;
-                    case 2:
-                        pOriginalNPCData[i + 1].uPortraitID = atoi(test_string);
-                        break;
-                    case 6:
-                        pOriginalNPCData[i + 1].Location2D = static_cast<HouseId>(atoi(test_string));
-                        break;
-                    case 7:
-                        pOriginalNPCData[i + 1].profession = static_cast<NpcProfession>(atoi(test_string));
-                        break;
-                    case 8:
-                        pOriginalNPCData[i + 1].greet = atoi(test_string);
-                        break;
-                    case 9:
-                        pOriginalNPCData[i + 1].is_joinable = (*test_string == 'y') ? 1 : 0;
-                        break;
-                    case 10:
-                        pOriginalNPCData[i + 1].dialogue_1_evt_id = atoi(test_string);
-                        break;
-                    case 11:
-                        pOriginalNPCData[i + 1].dialogue_2_evt_id = atoi(test_string);
-                        break;
-                    case 12:
-                        pOriginalNPCData[i + 1].dialogue_3_evt_id = atoi(test_string);
-                        break;
-                    case 13:
-                        pOriginalNPCData[i + 1].dialogue_4_evt_id = atoi(test_string);
-                        break;
-                    case 14:
-                        pOriginalNPCData[i + 1].dialogue_5_evt_id = atoi(test_string);
-                        break;
-                    case 15:
-                        pOriginalNPCData[i + 1].dialogue_6_evt_id = atoi(test_string);
-                        break;
-                }
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 16) && !break_loop);
+        }
     }
     uNumNewNPCs = 501;
 }
 
-void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
-    std::string txtRaw(npcGreets.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+void NPCStats::InitializeNPCGreets(const TsvTable &npcGreets) {
+    TsvReader reader(npcGreets);
+    reader.skipRows(1);
 
     for (int i = 1; i <= 205; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                switch (decode_step) {
-                    case 1:
-                        pNPCGreetings[i].pGreeting1 = removeQuotes(test_string);
-                        break;
-                    case 2:
-                        pNPCGreetings[i].pGreeting2 = removeQuotes(test_string);
-                        break;
-                }
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 3) && !break_loop);
+        TsvRow row = reader.readRow();
+        if (!row[1].empty())
+            pNPCGreetings[i].pGreeting1 = removeQuotes(row[1]);
+        if (!row[2].empty())
+            pNPCGreetings[i].pGreeting2 = removeQuotes(row[2]);
     }
 }
 
-void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
-    std::string txtRaw(npcGroups.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+void NPCStats::InitializeNPCGroups(const TsvTable &npcGroups) {
+    TsvReader reader(npcGroups);
+    reader.skipRows(1);
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                if (decode_step == 1) {
-                    pOriginalGroups[i] = atoi(test_string);
-                }
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        TsvRow row = reader.readRow();
+        if (!row[1].empty())
+            pOriginalGroups[i] = tsvToInt(row[1]);
     }
 }
 
-void NPCStats::InitializeNPCNews(const Blob &npcNews) {
-    std::string txtRaw(npcNews.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+void NPCStats::InitializeNPCNews(const TsvTable &npcNews) {
+    TsvReader reader(npcNews);
+    reader.skipRows(1);
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                if (decode_step == 1)
-                    pCatchPhrases[i] = removeQuotes(test_string);
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        TsvRow row = reader.readRow();
+        if (!row[1].empty())
+            pCatchPhrases[i] = removeQuotes(row[1]);
     }
 }
 
 //----- (0047702F) --------------------------------------------------------
 void NPCStats::Initialize(GameResourceManager *resourceManager) {
     pOriginalNPCData.fill(NPCData());
-    InitializeNPCData(resourceManager->getEventsFile("npcdata.txt"));
-    InitializeNPCGreets(resourceManager->getEventsFile("npcgreet.txt"));
-    InitializeNPCGroups(resourceManager->getEventsFile("npcgroup.txt"));
-    InitializeNPCNews(resourceManager->getEventsFile("npcnews.txt"));
-    InitializeNPCText(resourceManager->getEventsFile("npctext.txt"));
-    InitializeNPCTopics(resourceManager->getEventsFile("npctopic.txt"));
-    InitializeNPCDist(resourceManager->getEventsFile("npcdist.txt"));
-    InitializeNPCNames(resourceManager->getEventsFile("npcnames.txt"));
-    InitializeNPCProfs(resourceManager->getEventsFile("npcprof.txt"));
+    InitializeNPCData(resourceManager->getEventsTable("npcdata.txt"));
+    InitializeNPCGreets(resourceManager->getEventsTable("npcgreet.txt"));
+    InitializeNPCGroups(resourceManager->getEventsTable("npcgroup.txt"));
+    InitializeNPCNews(resourceManager->getEventsTable("npcnews.txt"));
+    InitializeNPCText(resourceManager->getEventsTable("npctext.txt"));
+    InitializeNPCTopics(resourceManager->getEventsTable("npctopic.txt"));
+    InitializeNPCDist(resourceManager->getEventsTable("npcdist.txt"));
+    InitializeNPCNames(resourceManager->getEventsTable("npcnames.txt"));
+    InitializeNPCProfs(resourceManager->getEventsTable("npcprof.txt"));
 }
 
-void NPCStats::InitializeNPCNames(const Blob &npcNames) {
-    std::string txtRaw(npcNames.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos = nullptr;
-    int decode_step;
+void NPCStats::InitializeNPCNames(const TsvTable &npcNames) {
+    TsvReader reader(npcNames);
+    reader.skipRows(1);
 
     uNewlNPCBufPos = 0;
 
+    int i;
     for (i = 0; i < 540; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            if (c == '\t') {
-                if ((decode_step == 1) && (!uNumNPCNames[SEX_FEMALE]))
-                    uNumNPCNames[SEX_FEMALE] = i;
-            } else {
-                while ((c != '\n') && (c != '\t') && (c > 0)) {
-                    ++temp_str_len;
-                    c = test_string[temp_str_len];
-                }
-                tmp_pos = test_string + temp_str_len;
-                if (*tmp_pos == 0) break_loop = true;
-
-                if (temp_str_len) {
-                    *tmp_pos = 0;
-                    if (decode_step == 0)
-                        pNPCNames[i][SEX_MALE] = removeQuotes(test_string);
-                    else if (decode_step == 1)
-                        pNPCNames[i][SEX_FEMALE] = removeQuotes(test_string);
-                } else {
-                    if ((decode_step == 1) && (!uNumNPCNames[SEX_FEMALE]))
-                        uNumNPCNames[SEX_FEMALE] = i;
-                }
+        TsvRow row = reader.readRow();
+        if (!row[0].empty())
+            pNPCNames[i][SEX_MALE] = removeQuotes(row[0]);
+        if (row.size() > 1) {
+            if (!row[1].empty()) {
+                pNPCNames[i][SEX_FEMALE] = removeQuotes(row[1]);
+            } else if (!uNumNPCNames[SEX_FEMALE]) {
+                uNumNPCNames[SEX_FEMALE] = i;
             }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        }
     }
     uNumNPCNames[SEX_MALE] = i;
 }
 
-void NPCStats::InitializeNPCProfs(const Blob &npcProfs) {
-    std::string txtRaw(npcProfs.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos = nullptr;
-    int decode_step;
+void NPCStats::InitializeNPCProfs(const TsvTable &npcProfs) {
+    TsvReader reader(npcProfs);
+    reader.skipRows(4);
 
     for (NpcProfession i : Segment(NPC_PROFESSION_FIRST_VALID, NPC_PROFESSION_LAST_VALID)) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            // while (*test_string == '\t')  // some steps are separated by
-            // multiple \t's
-            // ++test_string;
-
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                switch (decode_step) {
-                    case 2:
-                        pProfessions[i].uHirePrice = atoi(test_string);
-                        break;
-                    case 3:
-                        pProfessions[i].pActionText = removeQuotes(test_string);
-                        break;
-                    case 4:
-                        pProfessions[i].pBenefits = removeQuotes(test_string);
-                        break;
-                    case 5:
-                        pProfessions[i].pJoinText = removeQuotes(test_string);
-                        break;
-                    case 6:
-                        pProfessions[i].pDismissText = removeQuotes(test_string);
-                }
-            } else {
-                if (!decode_step) break_loop = true;
+        TsvRow row = reader.readRow();
+        if (row[0].empty())
+            continue;
+
+        for (int step = 1; step < 7; ++step) {
+            std::string_view cell = row[step];
+            if (cell.empty())
+                continue;
+
+            switch (step) {
+                case 2:
+                    pProfessions[i].uHirePrice = tsvToInt(cell);
+                    break;
+                case 3:
+                    pProfessions[i].pActionText = removeQuotes(cell);
+                    break;
+                case 4:
+                    pProfessions[i].pBenefits = removeQuotes(cell);
+                    break;
+                case 5:
+                    pProfessions[i].pJoinText = removeQuotes(cell);
+                    break;
+                case 6:
+                    pProfessions[i].pDismissText = removeQuotes(cell);
             }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 7) && !break_loop);
+        }
     }
     uNumNPCProfessions = 59;
 }
@@ -14,7 +14,7 @@
 #include "Utility/IndexedArray.h"
 #include "Utility/Flags.h"
 
-class Blob;
+class TsvTable;
 class GameResourceManager;
 
 // TODO(Nik-RE-dev): It seems that two greet flags are used purely because it's modification is performed
@@ -89,15 +89,15 @@ struct NPCStats {
     }
 
     void Initialize(GameResourceManager *resourceManager);
-    void InitializeNPCNames(const Blob &npcNames);
-    void InitializeNPCProfs(const Blob &npcProfs);
-    void InitializeNPCText(const Blob &npcText);
-    void InitializeNPCTopics(const Blob &npcTopics);
-    void InitializeNPCDist(const Blob &npcDist);
-    void InitializeNPCData(const Blob &npcData);
-    void InitializeNPCGreets(const Blob &npcGreets);
-    void InitializeNPCGroups(const Blob &npcGroups);
-    void InitializeNPCNews(const Blob &npcNews);
+    void InitializeNPCNames(const TsvTable &npcNames);
+    void InitializeNPCProfs(const TsvTable &npcProfs);
+    void InitializeNPCText(const TsvTable &npcText);
+    void InitializeNPCTopics(const TsvTable &npcTopics);
+    void InitializeNPCDist(const TsvTable &npcDist);
+    void InitializeNPCData(const TsvTable &npcData);
+    void InitializeNPCGreets(const TsvTable &npcGreets);
+    void InitializeNPCGroups(const TsvTable &npcGroups);
+    void InitializeNPCNews(const TsvTable &npcNews);
     void InitializeAdditionalNPCs(NPCData *pNPCDataBuff, MonsterId npc_uid,
                                   HouseId uLocation2D, MapId uMapId);
     /**
@@ -6,11 +6,11 @@
 
 #include "Utility/IndexedArray.h"
 
-class Blob;
+class TsvTable;
 
 /**
  * @offset 0x4768A9
  */
-void initializeQuests(const Blob &quests);
+void initializeQuests(const TsvTable &quests);
 
 extern IndexedArray<std::string, QBIT_FIRST, QBIT_LAST> pQuestTable;
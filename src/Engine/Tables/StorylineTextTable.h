@@ -3,7 +3,7 @@
 #include <cstdint>
 #include <string>
 
-class Blob;
+class TsvTable;
 
 struct StorylineRecord {
     std::string pText;
@@ -15,7 +15,7 @@ struct StorylineRecord {
 };
 
 struct StorylineText {
-    void Initialize(const Blob &history);
+    void Initialize(const TsvTable &history);
     StorylineRecord StoreLine[29];
     int field_15C;
     // int field_0;
@@ -3,11 +3,11 @@
 #include <string>
 #include <array>
 
-class Blob;
+class TsvTable;
 
 /**
  * @offset 0x476682
  */
-void initializeTransitions(const Blob &transitions);
+void initializeTransitions(const TsvTable &transitions);
 
 extern std::array<std::string, 465> pTransitionStrings;
@@ -1,5 +1,8 @@
 #include <cstdlib>
+#include <cassert>
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "Engine/Time/Timer.h"
 #include "Engine/Pid.h"
@@ -25,14 +28,41 @@
 
 stru262_TurnBased *pTurnEngine = new stru262_TurnBased;
 
+bool isBeforeInTurnQueue(const TurnBased_QueueElem &l, const TurnBased_QueueElem &r) {
+    if (l.actor_initiative != r.actor_initiative)
+        return l.actor_initiative < r.actor_initiative; // if less initiative -> top
+
+    ObjectType lType = l.uPackedID.type();
+    ObjectType rType = r.uPackedID.type();
+    if (lType != rType)
+        return lType == OBJECT_Character && rType == OBJECT_Actor; // player preferable
+
+    return l.uPackedID.id() < r.uPackedID.id(); // less id preferable
+}
+
+void sortTurnQueue(std::span<TurnBased_QueueElem> queue) {
+    // Queue is almost always nearly sorted, e.g. only a single element has changed its initiative, or all initiatives
+    // were decreased by the same amount. Insertion sort is close to linear in this case.
+    if (std::ranges::is_sorted(queue, isBeforeInTurnQueue))
+        return;
+
+    for (auto it = queue.begin() + 1; it != queue.end(); ++it) {
+        auto pos = std::upper_bound(queue.begin(), it, *it, isBeforeInTurnQueue);
+        std::rotate(pos, it, it + 1);
+    }
+}
+
 //----- (00404544) --------------------------------------------------------
 void stru262_TurnBased::SortTurnQueue() {
+    UpdateTurnQueue(true);
+}
+
+void stru262_TurnBased::UpdateTurnQueue(bool fullSort) {
     int active_actors;
-    TurnBased_QueueElem *current_top;   // eax@16
-    TurnBased_QueueElem *test_element;  // ecx@18
-    int i, j;
+    int i;
     ObjectType p_type;
     unsigned int p_id;
+    std::vector<Pid> inactive;
 
     active_actors = this->pQueue.size();
     // set non active actors in queue initiative that not allow them to
@@ -45,35 +75,33 @@ void stru262_TurnBased::SortTurnQueue() {
             pActors[p_id].attributes |= ACTOR_STAND_IN_QUEUE;  // 0x80
             if (!pActors[p_id].CanAct()) {
                 --active_actors;
-                pQueue[i].actor_initiative = 1001;
+                if (fullSort) {
+                    pQueue[i].actor_initiative = 1001;
+                } else {
+                    inactive.push_back(pQueue[i].uPackedID);
+                }
                 pActors[p_id].ResetQueue();
             }
         } else if (p_type == OBJECT_Character) {
             if (!pParty->pCharacters[p_id].CanAct()) {
                 --active_actors;
-                pQueue[i].actor_initiative = 1001;
+                if (fullSort) {
+                    pQueue[i].actor_initiative = 1001;
+                } else {
+                    inactive.push_back(pQueue[i].uPackedID);
+                }
             }
         }
     }
-    // sort
-    for (i = 0; i + 1 < this->pQueue.size(); ++i) {
-        current_top = &pQueue[i];
-        for (j = i + 1; j < this->pQueue.size(); ++j) {
-            test_element = &pQueue[j];
-            if (test_element->actor_initiative <
-                    current_top
-                        ->actor_initiative ||  // if less initiative -> top
-                ((test_element->actor_initiative ==
-                  current_top->actor_initiative) &&
-                 (((test_element->uPackedID.type() == OBJECT_Character) &&
-                   (current_top->uPackedID.type() ==
-                    OBJECT_Actor)) ||  // player preferable
-                  ((test_element->uPackedID.type() ==
-                    current_top->uPackedID.type()) &&
-                   (test_element->uPackedID.id() < current_top->uPackedID.id()))))) {  // less id preferable
-                std::swap(*current_top, *test_element);
-            }
+    if (fullSort) {
+        sortTurnQueue(pQueue);
+    } else {
+        // Queue is sorted, so we only need to move the elements that cannot act to the back.
+        for (Pid pid : inactive) {
+            auto it = std::ranges::find(pQueue, pid, &TurnBased_QueueElem::uPackedID);
+            UpdateQueueInitiative(it - pQueue.begin(), 1001);
         }
+        assert(std::ranges::is_sorted(pQueue, isBeforeInTurnQueue));
     }
     this->pQueue.resize(active_actors);
     if (pQueue.empty())
@@ -93,6 +121,23 @@ void stru262_TurnBased::SortTurnQueue() {
                 Duration::fromTicks((double)pQueue[i].actor_initiative / flt_debugrecmod3); // Was * 0.46875, 0.46875 = 1 / 2.133333333333333.
     }
 }
+
+int stru262_TurnBased::UpdateQueueInitiative(int queueIndex, int initiative) {
+    auto it = pQueue.begin() + queueIndex;
+    it->actor_initiative = initiative;
+
+    // Everything except for the updated element is assumed to be sorted, so we only need to find the new place for it.
+    auto pos = std::upper_bound(pQueue.begin(), it, *it, isBeforeInTurnQueue);
+    if (pos != it) {
+        std::rotate(pos, it, it + 1);
+        return pos - pQueue.begin();
+    }
+
+    pos = std::lower_bound(it + 1, pQueue.end(), *it, isBeforeInTurnQueue);
+    std::rotate(it, it + 1, pos);
+    return pos - pQueue.begin() - 1;
+}
+
 //----- (0040471C) --------------------------------------------------------
 void stru262_TurnBased::ApplyPlayerAction() {
     if (pParty->bTurnBasedModeOn) {
@@ -333,13 +378,13 @@ void stru262_TurnBased::StartTurn() {
         }
     }
     // add new arrived actors
+    std::vector<bool> actorsInQueue(pActors.size(), false);
+    for (const TurnBased_QueueElem &element : pQueue)
+        if (element.uPackedID.type() == OBJECT_Actor)
+            actorsInQueue[element.uPackedID.id()] = true;
     for (actor_num = 0; actor_num < ai_arrays_size; ++actor_num) {
-        for (j = 0; j < this->pQueue.size(); ++j) {
-            if ((pQueue[j].uPackedID.type() == OBJECT_Actor) &&
-                ai_near_actors_ids[actor_num] == pQueue[j].uPackedID.id())
-                break;
-        }
-        if (j == this->pQueue.size()) {
+        if (!actorsInQueue[ai_near_actors_ids[actor_num]]) {
+            actorsInQueue[ai_near_actors_ids[actor_num]] = true;
             TurnBased_QueueElem &element = this->pQueue.emplace_back();
             element.uPackedID = Pid(OBJECT_Actor, ai_near_actors_ids[actor_num]);
             element.actor_initiative = 1;
@@ -495,8 +540,8 @@ void stru262_TurnBased::_406457(int a2) {
             .recoveryTime;
     }
 
-    pQueue[a2].actor_initiative = v6.ticks();
-    SortTurnQueue();
+    UpdateQueueInitiative(a2, v6.ticks());
+    UpdateTurnQueue(false);
     if (pQueue[0].uPackedID.type() == OBJECT_Character)
         pParty->setActiveCharacterIndex(pQueue[0].uPackedID.id() + 1);
     else
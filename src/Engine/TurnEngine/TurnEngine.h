@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include "Engine/Pid.h"
@@ -19,6 +20,19 @@ struct TurnBased_QueueElem {
     TurnEngineAiAction AI_action_type;
 };
 
+/**
+ * Turn queue order. Lower initiative acts first, ties go to characters over actors, and then to lower ids.
+ *
+ * This is a total order for the elements of a single queue, so any sort produces the same queue.
+ */
+bool isBeforeInTurnQueue(const TurnBased_QueueElem &l, const TurnBased_QueueElem &r);
+
+/**
+ * Sorts the provided turn queue with `isBeforeInTurnQueue`. Queue is expected to be nearly sorted, in which case this
+ * function runs in close to linear time.
+ */
+void sortTurnQueue(std::span<TurnBased_QueueElem> queue);
+
 struct stru262_TurnBased {
     inline stru262_TurnBased() {
         turns_count = 0;
@@ -31,6 +45,24 @@ struct stru262_TurnBased {
     }
 
     void SortTurnQueue();
+
+    /**
+     * Drops the elements that cannot act from the queue, then updates the active character & the recovery times.
+     *
+     * @param fullSort                  Whether to sort the whole queue. If false, the queue is assumed to be sorted
+     *                                  already, e.g. after a call to `UpdateQueueInitiative`.
+     */
+    void UpdateTurnQueue(bool fullSort);
+
+    /**
+     * Sets initiative of a single queue element and moves it into its place in the queue. Unlike `SortTurnQueue`,
+     * doesn't drop the elements that cannot act.
+     *
+     * @param queueIndex                Index of the element in `pQueue`.
+     * @param initiative                New initiative.
+     * @return                          New index of the element in `pQueue`.
+     */
+    int UpdateQueueInitiative(int queueIndex, int initiative);
     void ApplyPlayerAction();
     void Start();
     void End(bool bPlaySound);
@@ -0,0 +1,125 @@
+#include "ProfilerOverlay.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <imgui/imgui.h> // NOLINT: not a C system header.
+
+#include "Engine/EngineFileSystem.h"
+#include "Engine/Engine.h"
+
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Profiler/Profiler.h"
+
+#include "Utility/Streams/StringOutputStream.h"
+#include "Utility/String/Format.h"
+
+namespace {
+
+struct ZoneStats {
+    int threadId = 0;
+    int depth = 0;
+    const char *name = nullptr;
+    int64_t totalNs = 0;
+    int count = 0;
+    AllocationStats allocations;
+};
+
+} // namespace
+
+void ProfilerOverlay::update() {
+    ImGui::Begin("Profiler");
+
+    bool enabled = Profiler::isEnabled();
+    if (ImGui::Checkbox("Record", &enabled))
+        Profiler::setEnabled(enabled);
+
+    ImGui::SameLine();
+    bool allocationsEnabled = AllocationTracker::isEnabled();
+    if (ImGui::Checkbox("Allocations", &allocationsEnabled))
+        AllocationTracker::setEnabled(allocationsEnabled);
+
+    ImGui::SameLine();
+    if (ImGui::Button("Save trace")) {
+        std::string trace;
+        StringOutputStream stream(&trace);
+        Profiler::writeChromeTrace(&stream);
+        stream.close();
+        ufs->write("profiler_trace.json", Blob::fromString(std::move(trace)));
+    }
+
+    updateAllocations();
+
+    int64_t frameStartNs = 0;
+    int64_t frameEndNs = 0;
+    std::vector<ProfilerEvent> events = Profiler::lastFrameEvents(&frameStartNs, &frameEndNs);
+    if (frameStartNs < 0) {
+        ImGui::Text("No frames recorded.");
+        ImGui::End();
+        return;
+    }
+
+    // Zones with the same name at the same depth are merged, zones are listed in the order of their first appearance.
+    std::vector<ZoneStats> stats;
+    for (const ProfilerEvent &event : events) {
+        auto pos = std::ranges::find_if(stats, [&](const ZoneStats &zone) {
+            return zone.threadId == event.threadId && zone.depth == event.depth && zone.name == event.name;
+        });
+        if (pos == stats.end()) {
+            stats.push_back({event.threadId, event.depth, event.name});
+            pos = stats.end() - 1;
+        }
+        pos->totalNs += event.endNs - event.startNs;
+        pos->count++;
+        pos->allocations.count += event.allocations.count;
+        pos->allocations.bytes += event.allocations.bytes;
+    }
+    std::ranges::stable_sort(stats, std::less(), &ZoneStats::threadId);
+
+    ImGui::Text("Frame: %.2f ms", (frameEndNs - frameStartNs) / 1e6);
+
+    int threadId = -1;
+    for (const ZoneStats &zone : stats) {
+        if (zone.threadId != threadId) {
+            threadId = zone.threadId;
+            ImGui::Separator();
+            ImGui::Text("Thread %d", threadId);
+        }
+
+        if (AllocationTracker::isEnabled()) {
+            ImGui::Text("%*s%s: %.3f ms (x%d), %lld allocs, %lld bytes", zone.depth * 2, "", zone.name,
+                        zone.totalNs / 1e6, zone.count, static_cast<long long>(zone.allocations.count),
+                        static_cast<long long>(zone.allocations.bytes));
+        } else {
+            ImGui::Text("%*s%s: %.3f ms (x%d)", zone.depth * 2, "", zone.name, zone.totalNs / 1e6, zone.count);
+        }
+    }
+
+    ImGui::End();
+}
+
+void ProfilerOverlay::updateAllocations() {
+    AllocationStats totalAllocations = AllocationTracker::totalStats();
+    _frameAllocations = totalAllocations - _prevTotalAllocations;
+    _prevTotalAllocations = totalAllocations;
+
+    if (!AllocationTracker::isEnabled())
+        return;
+
+    int budget = engine->config->debug.AllocationBudget.value();
+    bool overBudget = budget > 0 && _frameAllocations.count > budget;
+    if (overBudget)
+        _framesOverBudget++;
+
+    std::string text = fmt::format("Allocations: {} ({} bytes)", _frameAllocations.count, _frameAllocations.bytes);
+    if (budget > 0)
+        text += fmt::format(", budget {}, {} frames over budget", budget, _framesOverBudget);
+
+    if (overBudget) {
+        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%s", text.c_str());
+    } else {
+        ImGui::TextUnformatted(text.c_str());
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Utility/Memory/AllocationTracker.h"
+
+#include "Overlay.h"
+
+/**
+ * Shows where the last frame went, using the zones recorded by `Profiler`, and how much it allocated, using the
+ * `AllocationTracker`.
+ */
+class ProfilerOverlay : public Overlay {
+ public:
+    virtual void update() override;
+
+ private:
+    void updateAllocations();
+
+ private:
+    AllocationStats _prevTotalAllocations;
+    AllocationStats _frameAllocations; // Allocations made between the last two calls to `update`.
+    int _framesOverBudget = 0;
+};
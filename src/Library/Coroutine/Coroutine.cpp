@@ -0,0 +1,138 @@
+#include "Coroutine.h"
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#   define MM_COROUTINE_UCONTEXT
+#endif
+
+#ifdef MM_COROUTINE_UCONTEXT
+#   include <sys/mman.h>
+#   include <ucontext.h>
+#   include <unistd.h>
+#endif
+
+#include "Utility/Exception.h"
+
+#ifdef MM_COROUTINE_UCONTEXT
+
+struct Coroutine::Context {
+    ucontext_t caller;
+    ucontext_t coroutine;
+    void *mapping = nullptr; // Stack memory, including the guard page.
+    size_t mappingSize = 0;
+};
+
+Coroutine::Coroutine(std::function<void()> body, size_t stackSize) :
+    _body(std::move(body)),
+    _context(std::make_unique<Context>()) {
+    assert(_body);
+
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    stackSize = (stackSize + pageSize - 1) / pageSize * pageSize;
+
+    // Stack grows down, so the guard page goes first. Overflowing the stack will then segfault instead of silently
+    // corrupting the heap.
+    _context->mappingSize = stackSize + pageSize;
+    _context->mapping = mmap(nullptr, _context->mappingSize, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (_context->mapping == MAP_FAILED)
+        Exception::throwFromErrno("mmap");
+    if (mprotect(_context->mapping, pageSize, PROT_NONE) != 0) {
+        munmap(_context->mapping, _context->mappingSize);
+        Exception::throwFromErrno("mprotect");
+    }
+
+    if (getcontext(&_context->coroutine) != 0) {
+        munmap(_context->mapping, _context->mappingSize);
+        Exception::throwFromErrno("getcontext");
+    }
+    _context->coroutine.uc_stack.ss_sp = static_cast<char *>(_context->mapping) + pageSize;
+    _context->coroutine.uc_stack.ss_size = stackSize;
+    _context->coroutine.uc_link = &_context->caller;
+
+    // makecontext only passes ints, so the pointer is split in two.
+    uint64_t self = reinterpret_cast<uintptr_t>(this);
+    makecontext(&_context->coroutine, reinterpret_cast<void (*)()>(&Coroutine::entryPoint), 2,
+                static_cast<unsigned int>(self), static_cast<unsigned int>(self >> 32));
+}
+
+Coroutine::~Coroutine() {
+    assert(!_running);
+    assert(!_started || _finished); // Can't unwind a suspended coroutine.
+
+    munmap(_context->mapping, _context->mappingSize);
+}
+
+bool Coroutine::isSupported() {
+    return true;
+}
+
+void Coroutine::resume() {
+    assert(!_running && !_finished);
+
+    _started = true;
+    _running = true;
+    swapcontext(&_context->caller, &_context->coroutine);
+    assert(!_running);
+
+    if (_exception)
+        std::rethrow_exception(std::exchange(_exception, nullptr));
+}
+
+void Coroutine::yield() {
+    assert(_running);
+
+    _running = false;
+    swapcontext(&_context->coroutine, &_context->caller);
+    assert(_running);
+}
+
+void Coroutine::entryPoint(unsigned int lo, unsigned int hi) {
+    uint64_t self = (static_cast<uint64_t>(hi) << 32) | lo;
+    reinterpret_cast<Coroutine *>(static_cast<uintptr_t>(self))->run();
+    // Returning from here switches to uc_link, which is the context of the last `resume` call.
+}
+
+#else
+
+struct Coroutine::Context {};
+
+Coroutine::Coroutine([[maybe_unused]] std::function<void()> body, [[maybe_unused]] size_t stackSize) {
+    throw Exception("Coroutines are not supported on this platform");
+}
+
+Coroutine::~Coroutine() = default;
+
+bool Coroutine::isSupported() {
+    return false;
+}
+
+void Coroutine::resume() {
+    assert(false);
+}
+
+void Coroutine::yield() {
+    assert(false);
+}
+
+void Coroutine::entryPoint(unsigned int, unsigned int) {
+    assert(false);
+}
+
+#endif
+
+void Coroutine::run() {
+    // Exceptions can't propagate through the context switch, so we pass them to `resume` manually.
+    try {
+        _body();
+    } catch (...) {
+        _exception = std::current_exception();
+    }
+
+    _body = {};
+    _running = false;
+    _finished = true;
+}
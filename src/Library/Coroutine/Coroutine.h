@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+
+/**
+ * Minimal stackful coroutine.
+ *
+ * The coroutine body runs on its own stack, but on the thread that calls `resume`. Switching between the body and
+ * the caller is a plain user-space context switch, so unlike a thread ping-pong it doesn't involve the OS scheduler.
+ *
+ * Some things to keep in mind:
+ * - Exception handling state is per-thread, and thus is shared between the coroutine and its caller. Don't `yield`
+ *   from inside a `catch` block.
+ * - Thread-locals are also shared.
+ * - Destroying a suspended coroutine is not supported as there is no way to unwind its stack. Make sure the body
+ *   returns first.
+ *
+ * Only desktop Linux is supported for now, use `isSupported` to check.
+ *
+ * This class is not thread-safe.
+ */
+class Coroutine {
+ public:
+    static constexpr size_t DEFAULT_STACK_SIZE = 8 * 1024 * 1024; // Same as the default thread stack size on Linux.
+
+    /**
+     * @param body                      Coroutine body. It's not started until the first call to `resume`.
+     * @param stackSize                 Stack size for the coroutine. Stack memory is committed lazily, so there's no
+     *                                  point in saving on this.
+     * @throws Exception                If coroutines are not supported on the current platform.
+     */
+    explicit Coroutine(std::function<void()> body, size_t stackSize = DEFAULT_STACK_SIZE);
+    ~Coroutine();
+
+    Coroutine(const Coroutine &) = delete;
+    Coroutine &operator=(const Coroutine &) = delete;
+
+    /**
+     * @return                          Whether coroutines are supported on the current platform.
+     */
+    [[nodiscard]] static bool isSupported();
+
+    /**
+     * Switches into the coroutine and runs it until it either calls `yield` or returns. Must be called from outside
+     * the coroutine, and the coroutine must not be finished.
+     *
+     * If an exception escapes the coroutine body, it is rethrown from this function, and the coroutine is considered
+     * finished.
+     */
+    void resume();
+
+    /**
+     * Switches back to the code that has called `resume`. Must be called from inside the coroutine.
+     */
+    void yield();
+
+    /**
+     * @return                          Whether the coroutine is running right now, i.e. whether we're inside it.
+     */
+    [[nodiscard]] bool isRunning() const {
+        return _running;
+    }
+
+    /**
+     * @return                          Whether the coroutine body has returned.
+     */
+    [[nodiscard]] bool isFinished() const {
+        return _finished;
+    }
+
+ private:
+    struct Context;
+
+    static void entryPoint(unsigned int lo, unsigned int hi);
+    void run();
+
+ private:
+    std::function<void()> _body;
+    std::unique_ptr<Context> _context;
+    std::exception_ptr _exception;
+    bool _started = false;
+    bool _running = false;
+    bool _finished = false;
+};
@@ -0,0 +1,100 @@
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Coroutine/Coroutine.h"
+
+UNIT_TEST(Coroutine, PingPong) {
+    if (!Coroutine::isSupported())
+        GTEST_SKIP();
+
+    std::vector<int> log;
+    Coroutine *self = nullptr;
+    Coroutine coroutine([&] {
+        EXPECT_TRUE(self->isRunning());
+        for (int i = 0; i < 3; i++) {
+            log.push_back(i * 2);
+            self->yield();
+        }
+    });
+    self = &coroutine;
+
+    EXPECT_FALSE(coroutine.isRunning());
+    for (int i = 0; i < 3; i++) {
+        coroutine.resume();
+        EXPECT_FALSE(coroutine.isFinished());
+        log.push_back(i * 2 + 1);
+    }
+    coroutine.resume();
+    EXPECT_TRUE(coroutine.isFinished());
+    EXPECT_FALSE(coroutine.isRunning());
+
+    EXPECT_EQ(log, std::vector<int>({0, 1, 2, 3, 4, 5}));
+}
+
+UNIT_TEST(Coroutine, NotStarted) {
+    if (!Coroutine::isSupported())
+        GTEST_SKIP();
+
+    bool called = false;
+    {
+        Coroutine coroutine([&] { called = true; });
+    }
+    EXPECT_FALSE(called);
+}
+
+UNIT_TEST(Coroutine, ExceptionsInside) {
+    if (!Coroutine::isSupported())
+        GTEST_SKIP();
+
+    // Exceptions thrown and caught inside the coroutine should work across yields.
+    std::string message;
+    Coroutine *self = nullptr;
+    Coroutine coroutine([&] {
+        try {
+            self->yield();
+            throw std::runtime_error("inside");
+        } catch (const std::exception &e) {
+            message = e.what();
+        }
+    });
+    self = &coroutine;
+
+    coroutine.resume();
+    EXPECT_TRUE(message.empty());
+    coroutine.resume();
+    EXPECT_TRUE(coroutine.isFinished());
+    EXPECT_EQ(message, "inside");
+}
+
+UNIT_TEST(Coroutine, ExceptionsPropagate) {
+    if (!Coroutine::isSupported())
+        GTEST_SKIP();
+
+    Coroutine coroutine([&] {
+        throw std::runtime_error("escaped");
+    });
+
+    EXPECT_THROW(coroutine.resume(), std::runtime_error);
+    EXPECT_TRUE(coroutine.isFinished());
+}
+
+UNIT_TEST(Coroutine, DeepStack) {
+    if (!Coroutine::isSupported())
+        GTEST_SKIP();
+
+    // Recursion that would overflow a tiny stack, just to make sure that the requested stack size is respected.
+    std::function<int(int)> recurse = [&](int depth) {
+        volatile char buffer[1024];
+        buffer[0] = static_cast<char>(depth);
+        return depth == 0 ? buffer[0] : recurse(depth - 1) + 1;
+    };
+
+    int result = 0;
+    Coroutine coroutine([&] { result = recurse(1000); }, 4 * 1024 * 1024);
+    coroutine.resume();
+    EXPECT_EQ(result, 1000);
+}
@@ -0,0 +1,162 @@
+#include "ForkServer.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <exception>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#   include <poll.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
+#include "Utility/Exception.h"
+
+ForkServer::ForkServer(int maxWorkers) : _maxWorkers(maxWorkers) {
+    assert(maxWorkers > 0);
+}
+
+#ifdef __linux__
+
+namespace {
+
+struct Worker {
+    int jobIndex = -1;
+    pid_t pid = -1;
+    int fd = -1; // Read end of the worker's stdout & stderr pipe.
+};
+
+} // namespace
+
+[[noreturn]] static void runWorker(int jobIndex, int fd, const ForkServer::Job &job) {
+    // Both stdout & stderr go into the same pipe so that the output is not reordered.
+    if (dup2(fd, STDOUT_FILENO) < 0 || dup2(fd, STDERR_FILENO) < 0)
+        _exit(127);
+    close(fd);
+
+    // Stdout is fully buffered when it's not a terminal, and we want to preserve the order of output lines.
+    setvbuf(stdout, nullptr, _IOLBF, BUFSIZ);
+
+    int exitCode = 1;
+    try {
+        exitCode = job(jobIndex);
+    } catch (const std::exception &e) {
+        fprintf(stderr, "%s\n", e.what());
+    } catch (...) {
+        fprintf(stderr, "Unknown exception\n");
+    }
+
+    fflush(nullptr);
+    _exit(exitCode);
+}
+
+static void startWorker(int jobIndex, const ForkServer::Job &job, Worker *worker) {
+    int fds[2];
+    if (pipe(fds) != 0)
+        Exception::throwFromErrno("pipe");
+
+    // Otherwise buffered output will be written out twice, once by the parent and once by the worker.
+    fflush(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        Exception::throwFromErrno("fork");
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+        runWorker(jobIndex, fds[1], job);
+    }
+
+    // Closing the write end right away, so that we get an EOF once the worker exits.
+    close(fds[1]);
+    worker->jobIndex = jobIndex;
+    worker->pid = pid;
+    worker->fd = fds[0];
+}
+
+static int waitForWorker(pid_t pid) {
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0)
+        if (errno != EINTR)
+            Exception::throwFromErrno("waitpid");
+
+    if (WIFSIGNALED(status))
+        return 128 + WTERMSIG(status);
+    return WEXITSTATUS(status);
+}
+
+bool ForkServer::isSupported() {
+    return true;
+}
+
+std::vector<ForkServerJobResult> ForkServer::run(int jobCount, Job job, FinishCallback finishCallback) {
+    assert(jobCount >= 0 && job);
+
+    std::vector<ForkServerJobResult> results(jobCount);
+    std::vector<Worker> workers;
+    std::vector<pollfd> pollFds;
+    int nextJob = 0;
+    char buffer[4096];
+
+    while (nextJob < jobCount || !workers.empty()) {
+        while (nextJob < jobCount && workers.size() < static_cast<size_t>(_maxWorkers))
+            startWorker(nextJob++, job, &workers.emplace_back());
+
+        pollFds.clear();
+        for (const Worker &worker : workers)
+            pollFds.push_back({worker.fd, POLLIN, 0});
+
+        if (poll(pollFds.data(), pollFds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            Exception::throwFromErrno("poll");
+        }
+
+        // Going backwards so that finished workers can be removed in place.
+        for (ssize_t i = std::ssize(workers) - 1; i >= 0; i--) {
+            if (pollFds[i].revents == 0)
+                continue;
+
+            Worker &worker = workers[i];
+            ssize_t size = read(worker.fd, buffer, sizeof(buffer));
+            if (size < 0 && errno == EINTR)
+                continue;
+            if (size < 0)
+                Exception::throwFromErrno("read");
+
+            ForkServerJobResult &result = results[worker.jobIndex];
+            if (size > 0) {
+                result.output.append(buffer, size);
+                continue;
+            }
+
+            // EOF, the worker has exited, or at least has closed its output.
+            close(worker.fd);
+            result.exitCode = waitForWorker(worker.pid);
+            if (finishCallback)
+                finishCallback(worker.jobIndex, result);
+            workers.erase(workers.begin() + i);
+        }
+    }
+
+    return results;
+}
+
+#else
+
+bool ForkServer::isSupported() {
+    return false;
+}
+
+std::vector<ForkServerJobResult> ForkServer::run(int, Job, FinishCallback) {
+    throw Exception("Fork server is not supported on this platform");
+}
+
+#endif
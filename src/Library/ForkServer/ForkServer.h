@@ -0,0 +1,55 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+struct ForkServerJobResult {
+    int exitCode = 0; // Exit code of the worker process, or 128 + signal number if it was killed by a signal.
+    std::string output; // Everything that the worker process has written to stdout & stderr.
+};
+
+/**
+ * Runs jobs in `fork`-ed worker processes, one process per job.
+ *
+ * The point is to pay for an expensive initialization once, and then to run the jobs in copy-on-write copies of
+ * the initialized process. Workers start from the point where `run` was called, run the job, and then exit right
+ * away, without running any destructors or `atexit` handlers.
+ *
+ * Note that only the calling thread survives a `fork`. It's up to the caller to shut down all other threads
+ * before calling `run`, and to restart them in the workers if needed.
+ *
+ * Only Linux is supported for now, use `isSupported` to check.
+ */
+class ForkServer {
+ public:
+    using Job = std::function<int(int)>;
+    using FinishCallback = std::function<void(int, const ForkServerJobResult &)>;
+
+    /**
+     * @param maxWorkers                Max number of worker processes running at the same time.
+     */
+    explicit ForkServer(int maxWorkers);
+
+    /**
+     * @return                          Whether `fork` is supported on the current platform.
+     */
+    [[nodiscard]] static bool isSupported();
+
+    /**
+     * Runs the provided jobs and waits for all of them to finish.
+     *
+     * @param jobCount                  Number of jobs to run.
+     * @param job                       Job function, called in a worker process with the job index. Return value is
+     *                                  used as the worker's exit code. Exceptions are printed out and result in
+     *                                  exit code 1.
+     * @param finishCallback            Callback to invoke in the calling process whenever a job finishes, in the
+     *                                  order the jobs finish. Can be empty.
+     * @return                          Results for all jobs, indexed by job index.
+     * @throws Exception                On errors, or if `fork` is not supported.
+     */
+    std::vector<ForkServerJobResult> run(int jobCount, Job job, FinishCallback finishCallback = {});
+
+ private:
+    int _maxWorkers = 1;
+};
@@ -0,0 +1,62 @@
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#include "Utility/String/Format.h"
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/ForkServer/ForkServer.h"
+
+UNIT_TEST(ForkServer, ExitCodesAndOutput) {
+    if (!ForkServer::isSupported())
+        GTEST_SKIP();
+
+    std::vector<int> finished;
+    std::vector<ForkServerJobResult> results = ForkServer(3).run(10, [] (int index) {
+        printf("out %d\n", index);
+        fprintf(stderr, "err %d\n", index);
+        return index % 3;
+    }, [&] (int index, const ForkServerJobResult &) {
+        finished.push_back(index);
+    });
+
+    ASSERT_EQ(results.size(), 10);
+    EXPECT_EQ(finished.size(), 10);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(results[i].exitCode, i % 3);
+        EXPECT_EQ(results[i].output, fmt::format("out {}\nerr {}\n", i, i));
+    }
+}
+
+UNIT_TEST(ForkServer, CopyOnWrite) {
+    if (!ForkServer::isSupported())
+        GTEST_SKIP();
+
+    // Workers see the state of the parent at the time of the call, and their changes don't leak back.
+    int value = 42;
+    std::vector<ForkServerJobResult> results = ForkServer(2).run(4, [&] (int index) {
+        value += index;
+        return value;
+    });
+
+    EXPECT_EQ(value, 42);
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(results[i].exitCode, 42 + i);
+}
+
+UNIT_TEST(ForkServer, Failures) {
+    if (!ForkServer::isSupported())
+        GTEST_SKIP();
+
+    std::vector<ForkServerJobResult> results = ForkServer(2).run(2, [] (int index) -> int {
+        if (index == 0)
+            throw std::runtime_error("boom");
+        abort();
+    });
+
+    EXPECT_EQ(results[0].exitCode, 1);
+    EXPECT_EQ(results[0].output, "boom\n");
+    EXPECT_GT(results[1].exitCode, 128);
+}
@@ -28,6 +28,8 @@ struct Vec2 {
         return std::sqrt(lengthSqr());
     }
 
+    friend bool operator==(const Vec2 &l, const Vec2 &r) = default;
+
     friend Vec2 operator+(const Vec2 &l, const Vec2 &r) {
         return Vec2(l.x + r.x, l.y + r.y);
     }
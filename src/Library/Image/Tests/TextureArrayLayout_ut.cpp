@@ -0,0 +1,52 @@
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Image/TextureArrayLayout.h"
+
+UNIT_TEST(TextureArrayLayout, GroupsBySize) {
+    TextureArrayLayout layout;
+
+    EXPECT_EQ(layout.insert("a", Sizei(128, 128)), TextureArraySlot(0, 0));
+    EXPECT_EQ(layout.insert("b", Sizei(64, 64)), TextureArraySlot(1, 0));
+    EXPECT_EQ(layout.insert("c", Sizei(128, 128)), TextureArraySlot(0, 1));
+    EXPECT_EQ(layout.insert("d", Sizei(64, 128)), TextureArraySlot(2, 0));
+    EXPECT_EQ(layout.insert("e", Sizei(64, 64)), TextureArraySlot(1, 1));
+
+    EXPECT_EQ(layout.size(), 5);
+    EXPECT_EQ(layout.units()[0].size, Sizei(128, 128));
+    EXPECT_EQ(layout.units()[0].layers, std::vector<std::string>({"a", "c"}));
+    EXPECT_EQ(layout.units()[1].layers, std::vector<std::string>({"b", "e"}));
+    EXPECT_EQ(layout.units()[2].layers, std::vector<std::string>({"d"}));
+    EXPECT_EQ(layout.units()[3].size, Sizei());
+}
+
+UNIT_TEST(TextureArrayLayout, InsertExisting) {
+    TextureArrayLayout layout;
+
+    EXPECT_EQ(layout.insert("a", Sizei(32, 32)), TextureArraySlot(0, 0));
+    EXPECT_EQ(layout.insert("b", Sizei(32, 32)), TextureArraySlot(0, 1));
+
+    // Size is ignored for textures that are already in the layout.
+    EXPECT_EQ(layout.insert("a", Sizei(16, 16)), TextureArraySlot(0, 0));
+    EXPECT_EQ(layout.find("a"), TextureArraySlot(0, 0));
+    EXPECT_EQ(layout.find("c"), std::nullopt);
+    EXPECT_EQ(layout.size(), 2);
+    EXPECT_EQ(layout.units()[1].size, Sizei());
+}
+
+UNIT_TEST(TextureArrayLayout, Overflow) {
+    TextureArrayLayout layout;
+
+    for (int i = 0; i < TextureArrayLayout::MAX_LAYERS; i++)
+        EXPECT_EQ(layout.insert(std::to_string(i), Sizei(8, 8)), TextureArraySlot(0, i));
+    EXPECT_EQ(layout.insert("full", Sizei(8, 8)), std::nullopt);
+    EXPECT_EQ(layout.find("full"), std::nullopt);
+
+    for (int i = 1; i < TextureArrayLayout::MAX_UNITS; i++)
+        EXPECT_EQ(layout.insert("unit" + std::to_string(i), Sizei(8, 8 + i)), TextureArraySlot(i, 0));
+    EXPECT_EQ(layout.insert("nounit", Sizei(1, 1)), std::nullopt);
+
+    // Units that have space left still accept textures.
+    EXPECT_EQ(layout.insert("more", Sizei(8, 9)), TextureArraySlot(1, 1));
+}
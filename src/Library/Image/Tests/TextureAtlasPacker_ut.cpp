@@ -0,0 +1,67 @@
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/Rect.h"
+#include "Library/Image/TextureAtlasPacker.h"
+
+UNIT_TEST(TextureAtlasPacker, SimplePacking) {
+    TextureAtlasPacker packer(Sizei(64, 64));
+
+    EXPECT_TRUE(packer.empty());
+    EXPECT_EQ(packer.insert(Sizei(32, 16)), Pointi(0, 0));
+    EXPECT_EQ(packer.insert(Sizei(32, 32)), Pointi(32, 0));
+    EXPECT_EQ(packer.insert(Sizei(32, 16)), Pointi(0, 16));
+    EXPECT_EQ(packer.insert(Sizei(64, 32)), Pointi(0, 32));
+    EXPECT_EQ(packer.insert(Sizei(1, 1)), std::nullopt);
+    EXPECT_FALSE(packer.empty());
+    EXPECT_EQ(packer.occupancy(), 1.0f);
+}
+
+UNIT_TEST(TextureAtlasPacker, FillsGaps) {
+    TextureAtlasPacker packer(Sizei(64, 64));
+
+    EXPECT_EQ(packer.insert(Sizei(16, 48)), Pointi(0, 0));
+    EXPECT_EQ(packer.insert(Sizei(16, 16)), Pointi(16, 0));
+    EXPECT_EQ(packer.insert(Sizei(32, 8)), Pointi(32, 0));
+
+    // Goes into the lowest spot, which is to the right of the tall rectangle.
+    EXPECT_EQ(packer.insert(Sizei(48, 8)), Pointi(16, 16));
+}
+
+UNIT_TEST(TextureAtlasPacker, NoOverlaps) {
+    TextureAtlasPacker packer(Sizei(256, 256));
+
+    std::vector<Recti> placed;
+    for (int i = 0; i < 200; i++) {
+        Sizei size(4 + (i * 7) % 29, 4 + (i * 13) % 23);
+        std::optional<Pointi> pos = packer.insert(size);
+        if (!pos)
+            continue;
+
+        Recti rect(*pos, size);
+        EXPECT_GE(rect.x, 0);
+        EXPECT_GE(rect.y, 0);
+        EXPECT_LE(rect.x + rect.w, 256);
+        EXPECT_LE(rect.y + rect.h, 256);
+        for (const Recti &other : placed)
+            EXPECT_FALSE(rect.intersects(other));
+        placed.push_back(rect);
+    }
+
+    EXPECT_GT(placed.size(), 50);
+    EXPECT_GT(packer.occupancy(), 0.7f);
+}
+
+UNIT_TEST(TextureAtlasPacker, Clear) {
+    TextureAtlasPacker packer(Sizei(32, 32));
+
+    EXPECT_EQ(packer.insert(Sizei(32, 32)), Pointi(0, 0));
+    EXPECT_EQ(packer.insert(Sizei(1, 1)), std::nullopt);
+    EXPECT_EQ(packer.insert(Sizei(33, 1)), std::nullopt);
+
+    packer.clear();
+    EXPECT_TRUE(packer.empty());
+    EXPECT_EQ(packer.occupancy(), 0.0f);
+    EXPECT_EQ(packer.insert(Sizei(16, 16)), Pointi(0, 0));
+}
@@ -0,0 +1,34 @@
+#include "TextureArrayLayout.h"
+
+#include <cassert>
+
+std::optional<TextureArraySlot> TextureArrayLayout::find(std::string_view name) const {
+    auto pos = _slots.find(name);
+    if (pos == _slots.end())
+        return std::nullopt;
+    return pos->second;
+}
+
+std::optional<TextureArraySlot> TextureArrayLayout::insert(std::string_view name, Sizei size) {
+    assert(size.w > 0 && size.h > 0);
+
+    if (std::optional<TextureArraySlot> result = find(name))
+        return result;
+
+    int unit = 0;
+    for (; unit < MAX_UNITS; unit++)
+        if (_units[unit].size == size || _units[unit].size == Sizei())
+            break;
+    if (unit == MAX_UNITS)
+        return std::nullopt;
+
+    TextureArrayUnit &target = _units[unit];
+    if (target.layers.size() >= MAX_LAYERS)
+        return std::nullopt;
+
+    TextureArraySlot result = {unit, static_cast<int>(target.layers.size())};
+    target.size = size;
+    target.layers.emplace_back(name);
+    _slots.emplace(name, result);
+    return result;
+}
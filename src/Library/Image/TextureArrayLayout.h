@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Library/Geometry/Size.h"
+
+#include "Utility/String/TransparentFunctors.h"
+
+struct TextureArraySlot {
+    int unit = 0;
+    int layer = 0;
+
+    friend bool operator==(const TextureArraySlot &l, const TextureArraySlot &r) = default;
+};
+
+struct TextureArrayUnit {
+    Sizei size; // Size of all textures in this unit, zero if the unit is not used.
+    std::vector<std::string> layers; // Texture names, by layer.
+};
+
+/**
+ * Assignment of textures to texture array layers, as used by the level geometry shaders.
+ *
+ * Textures in a texture array must all have the same size, so the textures are grouped by size into units, each unit
+ * being a separate texture array. A texture goes into the first unit of matching size, or into the first free unit.
+ *
+ * This class doesn't deal with the texture data, only with the names & sizes, so it can be built without a renderer.
+ */
+class TextureArrayLayout {
+ public:
+    static constexpr int MAX_UNITS = 16;
+    static constexpr int MAX_LAYERS = 256;
+
+    /**
+     * @param name                      Texture name.
+     * @return                          Slot for the provided texture, or `std::nullopt` if it wasn't inserted.
+     */
+    [[nodiscard]] std::optional<TextureArraySlot> find(std::string_view name) const;
+
+    /**
+     * Inserts a texture into this layout. Inserting a texture that's already there just returns its slot.
+     *
+     * @param name                      Texture name.
+     * @param size                      Texture size.
+     * @return                          Slot for the inserted texture, or `std::nullopt` if all units are taken by
+     *                                  other texture sizes, or if the unit for this texture size is full.
+     */
+    std::optional<TextureArraySlot> insert(std::string_view name, Sizei size);
+
+    [[nodiscard]] const std::array<TextureArrayUnit, MAX_UNITS> &units() const {
+        return _units;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _slots.empty();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _slots.size();
+    }
+
+ private:
+    std::array<TextureArrayUnit, MAX_UNITS> _units;
+    std::unordered_map<TransparentString, TextureArraySlot, TransparentStringHash, TransparentStringEquals> _slots;
+};
@@ -0,0 +1,94 @@
+#include "TextureAtlasPacker.h"
+
+#include <algorithm>
+#include <cassert>
+
+TextureAtlasPacker::TextureAtlasPacker(Sizei size) : _size(size) {
+    assert(size.w > 0 && size.h > 0);
+    clear();
+}
+
+std::optional<Pointi> TextureAtlasPacker::insert(Sizei size) {
+    assert(size.w > 0 && size.h > 0);
+
+    size_t bestIndex = _skyline.size();
+    int bestY = 0;
+    int bestBottom = _size.h + 1;
+    int bestWidth = 0;
+    for (size_t i = 0; i < _skyline.size(); i++) {
+        std::optional<int> y = fit(i, size);
+        if (!y)
+            continue;
+
+        int bottom = *y + size.h;
+        if (bottom < bestBottom || (bottom == bestBottom && _skyline[i].w < bestWidth)) {
+            bestIndex = i;
+            bestY = *y;
+            bestBottom = bottom;
+            bestWidth = _skyline[i].w;
+        }
+    }
+
+    if (bestIndex == _skyline.size())
+        return std::nullopt;
+
+    Pointi result(_skyline[bestIndex].x, bestY);
+    _skyline.insert(_skyline.begin() + bestIndex, SkylineNode(result.x, bestBottom, size.w));
+
+    // Shrink or drop the nodes that are now below the new one.
+    int right = result.x + size.w;
+    size_t i = bestIndex + 1;
+    while (i < _skyline.size() && _skyline[i].x < right) {
+        SkylineNode &node = _skyline[i];
+        int shrink = right - node.x;
+        if (shrink < node.w) {
+            node.x += shrink;
+            node.w -= shrink;
+            break;
+        }
+        _skyline.erase(_skyline.begin() + i);
+    }
+
+    // Merge neighbours of the same height.
+    for (size_t j = 0; j + 1 < _skyline.size();) {
+        if (_skyline[j].y == _skyline[j + 1].y) {
+            _skyline[j].w += _skyline[j + 1].w;
+            _skyline.erase(_skyline.begin() + j + 1);
+        } else {
+            j++;
+        }
+    }
+
+    _usedArea += static_cast<int64_t>(size.w) * size.h;
+    return result;
+}
+
+void TextureAtlasPacker::clear() {
+    _skyline.clear();
+    if (_size.w > 0)
+        _skyline.push_back(SkylineNode(0, 0, _size.w));
+    _usedArea = 0;
+}
+
+float TextureAtlasPacker::occupancy() const {
+    if (_size.w == 0 || _size.h == 0)
+        return 0.0f;
+    return static_cast<float>(_usedArea) / (static_cast<float>(_size.w) * _size.h);
+}
+
+std::optional<int> TextureAtlasPacker::fit(size_t index, Sizei size) const {
+    int x = _skyline[index].x;
+    if (x + size.w > _size.w)
+        return std::nullopt;
+
+    int y = 0;
+    int remaining = size.w;
+    for (size_t i = index; remaining > 0; i++) {
+        assert(i < _skyline.size());
+        y = std::max(y, _skyline[i].y);
+        if (y + size.h > _size.h)
+            return std::nullopt;
+        remaining -= _skyline[i].w;
+    }
+    return y;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Library/Geometry/Point.h"
+#include "Library/Geometry/Size.h"
+
+/**
+ * Skyline bottom-left rectangle packer, as used for building texture atlases at runtime.
+ *
+ * The packer tracks the upper boundary ("skyline") of the already placed rectangles, and puts each new rectangle at
+ * the position that keeps the skyline as low as possible. Rectangles can only be added, space is reclaimed by
+ * clearing the whole packer.
+ *
+ * This class doesn't deal with the texture data, only with the sizes, so it can be used without a renderer.
+ */
+class TextureAtlasPacker {
+ public:
+    TextureAtlasPacker() = default;
+    explicit TextureAtlasPacker(Sizei size);
+
+    /**
+     * @param size                      Size of the rectangle to place.
+     * @return                          Top-left corner of the placed rectangle, or `std::nullopt` if there is no
+     *                                  space left for a rectangle of this size.
+     */
+    std::optional<Pointi> insert(Sizei size);
+
+    /**
+     * Removes all the placed rectangles.
+     */
+    void clear();
+
+    [[nodiscard]] Sizei size() const {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _usedArea == 0;
+    }
+
+    /**
+     * @return                          Fraction of the atlas area that's taken by the placed rectangles.
+     */
+    [[nodiscard]] float occupancy() const;
+
+ private:
+    struct SkylineNode {
+        int x = 0;
+        int y = 0;
+        int w = 0;
+    };
+
+    [[nodiscard]] std::optional<int> fit(size_t index, Sizei size) const;
+
+ private:
+    Sizei _size;
+    std::vector<SkylineNode> _skyline; // Sorted by x, covers the whole atlas width.
+    int64_t _usedArea = 0;
+};
@@ -0,0 +1,88 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Parallel/WorkerPool.h"
+
+UNIT_TEST(WorkerPool, CoversAllIndices) {
+    WorkerPool pool(4);
+    EXPECT_EQ(pool.threadCount(), 4);
+
+    for (size_t size : {0, 1, 15, 16, 17, 1000, 12345}) {
+        std::vector<int> hits(size, 0);
+        pool.parallelFor(size, 16, [&](size_t begin, size_t end) {
+            EXPECT_LT(begin, end);
+            EXPECT_LE(end, size);
+            for (size_t i = begin; i < end; i++)
+                hits[i]++;
+        });
+
+        for (size_t i = 0; i < size; i++)
+            EXPECT_EQ(hits[i], 1) << "size = " << size << ", i = " << i;
+    }
+}
+
+UNIT_TEST(WorkerPool, SmallJobsRunInline) {
+    WorkerPool pool(4);
+
+    std::thread::id caller = std::this_thread::get_id();
+    int calls = 0;
+    pool.parallelFor(100, 100, [&](size_t begin, size_t end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 100);
+        calls++;
+    });
+    EXPECT_EQ(calls, 1);
+}
+
+UNIT_TEST(WorkerPool, SingleThread) {
+    WorkerPool pool(0);
+    EXPECT_EQ(pool.threadCount(), 1);
+
+    std::vector<int> values(1000);
+    pool.parallelFor(values.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+            values[i] = static_cast<int>(i);
+    });
+
+    std::vector<int> expected(values.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(values, expected);
+}
+
+UNIT_TEST(WorkerPool, RepeatedJobs) {
+    WorkerPool pool(8);
+
+    std::atomic<int64_t> sum = 0;
+    for (int i = 0; i < 1000; i++) {
+        pool.parallelFor(64, 1, [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; j++)
+                sum += static_cast<int64_t>(j);
+        });
+    }
+    EXPECT_EQ(sum, 1000 * (63 * 64 / 2));
+}
+
+UNIT_TEST(WorkerPool, Exceptions) {
+    WorkerPool pool(4);
+
+    std::atomic<size_t> processed = 0;
+    EXPECT_THROW(pool.parallelFor(1000, 10, [&](size_t begin, size_t end) {
+        processed += end - begin;
+        if (begin <= 500 && 500 < end)
+            throw std::runtime_error("500");
+    }), std::runtime_error);
+    EXPECT_EQ(processed, 1000);
+
+    // Pool is still usable.
+    processed = 0;
+    pool.parallelFor(1000, 10, [&](size_t begin, size_t end) {
+        processed += end - begin;
+    });
+    EXPECT_EQ(processed, 1000);
+}
@@ -0,0 +1,103 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+struct WorkerPool::Job {
+    const std::function<void(size_t, size_t)> *body = nullptr;
+    size_t size = 0;
+    size_t chunkSize = 0;
+    size_t chunkCount = 0;
+    std::atomic<size_t> nextChunk = 0;
+    std::exception_ptr exception; // Guarded by WorkerPool::_mutex.
+};
+
+WorkerPool::WorkerPool(int threadCount) {
+    for (int i = 1; i < threadCount; i++)
+        _threads.emplace_back(&WorkerPool::run, this);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _workAvailable.notify_all();
+
+    for (std::thread &thread : _threads)
+        thread.join();
+}
+
+void WorkerPool::parallelFor(size_t size, size_t minChunkSize, const std::function<void(size_t, size_t)> &body) {
+    minChunkSize = std::max<size_t>(minChunkSize, 1);
+    if (_threads.empty() || size <= minChunkSize) {
+        if (size)
+            body(0, size);
+        return;
+    }
+
+    // A few chunks per thread, so that a thread that got preempted doesn't hold everyone else up.
+    Job job;
+    job.body = &body;
+    job.size = size;
+    job.chunkSize = std::max(minChunkSize, (size + threadCount() * 4 - 1) / (threadCount() * 4));
+    job.chunkCount = (size + job.chunkSize - 1) / job.chunkSize;
+
+    {
+        std::lock_guard lock(_mutex);
+        _job = &job;
+        _generation++;
+    }
+    _workAvailable.notify_all();
+
+    runChunks(&job);
+
+    {
+        // All chunks are claimed at this point, and chunks are only claimed by active workers.
+        std::unique_lock lock(_mutex);
+        _workDone.wait(lock, [&] { return _activeWorkers == 0; });
+        _job = nullptr;
+    }
+
+    if (job.exception)
+        std::rethrow_exception(job.exception);
+}
+
+void WorkerPool::run() {
+    uint64_t lastGeneration = 0;
+
+    std::unique_lock lock(_mutex);
+    while (true) {
+        _workAvailable.wait(lock, [&] { return _stopping || _generation != lastGeneration; });
+        if (_stopping)
+            return;
+
+        lastGeneration = _generation;
+        Job *job = _job;
+        if (!job)
+            continue; // Woke up too late, the job is already done.
+
+        _activeWorkers++;
+        lock.unlock();
+        runChunks(job);
+        lock.lock();
+        if (--_activeWorkers == 0)
+            _workDone.notify_all();
+    }
+}
+
+void WorkerPool::runChunks(Job *job) {
+    size_t chunk;
+    while ((chunk = job->nextChunk.fetch_add(1, std::memory_order_relaxed)) < job->chunkCount) {
+        size_t begin = chunk * job->chunkSize;
+        size_t end = std::min(begin + job->chunkSize, job->size);
+        try {
+            (*job->body)(begin, end);
+        } catch (...) {
+            std::lock_guard lock(_mutex);
+            if (!job->exception)
+                job->exception = std::current_exception();
+        }
+    }
+}
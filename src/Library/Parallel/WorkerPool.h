@@ -0,0 +1,69 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed-size pool of worker threads for data-parallel loops.
+ *
+ * The pool is meant for short per-frame jobs, e.g. culling thousands of billboards, where spawning a thread per job
+ * would cost more than the job itself. The calling thread always takes part in the work, so a pool with a thread
+ * count of 1 doesn't start any threads and runs everything inline.
+ *
+ * Jobs are split into contiguous index ranges. There are no guarantees on which thread processes which range, so
+ * callers that need deterministic results should write them into per-index slots and merge them afterwards in index
+ * order.
+ */
+class WorkerPool {
+ public:
+    /**
+     * @param threadCount               Total number of threads to use, including the calling thread. Values less
+     *                                  than 1 are treated as 1.
+     */
+    explicit WorkerPool(int threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /**
+     * @return                          Total number of threads used by this pool, including the calling thread.
+     */
+    [[nodiscard]] int threadCount() const {
+        return static_cast<int>(_threads.size()) + 1;
+    }
+
+    /**
+     * Calls `body` for a set of disjoint ranges that cover `[0, size)`, and waits for all the calls to finish. Ranges
+     * are at least `minChunkSize` long, except for the last one. Jobs smaller than that are run inline.
+     *
+     * Must not be called concurrently from several threads, or from inside `body`. If `body` throws, the first
+     * exception is rethrown once all the other ranges are done.
+     *
+     * @param size                      Number of elements to process.
+     * @param minChunkSize              Minimal number of elements to process in a single `body` call.
+     * @param body                      Callback taking a `[begin, end)` range of element indices.
+     */
+    void parallelFor(size_t size, size_t minChunkSize, const std::function<void(size_t, size_t)> &body);
+
+ private:
+    struct Job;
+
+    void run();
+    void runChunks(Job *job);
+
+ private:
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _workDone;
+    Job *_job = nullptr;
+    uint64_t _generation = 0; // Incremented for every new job, so that workers don't pick the same job twice.
+    int _activeWorkers = 0;
+    bool _stopping = false;
+};
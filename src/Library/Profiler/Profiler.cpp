@@ -0,0 +1,245 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/String/Format.h"
+
+namespace {
+
+/** Number of zones that a thread records before handing them off to the shared ring buffer. */
+constexpr size_t PENDING_CAPACITY = 256;
+
+/**
+ * Ring buffer of `THREAD_BUFFER_CAPACITY` zones. Guarded by `ProfilerState::mutex`.
+ */
+struct EventRing {
+    std::vector<ProfilerEvent> events;
+    size_t written = 0; // Total number of events written.
+};
+
+struct ProfilerState {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<EventRing>> rings; // Rings outlive their threads, so that their zones are not lost.
+    std::vector<EventRing *> freeRings; // Rings of the threads that have exited, reused by new threads.
+    int nextThreadId = 0;
+    std::atomic<int> generation = 0; // Incremented on `Profiler::clear`.
+    int64_t prevFrameStartNs = -1;
+    int64_t lastFrameStartNs = -1;
+};
+
+ProfilerState &profilerState() {
+    static ProfilerState state;
+    return state;
+}
+
+/**
+ * Per-thread buffer. Zones are written here without any locking, and are handed off to the thread's ring under
+ * the profiler mutex when a top level zone ends, when the buffer is full, or when the thread exits.
+ */
+class ThreadBuffer {
+ public:
+    ThreadBuffer() {
+        profilerState(); // Make sure the state outlives the thread-local buffers of the main thread.
+    }
+
+    ~ThreadBuffer() {
+        if (!_ring)
+            return;
+
+        ProfilerState &state = profilerState();
+        std::lock_guard lock(state.mutex);
+        flushLocked(&state);
+        state.freeRings.push_back(_ring);
+    }
+
+    void record(const char *name, int64_t startNs, int64_t endNs, int depth, AllocationStats allocations) {
+        if (!_ring)
+            initialize();
+        if (_pendingCount == PENDING_CAPACITY)
+            flush();
+        if (_pendingCount == 0)
+            _generation = profilerState().generation.load(std::memory_order_relaxed);
+
+        ProfilerEvent &event = _pending[_pendingCount++];
+        event.name = name;
+        event.startNs = startNs;
+        event.endNs = endNs;
+        event.depth = depth;
+        event.threadId = _threadId;
+        event.allocations = allocations;
+
+        if (depth == 0)
+            flush();
+    }
+
+    void flush() {
+        if (_pendingCount == 0)
+            return;
+
+        ProfilerState &state = profilerState();
+        std::lock_guard lock(state.mutex);
+        flushLocked(&state);
+    }
+
+ private:
+    void initialize() {
+        _pending = std::make_unique<ProfilerEvent[]>(PENDING_CAPACITY);
+
+        ProfilerState &state = profilerState();
+        std::lock_guard lock(state.mutex);
+        _threadId = state.nextThreadId++;
+        if (!state.freeRings.empty()) {
+            _ring = state.freeRings.back();
+            state.freeRings.pop_back();
+        } else {
+            _ring = state.rings.emplace_back(std::make_unique<EventRing>()).get();
+            _ring->events.resize(Profiler::THREAD_BUFFER_CAPACITY);
+        }
+    }
+
+    void flushLocked(ProfilerState *state) {
+        // Zones recorded before the last `Profiler::clear` call are dropped.
+        if (_generation == state->generation) {
+            for (size_t i = 0; i < _pendingCount; i++)
+                _ring->events[_ring->written++ % Profiler::THREAD_BUFFER_CAPACITY] = _pending[i];
+        }
+        _pendingCount = 0;
+    }
+
+ private:
+    EventRing *_ring = nullptr;
+    std::unique_ptr<ProfilerEvent[]> _pending;
+    size_t _pendingCount = 0;
+    int _threadId = 0;
+    int _generation = 0;
+};
+
+// With the coroutine control backend, the control routine runs on the game thread and shares these. Its zones then
+// end up nested inside the game zone that's open around `swapBuffers`, and are attributed to the game thread.
+thread_local ThreadBuffer threadBuffer;
+thread_local int threadDepth = 0;
+
+void appendEvents(const EventRing &ring, std::vector<ProfilerEvent> *result) {
+    size_t count = std::min(ring.written, Profiler::THREAD_BUFFER_CAPACITY);
+    for (size_t i = ring.written - count; i < ring.written; i++)
+        result->push_back(ring.events[i % Profiler::THREAD_BUFFER_CAPACITY]);
+}
+
+std::string escapeJson(const char *s) {
+    std::string result;
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            result += '\\';
+        result += *s;
+    }
+    return result;
+}
+
+} // namespace
+
+void Profiler::setEnabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+int64_t Profiler::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::record(const char *name, int64_t startNs, int64_t endNs, int depth, AllocationStats allocations) {
+    threadBuffer.record(name, startNs, endNs, depth, allocations);
+}
+
+void Profiler::markFrame() {
+    if (!isEnabled())
+        return;
+
+    ProfilerState &state = profilerState();
+    std::lock_guard lock(state.mutex);
+    state.prevFrameStartNs = state.lastFrameStartNs;
+    state.lastFrameStartNs = now();
+}
+
+std::vector<ProfilerEvent> Profiler::events() {
+    std::vector<ProfilerEvent> result;
+
+    threadBuffer.flush();
+
+    ProfilerState &state = profilerState();
+    std::lock_guard lock(state.mutex);
+    for (const std::unique_ptr<EventRing> &ring : state.rings)
+        appendEvents(*ring, &result);
+
+    std::ranges::stable_sort(result, std::less(), &ProfilerEvent::startNs);
+    return result;
+}
+
+std::vector<ProfilerEvent> Profiler::lastFrameEvents(int64_t *frameStartNs, int64_t *frameEndNs) {
+    {
+        ProfilerState &state = profilerState();
+        std::lock_guard lock(state.mutex);
+        *frameStartNs = state.prevFrameStartNs;
+        *frameEndNs = state.lastFrameStartNs;
+    }
+
+    if (*frameStartNs < 0)
+        return {};
+
+    std::vector<ProfilerEvent> result = events();
+    std::erase_if(result, [&](const ProfilerEvent &event) {
+        return event.startNs < *frameStartNs || event.startNs >= *frameEndNs;
+    });
+    return result;
+}
+
+void Profiler::clear() {
+    ProfilerState &state = profilerState();
+    std::lock_guard lock(state.mutex);
+    for (const std::unique_ptr<EventRing> &ring : state.rings)
+        ring->written = 0;
+    state.generation++;
+    state.prevFrameStartNs = -1;
+    state.lastFrameStartNs = -1;
+}
+
+size_t Profiler::threadBufferCount() {
+    ProfilerState &state = profilerState();
+    std::lock_guard lock(state.mutex);
+    return state.rings.size();
+}
+
+void Profiler::writeChromeTrace(OutputStream *dst) {
+    std::vector<ProfilerEvent> events = Profiler::events();
+    int64_t baseNs = events.empty() ? 0 : events.front().startNs;
+
+    dst->write("{\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); i++) {
+        const ProfilerEvent &event = events[i];
+        dst->write(fmt::format("{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{},"
+                               "\"args\":{{\"allocations\":{},\"allocated_bytes\":{}}}}}{}\n",
+                               escapeJson(event.name), (event.startNs - baseNs) / 1000.0,
+                               (event.endNs - event.startNs) / 1000.0, event.threadId,
+                               event.allocations.count, event.allocations.bytes,
+                               i + 1 == events.size() ? "" : ","));
+    }
+    dst->write("],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+void ProfilerScope::begin(const char *name) {
+    _name = name;
+    _depth = threadDepth++;
+    _startAllocations = AllocationTracker::threadStats();
+    _startNs = Profiler::now();
+}
+
+void ProfilerScope::end() {
+    int64_t endNs = Profiler::now();
+    threadDepth--;
+    Profiler::record(_name, _startNs, endNs, _depth, AllocationTracker::threadStats() - _startAllocations);
+}
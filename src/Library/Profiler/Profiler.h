@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Utility/Memory/AllocationTracker.h"
+#include "Utility/Preprocessor.h"
+
+class OutputStream;
+
+struct ProfilerEvent {
+    const char *name = nullptr; // Zone name, a string literal.
+    int64_t startNs = 0;
+    int64_t endNs = 0;
+    int depth = 0; // Zone nesting depth, top level zones have depth 0.
+    int threadId = 0; // Profiler thread id, threads are numbered in the order they've recorded their first zone.
+    AllocationStats allocations; // Allocations made inside the zone & its children, zero if tracking is off.
+};
+
+/**
+ * Low-overhead hierarchical profiler.
+ *
+ * Zones are recorded into per-thread ring buffers, so the profiler only keeps the last
+ * `Profiler::THREAD_BUFFER_CAPACITY` zones for each thread. Recording a zone doesn't lock anything, zones are
+ * collected in a small thread-local buffer and handed off to the ring buffer when a top level zone ends. Ring buffers
+ * of the threads that have exited are reused by new threads. Recording is off by default, and when it's off entering
+ * a zone costs a single relaxed atomic load. Zones can also be compiled out completely by turning off the
+ * `OE_USE_PROFILER` CMake option.
+ *
+ * Use `MM_PROFILE_ZONE` to instrument the code:
+ * ```
+ * void Engine::Draw() {
+ *     MM_PROFILE_ZONE("Engine::Draw");
+ *     ...
+ * }
+ * ```
+ */
+class Profiler {
+ public:
+    static constexpr size_t THREAD_BUFFER_CAPACITY = 65536;
+
+    [[nodiscard]] static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    static void setEnabled(bool enabled);
+
+    /**
+     * @return                          Current profiler timestamp, in nanoseconds.
+     */
+    [[nodiscard]] static int64_t now();
+
+    /**
+     * Records a single zone for the current thread. Normally you don't need to call this function directly, use
+     * `MM_PROFILE_ZONE` instead.
+     */
+    static void record(const char *name, int64_t startNs, int64_t endNs, int depth, AllocationStats allocations = {});
+
+    /**
+     * Marks the start of a new frame. Should be called from the main thread.
+     */
+    static void markFrame();
+
+    /**
+     * @return                          All zones that are currently in the ring buffers, for all threads, ordered by
+     *                                  start time.
+     */
+    [[nodiscard]] static std::vector<ProfilerEvent> events();
+
+    /**
+     * @param[out] frameStartNs         Start of the last complete frame.
+     * @param[out] frameEndNs           End of the last complete frame.
+     * @return                          Zones that started during the last complete frame, ordered by start time.
+     *                                  Returns an empty vector if no frames were completed yet.
+     */
+    [[nodiscard]] static std::vector<ProfilerEvent> lastFrameEvents(int64_t *frameStartNs, int64_t *frameEndNs);
+
+    /**
+     * Drops all recorded zones & frames.
+     */
+    static void clear();
+
+    /**
+     * @return                          Number of per-thread ring buffers allocated so far. This is the maximal number
+     *                                  of threads that were recording zones at the same time.
+     */
+    [[nodiscard]] static size_t threadBufferCount();
+
+    /**
+     * Writes out all zones that are currently in the ring buffers in Chrome trace event format. The result can be
+     * opened in `chrome://tracing` or in Perfetto UI.
+     *
+     * @param dst                       Stream to write to.
+     */
+    static void writeChromeTrace(OutputStream *dst);
+
+ private:
+    static inline std::atomic<bool> _enabled = false;
+};
+
+/**
+ * RAII profiler zone, see `MM_PROFILE_ZONE`.
+ */
+class ProfilerScope {
+ public:
+    explicit ProfilerScope(const char *name) {
+        if (Profiler::isEnabled())
+            begin(name);
+    }
+
+    ~ProfilerScope() {
+        if (_name)
+            end();
+    }
+
+    ProfilerScope(const ProfilerScope &) = delete;
+    ProfilerScope &operator=(const ProfilerScope &) = delete;
+
+ private:
+    void begin(const char *name);
+    void end();
+
+ private:
+    const char *_name = nullptr;
+    int64_t _startNs = 0;
+    AllocationStats _startAllocations;
+    int _depth = 0;
+};
+
+#ifdef OE_USE_PROFILER
+#   define MM_PROFILE_ZONE(NAME) ProfilerScope MM_PP_CAT(profilerScope, __LINE__)(NAME)
+#else
+#   define MM_PROFILE_ZONE(NAME) static_cast<void>(0)
+#endif
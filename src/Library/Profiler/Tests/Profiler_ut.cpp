@@ -0,0 +1,134 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Profiler/Profiler.h"
+
+#include "Utility/Streams/StringOutputStream.h"
+#include "Utility/ScopeGuard.h"
+
+UNIT_TEST(Profiler, NestedZones) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    MM_AT_SCOPE_EXIT(Profiler::setEnabled(false));
+
+    {
+        ProfilerScope outer("outer");
+        ProfilerScope inner("inner");
+    }
+
+    std::vector<ProfilerEvent> events = Profiler::events();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(std::string(events[0].name), "outer");
+    EXPECT_EQ(events[0].depth, 0);
+    EXPECT_EQ(std::string(events[1].name), "inner");
+    EXPECT_EQ(events[1].depth, 1);
+    EXPECT_LE(events[0].startNs, events[1].startNs);
+    EXPECT_GE(events[0].endNs, events[1].endNs);
+}
+
+UNIT_TEST(Profiler, Disabled) {
+    Profiler::clear();
+    Profiler::setEnabled(false);
+
+    {
+        ProfilerScope zone("zone");
+    }
+
+    EXPECT_TRUE(Profiler::events().empty());
+}
+
+UNIT_TEST(Profiler, RingBuffer) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    MM_AT_SCOPE_EXIT(Profiler::setEnabled(false));
+
+    for (size_t i = 0; i < Profiler::THREAD_BUFFER_CAPACITY + 10; i++)
+        Profiler::record("zone", i, i + 1, 0);
+
+    std::vector<ProfilerEvent> events = Profiler::events();
+    ASSERT_EQ(events.size(), Profiler::THREAD_BUFFER_CAPACITY);
+    EXPECT_EQ(events.front().startNs, 10);
+    EXPECT_EQ(events.back().startNs, Profiler::THREAD_BUFFER_CAPACITY + 9);
+}
+
+UNIT_TEST(Profiler, Threads) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    MM_AT_SCOPE_EXIT(Profiler::setEnabled(false));
+
+    {
+        ProfilerScope zone("main");
+    }
+    std::thread([] {
+        ProfilerScope zone("worker");
+    }).join();
+
+    std::vector<ProfilerEvent> events = Profiler::events();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].threadId, events[1].threadId);
+}
+
+UNIT_TEST(Profiler, ThreadBuffersAreReused) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    MM_AT_SCOPE_EXIT(Profiler::setEnabled(false));
+
+    {
+        ProfilerScope zone("main");
+    }
+    std::thread([] {
+        ProfilerScope zone("worker");
+    }).join();
+    size_t bufferCount = Profiler::threadBufferCount();
+
+    for (int i = 0; i < 10; i++) {
+        std::thread([] {
+            ProfilerScope zone("worker");
+            ProfilerScope nested("nested");
+        }).join();
+    }
+
+    EXPECT_EQ(Profiler::threadBufferCount(), bufferCount);
+    EXPECT_EQ(Profiler::events().size(), 22); // Zones of the exited threads are still there.
+}
+
+UNIT_TEST(Profiler, ChromeTrace) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    MM_AT_SCOPE_EXIT(Profiler::setEnabled(false));
+
+    Profiler::record("a\"b", 1000, 3000, 0);
+
+    std::string trace;
+    StringOutputStream stream(&trace);
+    Profiler::writeChromeTrace(&stream);
+    stream.close();
+
+    EXPECT_TRUE(trace.starts_with("{\"traceEvents\":["));
+    EXPECT_TRUE(trace.contains("\"name\":\"a\\\"b\",\"ph\":\"X\",\"ts\":0.000,\"dur\":2.000"));
+}
+
+UNIT_TEST(Profiler, Allocations) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+    AllocationTracker::setEnabled(true);
+    MM_AT_SCOPE_EXIT(Profiler::setEnabled(false));
+    MM_AT_SCOPE_EXIT(AllocationTracker::setEnabled(false));
+
+    {
+        ProfilerScope outer("outer");
+        AllocationTracker::record(100);
+        {
+            ProfilerScope inner("inner");
+            AllocationTracker::record(10);
+        }
+    }
+
+    std::vector<ProfilerEvent> events = Profiler::events();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].allocations, AllocationStats(2, 110));
+    EXPECT_EQ(events[1].allocations, AllocationStats(1, 10));
+}
@@ -0,0 +1,89 @@
+#include "PhiloxRandomEngine.h"
+
+#include <cassert>
+#include <memory>
+
+static constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+static constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+static constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+static constexpr int PHILOX_ROUNDS = 10;
+
+static uint64_t splitMix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+static int scale(uint32_t value, int hi) {
+    assert(hi > 0);
+    return static_cast<int>((static_cast<uint64_t>(value) * static_cast<uint64_t>(hi)) >> 32);
+}
+
+PhiloxRandomEngine::PhiloxRandomEngine() : _key(keyForSeed(0)) {}
+
+PhiloxRandomEngine::PhiloxRandomEngine(uint64_t key, uint64_t stream) : _key(key), _stream(stream) {}
+
+float PhiloxRandomEngine::randomFloat() {
+    return (next() >> 8) * (1.0f / 16777216.0f);
+}
+
+int PhiloxRandomEngine::random(int hi) {
+    return scale(next(), hi);
+}
+
+int PhiloxRandomEngine::peek(int hi) const {
+    if (_bufferPos < 4)
+        return scale(_buffer[_bufferPos], hi);
+    return scale(generate(_index)[0], hi);
+}
+
+void PhiloxRandomEngine::seed(int seed) {
+    *this = PhiloxRandomEngine(keyForSeed(seed), 0);
+}
+
+std::unique_ptr<RandomEngine> PhiloxRandomEngine::clone() const {
+    return std::make_unique<PhiloxRandomEngine>(*this);
+}
+
+PhiloxRandomEngine PhiloxRandomEngine::substream(uint64_t id) const {
+    return PhiloxRandomEngine(_key, splitMix64(_stream ^ splitMix64(id)));
+}
+
+std::array<uint32_t, 4> PhiloxRandomEngine::block(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        if (round > 0) {
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+
+        uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * counter[0];
+        uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * counter[2];
+        counter = {
+            static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+            static_cast<uint32_t>(p1),
+            static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+            static_cast<uint32_t>(p0)
+        };
+    }
+    return counter;
+}
+
+uint64_t PhiloxRandomEngine::keyForSeed(int seed) {
+    return splitMix64(static_cast<uint32_t>(seed));
+}
+
+uint32_t PhiloxRandomEngine::next() {
+    if (_bufferPos == 4) {
+        _buffer = generate(_index++);
+        _bufferPos = 0;
+    }
+    return _buffer[_bufferPos++];
+}
+
+std::array<uint32_t, 4> PhiloxRandomEngine::generate(uint64_t index) const {
+    return block({static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+                  static_cast<uint32_t>(_stream), static_cast<uint32_t>(_stream >> 32)},
+                 {static_cast<uint32_t>(_key), static_cast<uint32_t>(_key >> 32)});
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "RandomEngine.h"
+
+/**
+ * Counter-based random engine implementing Philox4x32-10, see "Parallel Random Numbers: As Easy as 1, 2, 3" by
+ * Salmon et al.
+ *
+ * Output is a pure function of `(key, stream, position)`, and there is no hidden state to drag along. This makes it
+ * possible to derive independent substreams with `substream`, and the numbers drawn from a substream don't depend on
+ * what's been drawn from its parent or from any other substream, or in which order.
+ */
+class PhiloxRandomEngine : public RandomEngine {
+ public:
+    PhiloxRandomEngine();
+
+    /**
+     * @param key                       Key, usually derived from the seed.
+     * @param stream                    Stream id, streams with different ids are independent.
+     */
+    PhiloxRandomEngine(uint64_t key, uint64_t stream);
+
+    virtual float randomFloat() override;
+    virtual int random(int hi) override;
+    virtual int peek(int hi) const override;
+    virtual void seed(int seed) override;
+    [[nodiscard]] virtual std::unique_ptr<RandomEngine> clone() const override;
+
+    /**
+     * @param id                        Substream id.
+     * @return                          New random engine that shares the key with this one, and that is positioned
+     *                                  at the start of a stream derived from this engine's stream and `id`. Doesn't
+     *                                  depend on how many numbers were drawn from this engine.
+     */
+    [[nodiscard]] PhiloxRandomEngine substream(uint64_t id) const;
+
+    [[nodiscard]] uint64_t key() const {
+        return _key;
+    }
+
+    [[nodiscard]] uint64_t stream() const {
+        return _stream;
+    }
+
+    /**
+     * Raw Philox4x32-10 block function.
+     *
+     * @param counter                   Counter block.
+     * @param key                       Key.
+     * @return                          Encrypted counter block.
+     */
+    [[nodiscard]] static std::array<uint32_t, 4> block(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key);
+
+    /**
+     * @param seed                      Random seed, as passed to `seed`.
+     * @return                          Key that this engine uses for the provided seed.
+     */
+    [[nodiscard]] static uint64_t keyForSeed(int seed);
+
+ private:
+    uint32_t next();
+    [[nodiscard]] std::array<uint32_t, 4> generate(uint64_t index) const;
+
+ private:
+    uint64_t _key = 0;
+    uint64_t _stream = 0;
+    uint64_t _index = 0; // Index of the next block to generate.
+    std::array<uint32_t, 4> _buffer = {};
+    int _bufferPos = 4; // Position of the next number in `_buffer`, `4` means the buffer is empty.
+};
@@ -42,6 +42,12 @@ class RandomEngine {
      */
     virtual void seed(int seed) = 0;
 
+    /**
+     * @return                          Copy of this random engine, including its current state. The copy produces
+     *                                  the same sequence of numbers as this engine would.
+     */
+    [[nodiscard]] virtual std::unique_ptr<RandomEngine> clone() const = 0;
+
     /**
      * @param min                       Minimal result value.
      * @param max                       Maximal result value. Must be greater or equal to `min`.
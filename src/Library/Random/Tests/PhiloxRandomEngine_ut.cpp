@@ -0,0 +1,78 @@
+#include <array>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Random/PhiloxRandomEngine.h"
+
+static std::vector<int> draw(PhiloxRandomEngine *rng, int count) {
+    std::vector<int> result;
+    for (int i = 0; i < count; i++)
+        result.push_back(rng->random(1000000));
+    return result;
+}
+
+UNIT_TEST(PhiloxRandomEngine, KnownAnswer) {
+    // Test vectors from the Random123 distribution.
+    std::array<uint32_t, 4> zero = PhiloxRandomEngine::block({0, 0, 0, 0}, {0, 0});
+    EXPECT_EQ(zero, (std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+
+    std::array<uint32_t, 4> ones = PhiloxRandomEngine::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                                             {0xffffffff, 0xffffffff});
+    EXPECT_EQ(ones, (std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+
+    std::array<uint32_t, 4> pi = PhiloxRandomEngine::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                                                           {0xa4093822, 0x299f31d0});
+    EXPECT_EQ(pi, (std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+UNIT_TEST(PhiloxRandomEngine, SeedZero) {
+    PhiloxRandomEngine a;
+    PhiloxRandomEngine b;
+    draw(&b, 10);
+    b.seed(0);
+    EXPECT_EQ(draw(&a, 10), draw(&b, 10));
+}
+
+UNIT_TEST(PhiloxRandomEngine, Peek) {
+    PhiloxRandomEngine rng;
+    for (int i = 0; i < 20; i++) {
+        int peeked = rng.peek(100);
+        EXPECT_EQ(peeked, rng.random(100));
+    }
+}
+
+UNIT_TEST(PhiloxRandomEngine, Range) {
+    PhiloxRandomEngine rng;
+    rng.seed(42);
+    for (int i = 0; i < 1000; i++) {
+        int value = rng.random(7);
+        EXPECT_GE(value, 0);
+        EXPECT_LT(value, 7);
+
+        float f = rng.randomFloat();
+        EXPECT_GE(f, 0.0f);
+        EXPECT_LT(f, 1.0f);
+    }
+}
+
+UNIT_TEST(PhiloxRandomEngine, Substreams) {
+    PhiloxRandomEngine parent;
+    parent.seed(123);
+
+    PhiloxRandomEngine a0 = parent.substream(1);
+    PhiloxRandomEngine b0 = parent.substream(2);
+    draw(&parent, 17); // Drawing from the parent shouldn't affect the substreams.
+    PhiloxRandomEngine b1 = parent.substream(2);
+    PhiloxRandomEngine a1 = parent.substream(1);
+
+    std::vector<int> a = draw(&a0, 10);
+    EXPECT_EQ(a, draw(&a1, 10));
+    EXPECT_EQ(draw(&b0, 10), draw(&b1, 10));
+    EXPECT_NE(a, draw(&b1, 10));
+
+    PhiloxRandomEngine other;
+    other.seed(124);
+    PhiloxRandomEngine c = other.substream(1);
+    EXPECT_NE(a, draw(&c, 10));
+}
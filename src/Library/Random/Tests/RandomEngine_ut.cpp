@@ -0,0 +1,37 @@
+#include <memory>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Random/MersenneTwisterRandomEngine.h"
+#include "Library/Random/PhiloxRandomEngine.h"
+#include "Library/Random/SequentialRandomEngine.h"
+
+static std::vector<int> draw(RandomEngine *rng, int count) {
+    std::vector<int> result;
+    for (int i = 0; i < count; i++)
+        result.push_back(rng->random(1000000));
+    return result;
+}
+
+static void checkClone(RandomEngine *rng) {
+    rng->seed(123);
+    draw(rng, 17);
+
+    std::unique_ptr<RandomEngine> copy = rng->clone();
+    EXPECT_EQ(draw(rng, 100), draw(copy.get(), 100));
+
+    // Copies are independent.
+    copy = rng->clone();
+    draw(copy.get(), 10);
+    EXPECT_NE(draw(rng, 10), draw(copy.get(), 10));
+}
+
+UNIT_TEST(RandomEngine, Clone) {
+    MersenneTwisterRandomEngine mersenneTwister;
+    PhiloxRandomEngine philox;
+    SequentialRandomEngine sequential;
+    checkClone(&mersenneTwister);
+    checkClone(&philox);
+    checkClone(&sequential);
+}
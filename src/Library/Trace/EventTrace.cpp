@@ -8,8 +8,12 @@
 #include "Library/Serialization/EnumSerialization.h"
 #include "Library/Json/Json.h"
 
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/BlobOutputStream.h"
+
 #include "Io/Key.h" // TODO(captainurist): doesn't belong here
 
+#include "EventTraceBinary.h"
 #include "PaintEvent.h"
 
 MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(Pointi, (
@@ -102,11 +106,28 @@ MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(PlatformResizeEvent, (
     (size, "size")
 ))
 
-MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(PaintEvent, (
-    (type, "type"),
-    (tickCount, "tickCount"),
-    (randomState, "randomState")
-))
+// Not using MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS here so that traces w/o state hashes don't get an empty
+// array in every paint event.
+void to_json(Json &json, const PaintEvent &value) {
+    nlohmann::to_json(json["type"], value.type);
+    nlohmann::to_json(json["tickCount"], value.tickCount);
+    nlohmann::to_json(json["randomState"], value.randomState);
+    if (!value.stateHashes.empty())
+        nlohmann::to_json(json["stateHashes"], value.stateHashes);
+}
+
+void from_json(const Json &json, PaintEvent &value) {
+    if (!json.is_object())
+        throwJsonDeserializationError(json, "PaintEvent");
+    if (json.contains("type"))
+        nlohmann::from_json(json["type"], value.type);
+    if (json.contains("tickCount"))
+        nlohmann::from_json(json["tickCount"], value.tickCount);
+    if (json.contains("randomState"))
+        nlohmann::from_json(json["randomState"], value.randomState);
+    if (json.contains("stateHashes"))
+        nlohmann::from_json(json["stateHashes"], value.stateHashes);
+}
 
 template<class Callable>
 inline void dispatchByEventType(PlatformEventType type, Callable &&callable) {
@@ -241,6 +262,36 @@ EventTrace EventTrace::fromJsonBlob(const Blob &blob, PlatformWindow *window) {
     return result;
 }
 
+Blob EventTrace::toBinaryBlob(const EventTrace &trace) {
+    Blob result;
+    BlobOutputStream stream(&result);
+    EventTraceBinaryWriter writer(&stream, trace.header);
+    for (const std::unique_ptr<PlatformEvent> &event : trace.events)
+        writer.write(event.get());
+    writer.close();
+    stream.close();
+    return result;
+}
+
+EventTrace EventTrace::fromBinaryBlob(const Blob &blob, PlatformWindow *window) {
+    BlobInputStream stream(blob);
+    EventTraceBinaryReader reader(&stream, window);
+
+    EventTrace result;
+    result.header = reader.header();
+    while (std::unique_ptr<PlatformEvent> event = reader.read())
+        result.events.push_back(std::move(event));
+    return result;
+}
+
+bool EventTrace::isBinaryBlob(const Blob &blob) {
+    return blob.string_view().starts_with(EVENT_TRACE_BINARY_MAGIC);
+}
+
+EventTrace EventTrace::fromBlob(const Blob &blob, PlatformWindow *window) {
+    return isBinaryBlob(blob) ? fromBinaryBlob(blob, window) : fromJsonBlob(blob, window);
+}
+
 bool EventTrace::isTraceable(const PlatformEvent *event) {
     bool result = false;
     dispatchByEventType(event->type, [&](auto) { result = true; }); // Callback not invoked => not supported.
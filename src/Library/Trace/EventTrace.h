@@ -54,6 +54,18 @@ struct EventTrace {
     static Blob toJsonBlob(const EventTrace &trace);
     static EventTrace fromJsonBlob(const Blob &blob, PlatformWindow *window);
 
+    /**
+     * @see EventTraceBinaryWriter
+     */
+    static Blob toBinaryBlob(const EventTrace &trace);
+    static EventTrace fromBinaryBlob(const Blob &blob, PlatformWindow *window);
+    static bool isBinaryBlob(const Blob &blob);
+
+    /**
+     * Loads a trace in either of the supported formats, json or binary.
+     */
+    static EventTrace fromBlob(const Blob &blob, PlatformWindow *window);
+
     static bool isTraceable(const PlatformEvent *event);
     static std::unique_ptr<PlatformEvent> cloneEvent(const PlatformEvent *event);
 
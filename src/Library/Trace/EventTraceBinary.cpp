@@ -0,0 +1,367 @@
+#include "EventTraceBinary.h"
+
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Library/Compression/Compression.h"
+#include "Library/Json/Json.h"
+
+#include "Utility/Streams/InputStream.h"
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/Exception.h"
+
+#include "PaintEvent.h"
+
+MM_DECLARE_JSON_SERIALIZATION_FUNCTIONS(EventTraceHeader)
+
+static constexpr uint8_t TRACE_VERSION = 1;
+
+/** Events are accumulated into blocks of about this size before being compressed & written out. */
+static constexpr size_t TRACE_BLOCK_SIZE = 64 * 1024;
+
+/** Sanity limit for the block & header sizes, anything larger is treated as a corrupted file. */
+static constexpr size_t TRACE_MAX_CHUNK_SIZE = 64 * 1024 * 1024;
+
+static uint64_t zigzagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static int64_t zigzagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+static void writeVarint(std::string *dst, uint64_t value) {
+    while (value >= 0x80) {
+        dst->push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    dst->push_back(static_cast<char>(value));
+}
+
+static void writeSigned(std::string *dst, int64_t value) {
+    writeVarint(dst, zigzagEncode(value));
+}
+
+static void writeFixed64(std::string *dst, uint64_t value) {
+    for (int i = 0; i < 8; i++)
+        dst->push_back(static_cast<char>(value >> (i * 8)));
+}
+
+static uint64_t readStreamVarint(InputStream *stream) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = 0;
+        stream->readOrFail(&byte, 1);
+        result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return result;
+    }
+    throw Exception("Invalid varint in binary trace '{}'", stream->displayPath());
+}
+
+namespace {
+
+/**
+ * Bounds-checked reader over a single decompressed block.
+ */
+class BlockReader {
+ public:
+    BlockReader(std::string_view data, size_t *pos) : _data(data), _pos(pos) {}
+
+    uint8_t readByte() {
+        if (*_pos >= _data.size())
+            throw Exception("Unexpected end of block in binary trace");
+        return static_cast<uint8_t>(_data[(*_pos)++]);
+    }
+
+    uint64_t readVarint() {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = readByte();
+            result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return result;
+        }
+        throw Exception("Invalid varint in binary trace");
+    }
+
+    int64_t readSigned() {
+        return zigzagDecode(readVarint());
+    }
+
+    uint64_t readFixed64() {
+        uint64_t result = 0;
+        for (int i = 0; i < 8; i++)
+            result |= static_cast<uint64_t>(readByte()) << (i * 8);
+        return result;
+    }
+
+ private:
+    std::string_view _data;
+    size_t *_pos = nullptr;
+};
+
+} // namespace
+
+EventTraceBinaryWriter::EventTraceBinaryWriter(OutputStream *stream, const EventTraceHeader &header,
+                                               EventTraceCompression compression) : _stream(stream), _compression(compression) {
+    assert(stream);
+
+    std::string prefix;
+    prefix += EVENT_TRACE_BINARY_MAGIC;
+    prefix.push_back(static_cast<char>(TRACE_VERSION));
+    prefix.push_back(static_cast<char>(std::to_underlying(compression)));
+
+    Json json;
+    to_json(json, header);
+    std::string headerString = json.dump();
+    writeVarint(&prefix, headerString.size());
+    prefix += headerString;
+
+    _stream->write(prefix);
+    _block.reserve(TRACE_BLOCK_SIZE + 1024);
+}
+
+EventTraceBinaryWriter::~EventTraceBinaryWriter() = default;
+
+void EventTraceBinaryWriter::write(const PlatformEvent *event) {
+    assert(_stream); // Not closed.
+
+    _block.push_back(static_cast<char>(std::to_underlying(event->type)));
+
+    switch (event->type) {
+    case EVENT_KEY_PRESS:
+    case EVENT_KEY_RELEASE: {
+        const PlatformKeyEvent *e = static_cast<const PlatformKeyEvent *>(event);
+        writeVarint(&_block, std::to_underlying(e->key));
+        writeVarint(&_block, static_cast<PlatformModifiers::underlying_type>(e->mods));
+        _block.push_back(e->isAutoRepeat);
+        break;
+    }
+    case EVENT_MOUSE_BUTTON_PRESS:
+    case EVENT_MOUSE_BUTTON_RELEASE:
+    case EVENT_MOUSE_MOVE: {
+        const PlatformMouseEvent *e = static_cast<const PlatformMouseEvent *>(event);
+        writeVarint(&_block, std::to_underlying(e->button));
+        writeVarint(&_block, static_cast<PlatformMouseButtons::underlying_type>(e->buttons));
+        writeSigned(&_block, static_cast<int64_t>(e->pos.x) - _lastMousePos.x);
+        writeSigned(&_block, static_cast<int64_t>(e->pos.y) - _lastMousePos.y);
+        _block.push_back(e->isDoubleClick);
+        _lastMousePos = e->pos;
+        break;
+    }
+    case EVENT_MOUSE_WHEEL: {
+        const PlatformWheelEvent *e = static_cast<const PlatformWheelEvent *>(event);
+        writeSigned(&_block, e->angleDelta.x);
+        writeSigned(&_block, e->angleDelta.y);
+        break;
+    }
+    case EVENT_WINDOW_MOVE: {
+        const PlatformMoveEvent *e = static_cast<const PlatformMoveEvent *>(event);
+        writeSigned(&_block, e->pos.x);
+        writeSigned(&_block, e->pos.y);
+        break;
+    }
+    case EVENT_WINDOW_RESIZE: {
+        const PlatformResizeEvent *e = static_cast<const PlatformResizeEvent *>(event);
+        writeSigned(&_block, e->size.w);
+        writeSigned(&_block, e->size.h);
+        break;
+    }
+    case EVENT_WINDOW_ACTIVATE:
+    case EVENT_WINDOW_DEACTIVATE:
+    case EVENT_WINDOW_CLOSE_REQUEST:
+        break;
+    case EVENT_PAINT: {
+        const PaintEvent *e = static_cast<const PaintEvent *>(event);
+        writeSigned(&_block, e->tickCount - _lastTickCount);
+        writeSigned(&_block, e->randomState);
+        writeVarint(&_block, e->stateHashes.size());
+        for (uint64_t hash : e->stateHashes)
+            writeFixed64(&_block, hash);
+        _lastTickCount = e->tickCount;
+        break;
+    }
+    default:
+        throw Exception("Event of type {} cannot be written into a binary trace", std::to_underlying(event->type));
+    }
+
+    if (_block.size() >= TRACE_BLOCK_SIZE)
+        flushBlock();
+}
+
+void EventTraceBinaryWriter::close() {
+    if (!_stream)
+        return;
+
+    flushBlock();
+
+    std::string terminator;
+    writeVarint(&terminator, 0);
+    _stream->write(terminator);
+    _stream->flush();
+    _stream = nullptr;
+}
+
+void EventTraceBinaryWriter::flushBlock() {
+    if (_block.empty())
+        return;
+
+    Blob stored;
+    if (_compression == TRACE_COMPRESSION_ZLIB) {
+        stored = zlib::compress(Blob::view(_block));
+        if (!stored)
+            throw Exception("Failed to compress binary trace block");
+    } else {
+        stored = Blob::view(_block);
+    }
+
+    std::string blockHeader;
+    writeVarint(&blockHeader, _block.size());
+    writeVarint(&blockHeader, stored.size());
+    _stream->write(blockHeader);
+    _stream->write(stored);
+
+    _block.clear();
+}
+
+EventTraceBinaryReader::EventTraceBinaryReader(InputStream *stream, PlatformWindow *window) : _stream(stream), _window(window) {
+    assert(stream);
+
+    char prefix[6];
+    _stream->readOrFail(prefix, sizeof(prefix));
+    if (std::string_view(prefix, 4) != EVENT_TRACE_BINARY_MAGIC)
+        throw Exception("File '{}' is not a binary trace", _stream->displayPath());
+
+    uint8_t version = prefix[4];
+    if (version != TRACE_VERSION)
+        throw Exception("Binary trace '{}' has unsupported version {}", _stream->displayPath(), version);
+
+    uint8_t compression = prefix[5];
+    if (compression != std::to_underlying(TRACE_COMPRESSION_NONE) && compression != std::to_underlying(TRACE_COMPRESSION_ZLIB))
+        throw Exception("Binary trace '{}' uses unsupported compression {}", _stream->displayPath(), compression);
+    _compression = static_cast<EventTraceCompression>(compression);
+
+    size_t headerSize = readStreamVarint(_stream);
+    if (headerSize > TRACE_MAX_CHUNK_SIZE)
+        throw Exception("Binary trace '{}' is corrupted", _stream->displayPath());
+    std::string headerString(headerSize, '\0');
+    _stream->readOrFail(headerString.data(), headerSize);
+    from_json(Json::parse(headerString), _header);
+}
+
+EventTraceBinaryReader::~EventTraceBinaryReader() = default;
+
+std::unique_ptr<PlatformEvent> EventTraceBinaryReader::read() {
+    if (_blockPos == _block.size() && !readBlock())
+        return nullptr;
+
+    BlockReader reader(_block, &_blockPos);
+    PlatformEventType type = static_cast<PlatformEventType>(reader.readByte());
+
+    auto makeWindowEvent = [&]<class T>(std::unique_ptr<T> event) {
+        event->type = type;
+        event->window = _window;
+        return event;
+    };
+
+    switch (type) {
+    case EVENT_KEY_PRESS:
+    case EVENT_KEY_RELEASE: {
+        auto e = makeWindowEvent(std::make_unique<PlatformKeyEvent>());
+        e->key = static_cast<PlatformKey>(reader.readVarint());
+        e->mods = PlatformModifiers(static_cast<PlatformModifiers::underlying_type>(reader.readVarint()));
+        e->isAutoRepeat = reader.readByte();
+        return e;
+    }
+    case EVENT_MOUSE_BUTTON_PRESS:
+    case EVENT_MOUSE_BUTTON_RELEASE:
+    case EVENT_MOUSE_MOVE: {
+        auto e = makeWindowEvent(std::make_unique<PlatformMouseEvent>());
+        e->button = static_cast<PlatformMouseButton>(reader.readVarint());
+        e->buttons = PlatformMouseButtons(static_cast<PlatformMouseButtons::underlying_type>(reader.readVarint()));
+        _lastMousePos.x += reader.readSigned();
+        _lastMousePos.y += reader.readSigned();
+        e->pos = _lastMousePos;
+        e->isDoubleClick = reader.readByte();
+        return e;
+    }
+    case EVENT_MOUSE_WHEEL: {
+        auto e = makeWindowEvent(std::make_unique<PlatformWheelEvent>());
+        e->angleDelta.x = reader.readSigned();
+        e->angleDelta.y = reader.readSigned();
+        return e;
+    }
+    case EVENT_WINDOW_MOVE: {
+        auto e = makeWindowEvent(std::make_unique<PlatformMoveEvent>());
+        e->pos.x = reader.readSigned();
+        e->pos.y = reader.readSigned();
+        return e;
+    }
+    case EVENT_WINDOW_RESIZE: {
+        auto e = makeWindowEvent(std::make_unique<PlatformResizeEvent>());
+        e->size.w = reader.readSigned();
+        e->size.h = reader.readSigned();
+        return e;
+    }
+    case EVENT_WINDOW_ACTIVATE:
+    case EVENT_WINDOW_DEACTIVATE:
+    case EVENT_WINDOW_CLOSE_REQUEST:
+        return makeWindowEvent(std::make_unique<PlatformWindowEvent>());
+    case EVENT_PAINT: {
+        auto e = std::make_unique<PaintEvent>();
+        e->type = type;
+        _lastTickCount += reader.readSigned();
+        e->tickCount = _lastTickCount;
+        e->randomState = reader.readSigned();
+        size_t hashCount = reader.readVarint();
+        if (hashCount > _block.size())
+            throw Exception("Binary trace '{}' is corrupted", _stream->displayPath());
+        e->stateHashes.resize(hashCount);
+        for (uint64_t &hash : e->stateHashes)
+            hash = reader.readFixed64();
+        return e;
+    }
+    default:
+        throw Exception("Binary trace '{}' contains an event of unknown type {}", _stream->displayPath(), std::to_underlying(type));
+    }
+}
+
+bool EventTraceBinaryReader::readBlock() {
+    if (_finished)
+        return false;
+
+    _block.clear();
+    _blockPos = 0;
+
+    size_t rawSize = readStreamVarint(_stream);
+    if (rawSize == 0) {
+        _finished = true;
+        return false;
+    }
+
+    size_t storedSize = readStreamVarint(_stream);
+    if (rawSize > TRACE_MAX_CHUNK_SIZE || storedSize > TRACE_MAX_CHUNK_SIZE)
+        throw Exception("Binary trace '{}' is corrupted", _stream->displayPath());
+
+    Blob stored = Blob::read(_stream, storedSize);
+    if (stored.size() != storedSize)
+        throw Exception("Unexpected end of binary trace '{}'", _stream->displayPath());
+
+    if (_compression == TRACE_COMPRESSION_ZLIB) {
+        Blob raw = zlib::uncompress(stored, rawSize);
+        if (raw.size() != rawSize)
+            throw Exception("Failed to decompress block in binary trace '{}'", _stream->displayPath());
+        _block = raw.string_view();
+    } else {
+        if (storedSize != rawSize)
+            throw Exception("Binary trace '{}' is corrupted", _stream->displayPath());
+        _block = stored.string_view();
+    }
+
+    return true;
+}
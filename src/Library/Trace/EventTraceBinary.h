@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "Library/Geometry/Point.h"
+
+#include "EventTrace.h"
+
+class InputStream;
+class OutputStream;
+
+enum class EventTraceCompression : uint8_t {
+    TRACE_COMPRESSION_NONE = 0,
+    TRACE_COMPRESSION_ZLIB = 1,
+};
+using enum EventTraceCompression;
+
+/** Magic bytes that binary traces start with. */
+inline constexpr std::string_view EVENT_TRACE_BINARY_MAGIC = "OETR";
+
+/**
+ * Writer for the binary event trace format.
+ *
+ * The format is a compact alternative to the json traces. It starts with a small fixed header (magic, version,
+ * compression), followed by the trace header stored as json, and then by a sequence of blocks with the events.
+ * Each block is `[varint rawSize][varint storedSize][data]`, with a zero `rawSize` marking the end of the stream.
+ * Blocks are compressed independently, so traces can be written & read in a streaming fashion.
+ *
+ * Inside the blocks events are stored back to back. Integers are varint-encoded, tick counts are delta-encoded
+ * relative to the previous paint event, and mouse positions are delta-encoded relative to the previous mouse event.
+ */
+class EventTraceBinaryWriter {
+ public:
+    EventTraceBinaryWriter(OutputStream *stream, const EventTraceHeader &header,
+                           EventTraceCompression compression = TRACE_COMPRESSION_ZLIB);
+    ~EventTraceBinaryWriter();
+
+    /**
+     * @param event                     Event to write. Must be traceable, see `EventTrace::isTraceable`.
+     */
+    void write(const PlatformEvent *event);
+
+    /**
+     * Flushes the last block and writes the end-of-stream marker. Doesn't close the underlying stream.
+     */
+    void close();
+
+ private:
+    void flushBlock();
+
+ private:
+    OutputStream *_stream = nullptr;
+    EventTraceCompression _compression = TRACE_COMPRESSION_NONE;
+    std::string _block;
+    int64_t _lastTickCount = 0;
+    Pointi _lastMousePos;
+};
+
+/**
+ * Reader for the binary event trace format.
+ *
+ * @see EventTraceBinaryWriter
+ */
+class EventTraceBinaryReader {
+ public:
+    /**
+     * Reads the trace header from the provided stream.
+     *
+     * @param stream                    Stream to read from.
+     * @param window                    Window to set for the window events.
+     * @throws Exception                On error.
+     */
+    EventTraceBinaryReader(InputStream *stream, PlatformWindow *window);
+    ~EventTraceBinaryReader();
+
+    [[nodiscard]] const EventTraceHeader &header() const {
+        return _header;
+    }
+
+    /**
+     * @return                          Next event in the trace, or `nullptr` if the end of the trace was reached.
+     * @throws Exception                On error.
+     */
+    [[nodiscard]] std::unique_ptr<PlatformEvent> read();
+
+ private:
+    bool readBlock();
+
+ private:
+    InputStream *_stream = nullptr;
+    PlatformWindow *_window = nullptr;
+    EventTraceHeader _header;
+    EventTraceCompression _compression = TRACE_COMPRESSION_NONE;
+    std::string _block;
+    size_t _blockPos = 0;
+    bool _finished = false;
+    int64_t _lastTickCount = 0;
+    Pointi _lastMousePos;
+};
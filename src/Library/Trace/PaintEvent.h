@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "Library/Platform/Interface/PlatformEvents.h"
 
@@ -14,4 +15,8 @@ class PaintEvent : public PlatformEvent {
 
     /** Random state at the start of the next frame, as returned by `grng->peek(1024)`. */
     int randomState = -1;
+
+    /** Per-subsystem hashes of the game state at the end of the frame, see `EngineTraceStateAccessor::makeStateHashes`.
+     * Empty if state hashing was disabled when the trace was recorded. */
+    std::vector<uint64_t> stateHashes;
 };
@@ -0,0 +1,119 @@
+#include <memory>
+#include <utility>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Trace/EventTrace.h"
+#include "Library/Trace/EventTraceBinary.h"
+#include "Library/Trace/PaintEvent.h"
+
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/BlobOutputStream.h"
+
+static EventTrace makeTestTrace(int paintCount) {
+    EventTrace result;
+    result.header.saveFileSize = 12345;
+    result.header.afterLoadRandomState = 42;
+    result.header.startState.locationName = "out01.odm";
+    result.header.startState.partyPosition = Vec3i(-100, 200, 300);
+
+    for (int i = 0; i < paintCount; i++) {
+        auto mouse = std::make_unique<PlatformMouseEvent>();
+        mouse->type = i % 3 == 0 ? EVENT_MOUSE_BUTTON_PRESS : EVENT_MOUSE_MOVE;
+        mouse->button = i % 3 == 0 ? BUTTON_LEFT : BUTTON_NONE;
+        mouse->buttons = i % 3 == 0 ? BUTTON_LEFT : BUTTON_NONE;
+        mouse->pos = Pointi((i * 7) % 640, 480 - (i * 13) % 480);
+        mouse->isDoubleClick = i % 11 == 0;
+        result.events.push_back(std::move(mouse));
+
+        if (i % 5 == 0) {
+            auto key = std::make_unique<PlatformKeyEvent>();
+            key->type = EVENT_KEY_PRESS;
+            key->key = PlatformKey::KEY_A;
+            key->mods = MOD_SHIFT | MOD_CTRL;
+            key->isAutoRepeat = i % 2 == 0;
+            result.events.push_back(std::move(key));
+        }
+
+        if (i % 17 == 0) {
+            auto wheel = std::make_unique<PlatformWheelEvent>();
+            wheel->type = EVENT_MOUSE_WHEEL;
+            wheel->angleDelta = Pointi(0, -120);
+            result.events.push_back(std::move(wheel));
+
+            auto activate = std::make_unique<PlatformWindowEvent>();
+            activate->type = EVENT_WINDOW_ACTIVATE;
+            result.events.push_back(std::move(activate));
+        }
+
+        auto paint = std::make_unique<PaintEvent>();
+        paint->type = EVENT_PAINT;
+        paint->tickCount = 16 * i + (i % 4);
+        paint->randomState = i * 1000003;
+        if (i % 2 == 0)
+            paint->stateHashes = {0xCBF29CE484222325ull ^ i, 0xFFFFFFFFFFFFFFFFull, 0};
+        result.events.push_back(std::move(paint));
+    }
+
+    return result;
+}
+
+static void expectSameTrace(const EventTrace &l, const EventTrace &r) {
+    // Json is the reference format, so we compare via json.
+    EXPECT_EQ(EventTrace::toJsonBlob(l).string_view(), EventTrace::toJsonBlob(r).string_view());
+}
+
+UNIT_TEST(EventTraceBinary, RoundTrip) {
+    // 5000 frames is enough to span several blocks.
+    EventTrace trace = makeTestTrace(5000);
+
+    Blob binary = EventTrace::toBinaryBlob(trace);
+    EXPECT_TRUE(EventTrace::isBinaryBlob(binary));
+    EXPECT_LT(binary.size(), EventTrace::toJsonBlob(trace).size() / 10);
+
+    EventTrace loaded = EventTrace::fromBlob(binary, nullptr);
+    expectSameTrace(trace, loaded);
+}
+
+UNIT_TEST(EventTraceBinary, RoundTripUncompressed) {
+    EventTrace trace = makeTestTrace(100);
+
+    Blob binary;
+    BlobOutputStream output(&binary);
+    EventTraceBinaryWriter writer(&output, trace.header, TRACE_COMPRESSION_NONE);
+    for (const std::unique_ptr<PlatformEvent> &event : trace.events)
+        writer.write(event.get());
+    writer.close();
+    output.close();
+
+    BlobInputStream input(binary);
+    EventTraceBinaryReader reader(&input, nullptr);
+    EXPECT_EQ(reader.header().saveFileSize, 12345);
+
+    EventTrace loaded;
+    loaded.header = reader.header();
+    while (std::unique_ptr<PlatformEvent> event = reader.read())
+        loaded.events.push_back(std::move(event));
+    EXPECT_EQ(reader.read(), nullptr);
+
+    expectSameTrace(trace, loaded);
+}
+
+UNIT_TEST(EventTraceBinary, EmptyTrace) {
+    EventTrace trace;
+    EventTrace loaded = EventTrace::fromBinaryBlob(EventTrace::toBinaryBlob(trace), nullptr);
+    EXPECT_TRUE(loaded.events.empty());
+}
+
+UNIT_TEST(EventTraceBinary, JsonStillLoads) {
+    EventTrace trace = makeTestTrace(10);
+    Blob json = EventTrace::toJsonBlob(trace);
+    EXPECT_FALSE(EventTrace::isBinaryBlob(json));
+    expectSameTrace(trace, EventTrace::fromBlob(json, nullptr));
+}
+
+UNIT_TEST(EventTraceBinary, TruncatedTraceThrows) {
+    Blob binary = EventTrace::toBinaryBlob(makeTestTrace(100));
+    Blob truncated = Blob::copy(binary.data(), binary.size() - 5);
+    EXPECT_ANY_THROW((void) EventTrace::fromBinaryBlob(truncated, nullptr));
+}
@@ -0,0 +1,85 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Tsv/TsvTable.h"
+
+static std::vector<std::string> cells(TsvRow row) {
+    return std::vector<std::string>(row.begin(), row.end());
+}
+
+UNIT_TEST(TsvTable, Parse) {
+    TsvTable table = TsvTable::parse(Blob::fromString("Header\tLine\r\n1\t\"Sword\"\t\r\n\r\n2\tA\nB\r\n"));
+
+    EXPECT_EQ(table.size(), 5);
+    EXPECT_EQ(cells(table[0]), std::vector<std::string>({"Header", "Line"}));
+    EXPECT_EQ(cells(table[1]), std::vector<std::string>({"1", "\"Sword\"", ""}));
+    EXPECT_EQ(cells(table[2]), std::vector<std::string>({""}));
+    EXPECT_EQ(cells(table[3]), std::vector<std::string>({"2", "A\nB"}));
+    EXPECT_EQ(cells(table[4]), std::vector<std::string>({""}));
+
+    EXPECT_EQ(table[1][5], "");
+}
+
+UNIT_TEST(TsvTable, ParseSkipsEmptyRows) {
+    // Consecutive \r's are collapsed, just like strtok does.
+    TsvTable table = TsvTable::parse(Blob::fromString("\r\r1\r\r\r\n2"));
+
+    EXPECT_EQ(table.size(), 2);
+    EXPECT_EQ(table[0][0], "1");
+    EXPECT_EQ(table[1][0], "2");
+}
+
+UNIT_TEST(TsvTable, ParseEmpty) {
+    TsvTable table = TsvTable::parse(Blob());
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.size(), 0);
+}
+
+UNIT_TEST(TsvTable, CompileRoundTrip) {
+    TsvTable table = TsvTable::parse(Blob::fromString("a\tb\tc\r\n\td\r\n\r\nlast"));
+    uint64_t hash = TsvTable::hash("source");
+
+    TsvTable compiled = TsvTable::fromCompiled(table.compile(hash), hash);
+    EXPECT_EQ(compiled.size(), table.size());
+    for (size_t i = 0; i < table.size(); i++)
+        EXPECT_EQ(cells(compiled[i]), cells(table[i]));
+}
+
+UNIT_TEST(TsvTable, CompileHashMismatch) {
+    TsvTable table = TsvTable::parse(Blob::fromString("a\tb"));
+    Blob compiled = table.compile(TsvTable::hash("old"));
+
+    EXPECT_TRUE(TsvTable::fromCompiled(Blob::share(compiled), TsvTable::hash("new")).empty());
+    EXPECT_FALSE(TsvTable::fromCompiled(Blob::share(compiled), TsvTable::hash("old")).empty());
+    EXPECT_TRUE(TsvTable::fromCompiled(compiled.subBlob(0, compiled.size() - 1), TsvTable::hash("old")).empty());
+    EXPECT_TRUE(TsvTable::fromCompiled(Blob::fromString("a\tb"), TsvTable::hash("old")).empty());
+}
+
+UNIT_TEST(TsvTable, Reader) {
+    TsvTable table = TsvTable::parse(Blob::fromString("h\r\n1\r\n2\r\n3"));
+    TsvReader reader(table);
+
+    EXPECT_EQ(reader.readRow()[0], "h");
+    reader.skipRows(2);
+    EXPECT_EQ(reader.readRow()[0], "3");
+    EXPECT_TRUE(reader.atEnd());
+    EXPECT_ANY_THROW((void) reader.readRow());
+    EXPECT_ANY_THROW(reader.skipRows(1));
+}
+
+UNIT_TEST(TsvTable, ToInt) {
+    for (const char *s : {"0", "42", "-17", "+5", "  12", "\t7x", "x7", "", "-", "3.9", "2147483647", "-2147483648"})
+        EXPECT_EQ(tsvToInt(s), atoi(s)) << s;
+
+    EXPECT_EQ(tsvToInt(std::string_view("123456", 3)), 123);
+}
+
+UNIT_TEST(TsvTable, ToFloat) {
+    for (const char *s : {"0", "1.5", "-0.25", " 2e3", "x", ""})
+        EXPECT_EQ(tsvToFloat(s), static_cast<float>(atof(s))) << s;
+
+    EXPECT_EQ(tsvToFloat(std::string_view("1.25", 3)), 1.2f);
+}
@@ -0,0 +1,199 @@
+#include "TsvTable.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Utility/Memory/AllocationTracker.h"
+#include "Utility/Memory/FreeDeleter.h"
+#include "Utility/Exception.h"
+
+static constexpr char TSV_COMPILED_MAGIC[4] = {'O', 'E', 'T', 'T'};
+static constexpr uint32_t TSV_COMPILED_VERSION = 1;
+
+namespace {
+
+struct TsvCompiledHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t sourceHash;
+    uint32_t rowCount;
+    uint32_t cellCount;
+    uint32_t textSize;
+    uint32_t padding;
+};
+static_assert(sizeof(TsvCompiledHeader) == 32);
+
+// Compiled layout is the header, followed by uint32_t rowStarts[rowCount + 1], uint32_t cellEnds[cellCount], and then
+// by textSize bytes of concatenated cell contents.
+
+} // namespace
+
+TsvTable TsvTable::parse(Blob text) {
+    TsvTable result;
+    result._storage = std::move(text);
+    result._rowStarts.push_back(0);
+
+    std::string_view data = result._storage.string_view();
+    size_t pos = 0;
+    while (pos < data.size()) {
+        if (data[pos] == '\r') {
+            pos++; // Skip empty rows, like strtok does.
+            continue;
+        }
+
+        size_t end = data.find('\r', pos);
+        if (end == std::string_view::npos)
+            end = data.size();
+
+        std::string_view row = data.substr(pos, end - pos);
+        if (row.starts_with('\n'))
+            row.remove_prefix(1);
+
+        size_t cellStart = 0;
+        while (true) {
+            size_t cellEnd = row.find('\t', cellStart);
+            if (cellEnd == std::string_view::npos) {
+                result._cells.push_back(row.substr(cellStart));
+                break;
+            }
+            result._cells.push_back(row.substr(cellStart, cellEnd - cellStart));
+            cellStart = cellEnd + 1;
+        }
+        result._rowStarts.push_back(result._cells.size());
+
+        pos = end;
+    }
+
+    return result;
+}
+
+TsvTable TsvTable::fromCompiled(Blob compiled, uint64_t sourceHash) {
+    TsvCompiledHeader header;
+    if (compiled.size() < sizeof(header))
+        return {};
+    memcpy(&header, compiled.data(), sizeof(header));
+    if (memcmp(header.magic, TSV_COMPILED_MAGIC, sizeof(header.magic)) != 0 || header.version != TSV_COMPILED_VERSION ||
+        header.sourceHash != sourceHash)
+        return {};
+
+    size_t tableSize = sizeof(uint32_t) * (static_cast<size_t>(header.rowCount) + 1 + header.cellCount);
+    if (compiled.size() != sizeof(header) + tableSize + header.textSize)
+        return {};
+
+    const char *tables = static_cast<const char *>(compiled.data()) + sizeof(header);
+    const char *text = tables + tableSize;
+
+    TsvTable result;
+    result._rowStarts.resize(header.rowCount + 1);
+    memcpy(result._rowStarts.data(), tables, sizeof(uint32_t) * result._rowStarts.size());
+    if (result._rowStarts.front() != 0 || result._rowStarts.back() != header.cellCount)
+        return {};
+    for (size_t i = 1; i < result._rowStarts.size(); i++)
+        if (result._rowStarts[i] < result._rowStarts[i - 1])
+            return {};
+
+    std::vector<uint32_t> cellEnds(header.cellCount);
+    memcpy(cellEnds.data(), tables + sizeof(uint32_t) * result._rowStarts.size(), sizeof(uint32_t) * cellEnds.size());
+
+    result._cells.reserve(header.cellCount);
+    uint32_t cellStart = 0;
+    for (uint32_t cellEnd : cellEnds) {
+        if (cellEnd < cellStart || cellEnd > header.textSize)
+            return {};
+        result._cells.emplace_back(text + cellStart, cellEnd - cellStart);
+        cellStart = cellEnd;
+    }
+
+    result._storage = std::move(compiled);
+    return result;
+}
+
+Blob TsvTable::compile(uint64_t sourceHash) const {
+    size_t textSize = 0;
+    for (std::string_view cell : _cells)
+        textSize += cell.size();
+
+    TsvCompiledHeader header = {};
+    memcpy(header.magic, TSV_COMPILED_MAGIC, sizeof(header.magic));
+    header.version = TSV_COMPILED_VERSION;
+    header.sourceHash = sourceHash;
+    header.rowCount = size();
+    header.cellCount = _cells.size();
+    header.textSize = textSize;
+
+    std::vector<uint32_t> rowStarts = _rowStarts;
+    if (rowStarts.empty())
+        rowStarts.push_back(0);
+
+    size_t totalSize = sizeof(header) + sizeof(uint32_t) * (rowStarts.size() + _cells.size()) + textSize;
+    std::unique_ptr<void, FreeDeleter> memory(trackedMalloc(totalSize));
+    char *pos = static_cast<char *>(memory.get());
+
+    memcpy(pos, &header, sizeof(header));
+    pos += sizeof(header);
+
+    memcpy(pos, rowStarts.data(), sizeof(uint32_t) * rowStarts.size());
+    pos += sizeof(uint32_t) * rowStarts.size();
+
+    uint32_t cellEnd = 0;
+    for (std::string_view cell : _cells) {
+        cellEnd += cell.size();
+        memcpy(pos, &cellEnd, sizeof(cellEnd));
+        pos += sizeof(cellEnd);
+    }
+
+    for (std::string_view cell : _cells) {
+        memcpy(pos, cell.data(), cell.size());
+        pos += cell.size();
+    }
+
+    return Blob::fromMalloc(std::move(memory), totalSize);
+}
+
+uint64_t TsvTable::hash(std::string_view data) {
+    uint64_t result = 0xcbf29ce484222325ull;
+    for (char c : data) {
+        result ^= static_cast<unsigned char>(c);
+        result *= 0x100000001b3ull;
+    }
+    return result;
+}
+
+TsvRow TsvReader::readRow() {
+    if (atEnd())
+        throw Exception("Unexpected end of table '{}' at row {}", _table->displayPath(), _pos);
+    return (*_table)[_pos++];
+}
+
+void TsvReader::skipRows(size_t count) {
+    if (_table->size() - std::min(_pos, _table->size()) < count)
+        throw Exception("Unexpected end of table '{}' at row {}", _table->displayPath(), _table->size());
+    _pos += count;
+}
+
+int tsvToInt(std::string_view s) {
+    size_t pos = 0;
+    while (pos < s.size() && std::isspace(static_cast<unsigned char>(s[pos])))
+        pos++;
+
+    bool negative = false;
+    if (pos < s.size() && (s[pos] == '-' || s[pos] == '+')) {
+        negative = s[pos] == '-';
+        pos++;
+    }
+
+    unsigned int result = 0;
+    while (pos < s.size() && s[pos] >= '0' && s[pos] <= '9')
+        result = result * 10 + (s[pos++] - '0');
+
+    return static_cast<int>(negative ? 0u - result : result);
+}
+
+float tsvToFloat(std::string_view s) {
+    return atof(std::string(s).c_str());
+}
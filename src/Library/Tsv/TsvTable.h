@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "Utility/Memory/Blob.h"
+
+/**
+ * Single row of a `TsvTable`.
+ */
+class TsvRow {
+ public:
+    TsvRow() = default;
+    explicit TsvRow(std::span<const std::string_view> cells) : _cells(cells) {}
+
+    [[nodiscard]] size_t size() const {
+        return _cells.size();
+    }
+
+    /**
+     * @param index                     Cell index.
+     * @return                          Contents of the cell at `index`, or an empty string if the row doesn't have
+     *                                  that many cells.
+     */
+    [[nodiscard]] std::string_view operator[](size_t index) const {
+        return index < _cells.size() ? _cells[index] : std::string_view();
+    }
+
+    [[nodiscard]] auto begin() const {
+        return _cells.begin();
+    }
+
+    [[nodiscard]] auto end() const {
+        return _cells.end();
+    }
+
+ private:
+    std::span<const std::string_view> _cells;
+};
+
+/**
+ * Tab-separated text table, in the format used by the text files in `events.lod`.
+ *
+ * Rows are separated with `\r\n`. For compatibility with the original `strtok`-based loaders, empty rows that consist
+ * of a lone `\r` are skipped, and a bare `\n` is treated as a part of the cell's contents.
+ *
+ * Parsed tables don't copy the text, cells are views into the blob that the table was created from. A table can also
+ * be compiled into a binary blob that can be loaded back without any text parsing, see `compile` & `fromCompiled`.
+ */
+class TsvTable {
+ public:
+    TsvTable() = default;
+
+    /**
+     * @param text                      Table text.
+     * @return                          Parsed table. Takes ownership of the provided blob.
+     */
+    [[nodiscard]] static TsvTable parse(Blob text);
+
+    /**
+     * @param compiled                  Blob produced by `compile`.
+     * @param sourceHash                Hash of the source data that the caller expects the blob to be compiled from,
+     *                                  see `compile`.
+     * @return                          Table loaded from the provided blob, or an empty table if the blob is not a
+     *                                  compiled table or if its source hash doesn't match.
+     */
+    [[nodiscard]] static TsvTable fromCompiled(Blob compiled, uint64_t sourceHash);
+
+    /**
+     * @param sourceHash                Hash of the source data to store in the compiled blob. Usually this is
+     *                                  `hash` of the data that the text was loaded from.
+     * @return                          Compiled table. Cell contents are stored as is, with no separators.
+     */
+    [[nodiscard]] Blob compile(uint64_t sourceHash) const;
+
+    /**
+     * @return                          64-bit FNV-1a hash of the provided data, to be used as source hash for the
+     *                                  compiled tables.
+     */
+    [[nodiscard]] static uint64_t hash(std::string_view data);
+
+    [[nodiscard]] bool empty() const {
+        return _rowStarts.size() <= 1;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _rowStarts.empty() ? 0 : _rowStarts.size() - 1;
+    }
+
+    [[nodiscard]] TsvRow operator[](size_t index) const {
+        assert(index < size());
+        return TsvRow(std::span(_cells).subspan(_rowStarts[index], _rowStarts[index + 1] - _rowStarts[index]));
+    }
+
+    [[nodiscard]] std::string_view displayPath() const {
+        return _storage.displayPath();
+    }
+
+ private:
+    Blob _storage;
+    std::vector<uint32_t> _rowStarts; // Indices into `_cells`, with an extra element at the end.
+    std::vector<std::string_view> _cells;
+};
+
+/**
+ * Sequential reader for `TsvTable`. Several readers can walk the same table concurrently.
+ */
+class TsvReader {
+ public:
+    explicit TsvReader(const TsvTable &table) : _table(&table) {}
+
+    [[nodiscard]] bool atEnd() const {
+        return _pos >= _table->size();
+    }
+
+    /**
+     * @return                          Next row of the table.
+     * @throws Exception                If there are no more rows in the table.
+     */
+    TsvRow readRow();
+
+    /**
+     * @param count                     Number of rows to skip.
+     * @throws Exception                If there are less than `count` rows left in the table.
+     */
+    void skipRows(size_t count);
+
+ private:
+    const TsvTable *_table = nullptr;
+    size_t _pos = 0;
+};
+
+/**
+ * `atoi` for string views. Just like `atoi`, leading whitespace is skipped, parsing stops at the first non-digit
+ * character, and `0` is returned if there are no digits.
+ */
+int tsvToInt(std::string_view s);
+
+/**
+ * `atof` for string views, see `tsvToInt`.
+ */
+float tsvToFloat(std::string_view s);
@@ -23,6 +23,7 @@
 #include "Media/AudioBufferDataSource.h"
 
 #include "Library/Logger/Logger.h"
+#include "Library/Profiler/Profiler.h"
 
 #include "SoundList.h"
 #include "OpenALTrack16.h"
@@ -205,59 +206,63 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
 
     if (!loadSoundDataSource(si)) return;
 
-    PAudioSample sample = CreateAudioSample();
-
     SoundPlaybackResult result = SOUND_PLAYBACK_INVALID;
-    sample->SetVolume(uMasterVolume);
+    AudioSamplePlayback playback;
+    playback.volume = uMasterVolume;
+    playback.priority = SOUND_PRIORITY_INTERFACE;
 
     if (mode == SOUND_MODE_UI) {
-        result = _regularSoundPool.playNew(sample, si->dataSource);
+        result = _regularSoundPool.playNew(si->dataSource, playback);
     } else if (mode == SOUND_MODE_EXCLUSIVE) {
         _regularSoundPool.stopSoundId(eSoundID);
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        result = _regularSoundPool.playUniqueSoundId(si->dataSource, eSoundID, playback);
     } else if (mode == SOUND_MODE_NON_RESETTABLE) {
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        result = _regularSoundPool.playUniqueSoundId(si->dataSource, eSoundID, playback);
     } else if (mode == SOUND_MODE_WALKING) {
         if (_currentWalkingSample) {
             _currentWalkingSample->Stop();
+        } else {
+            _currentWalkingSample = CreateAudioSample();
         }
-        _currentWalkingSample = sample;
+        _currentWalkingSample->SetVolume(uMasterVolume);
         _currentWalkingSample->Open(si->dataSource);
         _currentWalkingSample->Play();
     } else if (mode == SOUND_MODE_MUSIC) {
-        sample->SetVolume(uMusicVolume);
+        playback.volume = uMusicVolume;
         _regularSoundPool.stopSoundId(eSoundID);
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        result = _regularSoundPool.playUniqueSoundId(si->dataSource, eSoundID, playback);
     } else if (mode == SOUND_MODE_SPEECH) {
-        sample->SetVolume(uVoiceVolume);
+        playback.volume = uVoiceVolume;
         _regularSoundPool.stopSoundId(eSoundID);
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        result = _regularSoundPool.playUniqueSoundId(si->dataSource, eSoundID, playback);
     } else if (mode == SOUND_MODE_HOUSE_DOOR || mode == SOUND_MODE_HOUSE_SPEECH) {
         pid = mode == SOUND_MODE_HOUSE_DOOR ? FAKE_HOUSE_DOOR_PID : FAKE_HOUSE_SPEECH_PID;
         _regularSoundPool.stopPid(pid);
-        _regularSoundPool.playUniquePid(sample, si->dataSource, pid);
+        _regularSoundPool.playUniquePid(si->dataSource, pid, playback);
     } else {
         assert(pid);
 
         ObjectType object_type = pid.type();
         int object_id = pid.id();
+        playback.priority = SOUND_PRIORITY_WORLD;
         switch (object_type) {
             case OBJECT_Door: {
                 assert(uCurrentlyLoadedLevelType == LEVEL_INDOOR);
                 assert((int)object_id < pIndoor->pDoors.size());
 
-                sample->SetPosition(pIndoor->pDoors[object_id].pXOffsets[0],
-                                    pIndoor->pDoors[object_id].pYOffsets[0],
-                                    pIndoor->pDoors[object_id].pZOffsets[0], MAX_SOUND_DIST);
+                playback.position = Vec3f(pIndoor->pDoors[object_id].pXOffsets[0],
+                                          pIndoor->pDoors[object_id].pYOffsets[0],
+                                          pIndoor->pDoors[object_id].pZOffsets[0]);
 
-                result = _regularSoundPool.playUniquePid(sample, si->dataSource, pid, true);
+                result = _regularSoundPool.playUniquePid(si->dataSource, pid, playback);
 
                 break;
             }
 
             case OBJECT_Character: {
-                sample->SetVolume(uVoiceVolume);
-                result = _voiceSoundPool.playUniquePid(sample, si->dataSource, pid);
+                playback.volume = uVoiceVolume;
+                playback.priority = SOUND_PRIORITY_INTERFACE;
+                result = _voiceSoundPool.playUniquePid(si->dataSource, pid, playback);
 
                 break;
             }
@@ -265,13 +270,11 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
             case OBJECT_Actor: {
                 assert(object_id < pActors.size());
 
-                sample->SetPosition(pActors[object_id].pos.x,
-                                    pActors[object_id].pos.y,
-                                    pActors[object_id].pos.z, MAX_SOUND_DIST);
+                playback.position = pActors[object_id].pos;
 
                 // TODO(pskelton): Vanilla sounds like it does unique id but as exclusives
                 // Actors play unique sounds between them. Avoids issues where in a real time mob you are hit with a cacophony of overlapping attack noises.
-                result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID, true);
+                result = _regularSoundPool.playUniqueSoundId(si->dataSource, eSoundID, playback);
 
                 break;
             }
@@ -279,11 +282,10 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
             case OBJECT_Decoration: {
                 assert(object_id < pLevelDecorations.size());
 
-                sample->SetPosition(pLevelDecorations[object_id].vPosition.x,
-                                    pLevelDecorations[object_id].vPosition.y,
-                                    pLevelDecorations[object_id].vPosition.z, MAX_SOUND_DIST);
+                playback.position = pLevelDecorations[object_id].vPosition;
+                playback.priority = SOUND_PRIORITY_AMBIENT;
 
-                result = _loopingSoundPool.playNew(sample, si->dataSource, true);
+                result = _loopingSoundPool.playNew(si->dataSource, playback);
 
                 break;
             }
@@ -291,22 +293,20 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
             case OBJECT_Item: {
                 assert(object_id < pSpriteObjects.size());
 
-                sample->SetPosition(pSpriteObjects[object_id].vPosition.x,
-                                    pSpriteObjects[object_id].vPosition.y,
-                                    pSpriteObjects[object_id].vPosition.z, MAX_SOUND_DIST);
+                playback.position = pSpriteObjects[object_id].vPosition;
 
-                result = _regularSoundPool.playUniquePid(sample, si->dataSource, pid, true);
+                result = _regularSoundPool.playUniquePid(si->dataSource, pid, playback);
                 break;
             }
 
             case OBJECT_Face: {
-                result = _regularSoundPool.playUniquePid(sample, si->dataSource, pid);
+                result = _regularSoundPool.playUniquePid(si->dataSource, pid, playback);
 
                 break;
             }
 
             default: {
-                result = _regularSoundPool.playNew(sample, si->dataSource);
+                result = _regularSoundPool.playNew(si->dataSource, playback);
                 logger->warning("Unexpected object type from Pid in playSound");
                 break;
             }
@@ -374,6 +374,7 @@ bool AudioPlayer::loadSoundDataSource(SoundInfo* si) {
 }
 
 void AudioPlayer::UpdateSounds() {
+    MM_PROFILE_ZONE("AudioPlayer::UpdateSounds");
     float pitch = M_PI * pParty->_viewPitch / 1024.f;
     float yaw = M_PI * pParty->_viewYaw / 1024.f;
 
@@ -423,6 +424,19 @@ bool AudioPlayer::isWalkingSoundPlays() {
     return false;
 }
 
+void AudioPlayer::suspendDevice() {
+    MusicPause();
+    if (provider)
+        provider->PauseDevice();
+}
+
+void AudioPlayer::resumeDevice() {
+    if (provider)
+        provider->ResumeDevice();
+    if (bPlayerReady)
+        UpdateVolumeFromConfig(); // This will also resume the music unless it's muted.
+}
+
 float AudioPlayer::getSoundLength(SoundId eSoundID) {
     SoundInfo* si = pSoundList->soundInfo(eSoundID);
     if (!si) {
@@ -435,9 +449,9 @@ float AudioPlayer::getSoundLength(SoundId eSoundID) {
         if (!loadSoundDataSource(si)) return 0.0f;
 
         // then force the sample to load/play to save codec info
-        PAudioSample sample = CreateAudioSample();
-        sample->SetVolume(0);
-        _regularSoundPool.playNew(sample, si->dataSource);
+        AudioSamplePlayback playback;
+        playback.volume = 0;
+        _regularSoundPool.playNew(si->dataSource, playback);
     }
 
      return si->dataSource->GetDuration();
@@ -46,6 +46,17 @@ class AudioPlayer {
     void soundDrain();
     bool isWalkingSoundPlays();
 
+    /**
+     * Pauses the music and the audio device, so that no audio threads are left running. This makes it safe to
+     * `fork` the process, see `ForkServer`.
+     */
+    void suspendDevice();
+
+    /**
+     * Undoes `suspendDevice`.
+     */
+    void resumeDevice();
+
     /**
      * Returns length of sound in seconds.
      *
@@ -147,9 +158,11 @@ class AudioPlayer {
     float uVoiceVolume = 0;
     PAudioTrack pCurrentMusicTrack;
 
-    AudioSamplePool _voiceSoundPool = AudioSamplePool(false);
-    AudioSamplePool _regularSoundPool = AudioSamplePool(false);
-    AudioSamplePool _loopingSoundPool = AudioSamplePool(true);
+    // OpenAL Soft has 256 sources by default, pool capacities should sum up to less than that, leaving some room for
+    // the walking sound & music.
+    AudioSamplePool _voiceSoundPool = AudioSamplePool(false, 16);
+    AudioSamplePool _regularSoundPool = AudioSamplePool(false, 128);
+    AudioSamplePool _loopingSoundPool = AudioSamplePool(true, 64);
     PAudioSample _currentWalkingSample;
     SndReader _sndReader;
 };
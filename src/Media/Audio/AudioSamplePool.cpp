@@ -1,76 +1,81 @@
 #include "AudioSamplePool.h"
 
-SoundPlaybackResult AudioSamplePool::playNew(PAudioSample sample, PAudioDataSource source, bool positional) {
-    update();
-    if (!sample->Open(source)) {
-        return SOUND_PLAYBACK_FAILED;
-    }
-    sample->Play(_looping, positional);
-    _samplePool.push_back(AudioSamplePoolEntry(sample, SOUND_Invalid, Pid()));
-    return SOUND_PLAYBACK_SUCCEEDED;
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+#include "OpenALSample16.h"
+#include "OpenALSoundProvider.h"
+
+AudioSamplePool::AudioSamplePool(bool looping, int capacity, SampleFactory sampleFactory) : _looping(looping) {
+    assert(capacity > 0);
+
+    _sampleFactory = sampleFactory ? std::move(sampleFactory) : SampleFactory(&CreateAudioSample);
+    _slots.resize(capacity);
+    _freeSlots.reserve(capacity);
+    for (int i = capacity - 1; i >= 0; i--)
+        _freeSlots.push_back(i);
+    _activeSlots.reserve(capacity);
+    _activeSoundIds.reserve(capacity);
+    _activePids.reserve(capacity);
 }
 
-SoundPlaybackResult AudioSamplePool::playUniqueSoundId(PAudioSample sample, PAudioDataSource source, SoundId id, bool positional) {
-    update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        if (entry.id == id) {
+SoundPlaybackResult AudioSamplePool::playNew(PAudioDataSource source, const AudioSamplePlayback &playback) {
+    return play(std::move(source), SOUND_Invalid, Pid(), playback);
+}
+
+SoundPlaybackResult AudioSamplePool::playUniqueSoundId(PAudioDataSource source, SoundId id,
+                                                       const AudioSamplePlayback &playback) {
+    auto pos = std::ranges::find(_activeSoundIds, id);
+    if (pos != _activeSoundIds.end()) {
+        int activeIndex = pos - _activeSoundIds.begin();
+        if (!_slots[_activeSlots[activeIndex]].sample->IsStopped())
             return SOUND_PLAYBACK_SKIPPED;
-        }
-    }
-    if (!sample->Open(source)) {
-        return SOUND_PLAYBACK_FAILED;
+        releaseSlot(activeIndex);
     }
-    sample->Play(_looping, positional);
-    _samplePool.push_back(AudioSamplePoolEntry(sample, id, Pid()));
-    return SOUND_PLAYBACK_SUCCEEDED;
+
+    return play(std::move(source), id, Pid(), playback);
 }
 
-SoundPlaybackResult AudioSamplePool::playUniquePid(PAudioSample sample, PAudioDataSource source, Pid pid, bool positional) {
-    update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        if (entry.pid == pid) {
+SoundPlaybackResult AudioSamplePool::playUniquePid(PAudioDataSource source, Pid pid,
+                                                   const AudioSamplePlayback &playback) {
+    auto pos = std::ranges::find(_activePids, pid);
+    if (pos != _activePids.end()) {
+        int activeIndex = pos - _activePids.begin();
+        if (!_slots[_activeSlots[activeIndex]].sample->IsStopped())
             return SOUND_PLAYBACK_SKIPPED;
-        }
-    }
-    if (!sample->Open(source)) {
-        return SOUND_PLAYBACK_FAILED;
+        releaseSlot(activeIndex);
     }
-    sample->Play(_looping, positional);
-    _samplePool.push_back(AudioSamplePoolEntry(sample, SOUND_Invalid, pid));
-    return SOUND_PLAYBACK_SUCCEEDED;
+
+    return play(std::move(source), SOUND_Invalid, pid, playback);
 }
 
 void AudioSamplePool::pause() {
     update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->Pause();
-    }
+    for (int slotIndex : _activeSlots)
+        _slots[slotIndex].sample->Pause();
 }
 
 void AudioSamplePool::resume() {
     update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->Resume();
-    }
+    for (int slotIndex : _activeSlots)
+        _slots[slotIndex].sample->Resume();
 }
 
 void AudioSamplePool::stop() {
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->Stop();
-    }
-    _samplePool.clear();
+    for (int slotIndex : _activeSlots)
+        _slots[slotIndex].sample->Stop();
+    while (!_activeSlots.empty())
+        releaseSlot(_activeSlots.size() - 1);
 }
 
 void AudioSamplePool::stopSoundId(SoundId soundId) {
     assert(soundId != SOUND_Invalid);
 
-    auto it = _samplePool.begin();
-    while (it != _samplePool.end()) {
-        if ((*it).id == soundId) {
-            (*it).samplePtr->Stop();
-            it = _samplePool.erase(it);
-        } else {
-            it++;
+    for (int i = _activeSoundIds.size() - 1; i >= 0; i--) {
+        if (_activeSoundIds[i] == soundId) {
+            _slots[_activeSlots[i]].sample->Stop();
+            releaseSlot(i);
         }
     }
 }
@@ -78,33 +83,104 @@ void AudioSamplePool::stopSoundId(SoundId soundId) {
 void AudioSamplePool::stopPid(Pid pid) {
     assert(pid != Pid());
 
-    auto it = _samplePool.begin();
-    while (it != _samplePool.end()) {
-        if ((*it).pid == pid) {
-            (*it).samplePtr->Stop();
-            it = _samplePool.erase(it);
-        } else {
-            it++;
+    for (int i = _activePids.size() - 1; i >= 0; i--) {
+        if (_activePids[i] == pid) {
+            _slots[_activeSlots[i]].sample->Stop();
+            releaseSlot(i);
         }
     }
 }
 
 void AudioSamplePool::update() {
-    auto it = _samplePool.begin();
-    std::erase_if(_samplePool, [](const AudioSamplePoolEntry& entry) { return entry.samplePtr->IsStopped(); });
+    for (int i = _activeSlots.size() - 1; i >= 0; i--)
+        if (_slots[_activeSlots[i]].sample->IsStopped())
+            releaseSlot(i);
 }
 
 void AudioSamplePool::setVolume(float value) {
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->SetVolume(value);
-    }
+    for (int slotIndex : _activeSlots)
+        _slots[slotIndex].sample->SetVolume(value);
 }
 
 bool AudioSamplePool::hasPlaying() {
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        if (!entry.samplePtr->IsStopped()) {
+    for (int slotIndex : _activeSlots)
+        if (!_slots[slotIndex].sample->IsStopped())
             return true;
+    return false;
+}
+
+SoundPlaybackResult AudioSamplePool::play(PAudioDataSource source, SoundId id, Pid pid,
+                                          const AudioSamplePlayback &playback) {
+    int slotIndex = acquireSlot(playback.priority);
+    if (slotIndex == -1)
+        return SOUND_PLAYBACK_SKIPPED;
+
+    Slot &slot = _slots[slotIndex];
+    if (!slot.sample)
+        slot.sample = _sampleFactory();
+
+    slot.sample->SetVolume(playback.volume);
+    if (playback.position)
+        slot.sample->SetPosition(playback.position->x, playback.position->y, playback.position->z, MAX_SOUND_DIST);
+
+    if (!slot.sample->Open(std::move(source))) {
+        _freeSlots.push_back(slotIndex);
+        return SOUND_PLAYBACK_FAILED;
+    }
+    slot.sample->Play(_looping, playback.position.has_value());
+    slot.priority = playback.priority;
+    slot.serial = _nextSerial++;
+
+    _activeSlots.push_back(slotIndex);
+    _activeSoundIds.push_back(id);
+    _activePids.push_back(pid);
+    return SOUND_PLAYBACK_SUCCEEDED;
+}
+
+int AudioSamplePool::acquireSlot(SoundPriority priority) {
+    if (_freeSlots.empty())
+        update();
+
+    if (_freeSlots.empty()) {
+        // Steal the oldest sound with the lowest priority.
+        int victim = -1;
+        for (int i = 0; i < _activeSlots.size(); i++) {
+            const Slot &slot = _slots[_activeSlots[i]];
+            if (slot.priority > priority)
+                continue;
+
+            if (victim == -1) {
+                victim = i;
+                continue;
+            }
+
+            const Slot &victimSlot = _slots[_activeSlots[victim]];
+            if (std::tie(slot.priority, slot.serial) < std::tie(victimSlot.priority, victimSlot.serial))
+                victim = i;
         }
+
+        if (victim == -1)
+            return -1;
+
+        _slots[_activeSlots[victim]].sample->Stop();
+        releaseSlot(victim);
+        _stolenCount++;
     }
-    return false;
+
+    int result = _freeSlots.back();
+    _freeSlots.pop_back();
+    return result;
+}
+
+void AudioSamplePool::releaseSlot(int activeIndex) {
+    _freeSlots.push_back(_activeSlots[activeIndex]);
+
+    // Swap & pop, order of active slots doesn't matter.
+    int last = _activeSlots.size() - 1;
+    _activeSlots[activeIndex] = _activeSlots[last];
+    _activeSoundIds[activeIndex] = _activeSoundIds[last];
+    _activePids[activeIndex] = _activePids[last];
+    _activeSlots.pop_back();
+    _activeSoundIds.pop_back();
+    _activePids.pop_back();
 }
@@ -1,28 +1,48 @@
 #pragma once
 
-#include <list>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
 
 #include "Engine/Pid.h"
 
 #include "Media/AudioSample.h"
 
-#include "SoundEnums.h"
+#include "Library/Geometry/Vec.h"
 
-struct AudioSamplePoolEntry {
-    AudioSamplePoolEntry(PAudioSample samplePtr, SoundId id, Pid pid) : samplePtr(samplePtr), id(id), pid(pid) {}
+#include "SoundEnums.h"
 
-    PAudioSample samplePtr;
-    SoundId id;
-    Pid pid;
+struct AudioSamplePlayback {
+    float volume = 1.0f;
+    std::optional<Vec3f> position; // Set for positional sounds.
+    SoundPriority priority = SOUND_PRIORITY_WORLD;
 };
 
+/**
+ * Fixed-capacity pool of playing sounds.
+ *
+ * Each slot owns an audio sample that is reused between playbacks, so playing a sound doesn't allocate. Slot keys
+ * (sound ids & pids) are stored in separate contiguous arrays, so lookups in `playUnique*` and `stop*` functions
+ * don't touch the slots themselves.
+ *
+ * When all slots are taken, the pool steals the slot of the oldest sound with the lowest priority, as long as that
+ * priority is not higher than the priority of the new sound. Otherwise the new sound is skipped.
+ */
 class AudioSamplePool {
  public:
-    explicit AudioSamplePool(bool looping):_looping(looping) {}
+    using SampleFactory = std::function<PAudioSample()>;
+
+    /**
+     * @param looping                   Whether the sounds in this pool should be looped.
+     * @param capacity                  Max number of simultaneously playing sounds.
+     * @param sampleFactory             Factory for the audio samples. By default, creates OpenAL samples.
+     */
+    AudioSamplePool(bool looping, int capacity, SampleFactory sampleFactory = {});
 
-    SoundPlaybackResult playNew(PAudioSample sample, PAudioDataSource source, bool positional = false);
-    SoundPlaybackResult playUniqueSoundId(PAudioSample sample, PAudioDataSource source, SoundId id, bool positional = false);
-    SoundPlaybackResult playUniquePid(PAudioSample sample, PAudioDataSource source, Pid pid, bool positional = false);
+    SoundPlaybackResult playNew(PAudioDataSource source, const AudioSamplePlayback &playback);
+    SoundPlaybackResult playUniqueSoundId(PAudioDataSource source, SoundId id, const AudioSamplePlayback &playback);
+    SoundPlaybackResult playUniquePid(PAudioDataSource source, Pid pid, const AudioSamplePlayback &playback);
     void pause();
     void resume();
     void stop();
@@ -31,7 +51,40 @@ class AudioSamplePool {
     void update();
     void setVolume(float value);
     bool hasPlaying();
+
+    [[nodiscard]] int capacity() const {
+        return _slots.size();
+    }
+
+    /**
+     * @return                          Number of sounds that were stopped to make room for new ones.
+     */
+    [[nodiscard]] int64_t stolenCount() const {
+        return _stolenCount;
+    }
+
  private:
-    std::list<AudioSamplePoolEntry> _samplePool;
-    bool _looping;
+    struct Slot {
+        PAudioSample sample;
+        SoundPriority priority = SOUND_PRIORITY_AMBIENT;
+        int64_t serial = 0; // Playback start order, used to find the oldest sound.
+    };
+
+    SoundPlaybackResult play(PAudioDataSource source, SoundId id, Pid pid, const AudioSamplePlayback &playback);
+    int acquireSlot(SoundPriority priority);
+    void releaseSlot(int activeIndex);
+
+ private:
+    bool _looping = false;
+    SampleFactory _sampleFactory;
+    std::vector<Slot> _slots;
+    std::vector<int> _freeSlots; // Stack of free slot indices.
+
+    // Active slots, in no particular order. These three arrays are kept in sync.
+    std::vector<int> _activeSlots;
+    std::vector<SoundId> _activeSoundIds;
+    std::vector<Pid> _activePids;
+
+    int64_t _nextSerial = 0;
+    int64_t _stolenCount = 0;
 };
@@ -42,9 +42,17 @@ bool AudioSample16::Open(PAudioDataSource data_source) {
         return false;
     }
 
-    alGenSources((ALuint)1, &al_source);
-    if (checkOpenALError()) {
-        return false;
+    if (IsValid()) {
+        // Sample is being reused, so we can reuse the source too. Stopping it & clearing the buffer queue is enough.
+        alSourceStop(al_source);
+        checkOpenALError();
+        alSourcei(al_source, AL_BUFFER, 0);
+        checkOpenALError();
+    } else {
+        alGenSources((ALuint)1, &al_source);
+        if (checkOpenALError()) {
+            return false;
+        }
     }
 
     defaultSource();
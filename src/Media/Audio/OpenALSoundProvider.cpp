@@ -74,6 +74,27 @@ bool OpenALSoundProvider::Initialize() {
     return true;
 }
 
+static void callDeviceExtension(ALCdevice *device, const char *function) {
+    if (!device)
+        return;
+
+    if (!alcIsExtensionPresent(device, "ALC_SOFT_pause_device")) {
+        logger->warning("OpenAL: ALC_SOFT_pause_device is not supported, can't call {}", function);
+        return;
+    }
+
+    using DeviceFunction = void (ALC_APIENTRY *)(ALCdevice *);
+    reinterpret_cast<DeviceFunction>(alcGetProcAddress(device, function))(device);
+}
+
+void OpenALSoundProvider::PauseDevice() {
+    callDeviceExtension(device, "alcDevicePauseSOFT");
+}
+
+void OpenALSoundProvider::ResumeDevice() {
+    callDeviceExtension(device, "alcDeviceResumeSOFT");
+}
+
 void OpenALSoundProvider::SetListenerPosition(float x, float y, float z) {
     alListener3f(AL_POSITION, x, y, z);
 }
@@ -29,6 +29,12 @@ class OpenALSoundProvider {
     bool Initialize();
     void Release();
 
+    /**
+     * Pauses the device, which stops OpenAL's mixer thread. Does nothing if the device doesn't support pausing.
+     */
+    void PauseDevice();
+    void ResumeDevice();
+
     void DeleteStreamingTrack(StreamingTrackBuffer **buffer);
     void DeleteBuffer16(TrackBuffer **buffer);
     float alBufferLength(unsigned int buffer);
@@ -234,3 +234,18 @@ enum class SoundPlaybackResult {
     SOUND_PLAYBACK_SUCCEEDED
 };
 using enum SoundPlaybackResult;
+
+/**
+ * Sound priority, used to decide which sound to stop when we run out of voices.
+ */
+enum class SoundPriority {
+    /** Looping decoration sounds. */
+    SOUND_PRIORITY_AMBIENT,
+
+    /** Positional sounds from actors, items, doors, etc. */
+    SOUND_PRIORITY_WORLD,
+
+    /** UI sounds, speech & music. */
+    SOUND_PRIORITY_INTERFACE,
+};
+using enum SoundPriority;
@@ -0,0 +1,47 @@
+#include <cstdlib>
+#include <new>
+
+#include "AllocationTracker.h"
+
+// Global operator new & delete replacements that forward into `AllocationTracker`. This file is compiled as a
+// separate object library so that replacements only end up in the binaries that explicitly ask for them.
+//
+// Aligned & nothrow versions are not replaced. The default nothrow versions call into the replaceable ones, and
+// aligned allocations are rare enough not to matter.
+
+#ifdef OE_USE_ALLOCATION_TRACKER
+
+static void *trackedNew(size_t size) {
+    AllocationTracker::record(size);
+
+    // malloc(0) is allowed to return nullptr, operator new is not.
+    if (void *result = std::malloc(size ? size : 1))
+        return result;
+    throw std::bad_alloc();
+}
+
+void *operator new(size_t size) {
+    return trackedNew(size);
+}
+
+void *operator new[](size_t size) {
+    return trackedNew(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif // OE_USE_ALLOCATION_TRACKER
@@ -0,0 +1,37 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+
+// Note that these are accessed from inside operator new, so they must not allocate & must be trivially destructible.
+static constinit std::atomic<int64_t> globalAllocationCount = 0;
+static constinit std::atomic<int64_t> globalAllocationBytes = 0;
+// With the coroutine control backend, the control routine runs on the game thread, so its allocations are counted
+// here too, and show up in the game zone that's open around `swapBuffers`.
+static constinit thread_local AllocationStats threadAllocationStats;
+
+void AllocationTracker::setEnabled(bool enabled) {
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+AllocationStats AllocationTracker::totalStats() {
+    AllocationStats result;
+    result.count = globalAllocationCount.load(std::memory_order_relaxed);
+    result.bytes = globalAllocationBytes.load(std::memory_order_relaxed);
+    return result;
+}
+
+AllocationStats AllocationTracker::threadStats() {
+    return threadAllocationStats;
+}
+
+void AllocationTracker::recordInternal(size_t size) {
+    globalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    globalAllocationBytes.fetch_add(size, std::memory_order_relaxed);
+    threadAllocationStats.count++;
+    threadAllocationStats.bytes += size;
+}
+
+void *trackedMalloc(size_t size) {
+    AllocationTracker::record(size);
+    return std::malloc(size);
+}
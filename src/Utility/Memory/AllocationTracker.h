@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct AllocationStats {
+    int64_t count = 0; // Number of allocations.
+    int64_t bytes = 0; // Total number of bytes requested.
+
+    friend AllocationStats operator-(const AllocationStats &l, const AllocationStats &r) {
+        return {l.count - r.count, l.bytes - r.bytes};
+    }
+
+    friend bool operator==(const AllocationStats &l, const AllocationStats &r) = default;
+};
+
+/**
+ * Global allocation counter.
+ *
+ * Allocations get here from two places:
+ * - Global `operator new` & `operator delete` replacements from `AllocationHooks.cpp`. These are compiled in only if
+ *   the `OE_USE_ALLOCATION_TRACKER` CMake option is on, and only into the binaries that link to
+ *   `utility_allocation_hooks`.
+ * - `trackedMalloc`, which should be used instead of `malloc` for the buffers that are freed with `FreeDeleter`.
+ *
+ * Tracking is off by default, and when it's off an allocation costs a single extra relaxed atomic load. Note that
+ * only allocations are counted, deallocations are not tracked.
+ */
+class AllocationTracker {
+ public:
+    [[nodiscard]] static bool isEnabled() {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    static void setEnabled(bool enabled);
+
+    static void record(size_t size) {
+        if (isEnabled())
+            recordInternal(size);
+    }
+
+    /**
+     * @return                          Stats for all allocations recorded so far, across all threads.
+     */
+    [[nodiscard]] static AllocationStats totalStats();
+
+    /**
+     * @return                          Stats for all allocations recorded so far on the current thread.
+     */
+    [[nodiscard]] static AllocationStats threadStats();
+
+ private:
+    static void recordInternal(size_t size);
+
+ private:
+    static inline std::atomic<bool> _enabled = false;
+};
+
+/**
+ * Same as `malloc`, but the allocation is visible to the `AllocationTracker`. Doesn't handle allocation failures.
+ *
+ * @param size                          Number of bytes to allocate.
+ * @return                              Allocated memory, to be freed with `free`.
+ */
+void *trackedMalloc(size_t size);
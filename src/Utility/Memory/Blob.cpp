@@ -11,6 +11,7 @@
 #include "Utility/Streams/FileInputStream.h"
 #include "Utility/Exception.h"
 
+#include "AllocationTracker.h"
 #include "FreeDeleter.h"
 
 Blob Blob::subBlob(size_t offset, size_t size) const {
@@ -83,7 +84,7 @@ Blob Blob::copy(const void *data, size_t size) { // NOLINT: this is not std::cop
     if (size == 0)
         return Blob();
 
-    std::unique_ptr<void, FreeDeleter> memory(malloc(size)); // We don't handle allocation failures.
+    std::unique_ptr<void, FreeDeleter> memory(trackedMalloc(size)); // We don't handle allocation failures.
     memcpy(memory.get(), data, size);
     return fromMalloc(std::move(memory), size);
 }
@@ -108,7 +109,7 @@ Blob Blob::read(FILE *file, size_t size) {
     if (size == 0)
         return Blob();
 
-    std::unique_ptr<void, FreeDeleter> memory(malloc(size));
+    std::unique_ptr<void, FreeDeleter> memory(trackedMalloc(size));
 
     size_t read = fread(memory.get(), size, 1, file);
     if (read != 1)
@@ -121,7 +122,7 @@ Blob Blob::read(InputStream *stream, size_t size) {
     if (size == 0)
         return Blob();
 
-    std::unique_ptr<void, FreeDeleter> memory(malloc(size));
+    std::unique_ptr<void, FreeDeleter> memory(trackedMalloc(size));
     stream->readOrFail(memory.get(), size);
     return fromMalloc(std::move(memory), size).withDisplayPath(stream->displayPath());
 }
@@ -137,7 +138,7 @@ Blob Blob::concat(const Blob &l, const Blob &r) {
         return Blob::share(l);
     }
 
-    std::unique_ptr<void, FreeDeleter> memory(malloc(lsize + rsize));
+    std::unique_ptr<void, FreeDeleter> memory(trackedMalloc(lsize + rsize));
 
     memcpy(memory.get(), l.data(), lsize);
     memcpy(static_cast<char *>(memory.get()) + lsize, r.data(), rsize);
@@ -0,0 +1,99 @@
+#include "MemoryArena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+static size_t alignUp(size_t offset, size_t alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+MemoryArena::MemoryArena(size_t blockSize) : _blockSize(blockSize) {
+    assert(blockSize > 0);
+}
+
+MemoryArena::~MemoryArena() = default;
+
+void *MemoryArena::allocate(size_t size, size_t alignment) {
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    if (_blockIndex < _blocks.size()) {
+        Block &block = _blocks[_blockIndex];
+        uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        size_t offset = alignUp(base + _offset, alignment) - base;
+        if (offset + size <= block.size) {
+            _offset = offset + size;
+            return block.data.get() + offset;
+        }
+    }
+
+    return allocateSlow(size, alignment);
+}
+
+void MemoryArena::deallocate(void *ptr, size_t size) {
+    std::byte *bytes = static_cast<std::byte *>(ptr);
+
+#ifndef NDEBUG
+    std::memset(bytes, static_cast<int>(POISON_BYTE), size);
+#endif
+
+    if (_blockIndex >= _blocks.size())
+        return;
+
+    std::byte *blockData = _blocks[_blockIndex].data.get();
+    if (bytes + size == blockData + _offset)
+        _offset = bytes - blockData;
+}
+
+void *MemoryArena::allocateSlow(size_t size, size_t alignment) {
+    // Move on to the next block that fits. Blocks that are skipped over are wasted until the next reset.
+    if (_blockIndex < _blocks.size())
+        _usedBytes += _offset;
+    for (_blockIndex++; _blockIndex < _blocks.size(); _blockIndex++) {
+        if (_blocks[_blockIndex].size >= size + alignment) {
+            _offset = 0;
+            return allocate(size, alignment);
+        }
+        _usedBytes += _blocks[_blockIndex].size;
+    }
+
+    // Need a new block. Note that operator new[] guarantees max_align_t alignment, so for the most common case the
+    // extra alignment bytes are not needed, but we don't bother with this.
+    Block &block = _blocks.emplace_back();
+    block.size = std::max(_blockSize, size + alignment);
+    block.data.reset(new std::byte[block.size]);
+    _blockIndex = _blocks.size() - 1;
+    _offset = 0;
+    return allocate(size, alignment);
+}
+
+void MemoryArena::reset() {
+#ifndef NDEBUG
+    for (size_t i = 0; i < _blocks.size() && i <= _blockIndex; i++)
+        std::memset(_blocks[i].data.get(), static_cast<int>(POISON_BYTE), i == _blockIndex ? _offset : _blocks[i].size);
+#endif
+
+    if (_blocks.size() > 1) {
+        // Merge everything into a single block so that the next frame fits in without spilling over.
+        size_t totalSize = reservedBytes();
+        _blocks.clear();
+        Block &block = _blocks.emplace_back();
+        block.size = totalSize;
+        block.data.reset(new std::byte[block.size]);
+    }
+
+    _blockIndex = 0;
+    _offset = 0;
+    _usedBytes = 0;
+}
+
+size_t MemoryArena::usedBytes() const {
+    return _blockIndex < _blocks.size() ? _usedBytes + _offset : _usedBytes;
+}
+
+size_t MemoryArena::reservedBytes() const {
+    size_t result = 0;
+    for (const Block &block : _blocks)
+        result += block.size;
+    return result;
+}
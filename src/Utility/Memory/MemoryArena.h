@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Bump allocator for short-lived data.
+ *
+ * Allocations are carved out of large blocks and are all released at once by calling `reset`. Blocks are kept
+ * between resets, and if more than one block was used, they are merged into a single larger block on reset. So once
+ * the arena has warmed up, it doesn't touch the heap at all.
+ *
+ * In debug builds, released memory is filled with `POISON_BYTE`, both on `deallocate` and on `reset`, so
+ * use-after-free bugs are easier to spot.
+ *
+ * This class is not thread-safe.
+ */
+class MemoryArena {
+ public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+    static constexpr std::byte POISON_BYTE = std::byte(0xDD);
+
+    explicit MemoryArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~MemoryArena();
+
+    MemoryArena(const MemoryArena &) = delete;
+    MemoryArena &operator=(const MemoryArena &) = delete;
+
+    /**
+     * @param size                      Number of bytes to allocate.
+     * @param alignment                 Alignment of the allocated memory, must be a power of two.
+     * @return                          Pointer to the allocated memory, valid until the next call to `reset`.
+     */
+    [[nodiscard]] void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * Releases memory returned by `allocate`. The memory can only be reused if it's the last allocated region,
+     * otherwise it stays wasted until the next `reset`.
+     *
+     * @param ptr                       Pointer returned by `allocate`.
+     * @param size                      Size that was passed to `allocate`.
+     */
+    void deallocate(void *ptr, size_t size);
+
+    /**
+     * Releases all memory allocated from this arena.
+     */
+    void reset();
+
+    /**
+     * @return                          Number of bytes allocated since the last `reset`, including alignment padding.
+     */
+    [[nodiscard]] size_t usedBytes() const;
+
+    /**
+     * @return                          Total size of all blocks owned by this arena.
+     */
+    [[nodiscard]] size_t reservedBytes() const;
+
+ private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    void *allocateSlow(size_t size, size_t alignment);
+
+ private:
+    size_t _blockSize = 0;
+    std::vector<Block> _blocks;
+    size_t _blockIndex = 0; // Index of the block we're currently allocating from.
+    size_t _offset = 0; // Offset of the first free byte in the current block.
+    size_t _usedBytes = 0; // Used bytes in all blocks before the current one.
+};
+
+/**
+ * Standard allocator adapter for `MemoryArena`.
+ *
+ * Example usage:
+ * ```
+ * std::vector<int, ArenaAllocator<int>> ids(&arena);
+ * ```
+ */
+template<class T>
+class ArenaAllocator {
+ public:
+    using value_type = T;
+
+    ArenaAllocator(MemoryArena *arena) : _arena(arena) { // NOLINT: intentionally implicit.
+        assert(arena);
+    }
+
+    template<class Y>
+    ArenaAllocator(const ArenaAllocator<Y> &other) : _arena(other.arena()) {} // NOLINT: intentionally implicit.
+
+    [[nodiscard]] T *allocate(size_t count) {
+        return static_cast<T *>(_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *ptr, size_t count) {
+        _arena->deallocate(ptr, count * sizeof(T));
+    }
+
+    [[nodiscard]] MemoryArena *arena() const {
+        return _arena;
+    }
+
+    template<class Y>
+    friend bool operator==(const ArenaAllocator &l, const ArenaAllocator<Y> &r) {
+        return l.arena() == r.arena();
+    }
+
+ private:
+    MemoryArena *_arena = nullptr;
+};
+
+template<class T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
@@ -0,0 +1,52 @@
+#include <thread>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Memory/AllocationTracker.h"
+#include "Utility/ScopeGuard.h"
+
+UNIT_TEST(AllocationTracker, Disabled) {
+    AllocationTracker::setEnabled(false);
+
+    AllocationStats start = AllocationTracker::totalStats();
+    AllocationTracker::record(100);
+    EXPECT_EQ(AllocationTracker::totalStats(), start);
+}
+
+UNIT_TEST(AllocationTracker, Record) {
+    AllocationTracker::setEnabled(true);
+    MM_AT_SCOPE_EXIT(AllocationTracker::setEnabled(false));
+
+    AllocationStats totalStart = AllocationTracker::totalStats();
+    AllocationStats threadStart = AllocationTracker::threadStats();
+    AllocationTracker::record(100);
+    AllocationTracker::record(20);
+
+    // Unit tests don't link in the operator new hooks, so nothing else should get counted.
+    EXPECT_EQ(AllocationTracker::totalStats() - totalStart, AllocationStats(2, 120));
+    EXPECT_EQ(AllocationTracker::threadStats() - threadStart, AllocationStats(2, 120));
+}
+
+UNIT_TEST(AllocationTracker, Threads) {
+    AllocationTracker::setEnabled(true);
+    MM_AT_SCOPE_EXIT(AllocationTracker::setEnabled(false));
+
+    AllocationStats totalStart = AllocationTracker::totalStats();
+    AllocationStats threadStart = AllocationTracker::threadStats();
+    std::thread([] {
+        AllocationTracker::record(50);
+    }).join();
+
+    EXPECT_EQ(AllocationTracker::totalStats() - totalStart, AllocationStats(1, 50));
+    EXPECT_EQ(AllocationTracker::threadStats(), threadStart);
+}
+
+UNIT_TEST(AllocationTracker, TrackedMalloc) {
+    AllocationTracker::setEnabled(true);
+    MM_AT_SCOPE_EXIT(AllocationTracker::setEnabled(false));
+
+    AllocationStats start = AllocationTracker::threadStats();
+    void *memory = trackedMalloc(64);
+    free(memory);
+    EXPECT_EQ(AllocationTracker::threadStats() - start, AllocationStats(1, 64));
+}
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Memory/MemoryArena.h"
+
+UNIT_TEST(MemoryArena, Alignment) {
+    MemoryArena arena(1024);
+
+    for (size_t alignment : {1, 2, 4, 8, 16, 64}) {
+        (void) arena.allocate(1, 1);
+        void *ptr = arena.allocate(8, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0);
+    }
+}
+
+UNIT_TEST(MemoryArena, Reset) {
+    MemoryArena arena(1024);
+
+    void *first = arena.allocate(100);
+    (void) arena.allocate(100);
+    EXPECT_GE(arena.usedBytes(), 200);
+
+    arena.reset();
+    EXPECT_EQ(arena.usedBytes(), 0);
+    EXPECT_EQ(arena.reservedBytes(), 1024);
+    EXPECT_EQ(arena.allocate(100), first); // Memory is reused.
+}
+
+UNIT_TEST(MemoryArena, BlocksAreMerged) {
+    MemoryArena arena(1024);
+
+    for (int i = 0; i < 10; i++)
+        (void) arena.allocate(512);
+    EXPECT_GT(arena.reservedBytes(), 1024);
+
+    size_t reserved = arena.reservedBytes();
+    arena.reset();
+    EXPECT_EQ(arena.reservedBytes(), reserved);
+
+    // Same workload now fits into a single block, so nothing new is reserved.
+    for (int i = 0; i < 10; i++)
+        (void) arena.allocate(512);
+    EXPECT_EQ(arena.reservedBytes(), reserved);
+}
+
+UNIT_TEST(MemoryArena, LargeAllocation) {
+    MemoryArena arena(1024);
+
+    (void) arena.allocate(16);
+    void *ptr = arena.allocate(4096);
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_GE(arena.reservedBytes(), 1024 + 4096);
+}
+
+UNIT_TEST(MemoryArena, DeallocateLast) {
+    MemoryArena arena(1024);
+
+    void *a = arena.allocate(100, 1);
+    void *b = arena.allocate(100, 1);
+    arena.deallocate(a, 100); // Not the last one, no-op.
+    EXPECT_EQ(arena.usedBytes(), 200);
+
+    arena.deallocate(b, 100);
+    EXPECT_EQ(arena.usedBytes(), 100);
+    EXPECT_EQ(arena.allocate(100, 1), b);
+}
+
+#ifndef NDEBUG
+UNIT_TEST(MemoryArena, DeallocatePoisons) {
+    MemoryArena arena(1024);
+
+    std::byte *a = static_cast<std::byte *>(arena.allocate(100, 1));
+    std::byte *b = static_cast<std::byte *>(arena.allocate(100, 1));
+    std::fill_n(a, 100, std::byte(0));
+    std::fill_n(b, 100, std::byte(0));
+
+    arena.deallocate(a, 100); // Not the last one, but still poisoned.
+    arena.deallocate(b, 100);
+    EXPECT_TRUE(std::all_of(a, a + 100, [](std::byte x) { return x == MemoryArena::POISON_BYTE; }));
+    EXPECT_TRUE(std::all_of(b, b + 100, [](std::byte x) { return x == MemoryArena::POISON_BYTE; }));
+}
+#endif
+
+UNIT_TEST(MemoryArena, Vector) {
+    MemoryArena arena(64);
+
+    ArenaVector<int> v(&arena);
+    for (int i = 0; i < 1000; i++)
+        v.push_back(i);
+
+    for (int i = 0; i < 1000; i++)
+        EXPECT_EQ(v[i], i);
+
+    ArenaVector<int> w = v;
+    EXPECT_EQ(w, v);
+}
@@ -109,9 +109,6 @@ class SplitView : public std::ranges::view_interface<SplitView> {
 } // namespace detail
 
 
-// TODO(captainurist): drop!
-std::vector<char*> tokenize(char *input, const char separator);
-
 /**
  * Splits the provided string `s` using separator `sep`, returning a range of `std::string_view` chunks.
  *
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+class EngineController;
+class TestController;
+class FileSystem;
+
+struct BenchmarkContext {
+    EngineController *game = nullptr;
+    TestController *test = nullptr;
+    FileSystem *tfs = nullptr; // Test data file system.
+    std::map<std::string, double> metrics; // Benchmark-specific metrics, written out as is.
+};
+
+struct Benchmark {
+    std::string name;
+    std::string description;
+    std::function<void(BenchmarkContext *)> body;
+};
+
+/**
+ * @return                              All registered benchmarks. Each one either replays a trace from the test data,
+ *                                      or runs a fixed workload on top of a freshly started game.
+ */
+const std::vector<Benchmark> &allBenchmarks();
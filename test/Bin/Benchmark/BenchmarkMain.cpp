@@ -0,0 +1,87 @@
+#include <cfloat>
+#include <string>
+#include <utility>
+
+#include "Application/Startup/GameStarter.h"
+
+#include "Engine/Components/Control/EngineControlComponent.h"
+#include "Engine/Components/Control/EngineController.h"
+
+#include "Testing/Game/TestController.h"
+
+#include "Library/StackTrace/StackTraceOnCrash.h"
+#include "Library/FileSystem/Directory/DirectoryFileSystem.h"
+#include "Library/BuildInfo/BuildInfo.h"
+#include "Library/Json/Json.h"
+#include "Library/Serialization/Serialization.h"
+
+#include "Utility/Streams/FileOutputStream.h"
+#include "Utility/String/Format.h"
+#include "Utility/UnicodeCrt.h"
+
+#include "BenchmarkOptions.h"
+#include "BenchmarkRunner.h"
+
+int platformMain(int argc, char **argv) {
+    try {
+        StackTraceOnCrash st;
+        UnicodeCrt _(argc, argv);
+        BenchmarkOptions opts = BenchmarkOptions::parse(argc, argv);
+        if (opts.helpPrinted)
+            return 1;
+
+        if (opts.listRequested) {
+            for (const Benchmark &benchmark : allBenchmarks())
+                fmt::print(stdout, "{}: {}\n", benchmark.name, benchmark.description);
+            return 0;
+        }
+
+        GameStarter starter(opts);
+
+        Json results = Json::array();
+        bool overBudget = false;
+        starter.runInstrumented([&] (EngineController *game) {
+            DirectoryFileSystem tfs(opts.testPath);
+            TestController test(game, &tfs, FLT_MAX);
+            BenchmarkRunner runner(game, &test, &tfs);
+
+            for (const Benchmark &benchmark : allBenchmarks()) {
+                if (!benchmark.name.contains(opts.filter))
+                    continue;
+
+                fmt::print(stderr, "Running {}...\n", benchmark.name);
+                BenchmarkResult result = runner.run(benchmark);
+
+                int64_t maxAllocations = maxFrameAllocations(result);
+                if (opts.allocationBudget > 0 && maxAllocations > opts.allocationBudget) {
+                    fmt::print(stderr, "{}: {} allocations in a single frame, budget is {}.\n",
+                               benchmark.name, maxAllocations, opts.allocationBudget);
+                    overBudget = true;
+                }
+
+                results.push_back(std::move(result));
+            }
+        });
+
+        Json json = {
+            {"revision", gitRevision()},
+            {"control_backend", toString(opts.controlBackend.value_or(EngineControlComponent::defaultBackend()))},
+            {"allocation_budget", opts.allocationBudget},
+            {"over_budget", overBudget},
+            {"benchmarks", std::move(results)}
+        };
+        std::string output = json.dump(4) + "\n";
+
+        if (opts.outputPath.empty()) {
+            fmt::print(stdout, "{}", output);
+        } else {
+            FileOutputStream stream(opts.outputPath);
+            stream.write(output);
+            stream.close();
+        }
+        return overBudget ? 1 : 0;
+    } catch (const std::exception &e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+}
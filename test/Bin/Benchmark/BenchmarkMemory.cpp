@@ -0,0 +1,27 @@
+#include "BenchmarkMemory.h"
+
+#ifdef _WINDOWS
+#   define WIN32_LEAN_AND_MEAN
+#   include <windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+int64_t benchmarkPeakRss() {
+#ifdef _WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#   ifdef __APPLE__
+    return usage.ru_maxrss; // Bytes on macOS.
+#   else
+    return usage.ru_maxrss * 1024; // Kilobytes on Linux.
+#   endif
+#endif
+}
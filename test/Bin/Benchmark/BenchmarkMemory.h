@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @return                              Peak resident set size of the current process, in bytes, or zero if this
+ *                                      information is not available on the current platform.
+ */
+int64_t benchmarkPeakRss();
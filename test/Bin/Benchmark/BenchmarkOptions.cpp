@@ -0,0 +1,54 @@
+#include "BenchmarkOptions.h"
+
+#include <memory>
+#include <string>
+
+#include "Library/Cli/CliApp.h"
+
+BenchmarkOptions BenchmarkOptions::parse(int argc, char **argv) {
+    BenchmarkOptions result;
+    result.ramFsUserData = true; // Same as in tests, results shouldn't depend on external user data.
+    std::optional<std::string> testPath;
+
+    std::unique_ptr<CliApp> app = std::make_unique<CliApp>();
+
+    std::string requiredOptions = "Required Options";
+    std::string otherOptions = "Other Options";
+
+    auto testPathOption = app->add_option("--test-path", testPath,
+                                          "Path to test data dir.")->check(CLI::ExistingDirectory)->option_text("PATH")->group(requiredOptions);
+    app->add_option(
+        "--data-path", result.dataPath,
+        "Path to game data dir.")->check(CLI::ExistingDirectory)->option_text("PATH")->group(otherOptions);
+    app->add_option(
+        "-o,--output", result.outputPath,
+        "Path to write json results to, default is stdout.")->option_text("PATH")->group(otherOptions);
+    app->add_option(
+        "--filter", result.filter,
+        "Only run benchmarks with names containing the provided string.")->option_text("FILTER")->group(otherOptions);
+    app->add_option(
+        "--allocation-budget", result.allocationBudget,
+        "Per-frame allocation budget, run fails if any frame goes over it.")->option_text("COUNT")->group(otherOptions);
+    app->add_option(
+        "--control-backend", result.controlBackend,
+        "How to run the benchmarks in the game, one of 'thread', 'coroutine'. Default is 'thread'.")
+        ->option_text("BACKEND")->group(otherOptions);
+    app->add_flag(
+        "--list", result.listRequested,
+        "List the names of all benchmarks instead of running them.")->group(otherOptions);
+    app->add_flag(
+        "--headless", result.headless,
+        "Run in headless mode.")->group(otherOptions);
+    app->add_option(
+        "--log-level", result.logLevel,
+        "Log level, one of 'trace', 'debug', 'info', 'warning', 'error', 'critical'.")->option_text("LOG_LEVEL");
+    app->set_help_flag("-h,--help", "Print help and exit.")->group(otherOptions);
+
+    app->parse(argc, argv, result.helpPrinted);
+
+    if (!result.listRequested && !result.helpPrinted && !testPath)
+        throw CLI::RequiredError(testPathOption->get_name());
+    result.testPath = testPath.value_or("");
+
+    return result;
+}
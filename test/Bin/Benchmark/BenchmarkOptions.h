@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Application/Startup/GameStarterOptions.h"
+
+struct BenchmarkOptions : GameStarterOptions {
+    std::string testPath;
+    std::string outputPath; // Path to write json results to, empty means stdout.
+    std::string filter; // Only benchmarks with names containing this string are run.
+    int64_t allocationBudget = 0; // Per-frame allocation budget, zero means no budget.
+    bool helpPrinted = false;
+    bool listRequested = false;
+
+    static BenchmarkOptions parse(int argc, char **argv);
+};
@@ -0,0 +1,203 @@
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/TestController.h"
+
+#include "Engine/Graphics/Renderer/Renderer.h"
+#include "Engine/EngineGlobals.h"
+
+#include "Library/Json/Json.h"
+#include "Library/Platform/Application/PlatformApplication.h"
+#include "Library/Platform/Proxy/ProxyOpenGLContext.h"
+#include "Library/Profiler/Profiler.h"
+
+#include "BenchmarkMemory.h"
+
+class BenchmarkFrameRecorder : public ProxyOpenGLContext {
+ public:
+    void reset() {
+        Profiler::clear();
+        _phases.clear();
+        _frameMs.clear();
+        _frameAllocations.clear();
+        _frameDrawCalls.clear();
+        _lastFrameNs = Profiler::now();
+        _lastFrameAllocations = AllocationTracker::totalStats();
+        _lastDrawCalls = render->drawcalls;
+    }
+
+    std::vector<double> takeFrameMs() {
+        return std::move(_frameMs);
+    }
+
+    std::vector<int64_t> takeFrameAllocations() {
+        return std::move(_frameAllocations);
+    }
+
+    std::vector<int64_t> takeFrameDrawCalls() {
+        return std::move(_frameDrawCalls);
+    }
+
+    std::map<std::string, BenchmarkPhase> takePhases() {
+        collectPhases();
+        return std::move(_phases);
+    }
+
+    virtual void swapBuffers() override {
+        int64_t nowNs = Profiler::now();
+        int64_t frameAllocations = (AllocationTracker::totalStats() - _lastFrameAllocations).count;
+        _frameMs.push_back((nowNs - _lastFrameNs) / 1e6);
+        _frameAllocations.push_back(frameAllocations);
+
+        // Draw call counter is never reset unless the FPS overlay is on, in which case it's reset every frame.
+        int drawCalls = render->drawcalls;
+        _frameDrawCalls.push_back(drawCalls >= _lastDrawCalls ? drawCalls - _lastDrawCalls : drawCalls);
+        _lastDrawCalls = drawCalls;
+
+        // Drain the profiler every frame so that the ring buffers never overflow.
+        collectPhases();
+
+        // Don't attribute our own bookkeeping to the next frame.
+        _lastFrameNs = Profiler::now();
+        _lastFrameAllocations = AllocationTracker::totalStats();
+
+        // This call potentially destroys `this`, see the comment in `TestController::~TestController`.
+        ProxyOpenGLContext::swapBuffers();
+    }
+
+ private:
+    void collectPhases() {
+        for (const ProfilerEvent &event : Profiler::events()) {
+            BenchmarkPhase &phase = _phases[event.name];
+            phase.totalNs += event.endNs - event.startNs;
+            phase.count++;
+            phase.allocations.count += event.allocations.count;
+            phase.allocations.bytes += event.allocations.bytes;
+        }
+        Profiler::clear();
+    }
+
+ private:
+    int64_t _lastFrameNs = 0;
+    AllocationStats _lastFrameAllocations;
+    int _lastDrawCalls = 0;
+    std::vector<double> _frameMs;
+    std::vector<int64_t> _frameAllocations;
+    std::vector<int64_t> _frameDrawCalls;
+    std::map<std::string, BenchmarkPhase> _phases;
+};
+
+int64_t maxFrameAllocations(const BenchmarkResult &result) {
+    return result.frameAllocations.empty() ? 0 : std::ranges::max(result.frameAllocations);
+}
+
+void to_json(Json &json, const BenchmarkResult &value) {
+    std::vector<double> sorted = value.frameMs;
+    std::ranges::sort(sorted);
+
+    double totalMs = 0;
+    for (double ms : sorted)
+        totalMs += ms;
+
+    Json frameTime = Json::object();
+    if (!sorted.empty()) {
+        frameTime["avg_ms"] = totalMs / sorted.size();
+        frameTime["max_ms"] = sorted.back();
+        frameTime["p50_ms"] = sorted[sorted.size() / 2];
+        frameTime["p99_ms"] = sorted[std::min(sorted.size() - 1, sorted.size() * 99 / 100)];
+    }
+
+    int64_t totalDrawCalls = 0;
+    for (int64_t drawCalls : value.frameDrawCalls)
+        totalDrawCalls += drawCalls;
+
+    Json phases = Json::object();
+    for (const auto &[name, phase] : value.phases) {
+        phases[name] = {
+            {"total_ms", phase.totalNs / 1e6},
+            {"per_frame_ms", value.frames ? phase.totalNs / 1e6 / value.frames : 0.0},
+            {"count", phase.count},
+            {"allocations", phase.allocations.count},
+            {"allocated_bytes", phase.allocations.bytes}
+        };
+    }
+
+    json = {
+        {"name", value.name},
+        {"frames", value.frames},
+        {"seconds", value.seconds},
+        {"fps", value.seconds > 0 ? value.frames / value.seconds : 0.0},
+        {"frame_time", std::move(frameTime)},
+        {"phases", std::move(phases)},
+        {"allocations", {
+            {"count", value.allocations.count},
+            {"bytes", value.allocations.bytes},
+            {"max_per_frame", maxFrameAllocations(value)}
+        }},
+        {"draw_calls", {
+            {"avg_per_frame", value.frameDrawCalls.empty() ? 0.0 :
+                              static_cast<double>(totalDrawCalls) / value.frameDrawCalls.size()},
+            {"max_per_frame", value.frameDrawCalls.empty() ? 0 : std::ranges::max(value.frameDrawCalls)}
+        }},
+        {"peak_rss_bytes", value.peakRssBytes},
+        {"metrics", value.metrics}
+    };
+}
+
+BenchmarkRunner::BenchmarkRunner(EngineController *game, TestController *test, FileSystem *tfs) {
+    assert(game);
+    assert(test);
+    assert(tfs);
+
+    _game = game;
+    _test = test;
+    _tfs = tfs;
+    _recorder = application->installComponent(std::make_unique<BenchmarkFrameRecorder>());
+}
+
+BenchmarkRunner::~BenchmarkRunner() {
+    application->removeComponent<BenchmarkFrameRecorder>();
+}
+
+BenchmarkResult BenchmarkRunner::run(const Benchmark &benchmark) {
+    _test->prepareForNextTest();
+
+    BenchmarkContext ctx;
+    ctx.game = _game;
+    ctx.test = _test;
+    ctx.tfs = _tfs;
+
+    bool wasProfilerEnabled = Profiler::isEnabled();
+    bool wasTrackerEnabled = AllocationTracker::isEnabled();
+    Profiler::setEnabled(true);
+    AllocationTracker::setEnabled(true);
+    _recorder->reset();
+    AllocationStats startAllocations = AllocationTracker::totalStats();
+    auto start = std::chrono::steady_clock::now();
+
+    benchmark.body(&ctx);
+
+    auto end = std::chrono::steady_clock::now();
+    AllocationStats endAllocations = AllocationTracker::totalStats();
+    AllocationTracker::setEnabled(wasTrackerEnabled);
+    Profiler::setEnabled(wasProfilerEnabled);
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.frameMs = _recorder->takeFrameMs();
+    result.frames = result.frameMs.size();
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.phases = _recorder->takePhases();
+    result.frameAllocations = _recorder->takeFrameAllocations();
+    result.frameDrawCalls = _recorder->takeFrameDrawCalls();
+    result.allocations = endAllocations - startAllocations;
+    result.peakRssBytes = benchmarkPeakRss();
+    result.metrics = std::move(ctx.metrics);
+    return result;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Library/Json/JsonFwd.h"
+
+#include "Utility/Memory/AllocationTracker.h"
+
+#include "Benchmark.h"
+
+class EngineController;
+class TestController;
+class FileSystem;
+class BenchmarkFrameRecorder;
+
+struct BenchmarkPhase {
+    int64_t totalNs = 0; // Total time spent in the profiler zone.
+    int64_t count = 0; // Number of times the profiler zone was entered.
+    AllocationStats allocations; // Allocations made inside the profiler zone.
+};
+
+struct BenchmarkResult {
+    std::string name;
+    int64_t frames = 0;
+    double seconds = 0; // Wall time.
+    std::vector<double> frameMs; // Wall time for each frame.
+    std::map<std::string, BenchmarkPhase> phases; // Profiler zone name -> time spent in that zone.
+    AllocationStats allocations; // All allocations made while running the benchmark.
+    std::vector<int64_t> frameAllocations; // Number of allocations for each frame.
+    std::vector<int64_t> frameDrawCalls; // Number of draw calls for each frame, all zeros when running headless.
+    int64_t peakRssBytes = 0; // Peak RSS of the whole process at the end of the benchmark.
+    std::map<std::string, double> metrics; // Benchmark-specific metrics, see `BenchmarkContext::metrics`.
+};
+
+/**
+ * @return                              Max number of allocations made in a single frame, zero if there were no frames.
+ */
+int64_t maxFrameAllocations(const BenchmarkResult &result);
+
+void to_json(Json &json, const BenchmarkResult &value);
+
+/**
+ * Runs benchmarks on top of a `TestController`, collecting frame times from the swap chain, phase timings from
+ * the profiler zones, and allocation counts from the `AllocationTracker`.
+ *
+ * Must be used from the control thread, same as `TestController`.
+ */
+class BenchmarkRunner {
+ public:
+    BenchmarkRunner(EngineController *game, TestController *test, FileSystem *tfs);
+    ~BenchmarkRunner();
+
+    BenchmarkResult run(const Benchmark &benchmark);
+
+ private:
+    EngineController *_game = nullptr;
+    TestController *_test = nullptr;
+    FileSystem *_tfs = nullptr;
+    BenchmarkFrameRecorder *_recorder = nullptr;
+};
@@ -0,0 +1,409 @@
+#include "Benchmark.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/TestController.h"
+
+#include "Application/GameConfig.h"
+
+#include "Engine/Components/Control/EngineController.h"
+#include "Engine/Components/Control/WorldSnapshot.h"
+#include "Engine/Components/Trace/EngineTraceStateAccessor.h"
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LightmapBuilder.h"
+#include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LineOfSight.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/Renderer/Renderer.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/Decoration.h"
+#include "Engine/Objects/Items.h"
+#include "Engine/Objects/SpriteObject.h"
+#include "Engine/Random/Random.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Time/Timer.h"
+#include "Engine/Engine.h"
+#include "Engine/EngineGlobals.h"
+#include "Engine/FrameArena.h"
+#include "Engine/Party.h"
+
+#include "Media/Audio/AudioSamplePool.h"
+
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Trace/EventTrace.h"
+
+#include "Utility/Memory/AllocationTracker.h"
+
+template<class Callable>
+static double measureMs(Callable &&callable) {
+    auto start = std::chrono::steady_clock::now();
+    callable();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static Benchmark traceBenchmark(std::string name, std::string description, std::string save, std::string trace) {
+    return {std::move(name), std::move(description), [save, trace] (BenchmarkContext *ctx) {
+        ctx->test->playTraceFromTestData(save, trace);
+    }};
+}
+
+static void generateItems(BenchmarkContext *ctx) {
+    constexpr int ITEM_COUNT = 1000000;
+
+    grng->seed(1);
+    ItemGen item;
+    double ms = measureMs([&] {
+        for (int i = 0; i < ITEM_COUNT; i++) {
+            ItemTreasureLevel level = static_cast<ItemTreasureLevel>(1 + i % 6);
+            pItemTable->generateItem(level, RANDOM_ITEM_ANY, &item);
+        }
+    });
+
+    ctx->metrics["items"] = ITEM_COUNT;
+    ctx->metrics["items_per_second"] = ITEM_COUNT / (ms / 1000.0);
+}
+
+static void lineOfSight(BenchmarkContext *ctx) {
+    constexpr int REPEATS = 20;
+
+    ctx->game->startNewGame();
+
+    // Crowded AOE: lots of queries with a shared endpoint around the party, same as the one in the game tests.
+    Vec3f center = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
+    std::vector<LineOfSightQuery> queries;
+    for (int x = -40; x <= 40; x++)
+        for (int y = -40; y <= 40; y++)
+            queries.push_back({center + Vec3f(x * 256.0f, y * 256.0f, (x * y % 7) * 64.0f), center});
+    for (const Actor &actor : pActors)
+        queries.push_back({actor.pos + Vec3f(0, 0, 50), center});
+
+    LineOfSightBuffers buffers;
+    std::unique_ptr<bool[]> results = std::make_unique<bool[]>(queries.size());
+    double scalarMs = measureMs([&] {
+        for (int i = 0; i < REPEATS; i++)
+            for (size_t j = 0; j < queries.size(); j++)
+                results[j] = Check_LineOfSight(queries[j].target, queries[j].from);
+    });
+    double batchedMs = measureMs([&] {
+        for (int i = 0; i < REPEATS; i++)
+            Check_LineOfSight(queries, {results.get(), queries.size()}, &buffers);
+    });
+
+    ctx->metrics["queries"] = queries.size() * REPEATS;
+    ctx->metrics["scalar_ms"] = scalarMs;
+    ctx->metrics["batched_ms"] = batchedMs;
+}
+
+static void billboardLighting(BenchmarkContext *ctx) {
+    constexpr int REPEATS = 2000;
+
+    // Fight in Dragon Caves, so there are lots of actors, spell sprites & their lights around.
+    ctx->test->loadGameFromTestData("issue_503.mm7");
+    ctx->game->tick(2);
+
+    // Billboards & lights are left over from the last drawn frame. Scalar path is the per-billboard
+    // _43F55F_get_billboard_light_level call that FindBillboardsLightLevels_BLV used to do.
+    auto isLit = [](const RenderBillboard &billboard) {
+        return !(billboard.field_1E & 2) && billboard.uIndoorSectorID;
+    };
+    std::vector<int> scalarLevels(uNumBillboardsToDraw);
+    std::vector<int> batchLevels(uNumBillboardsToDraw);
+    double scalarMs = 0;
+    double batchMs = 0;
+    ctx->game->runGameRoutine([&] {
+        scalarMs = measureMs([&] {
+            for (int i = 0; i < REPEATS; i++)
+                for (unsigned j = 0; j < uNumBillboardsToDraw; j++)
+                    if (isLit(pBillboardRenderList[j]))
+                        scalarLevels[j] = _43F55F_get_billboard_light_level(&pBillboardRenderList[j], -1);
+        });
+        batchMs = measureMs([&] {
+            for (int i = 0; i < REPEATS; i++)
+                FindBillboardsLightLevels_BLV();
+        });
+        for (unsigned j = 0; j < uNumBillboardsToDraw; j++)
+            if (isLit(pBillboardRenderList[j]))
+                batchLevels[j] = pBillboardRenderList[j].dimming_level;
+    });
+
+    ctx->metrics["billboards"] = uNumBillboardsToDraw;
+    ctx->metrics["stationary_lights"] = pStationaryLightsStack->uNumLightsActive;
+    ctx->metrics["mobile_lights"] = pMobileLightsStack->uNumLightsActive;
+    ctx->metrics["scalar_ms"] = scalarMs / REPEATS;
+    ctx->metrics["batch_ms"] = batchMs / REPEATS;
+    ctx->metrics["identical"] = scalarLevels == batchLevels;
+}
+
+static void frameArenaAllocations(BenchmarkContext *ctx) {
+    constexpr int FRAMES = 500;
+
+    ctx->test->loadGameFromTestData("issue_503.mm7");
+    ctx->game->tick(2); // Warm up the frame arena.
+
+    // Heap allocations made by the code that was moved to the frame arena. Should be zero once the arena is warm.
+    AllocationStats arenaCodeAllocations;
+    ctx->game->runGameRoutine([&] {
+        AllocationStats start = AllocationTracker::threadStats();
+        for (int i = 0; i < FRAMES; i++) {
+            Actor::MakeActorAIList_BLV();
+            (void) pParty->getRandomActiveCharacterId(grng);
+            frameArena.reset(); // Same as in Renderer::Present.
+        }
+        arenaCodeAllocations = AllocationTracker::threadStats() - start;
+    });
+
+    // Whole frames, these end up in the per-frame allocation numbers & are checked against --allocation-budget.
+    ctx->game->tick(FRAMES);
+
+    ctx->metrics["arena_code_allocations_per_frame"] = static_cast<double>(arenaCodeAllocations.count) / FRAMES;
+    ctx->metrics["arena_code_allocated_bytes_per_frame"] = static_cast<double>(arenaCodeAllocations.bytes) / FRAMES;
+    ctx->metrics["arena_reserved_bytes"] = frameArena.reservedBytes();
+}
+
+static void traceFormats(BenchmarkContext *ctx) {
+    constexpr int REPEATS = 20;
+
+    EventTrace trace = EventTrace::fromJsonBlob(ctx->tfs->read("issue_1340.json"), ::window);
+
+    Blob json;
+    Blob binary;
+    double jsonWriteMs = measureMs([&] {
+        for (int i = 0; i < REPEATS; i++)
+            json = EventTrace::toJsonBlob(trace);
+    });
+    double binaryWriteMs = measureMs([&] {
+        for (int i = 0; i < REPEATS; i++)
+            binary = EventTrace::toBinaryBlob(trace);
+    });
+    double jsonReadMs = measureMs([&] {
+        for (int i = 0; i < REPEATS; i++)
+            EventTrace::fromJsonBlob(json, ::window);
+    });
+    double binaryReadMs = measureMs([&] {
+        for (int i = 0; i < REPEATS; i++)
+            EventTrace::fromBinaryBlob(binary, ::window);
+    });
+
+    ctx->metrics["json_bytes"] = json.size();
+    ctx->metrics["binary_bytes"] = binary.size();
+    ctx->metrics["json_write_ms"] = jsonWriteMs / REPEATS;
+    ctx->metrics["binary_write_ms"] = binaryWriteMs / REPEATS;
+    ctx->metrics["json_read_ms"] = jsonReadMs / REPEATS;
+    ctx->metrics["binary_read_ms"] = binaryReadMs / REPEATS;
+}
+
+static void buildOutdoorRenderLists() {
+    // Same sequence as in OutdoorLocation::ExecDraw.
+    pMobileLightsStack->uNumLightsActive = 0;
+    pStationaryLightsStack->uNumLightsActive = 0;
+    engine->StackPartyTorchLight();
+
+    uNumDecorationsDrawnThisFrame = 0;
+    uNumSpritesDrawnThisFrame = 0;
+    uNumBillboardsToDraw = 0;
+    render->uNumBillboardsToDraw = 0;
+
+    pOutdoor->PrepareActorsDrawList();
+    render->PrepareDecorationsRenderList_ODM();
+    render->DrawSpriteObjects();
+    render->TransformBillboardsAndSetPalettesODM();
+}
+
+static void outdoorRenderLists(BenchmarkContext *ctx) {
+    constexpr int FRAMES = 500;
+
+    ctx->game->startNewGame();
+
+    int savedThreads = engine->config->graphics.RenderListThreads.value();
+    for (auto [map, name] : {std::pair(MAP_TATALIA, "tatalia"), std::pair(MAP_DEYJA, "deyja")}) {
+        // Same as walking off the map edge.
+        ctx->game->runGameRoutine([map] {
+            pEventTimer->setPaused(true);
+            engine->_teleportPoint.invalidate();
+            engine->_transitionMapId = map;
+            uGameState = GAME_STATE_CHANGE_LOCATION;
+        });
+        ctx->game->skipLoadingScreen();
+        ctx->game->tick(2);
+
+        // Serial vs parallel, the resulting billboard lists must be the same.
+        std::vector<Pid> billboards[2];
+        double ms[2] = {};
+        for (int threads : {1, 0}) {
+            int index = threads == 1 ? 0 : 1;
+            ctx->game->runGameRoutine([&] {
+                engine->config->graphics.RenderListThreads.setValue(threads);
+                buildOutdoorRenderLists(); // Warm up, creates the worker pool & loads sprite textures.
+                ms[index] = measureMs([] {
+                    for (int i = 0; i < FRAMES; i++)
+                        buildOutdoorRenderLists();
+                });
+                for (unsigned i = 0; i < render->uNumBillboardsToDraw; i++)
+                    billboards[index].push_back(render->pBillboardRenderListD3D[i].object_pid);
+            });
+        }
+
+        std::string prefix = fmt::format("{}_", name);
+        ctx->metrics[prefix + "decorations"] = pLevelDecorations.size();
+        ctx->metrics[prefix + "billboards"] = billboards[0].size();
+        ctx->metrics[prefix + "serial_ms"] = ms[0] / FRAMES;
+        ctx->metrics[prefix + "parallel_ms"] = ms[1] / FRAMES;
+        ctx->metrics[prefix + "identical"] = billboards[0] == billboards[1];
+    }
+    engine->config->graphics.RenderListThreads.setValue(savedThreads);
+}
+
+static void worldRestore(BenchmarkContext *ctx) {
+    constexpr int REPEATS = 20;
+
+    ctx->game->startNewGame();
+
+    for (auto [map, name] : {std::pair(MAP_EMERALD_ISLAND, "outdoor"), std::pair(MAP_DRAGON_CAVES, "indoor")}) {
+        if (engine->_currentLoadedMapId != map) {
+            ctx->game->runGameRoutine([map] {
+                engine->_teleportPoint.invalidate();
+                engine->_transitionMapId = map;
+                uGameState = GAME_STATE_CHANGE_LOCATION;
+            });
+            ctx->game->skipLoadingScreen();
+            ctx->game->tick(2);
+        }
+
+        WorldSnapshot snapshot = ctx->game->saveWorld();
+        double loadMs = measureMs([&] {
+            for (int i = 0; i < REPEATS; i++)
+                ctx->game->loadGame(snapshot.save);
+        });
+        double restoreMs = measureMs([&] {
+            for (int i = 0; i < REPEATS; i++)
+                ctx->game->restoreWorld(snapshot);
+        });
+
+        std::string prefix = fmt::format("{}_", name);
+        ctx->metrics[prefix + "save_bytes"] = snapshot.save.size();
+        ctx->metrics[prefix + "load_ms"] = loadMs / REPEATS;
+        ctx->metrics[prefix + "restore_ms"] = restoreMs / REPEATS;
+    }
+}
+
+static void stateHashes(BenchmarkContext *ctx) {
+    constexpr int FRAMES = 200;
+
+    ctx->game->startNewGame();
+    ctx->game->tick(2);
+
+    // Cost of the hashes alone vs the cost of the frame they're computed for.
+    double frameMs = measureMs([&] {
+        ctx->game->tick(FRAMES);
+    });
+    double hashMs = measureMs([&] {
+        for (int i = 0; i < FRAMES; i++)
+            EngineTraceStateAccessor::makeStateHashes();
+    });
+
+    ctx->metrics["actors"] = pActors.size();
+    ctx->metrics["sprite_objects"] = pSpriteObjects.size();
+    ctx->metrics["frame_ms"] = frameMs / FRAMES;
+    ctx->metrics["hash_ms"] = hashMs / FRAMES;
+    ctx->metrics["overhead_percent"] = 100.0 * hashMs / frameMs;
+}
+
+namespace {
+
+/**
+ * Audio sample that doesn't play anything, just stops after a given number of ticks.
+ */
+class NullAudioSample : public IAudioSample {
+ public:
+    NullAudioSample(const int64_t *clock, int64_t duration) : _clock(clock), _duration(duration) {}
+
+    virtual bool Open(PAudioDataSource) override { return true; }
+    virtual bool IsValid() override { return true; }
+    virtual bool IsStopped() override { return *_clock >= _stopTick; }
+    virtual bool Play(bool, bool) override { _stopTick = *_clock + _duration; return true; }
+    virtual bool Stop() override { _stopTick = 0; return true; }
+    virtual bool Pause() override { return true; }
+    virtual bool Resume() override { return true; }
+    virtual bool SetVolume(float) override { return true; }
+    virtual bool SetPosition(float, float, float, float) override { return true; }
+
+ private:
+    const int64_t *_clock = nullptr;
+    int64_t _duration = 0;
+    int64_t _stopTick = 0;
+};
+
+} // namespace
+
+static void audioSamplePool(BenchmarkContext *ctx) {
+    constexpr int TICKS = 10000;
+    constexpr int SOUNDS_PER_TICK = 20; // Heavy combat.
+
+    int64_t clock = 0;
+    int samples = 0;
+    AudioSamplePool pool(false, 128, [&] {
+        samples++;
+        return std::make_shared<NullAudioSample>(&clock, 30 + samples % 50);
+    });
+
+    grng->seed(1);
+    int64_t skipped = 0;
+    double ms = measureMs([&] {
+        for (; clock < TICKS; clock++) {
+            for (int i = 0; i < SOUNDS_PER_TICK; i++) {
+                AudioSamplePlayback playback;
+                playback.position = Vec3f(0, 0, 0);
+                playback.priority = grng->random(10) == 0 ? SOUND_PRIORITY_INTERFACE : SOUND_PRIORITY_WORLD;
+
+                SoundPlaybackResult result;
+                if (i % 2 == 0) {
+                    result = pool.playUniqueSoundId(nullptr, static_cast<SoundId>(1 + grng->random(200)), playback);
+                } else {
+                    result = pool.playUniquePid(nullptr, Pid(OBJECT_Actor, grng->random(500)), playback);
+                }
+                if (result == SOUND_PLAYBACK_SKIPPED)
+                    skipped++;
+            }
+            if (clock % 5 == 0)
+                pool.stopSoundId(static_cast<SoundId>(1 + grng->random(200)));
+            pool.update();
+        }
+    });
+
+    ctx->metrics["plays"] = TICKS * SOUNDS_PER_TICK;
+    ctx->metrics["plays_per_second"] = TICKS * SOUNDS_PER_TICK / (ms / 1000.0);
+    ctx->metrics["skipped"] = skipped;
+    ctx->metrics["stolen"] = pool.stolenCount();
+    ctx->metrics["samples_created"] = samples;
+}
+
+const std::vector<Benchmark> &allBenchmarks() {
+    static const std::vector<Benchmark> result = {
+        traceBenchmark("EmeraldIsland", "Walking around Emerald Island, then moving to Castle Harmondale.",
+                       "issue_1340.mm7", "issue_1340.json"),
+        traceBenchmark("DragonCaves", "Fighting in Dragon Caves, then teleporting to Harmondale.",
+                       "issue_503.mm7", "issue_503.json"),
+        traceBenchmark("TidewaterCaverns", "Going from Tatalia into Tidewater Caverns and back.",
+                       "issue_159.mm7", "issue_159.json"),
+        traceBenchmark("Arena", "Going from Harmondale into the Arena.",
+                       "issue_1364.mm7", "issue_1364.json"),
+        {"GenerateItems", "Generating a million random items.", &generateItems},
+        {"LineOfSight", "Scalar vs batched line of sight checks for a crowded AOE on Emerald Island.", &lineOfSight},
+        {"BillboardLighting", "Scalar vs batched indoor billboard lighting during a fight in Dragon Caves.",
+         &billboardLighting},
+        {"FrameArena", "Per-frame heap allocations during a fight in Dragon Caves.",
+         &frameArenaAllocations},
+        {"TraceFormats", "Reading & writing a trace in json and binary formats.", &traceFormats},
+        {"AudioSamplePool", "Playing lots of short sounds through a null audio sample pool.", &audioSamplePool},
+        {"OutdoorRenderLists", "Serial vs parallel sprite & decoration render list building in Tatalia and Deyja.",
+         &outdoorRenderLists},
+        {"WorldRestore", "Loading a save vs restoring a world snapshot on Emerald Island and in Dragon Caves.",
+         &worldRestore},
+        {"StateHashes", "Per-frame trace state hashing overhead on Emerald Island.", &stateHashes},
+    };
+    return result;
+}
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "Application/Startup/GameStarter.h"
 
 #include "Engine/Components/Control/EngineController.h"
@@ -7,6 +14,8 @@
 #include "Testing/Game/GameTest.h"
 #include "Testing/Game/TestController.h"
 
+#include "Library/Environment/Interface/Environment.h"
+#include "Library/ForkServer/ForkServer.h"
 #include "Library/StackTrace/StackTraceOnCrash.h"
 #include "Library/Platform/Application/PlatformApplication.h"
 #include "Library/FileSystem/Directory/DirectoryFileSystem.h"
@@ -23,6 +32,61 @@ void printGoogleTestHelp(char *app) {
     testing::InitGoogleTest(&argc, argv);
 }
 
+/**
+ * @param output                        Value of the `--gtest_output` flag, `FORMAT[:PATH]`.
+ * @param shard                         Shard index.
+ * @return                              Flag value with the shard index added to the report file name, so that the
+ *                                      shards don't overwrite each other's reports.
+ */
+static std::string shardOutputFlag(std::string_view output, int shard) {
+    size_t colon = output.find(':');
+    std::string format(output.substr(0, colon));
+    std::string path(colon == std::string_view::npos ? std::string_view() : output.substr(colon + 1));
+
+    if (path.empty() || path.ends_with('/') || path.ends_with('\\')) {
+        path += fmt::format("test_detail.shard{}.{}", shard, format);
+    } else {
+        std::filesystem::path filePath(path);
+        std::string fileName = fmt::format("{}.shard{}{}", filePath.stem().string(), shard, filePath.extension().string());
+        path = (filePath.parent_path() / fileName).string();
+    }
+    return fmt::format("{}:{}", format, path);
+}
+
+/**
+ * Runs all tests in forked copies of the current process, using gtest sharding to split them between the workers.
+ *
+ * @return                              Exit code, non-zero if any of the shards has failed.
+ */
+static int runAllTestsForked(GameStarter *starter, int jobs) {
+    // Several shards per worker for better load balancing, as some of the tests are a lot slower than the others.
+    constexpr int SHARDS_PER_JOB = 4;
+    int shards = std::max(1, std::min(testing::UnitTest::GetInstance()->total_test_count(), jobs * SHARDS_PER_JOB));
+
+    starter->prepareForFork();
+    std::vector<ForkServerJobResult> results = ForkServer(jobs).run(shards, [&] (int shard) {
+        starter->resumeAfterFork();
+
+        // Gtest reads these when running the tests, and then skips all tests not in the current shard.
+        std::unique_ptr<Environment> environment = Environment::createStandardEnvironment();
+        environment->setenv("GTEST_TOTAL_SHARDS", std::to_string(shards));
+        environment->setenv("GTEST_SHARD_INDEX", std::to_string(shard));
+        if (!testing::GTEST_FLAG(output).empty())
+            testing::GTEST_FLAG(output) = shardOutputFlag(testing::GTEST_FLAG(output), shard);
+        return RUN_ALL_TESTS();
+    }, [&] (int shard, const ForkServerJobResult &result) {
+        fmt::print(stdout, "Shard {}/{}:\n{}", shard + 1, shards, result.output);
+    });
+    starter->resumeAfterFork();
+
+    int failedShards = std::ranges::count_if(results, [] (const ForkServerJobResult &result) {
+        return result.exitCode != 0;
+    });
+    if (failedShards > 0)
+        fmt::print(stdout, "{} out of {} shards failed.\n", failedShards, shards);
+    return failedShards > 0 ? 1 : 0;
+}
+
 int platformMain(int argc, char **argv) {
     try {
         StackTraceOnCrash st;
@@ -45,7 +109,7 @@ int platformMain(int argc, char **argv) {
             DirectoryFileSystem tfs(opts.testPath);
             TestController test(game, &tfs, opts.speed);
             GameTest::init(game, &test);
-            exitCode = RUN_ALL_TESTS();
+            exitCode = opts.jobs > 0 ? runAllTestsForked(&starter, opts.jobs) : RUN_ALL_TESTS();
         });
         return exitCode;
     } catch (const std::exception &e) {
@@ -26,6 +26,10 @@ GameTestOptions GameTestOptions::parse(int argc, char **argv) {
     app->add_option(
         "--speed", result.speed,
         "Playback speed, default is infinite, use '1.0' for realtime playback.")->option_text("SPEED");
+    app->add_option(
+        "-j,--jobs", result.jobs,
+        "Initialize once, then run test shards in forked copies of the process, running at most JOBS of them in "
+        "parallel. Implies --headless, Linux only.")->option_text("JOBS")->group(otherOptions);
     app->add_flag(
         "--tracing-rng", result.tracingRng,
         "Use random number generators that print stack trace on each call.")->group(otherOptions);
@@ -47,5 +51,11 @@ GameTestOptions GameTestOptions::parse(int argc, char **argv) {
         throw CLI::RequiredError(testPathOption->get_name());
     result.testPath = testPath.value_or("");
 
+    if (result.jobs > 0) {
+        // Only the game thread survives a fork, so the control routine should run on it.
+        result.headless = true;
+        result.controlBackend = CONTROL_BACKEND_COROUTINE;
+    }
+
     return result;
 }
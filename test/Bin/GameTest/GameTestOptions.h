@@ -8,6 +8,7 @@
 struct GameTestOptions : GameStarterOptions {
     std::string testPath;
     float speed = FLT_MAX; // Test playback speed.
+    int jobs = 0; // Number of forked worker processes to run tests in, zero means run in this process.
     bool helpPrinted = false;
     bool listRequested = false;
 
@@ -0,0 +1,406 @@
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Tables/CharacterFrameTable.h"
+#include "Engine/Tables/IconFrameTable.h"
+#include "Engine/Engine.h"
+#include "Engine/EngineFileSystem.h"
+#include "Engine/EngineGlobals.h"
+#include "Engine/MapEnumFunctions.h"
+#include "Engine/Party.h"
+#include "Engine/TurnEngine/TurnEngine.h"
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/Image.h"
+#include "Engine/Graphics/LevelMeshBuilder.h"
+#include "Engine/Graphics/Renderer/Renderer.h"
+#include "Engine/Graphics/Sprites.h"
+#include "Engine/Graphics/TextureFrameTable.h"
+#include "Engine/Graphics/LineOfSight.h"
+#include "Engine/Graphics/LocationFunctions.h"
+#include "Engine/Events/EventInterpreter.h"
+#include "Engine/Components/Control/WorldSnapshot.h"
+#include "Engine/Components/Trace/EngineTraceSimplePlayer.h"
+#include "Engine/Components/Trace/EngineTraceSimpleRecorder.h"
+#include "Engine/Components/Trace/EngineTraceStateAccessor.h"
+#include "Engine/Random/Random.h"
+#include "Engine/Time/Timer.h"
+#include "Library/Platform/Application/PlatformApplication.h"
+#include "Library/Trace/PaintEvent.h"
+#include "Utility/Exception.h"
+#include "Utility/ScopeGuard.h"
+
+// Tests for engine features that don't map to an issue or a PR. Most of them check that an optimized code path gives
+// exactly the same results as the original one, on real game data.
+
+GAME_TEST(Features, BatchedLineOfSight) {
+    // Batched line of sight checks should return exactly the same results as the scalar ones.
+    game.startNewGame();
+    EXPECT_EQ(uCurrentlyLoadedLevelType, LEVEL_OUTDOOR);
+
+    // AOE-like queries with a shared endpoint, some of them go through the buildings around the party.
+    Vec3f center = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
+    std::vector<LineOfSightQuery> queries;
+    for (int x = -40; x <= 40; x++)
+        for (int y = -40; y <= 40; y++)
+            queries.push_back({center + Vec3f(x * 256.0f, y * 256.0f, (x * y % 7) * 64.0f), center});
+    for (const Actor &actor : pActors)
+        queries.push_back({actor.pos + Vec3f(0, 0, 50), center});
+
+    LineOfSightBuffers buffers;
+    std::unique_ptr<bool[]> obscured = std::make_unique<bool[]>(queries.size());
+    Check_LOS_Obscurred(queries, {obscured.get(), queries.size()}, &buffers);
+
+    int obscuredCount = 0;
+    for (size_t i = 0; i < queries.size(); i++) {
+        EXPECT_EQ(obscured[i], Check_LOS_Obscurred_Outdoors_Bmodels(queries[i].target, queries[i].from));
+        obscuredCount += obscured[i];
+    }
+    EXPECT_GT(obscuredCount, 0);
+    EXPECT_LT(obscuredCount, static_cast<int>(queries.size()));
+
+    // Full line of sight check, including the side rays, should match query by query.
+    std::unique_ptr<bool[]> clear = std::make_unique<bool[]>(queries.size());
+    Check_LineOfSight(queries, {clear.get(), queries.size()}, &buffers);
+    for (size_t i = 0; i < queries.size(); i++)
+        EXPECT_EQ(clear[i], Check_LineOfSight(queries[i].target, queries[i].from));
+}
+
+GAME_TEST(Features, TurnQueueStress) {
+    // Turn-based fight with 200 actors. Turn queue should be ordered exactly as the original exchange sort would
+    // order it.
+    auto referenceSort = [](std::vector<TurnBased_QueueElem> queue) {
+        for (size_t i = 0; i + 1 < queue.size(); ++i)
+            for (size_t j = i + 1; j < queue.size(); ++j)
+                if (isBeforeInTurnQueue(queue[j], queue[i]))
+                    std::swap(queue[i], queue[j]);
+        return queue;
+    };
+    auto sameOrder = [](const std::vector<TurnBased_QueueElem> &l, const std::vector<TurnBased_QueueElem> &r) {
+        return std::ranges::equal(l, r, {}, &TurnBased_QueueElem::uPackedID, &TurnBased_QueueElem::uPackedID);
+    };
+    auto orderTape = tapes.custom([&] {
+        std::vector<TurnBased_QueueElem> queue = pTurnEngine->pQueue;
+        sortTurnQueue(queue);
+        return sameOrder(queue, referenceSort(pTurnEngine->pQueue));
+    });
+    // Incremental initiative updates on the live queue should produce the same order as setting the initiative and
+    // then doing a full reference sort.
+    auto updateTape = tapes.custom([&] {
+        stru262_TurnBased turnEngine;
+        std::vector<TurnBased_QueueElem> sorted = referenceSort(pTurnEngine->pQueue);
+        if (sorted.empty())
+            return true;
+
+        for (size_t index : {size_t(0), sorted.size() / 2, sorted.size() - 1}) {
+            for (int initiative : {0, sorted[sorted.size() / 2].actor_initiative, 1001}) {
+                turnEngine.pQueue = sorted;
+                turnEngine.UpdateQueueInitiative(index, initiative);
+
+                std::vector<TurnBased_QueueElem> reference = sorted;
+                reference[index].actor_initiative = initiative;
+                if (!sameOrder(turnEngine.pQueue, referenceSort(reference)))
+                    return false;
+            }
+        }
+        return true;
+    });
+    auto queueSizeTape = tapes.custom([] { return pTurnEngine->pQueue.size(); });
+    auto turnBasedTape = tapes.turnBasedMode();
+    auto turnsTape = tapes.custom([] { return pTurnEngine->turns_count; });
+
+    game.startNewGame();
+    test.startTaping();
+    for (int i = 0; i < 40; i++)
+        spawnMonsters(1, 0, 5, pParty->pos + Vec3f(0, 1000, 0), 0, i); // 200 dragonflies in front of the party.
+    game.tick();
+
+    game.pressAndReleaseKey(PlatformKey::KEY_RETURN); // Enter turn-based mode.
+    game.tick(10);
+    for (int i = 0; i < 20; i++) {
+        game.pressAndReleaseKey(PlatformKey::KEY_A); // Attack.
+        game.tick(10);
+    }
+    test.stopTaping();
+
+    EXPECT_CONTAINS(turnBasedTape, true);
+    EXPECT_GT(queueSizeTape.max(), 100u);
+    EXPECT_GT(turnsTape.max(), 1); // Monsters did get their turns.
+    EXPECT_EQ(orderTape, tape(true));
+    EXPECT_EQ(updateTape, tape(true));
+}
+
+// Reference implementation of the linear frame walk that was used by all frame tables before they got an index.
+// The original code would run off the end of the table, the index clamps instead, so we do the same here.
+template<class Frames, class FrameTime>
+static size_t referenceFrameWalk(const Frames &frames, size_t frameId, Duration offset, FrameTime &&frameTime) {
+    while (offset >= frameTime(frames[frameId]) && frameId + 1 < frames.size()) {
+        offset -= frameTime(frames[frameId]);
+        frameId++;
+    }
+    return frameId;
+}
+
+template<class Callable>
+static void forEachAnimationOffset(Duration length, Callable &&callable) {
+    for (Duration t; t <= length * 2; t += 1_ticks)
+        callable(t);
+    for (int64_t i = 0; i < 16; i++)
+        callable(Duration::fromTicks(1000000 + i * 7919));
+}
+
+GAME_TEST(Features, FrameTableAnimationIndex) {
+    // Indexed frame lookups should return exactly the same frames as the original linear walks, for all tables.
+    game.startNewGame();
+
+    int spriteChecks = 0;
+    for (size_t i = 0; i < pSpriteFrameTable->pSpriteSFrames.size(); i++) {
+        const auto &frames = pSpriteFrameTable->pSpriteSFrames;
+        Duration length = frames[i].uAnimLength;
+        if (!(frames[i].uFlags & 1) || !length) {
+            EXPECT_EQ(pSpriteFrameTable->GetFrame(i, 100_ticks), &frames[i]);
+            EXPECT_EQ(pSpriteFrameTable->GetFrameReversed(i, 100_ticks), &frames[i]);
+            continue;
+        }
+
+        auto frameTime = [](const SpriteFrame &frame) { return frame.uAnimTime; };
+        forEachAnimationOffset(length, [&](Duration t) {
+            size_t reversed = referenceFrameWalk(frames, i, length - t % length, frameTime);
+            EXPECT_EQ(pSpriteFrameTable->GetFrameReversed(i, t), &frames[reversed]);
+
+            // GetFrame backs off from frames that are not loaded, so we only check the frames that are.
+            size_t forward = referenceFrameWalk(frames, i, t % length, frameTime);
+            if (frames[forward].hw_sprites[0]) {
+                EXPECT_EQ(pSpriteFrameTable->GetFrame(i, t), &frames[forward]);
+                spriteChecks++;
+            }
+        });
+    }
+    EXPECT_GT(spriteChecks, 0);
+
+    for (size_t i = 0; i < pTextureFrameTable->textures.size(); i++) {
+        auto &frames = pTextureFrameTable->textures;
+        Duration length = frames[i].animationDuration;
+        if (!(frames[i].flags & TEXTURE_FRAME_TABLE_MORE_FRAMES) || !length) {
+            EXPECT_EQ(pTextureFrameTable->GetFrameTexture(i, 100_ticks), frames[i].GetTexture());
+            continue;
+        }
+
+        forEachAnimationOffset(length, [&](Duration t) {
+            size_t frame = referenceFrameWalk(frames, i, t % length, [](const TextureFrame &frame) {
+                return frame.frameDuration;
+            });
+            EXPECT_EQ(pTextureFrameTable->GetFrameTexture(i, t), frames[frame].GetTexture());
+        });
+    }
+
+    for (size_t i = 0; i < pIconsFrameTable->pIcons.size(); i++) {
+        const auto &frames = pIconsFrameTable->pIcons;
+        Duration length = frames[i].GetAnimLength();
+        if (!(frames[i].uFlags & 1) || !length) {
+            EXPECT_EQ(pIconsFrameTable->GetFrame(i, 100_ticks), &frames[i]);
+            continue;
+        }
+
+        forEachAnimationOffset(length, [&](Duration t) {
+            size_t frame = referenceFrameWalk(frames, i, t % length, [](const Icon &icon) {
+                return icon.GetAnimTime();
+            });
+            EXPECT_EQ(pIconsFrameTable->GetFrame(i, t), &frames[frame]);
+        });
+    }
+
+    for (size_t i = 0; i < pPlayerFrameTable->pFrames.size(); i++) {
+        const auto &frames = pPlayerFrameTable->pFrames;
+        Duration length = frames[i].uAnimLength;
+        if (frames[i].expression == CHARACTER_EXPRESSION_INVALID)
+            continue; // Not a start of an expression.
+        if (!(frames[i].uFlags & 1) || !length) {
+            EXPECT_EQ(pPlayerFrameTable->GetFrameBy_x(i, 100_ticks), &frames[i]);
+            continue;
+        }
+
+        forEachAnimationOffset(length, [&](Duration t) {
+            size_t frame = referenceFrameWalk(frames, i, t % length, [](const PlayerFrame &frame) {
+                return frame.uAnimTime;
+            });
+            EXPECT_EQ(pPlayerFrameTable->GetFrameBy_x(i, t), &frames[frame]);
+        });
+    }
+}
+
+GAME_TEST(Features, LevelMeshBuilder) {
+    // Level mesh should be buildable without a renderer, and should cover all the level faces.
+    game.startNewGame();
+    EXPECT_EQ(uCurrentlyLoadedLevelType, LEVEL_OUTDOOR);
+
+    auto checkMesh = [](const LevelMesh &mesh) {
+        EXPECT_EQ(mesh.type, LEVEL_OUTDOOR);
+        EXPECT_EQ(mesh.layout.find("HDWTR000"), TextureArraySlot(0, 0));
+        EXPECT_EQ(mesh.layout.size(), mesh.images.size());
+
+        for (const TextureArrayUnit &unit : mesh.layout.units()) {
+            for (const std::string &name : unit.layers) {
+                ASSERT_TRUE(mesh.images.contains(name));
+                EXPECT_EQ(mesh.images.at(name).width(), unit.size.w);
+                EXPECT_EQ(mesh.images.at(name).height(), unit.size.h);
+            }
+        }
+
+        size_t index = 0;
+        int checkedFaces = 0;
+        for (BSPModel &model : pOutdoor->pBModels) {
+            for (ODMFace &face : model.pFaces) {
+                const std::optional<TextureArraySlot> &slot = mesh.faceSlots[index++];
+                if (face.Invisible() || !face.GetTexture()) {
+                    EXPECT_EQ(slot, std::nullopt);
+                    continue;
+                }
+
+                ASSERT_TRUE(slot);
+                EXPECT_EQ(face.texunit, slot->unit);
+                EXPECT_EQ(face.texlayer, slot->layer);
+
+                std::string name = face.GetTexture()->GetName();
+                if (face.IsTextureFrameTable() || name == "wtrtyl")
+                    continue;
+                EXPECT_EQ(mesh.layout.units()[slot->unit].layers[slot->layer], name);
+                checkedFaces++;
+            }
+        }
+        EXPECT_EQ(index, mesh.faceSlots.size());
+        EXPECT_GT(checkedFaces, 0);
+    };
+
+    LevelMeshBuilder builder;
+    builder.start(LEVEL_OUTDOOR, {});
+    LevelMesh mesh = builder.take(LEVEL_OUTDOOR);
+    checkMesh(mesh);
+
+    // Second take has nothing prepared & should rebuild the same mesh synchronously.
+    LevelMesh rebuilt = builder.take(LEVEL_OUTDOOR);
+    checkMesh(rebuilt);
+    EXPECT_EQ(rebuilt.faceSlots, mesh.faceSlots);
+
+    // Mesh loaded from the cache should be identical to the one that was decoded.
+    engine->config->debug.LevelMeshCache.setValue(true);
+    ufs->remove("cache/meshes");
+    for (int i = 0; i < 2; i++) {
+        builder.start(LEVEL_OUTDOOR, "test.odm");
+        LevelMesh cached = builder.take(LEVEL_OUTDOOR);
+        EXPECT_TRUE(ufs->exists("cache/meshes/test.odm.bin"));
+        checkMesh(cached);
+        EXPECT_EQ(cached.faceSlots, mesh.faceSlots);
+        for (const auto &[name, image] : mesh.images)
+            EXPECT_TRUE(std::ranges::equal(cached.images.at(name).pixels(), image.pixels()));
+    }
+    ufs->remove("cache/meshes");
+    engine->config->debug.LevelMeshCache.setValue(false);
+}
+
+GAME_TEST(Features, RenderCommandList) {
+    // Engine should record a valid command list every frame.
+    game.startNewGame();
+    for (int i = 0; i < 10; i++) {
+        game.tick(1);
+        EXPECT_EQ(render->commandList.size(), render->uNumBillboardsToDraw);
+        EXPECT_NO_THROW(render->commandList.validate());
+    }
+}
+
+GAME_TEST(Features, WorldSnapshot) {
+    game.startNewGame();
+    for (MapId map : {MAP_EMERALD_ISLAND, MAP_DRAGON_CAVES}) {
+        if (engine->_currentLoadedMapId != map) {
+            game.runGameRoutine([map] {
+                engine->_teleportPoint.invalidate();
+                engine->_transitionMapId = map;
+                uGameState = GAME_STATE_CHANGE_LOCATION;
+            });
+            game.skipLoadingScreen();
+            game.tick(10);
+        }
+        EXPECT_EQ(engine->_currentLoadedMapId, map);
+
+        WorldSnapshot snapshot = game.saveWorld();
+        EXPECT_EQ(snapshot.map, map);
+        EXPECT_EQ(snapshot.indoorData != nullptr, isMapIndoor(map));
+        EXPECT_EQ(snapshot.outdoorData != nullptr, !isMapIndoor(map));
+        int nextRandom = grng->peek(1000000);
+
+        // Regular save load, level data is read from games.lod.
+        game.loadGame(snapshot.save);
+        std::vector<uint64_t> loadedHashes = EngineTraceStateAccessor::makeStateHashes();
+        game.tick(30);
+
+        // Restoring the snapshot should give the same world.
+        game.restoreWorld(snapshot);
+        EXPECT_EQ(engine->_currentLoadedMapId, map);
+        EXPECT_EQ(EngineTraceStateAccessor::makeStateHashes(), loadedHashes);
+        EXPECT_EQ(grng->peek(1000000), nextRandom);
+        EXPECT_EQ(pIndoor->preloadedData, nullptr); // Preloaded data was used up or dropped.
+        EXPECT_EQ(pOutdoor->preloadedData, nullptr);
+
+        // And the game should continue the same way every time it's restored.
+        game.tick(30);
+        std::vector<uint64_t> continuedHashes = EngineTraceStateAccessor::makeStateHashes();
+        Time continuedTime = pParty->GetPlayingTime();
+        game.restoreWorld(snapshot);
+        game.tick(30);
+        EXPECT_EQ(EngineTraceStateAccessor::makeStateHashes(), continuedHashes);
+        EXPECT_EQ(pParty->GetPlayingTime(), continuedTime);
+    }
+}
+
+GAME_TEST(Features, StateHashDivergence) {
+    // Record a few frames with state hashes, then play them back from the same world state with a tampered hash.
+    // Divergence should be reported on the tampered frame & for the tampered subsystem.
+    engine->config->debug.TraceStateHashes.setValue(true);
+    MM_AT_SCOPE_EXIT(engine->config->debug.TraceStateHashes.reset());
+
+    game.startNewGame();
+    WorldSnapshot snapshot = game.saveWorld();
+
+    EngineTraceSimpleRecorder *recorder = application->component<EngineTraceSimpleRecorder>();
+    recorder->startRecording();
+    game.tick(10);
+    std::vector<std::unique_ptr<PlatformEvent>> events = recorder->finishRecording();
+    ASSERT_EQ(events.size(), 10);
+
+    std::vector<PaintEvent> paintEvents;
+    for (const std::unique_ptr<PlatformEvent> &event : events) {
+        ASSERT_EQ(event->type, EVENT_PAINT);
+        paintEvents.push_back(*static_cast<const PaintEvent *>(event.get()));
+    }
+
+    auto playBack = [&] (std::vector<PaintEvent> paintEvents) {
+        std::vector<std::unique_ptr<PlatformEvent>> events;
+        for (PaintEvent &paintEvent : paintEvents)
+            events.push_back(std::make_unique<PaintEvent>(std::move(paintEvent)));
+
+        game.restoreWorld(snapshot);
+        try {
+            // Tick count isn't restored with the world, so time checks are skipped.
+            application->component<EngineTraceSimplePlayer>()->playTrace(&game, std::move(events), "test",
+                                                                         TRACE_PLAYBACK_SKIP_TIME_CHECKS);
+            return std::string();
+        } catch (const Exception &e) {
+            return std::string(e.what());
+        }
+    };
+
+    // Untampered playback should go through.
+    EXPECT_EQ(playBack(paintEvents), "");
+
+    // Tamper with the actors hash on frame 5.
+    paintEvents[5].stateHashes[1] ^= 1;
+    std::string error = playBack(paintEvents);
+    EXPECT_NE(error.find("at frame 5 "), std::string::npos) << error;
+    EXPECT_NE(error.find(": actors differ"), std::string::npos) << error;
+}
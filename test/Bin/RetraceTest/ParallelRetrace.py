@@ -38,6 +38,8 @@ def main():
     parser.add_argument("--job-size", type=int, default=5, help="Number of traces per job")
     parser.add_argument("--ls", help="Directory to look for traces to retrace")
     parser.add_argument("--headless", action="store_true", help="Run in headless mode")
+    parser.add_argument("--fork", action="store_true",
+                        help="Use a single process in fork-server mode instead of a process per job (Linux only)")
     parser.add_argument("program", help="Path to OpenEnroth binary")
     parser.add_argument("traces", nargs=argparse.REMAINDER, help="Trace files to retrace")
 
@@ -53,6 +55,16 @@ def main():
         print("No traces to retrace")
         sys.exit(1)
 
+    # Prepare args
+    workerArgs = ["retrace", "--check-canonical"]
+    if args.headless:
+        workerArgs.append("--headless")
+
+    # In fork-server mode the binary does the parallelization itself, and pays for engine startup only once
+    if args.fork:
+        forkArgs = workerArgs + ["--jobs", str(args.j), "--job-size", str(args.job_size)]
+        sys.exit(subprocess.call([args.program] + forkArgs + traces))
+
     # Split the files into chunks
     chunks = split_into_chunks(traces, args.job_size)
 
@@ -60,11 +72,6 @@ def main():
     queue = Queue()
     results = []
 
-    # Prepare args
-    workerArgs = ["retrace", "--check-canonical"]
-    if args.headless:
-        workerArgs.append("--headless")
-
     # Start worker threads
     threads = []
     for _ in range(args.j):
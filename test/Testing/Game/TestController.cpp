@@ -67,7 +67,21 @@ TestController::~TestController() {
 }
 
 void TestController::loadGameFromTestData(std::string_view name) {
-    _controller->loadGame(_tfs->read(name));
+    // Snapshot includes random engine state, and what that state is after loading a save depends on the engine
+    // settings that prepareForNextTest was called with.
+    auto key = std::tuple(std::string(name), engine->config->debug.TraceFrameTimeMs.value(),
+                          engine->config->debug.TraceRandomEngine.value());
+
+    auto pos = _worldSnapshots.find(key);
+    if (pos != _worldSnapshots.end()) {
+        _controller->restoreWorld(pos->second);
+    } else {
+        _worldSnapshots.emplace(std::move(key), _controller->loadWorld(_tfs->read(name)));
+    }
+}
+
+void TestController::clearWorldSnapshots() {
+    _worldSnapshots.clear();
 }
 
 void TestController::playTraceFromTestData(std::string_view saveName, std::string_view traceName, std::function<void()> postLoadCallback) {
@@ -2,10 +2,13 @@
 
 #include <string>
 #include <functional>
+#include <map>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include <memory>
 
+#include "Engine/Components/Control/WorldSnapshot.h"
 #include "Engine/Components/Trace/EngineTraceEnums.h"
 
 #include "Engine/Random/RandomEnums.h"
@@ -21,7 +24,17 @@ class TestController {
     TestController(EngineController *controller, FileSystem *tfs, float playbackSpeed);
     ~TestController();
 
+    /**
+     * Loads a save from the test data folder. Keeps a world snapshot of the loaded save, and restores it on subsequent
+     * calls made with the same frame time & random engine settings, so that these don't need to re-read the save, or
+     * to parse the level data.
+     *
+     * Snapshots are owned by this test controller, use `clearWorldSnapshots` to release them early.
+     *
+     * @param name                      Name of the save in the test data folder.
+     */
     void loadGameFromTestData(std::string_view name);
+    void clearWorldSnapshots();
     void playTraceFromTestData(std::string_view saveName, std::string_view traceName, std::function<void()> postLoadCallback = {});
     void playTraceFromTestData(std::string_view saveName, std::string_view traceName, EngineTracePlaybackFlags flags, std::function<void()> postLoadCallback = {});
 
@@ -60,4 +73,5 @@ class TestController {
     float _playbackSpeed;
     TestCallObserver _callObserver;
     std::vector<std::function<void()>> _tapeCallbacks;
+    std::map<std::tuple<std::string, int, RandomEngineType>, WorldSnapshot> _worldSnapshots;
 };